@@ -81,4 +81,6 @@ find_package(ORACLE)
 find_package(OpenMP REQUIRED)
 find_package(GMSH 4.8 REQUIRED)
 find_package(SuiteSparse REQUIRED)
+find_package(ZLIB REQUIRED)
+find_package(HDF5 COMPONENTS C)
 MESSAGE(STATUS "************* find packages ends ****************")
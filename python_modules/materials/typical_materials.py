@@ -1025,6 +1025,33 @@ def defElasticIsotropic3d(preprocessor, name, E, nu, rho= 0.0):
     retval.rho= rho
     return retval
 
+# Linear elastic cross-anisotropic 3d material.
+def defElasticCrossAnisotropic3d(preprocessor, name, Eh, Ev, nuhv, nuhh, Ghv, rho= 0.0):
+    '''Constructs a linear elastic cross-anisotropic 3D material (the
+       vertical direction is the z axis).
+
+    :param  preprocessor: preprocessor of the finite element problem.
+    :param  name: name identifying the material (if None compute a suitable name)
+    :param  Eh: Young’s modulus in any horizontal direction.
+    :param  Ev: Young’s modulus in the vertical direction.
+    :param  nuhv: Poisson’s ratio for strain in the vertical direction due to a horizontal direct stress.
+    :param  nuhh: Poisson’s ratio for strain in any horizontal direction due to a horizontal direct stress at right angles.
+    :param  Ghv: modulus of shear deformation in a vertical plane.
+    :param  rho: mass density, optional (defaults to 0.0)
+    '''
+    materialHandler= preprocessor.getMaterialHandler
+    matName= name
+    if(not matName):
+        matName= uuid.uuid1().hex
+    retval= materialHandler.newMaterial("elastic_cross_anisotropic", matName)
+    retval.Eh= Eh
+    retval.Ev= Ev
+    retval.nuhv= nuhv
+    retval.nuhh= nuhh
+    retval.Ghv= Ghv
+    retval.rho= rho
+    return retval
+
 # Elastic plate section.
 def defElasticPlateSection(preprocessor,name,E,nu,rho,h):
     '''Constructs an elastic isotropic section material appropriate 
@@ -0,0 +1,83 @@
+# -*- coding: utf-8 -*-
+''' Read the files written by the DataOutputBinaryFileHandler output
+    handler (binary file organized in column chunks).'''
+
+import struct
+import zlib
+import numpy
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026 LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+binaryColumnsMagic= b'XCBINCOL'
+binaryColumnsZlib= 1 # Header flag: chunks compressed with zlib.
+
+def read_header(f):
+    ''' Read the header of the file and return the column names, the
+        number of rows in each chunk and a flag that is true if the
+        chunks are compressed.
+
+    :param f: binary file object positioned at the beginning of the file.
+    '''
+    magic= f.read(8)
+    if(magic!=binaryColumnsMagic):
+        raise ValueError('not a binary columns file (magic: '+str(magic)+').')
+    version, numColumns, chunkSize= struct.unpack('=III', f.read(12))
+    if(version not in [1,2]):
+        raise ValueError('unknown binary columns file version: '+str(version))
+    compressed= False
+    if(version>1):
+        flags= struct.unpack('=I', f.read(4))[0]
+        compressed= bool(flags & binaryColumnsZlib)
+    columnNames= list()
+    for i in range(0,numColumns):
+        length= struct.unpack('=I', f.read(4))[0]
+        columnNames.append(f.read(length).decode('utf-8'))
+    return columnNames, chunkSize, compressed
+
+def read_binary_columns(fileName):
+    ''' Read the file and return the column names and a two-dimensional
+        numpy array whose rows are the records written to the file.
+
+    :param fileName: name of the file to read.
+    '''
+    with open(fileName, 'rb') as f:
+        columnNames, chunkSize, compressed= read_header(f)
+        numColumns= len(columnNames)
+        chunks= list()
+        while True:
+            buf= f.read(8)
+            if(len(buf)<8): # end of file.
+                break
+            numRows= struct.unpack('=Q', buf)[0]
+            if(compressed):
+                buf= f.read(8)
+                if(len(buf)<8): # truncated chunk.
+                    break
+                compressedSize= struct.unpack('=Q', buf)[0]
+                buf= f.read(compressedSize)
+                if(len(buf)<compressedSize): # truncated chunk.
+                    break
+                values= numpy.frombuffer(zlib.decompress(buf), dtype= numpy.float64)
+            else:
+                values= numpy.fromfile(f, dtype= numpy.float64, count= numRows*numColumns)
+            if(values.size<numRows*numColumns): # truncated chunk.
+                break
+            chunks.append(values.reshape((numColumns, numRows)).T)
+    if(chunks):
+        data= numpy.concatenate(chunks)
+    else:
+        data= numpy.empty((0, numColumns))
+    return columnNames, data
+
+def read_binary_columns_dict(fileName):
+    ''' Read the file and return a dictionary whose keys are the column
+        names and whose values are the corresponding numpy arrays.
+
+    :param fileName: name of the file to read.
+    '''
+    columnNames, data= read_binary_columns(fileName)
+    return {name: data[:,i] for i, name in enumerate(columnNames)}
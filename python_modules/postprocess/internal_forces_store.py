@@ -0,0 +1,202 @@
+# -*- coding: utf-8 -*-
+''' Write and read the indexed binary files that store the internal forces
+    obtained for each load combination (see the InternalForcesStore
+    class). The results of each combination are stored as a block of
+    columns, so they can be written one combination at a time and read
+    back through NumPy memory-mapped views without loading the whole
+    file in memory.'''
+
+import sys
+import struct
+import math
+import numpy
+import xc
+from misc_utils import log_messages as lmsg
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026 LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+internalForcesStoreMagic= b'XCIFSTOR'
+# Internal forces on the element sections (zero if not present).
+forceNames= ['N', 'Vy', 'Vz', 'T', 'My', 'Mz']
+# Extended properties (NaN if not present).
+extendedPropertyNames= ['chiLT', 'chiN', 'FcE', 'FbE']
+
+def get_value_names(vonMisesStressId= 'max_von_mises_stress'):
+    ''' Return the names of the value columns of the store.
+
+    :param vonMisesStressId: identifier of the Von Mises stress to store
+                            (see NDMaterial and MembranePlateFiberSection).
+    '''
+    return forceNames+extendedPropertyNames+[vonMisesStressId]
+
+def is_internal_forces_store(fileName):
+    ''' Return true if the given file is an internal forces store.
+
+    :param fileName: name of the file to check.
+    '''
+    with open(fileName, 'rb') as f:
+        magic= f.read(len(internalForcesStoreMagic))
+    return (magic==internalForcesStoreMagic)
+
+class InternalForcesStoreWriter(object):
+    ''' Write the internal forces dictionaries (see
+        export_internal_forces.get_internal_forces_dict) to an
+        internal forces store, one combination at a time.
+
+    :ivar store: XC InternalForcesStore object.
+    :ivar valueNames: names of the value columns.
+    '''
+    def __init__(self, fileName, vonMisesStressId= 'max_von_mises_stress'):
+        ''' Constructor.
+
+        :param fileName: name of the file to write.
+        :param vonMisesStressId: identifier of the Von Mises stress to store
+                                (see NDMaterial and MembranePlateFiberSection).
+        '''
+        self.valueNames= get_value_names(vonMisesStressId)
+        self.numForces= len(forceNames)
+        self.store= xc.InternalForcesStore()
+        if(not self.store.create(fileName, self.valueNames)):
+            className= type(self).__name__
+            methodName= sys._getframe(0).f_code.co_name
+            lmsg.error(className+'.'+methodName+"; can't create file: '"+fileName+"'.")
+
+    def appendCombinationDict(self, combInternalForcesDict):
+        ''' Append the results of the combinations in the given dictionary.
+
+        :param combInternalForcesDict: dictionary containing the internal
+                                       forces for each combination (see
+                                       get_internal_forces_dict).
+        '''
+        values= xc.Vector([0.0]*len(self.valueNames))
+        for combName in combInternalForcesDict:
+            self.store.beginCombination(combName)
+            elements= combInternalForcesDict[combName]
+            for elemTag in elements:
+                elementData= elements[elemTag]
+                if('internalForces' in elementData):
+                    internalForces= elementData['internalForces']
+                    for key in internalForces:
+                        forces= internalForces[key]
+                        for i, name in enumerate(self.valueNames):
+                            if(name in forces):
+                                values[i]= forces[name]
+                            elif(i<self.numForces):
+                                values[i]= 0.0
+                            else:
+                                values[i]= math.nan
+                        self.store.addRow(int(elemTag), int(key), values)
+            self.store.endCombination()
+
+    def close(self):
+        ''' Finish writing and close the file.'''
+        self.store.close()
+
+class InternalForcesStoreReader(object):
+    ''' Read an internal forces store through NumPy memory-mapped views.
+
+    :ivar valueNames: names of the value columns.
+    :ivar blocks: dictionary containing, for each combination name,
+                  the offset of its data and its number of rows.
+    '''
+    def __init__(self, fileName):
+        ''' Constructor.
+
+        :param fileName: name of the file to read.
+        '''
+        self.data= numpy.memmap(fileName, dtype= numpy.uint8, mode= 'r')
+        self.valueNames= list()
+        self.blocks= dict()
+        offset= self.readHeader()
+        self.scanBlocks(offset)
+
+    @staticmethod
+    def padding(sz):
+        ''' Return the number of bytes needed to pad the given size to a
+            multiple of 8.'''
+        return (8-sz%8)%8
+
+    def readHeader(self):
+        ''' Read the file header and return the offset of the first block.'''
+        magic= self.data[0:8].tobytes()
+        if(magic!=internalForcesStoreMagic):
+            raise ValueError('not an internal forces store (magic: '+str(magic)+').')
+        version, numValues= struct.unpack('=II', self.data[8:16].tobytes())
+        if(version!=1):
+            raise ValueError('unknown internal forces store version: '+str(version))
+        offset= 16
+        for i in range(0,numValues):
+            length= struct.unpack('=Q', self.data[offset:offset+8].tobytes())[0]
+            offset+= 8
+            self.valueNames.append(self.data[offset:offset+length].tobytes().decode('utf-8'))
+            offset+= length+self.padding(length)
+        return offset
+
+    def scanBlocks(self, offset):
+        ''' Build the combination index from the blocks in the file
+            (a truncated block at the end of the file is ignored).'''
+        fileSize= self.data.size
+        numValues= len(self.valueNames)
+        while(offset+16<=fileSize):
+            numRows, length= struct.unpack('=QQ', self.data[offset:offset+16].tobytes())
+            nameOffset= offset+16
+            dataOffset= nameOffset+length+self.padding(length)
+            blockEnd= dataOffset+numRows*(16+8*numValues)
+            if(blockEnd>fileSize):
+                className= type(self).__name__
+                methodName= sys._getframe(0).f_code.co_name
+                lmsg.warning(className+'.'+methodName+'; truncated block at offset: '+str(offset)+' ignored.')
+                break
+            combName= self.data[nameOffset:nameOffset+length].tobytes().decode('utf-8')
+            self.blocks[combName]= (dataOffset, numRows)
+            offset= blockEnd
+
+    def getCombinationNames(self):
+        ''' Return the names of the combinations in the store.'''
+        return list(self.blocks.keys())
+
+    def getCombination(self, combName):
+        ''' Return the element tags, the section indexes and the values
+            (one column for each value name) of the given combination as
+            read-only views of the file.
+
+        :param combName: name of the combination.
+        '''
+        dataOffset, numRows= self.blocks[combName]
+        tags= numpy.frombuffer(self.data, dtype= numpy.int64, count= numRows, offset= dataOffset)
+        sections= numpy.frombuffer(self.data, dtype= numpy.int64, count= numRows, offset= dataOffset+8*numRows)
+        values= numpy.frombuffer(self.data, dtype= numpy.float64, count= numRows*len(self.valueNames), offset= dataOffset+16*numRows).reshape((len(self.valueNames), numRows)).T
+        return tags, sections, values
+
+    def getCombinationDict(self, combName):
+        ''' Return a dictionary whose keys are the column names and whose
+            values are the corresponding views of the file.
+
+        :param combName: name of the combination.
+        '''
+        tags, sections, values= self.getCombination(combName)
+        retval= {'tagElem': tags, 'idSection': sections}
+        for i, name in enumerate(self.valueNames):
+            retval[name]= values[:,i]
+        return retval
+
+    def iterCombinations(self, elementTags= None):
+        ''' Iterate through the combinations in the store, yielding for
+            each one its name, the element tags, the section indexes and
+            the values of the rows corresponding to the given elements.
+
+        :param elementTags: tags of the elements of interest (if None
+                            return all the rows).
+        '''
+        if(elementTags is not None):
+            elementTags= numpy.asarray(list(elementTags), dtype= numpy.int64)
+        for combName in self.blocks:
+            tags, sections, values= self.getCombination(combName)
+            if(elementTags is not None):
+                mask= numpy.isin(tags, elementTags)
+                tags= tags[mask]; sections= sections[mask]; values= values[mask]
+            yield combName, tags, sections, values
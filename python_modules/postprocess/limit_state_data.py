@@ -12,10 +12,12 @@ __email__= "l.pereztato@ciccp.es, ana.Ortega@ciccp.es"
 
 import pickle
 import os
+import math
 import sys
 import json
 from solution import predefined_solutions
 from postprocess.reports import export_internal_forces as eif
+from postprocess import internal_forces_store as ifs
 from postprocess.reports import export_reactions as er
 from postprocess.reports import export_displacements as ed
 from postprocess.reports import export_modes as em
@@ -131,6 +133,12 @@ class LimitStateData(object):
                                        both axial and bending internal
                                        forces otherwise, use it only for 
                                        bending moments.
+    :ivar useInternalForcesStore: if true, write the internal forces to an
+                                  indexed binary file (see
+                                  internal_forces_store module), one
+                                  combination at a time, instead of
+                                  keeping them in a dictionary that is
+                                  written as JSON at the end.
     '''
     envConfig= None # configuration of XC environment variables.
     def __init__(self, limitStateLabel, outputDataBaseFileName, designSituations, woodArmerAlsoForAxialForces= True, cfg= None):
@@ -154,6 +162,8 @@ class LimitStateData(object):
         self.outputDataBaseFileName= outputDataBaseFileName
         self.designSituations= designSituations
         self.woodArmerAlsoForAxialForces= woodArmerAlsoForAxialForces
+        self.useInternalForcesStore= False
+        self.internalForcesWriter= None
         LimitStateData.envConfig= cfg
 
     @staticmethod
@@ -184,7 +194,10 @@ class LimitStateData(object):
     
     def getInternalForcesFileName(self):
         '''Return the name of the file where internal forces are stored.'''
-        return self.getInternalForcesResultsPath()+'intForce_'+ self.label +'.json'
+        extension= '.json'
+        if(self.useInternalForcesStore):
+            extension= '.xcif'
+        return self.getInternalForcesResultsPath()+'intForce_'+ self.label + extension
     
     def getReactionsResultsPath(self):
         '''Return the directory where reactions are stored.'''
@@ -399,9 +412,13 @@ class LimitStateData(object):
     def writeInternalForces(self):
         '''Write the internal forces results.
         '''
-        with open(self.fNameIntForc, 'w') as outfile:
-            json.dump(self.internalForcesDict, outfile)
-        outfile.close()
+        if(self.internalForcesWriter): # already written, one combination at a time.
+            self.internalForcesWriter.close()
+            self.internalForcesWriter= None
+        else:
+            with open(self.fNameIntForc, 'w') as outfile:
+                json.dump(self.internalForcesDict, outfile)
+            outfile.close()
         
     def writeReactions(self):
         '''Write the reactions.
@@ -421,6 +438,9 @@ class LimitStateData(object):
         ''' Prepare the dictionaries to store the results of the analysis.'''
         self.createOutputFiles()
         self.internalForcesDict= dict()
+        self.internalForcesWriter= None
+        if(self.useInternalForcesStore):
+            self.internalForcesWriter= ifs.InternalForcesStoreWriter(self.fNameIntForc, vonMisesStressId= getattr(self, 'vonMisesStressId', 'max_von_mises_stress'))
         self.reactionsDict= dict()
         self.displacementsDict= dict()
 
@@ -433,7 +453,11 @@ class LimitStateData(object):
                           going to be performed.
         :param constrainedNodes: constrained nodes (defaults to None)
         '''
-        self.internalForcesDict.update(self.getInternalForcesDict(combName,calcSet.elements))
+        combInternalForcesDict= self.getInternalForcesDict(combName,calcSet.elements)
+        if(self.internalForcesWriter):
+            self.internalForcesWriter.appendCombinationDict(combInternalForcesDict)
+        else:
+            self.internalForcesDict.update(combInternalForcesDict)
         if(constrainedNodes is not None):
             self.reactionsDict.update(self.getReactionsDict(combName, constrainedNodes= constrainedNodes))
         self.displacementsDict.update(self.getDisplacementsDict(combName, calcSet.nodes))
@@ -1451,6 +1475,56 @@ def read_int_forces_dict(intForcCombFileName, setCalc=None, vonMisesStressId= 'm
         
     return (elementTags, idCombs, internalForcesValues)
 
+def read_int_forces_store(intForcCombFileName, setCalc=None, vonMisesStressId= 'max_von_mises_stress'):
+    '''Extracts element and combination identifiers from the internal
+    forces binary store (see internal_forces_store module). Return 
+    elementTags, idCombs and internal-forces values. The file is read
+    through memory-mapped views, one combination at a time, so only the
+    rows corresponding to the elements of interest are loaded.
+    
+    :param intForcCombFileName: name of the file containing the internal
+                                forces obtained for each element for 
+                                the combinations analyzed
+    :param setCalc: set of elements to be analyzed (defaults to None which 
+                    means that all the elements in the file of internal forces
+                    results are analyzed)
+    :param vonMisesStressId: identifier of the Von Mises stress to read
+                            (see NDMaterial and MembranePlateFiberSection).
+    '''
+    elementTags= set()
+    idCombs= set()
+    internalForcesValues= defaultdict(list)
+    reader= ifs.InternalForcesStoreReader(intForcCombFileName)
+    valueNames= reader.valueNames
+    forceIndexes= [valueNames.index(name) for name in ifs.forceNames]
+    extendedIndexes= [(name, valueNames.index(name)) for name in ifs.extendedPropertyNames if name in valueNames]
+    vonMisesIndex= None
+    if(vonMisesStressId in valueNames):
+        vonMisesIndex= valueNames.index(vonMisesStressId)
+    setElTags= None
+    if(setCalc):
+        setElTags= setCalc.getElementTags()
+    for idComb, tags, sections, values in reader.iterCombinations(setElTags):
+        idCombs.add(idComb)
+        for tagElem, idSection, row in zip(tags.tolist(), sections.tolist(), values.tolist()):
+            elementTags.add(tagElem)
+            N, Vy, Vz, T, My, Mz= [row[i] for i in forceIndexes]
+            crossSectionInternalForces= CrossSectionInternalForces(idComb= idComb, tagElem= tagElem, idSection= idSection, N= N, Vy= Vy, Vz= Vz, T= T, My= My, Mz= Mz)
+            for name, i in extendedIndexes:
+                if(not math.isnan(row[i])):
+                    setattr(crossSectionInternalForces, name, row[i])
+            if((vonMisesIndex is not None) and (not math.isnan(row[vonMisesIndex]))):
+                crossSectionInternalForces.vonMisesStress= row[vonMisesIndex]
+            internalForcesValues[tagElem].append(crossSectionInternalForces)
+    if(len(elementTags)==0):
+        methodName= sys._getframe(0).f_code.co_name
+        if(setElTags):
+            errMsg= "; no internal forces for elements in set: '"+setCalc.name+"'."
+        else:
+            errMsg= "; no internal forces for any element."
+        lmsg.error(methodName+errMsg)
+    return (elementTags, idCombs, internalForcesValues)
+
 class GaussPointStresses(stresses.Stresses3D):
     ''' Definition of the stresses in Gauss point of a 2D element
 
@@ -1639,6 +1713,8 @@ def read_internal_forces_file(intForcCombFileName, setCalc=None, vonMisesStressI
     '''
     if('PlaneStress' in intForcCombFileName):
         retval= read_stresses_dict(stressesCombFileName= intForcCombFileName, setCalc= setCalc, vonMisesStressId= vonMisesStressId)
+    elif(ifs.is_internal_forces_store(intForcCombFileName)):
+        retval= read_int_forces_store(intForcCombFileName, setCalc, vonMisesStressId)
     else:
         f= open(intForcCombFileName,"r")
         c= f.read(1)
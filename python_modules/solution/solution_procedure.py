@@ -401,7 +401,8 @@ class SolutionProcedure(object):
         ''' Define the solution strategy.
 
         :param solutionAlgorithType: type of the solution algorithm. Available
-                                     types are: 'bfgs_soln_algo', 
+                                     types are: 'adaptive_newton_soln_algo',
+                                     'bfgs_soln_algo', 
                                      'broyden_soln_algo', 
                                      'krylov_newton_soln_algo', 
                                      'linear_soln_algo', 
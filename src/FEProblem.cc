@@ -34,6 +34,7 @@
 #include "utility/handler/DataOutputFileHandler.h"
 #include "utility/handler/DataOutputDatabaseHandler.h"
 #include "utility/handler/DataOutputStreamHandler.h"
+#include "utility/handler/DataOutputBinaryFileHandler.h"
 #include "utility/database/FE_Datastore.h"
 
 
@@ -43,6 +44,7 @@
 #include "utility/database/BerkeleyDbDatastore.h"
 #include "utility/database/SQLiteDatastore.h"
 #include "utility/database/PyDictDatastore.h"
+#include "utility/database/MemoryDatastore.h"
 
 #include "domain/mesh/Mesh.h"
 #include "domain/domain/Domain.h"
@@ -58,7 +60,7 @@ XC::FEProblem::FEProblem(void)
   : preprocessor(this,&output_handlers),proc_solu(this), dataBase(nullptr) {}
 
 //! @brief Database definition.
-//! @param type: type of the database (File, MySql, BerkeleyDB, SQLite).
+//! @param type: type of the database (File, MySql, BerkeleyDB, SQLite, PyDict, Memory).
 //! @param name: name of the database.
 XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &type, const std::string &name)
   {
@@ -77,6 +79,8 @@ XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &type, const s
       dataBase= new SQLiteDatastore(name, preprocessor, theBroker);
     else if(type == "PyDict")
       dataBase= new PyDictDatastore(name, preprocessor, theBroker);
+    else if(type == "Memory")
+      dataBase= new MemoryDatastore(name, preprocessor, theBroker);
     else
       {  
         std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
@@ -93,6 +97,46 @@ XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &type, const s
     return dataBase; 
   }
 
+//! @brief Create a new output handler to be used by the recorders.
+//! @param type: type of the handler (file, binary_file).
+//! @param name: name that identifies the handler.
+//! @param fileName: name of the output file.
+XC::DataOutputHandler *XC::FEProblem::newOutputHandler(const std::string &type, const std::string &name, const std::string &fileName)
+  {
+    DataOutputHandler *retval= getOutputHandler(name);
+    if(retval)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+	          << "; output handler: '" << name
+		  << "' already exists."
+	          << Color::def << std::endl;
+        return retval;
+      }
+    if(type == "file")
+      retval= new DataOutputFileHandler(fileName);
+    else if(type == "binary_file")
+      retval= new DataOutputBinaryFileHandler(fileName);
+    else
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; output handler type: '" << type
+		<< "' unknown (valid types: file, binary_file)."
+		<< Color::def << std::endl;
+    if(retval)
+      output_handlers[name]= retval;
+    return retval;
+  }
+
+//! @brief Return the output handler with the name being passed as parameter
+//! (nullptr if not found).
+XC::DataOutputHandler *XC::FEProblem::getOutputHandler(const std::string &name)
+  {
+    DataOutputHandler *retval= nullptr;
+    DataOutputHandler::map_output_handlers::iterator i= output_handlers.find(name);
+    if(i!=output_handlers.end())
+      retval= i->second;
+    return retval;
+  }
+
 //! @brief Return a Python dictionary with the object members values.
 boost::python::dict XC::FEProblem::getPyDict(void) const
   {
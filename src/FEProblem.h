@@ -112,6 +112,8 @@ class FEProblem: public CommandEntity
       { return proc_solu; }
     inline DataOutputHandler::map_output_handlers *getOutputHandlers(void) const
       { return &output_handlers; }
+    DataOutputHandler *newOutputHandler(const std::string &, const std::string &, const std::string &);
+    DataOutputHandler *getOutputHandler(const std::string &);
     static double getDt(void);
     static void setDt(const double &);
 
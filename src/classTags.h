@@ -455,6 +455,7 @@
 #define EquiALGORITHM_TAGS_PeriodicNewton       9
 #define EquiALGORITHM_TAGS_SecantNewton         10
 #define EquiALGORITHM_TAGS_AccelNewton          11
+#define EquiALGORITHM_TAGS_AdaptiveNewton       12
 
 #define ACCELERATOR_TAGS_Krylov		1
 #define ACCELERATOR_TAGS_Secant		2
@@ -551,6 +552,8 @@
 #define SOLVER_TAGS_DistributedDiagonalSolver 22
 #define SOLVER_TAGS_MumpsSolver			      	23
 #define SOLVER_TAGS_MumpsParallelSolver			24
+#define SOLVER_TAGS_KrylovSolver			25
+#define SOLVER_TAGS_UmfpackStaticCondensationSolver	26
 
 
 #define RECORDER_TAGS_ElementRecorder		1
@@ -573,6 +576,7 @@
 #define DATAHANDLER_TAGS_DataOutputStreamHandler		1
 #define DATAHANDLER_TAGS_DataOutputFileHandler		2
 #define DATAHANDLER_TAGS_DataOutputDatabaseHandler		3
+#define DATAHANDLER_TAGS_DataOutputBinaryFileHandler		4
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
 
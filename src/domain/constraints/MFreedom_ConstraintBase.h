@@ -95,7 +95,7 @@ class MFreedom_ConstraintBase: public Constraint
     
     std::vector<int> getIdxNodes(void) const;
 
-    bool isTimeVarying(void) const;
+    virtual bool isTimeVarying(void) const;
 
     void setDomain(Domain *);
 
@@ -87,7 +87,7 @@ class MFreedom_Joint: public OneRowMFreedom_Constraint
     ~MFreedom_Joint(void);
 
     // method to get information about the constraint
-    bool isTimeVarying(void) const;
+    virtual bool isTimeVarying(void) const;
     void setDomain(Domain *theDomain);
 
     // methods for output
@@ -23,7 +23,7 @@
 
 class_<XC::EqualDOF, bases<XC::MFreedom_Constraint>, boost::noncopyable >("EqualDOF", no_init);
 
-class_<XC::MFreedom_Joint , bases<XC::MFreedom_Constraint>, boost::noncopyable >("MFreedom_Joint2D", no_init);
+class_<XC::MFreedom_Joint , bases<XC::MFreedom_Constraint>, boost::noncopyable >("MFreedom_Joint", no_init);
 
 class_<XC::MFreedom_Joint2D , bases<XC::MFreedom_Joint>, boost::noncopyable >("MFreedom_Joint2D", no_init);
 
@@ -0,0 +1,224 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DOF_NumberingCache.cc
+
+#include "DOF_NumberingCache.h"
+#include "Domain.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/ElementIter.h"
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
+#include "domain/constraints/SFreedom_Constraint.h"
+#include "domain/constraints/SFreedom_ConstraintIter.h"
+#include "domain/constraints/MFreedom_Constraint.h"
+#include "domain/constraints/MFreedom_ConstraintIter.h"
+#include "domain/constraints/MRMFreedom_Constraint.h"
+#include "domain/constraints/MRMFreedom_ConstraintIter.h"
+#include <functional>
+
+//! @brief Mix the value into the hash (same formula as boost::hash_combine).
+static inline void hash_combine(size_t &seed, const int &value)
+  { seed^= std::hash<int>()(value) + 0x9e3779b9 + (seed<<6) + (seed>>2); }
+
+//! @brief Mix the components of the ID into the hash.
+static inline void hash_combine(size_t &seed, const XC::ID &id)
+  {
+    const int sz= id.Size();
+    hash_combine(seed, sz);
+    for(int i= 0;i<sz;i++)
+      hash_combine(seed, id(i));
+  }
+
+//! @brief Constructor.
+XC::DOF_NumberingCache::DOF_NumberingCache(Domain *owr)
+  : CommandEntity(owr), enabled(true), topologyHash(0), orderings(),
+    numHits(0), numMisses(0) {}
+
+//! @brief Compute a hash of the domain topology, that is, of everything
+//! that can change the result of the DOF numbering: the nodes and their
+//! number of degrees of freedom, the connectivity and the activation of
+//! the elements and the constraints.
+size_t XC::DOF_NumberingCache::computeTopologyHash(Domain &dom)
+  {
+    size_t retval= 0;
+    hash_combine(retval, dom.getNumNodes());
+    NodeIter &theNodes= dom.getNodes();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      {
+        hash_combine(retval, nodePtr->getTag());
+        hash_combine(retval, nodePtr->getNumberDOF());
+      }
+    hash_combine(retval, dom.getNumElements());
+    ElementIter &theElements= dom.getElements();
+    Element *elemPtr= nullptr;
+    while((elemPtr= theElements()) != nullptr)
+      {
+        hash_combine(retval, elemPtr->getTag());
+        hash_combine(retval, elemPtr->getClassTag());
+        hash_combine(retval, static_cast<int>(elemPtr->isAlive()));
+        hash_combine(retval, elemPtr->getNodePtrs().getExternalNodes());
+      }
+    ConstrContainer &constraints= dom.getConstraints();
+    SFreedom_ConstraintIter &theSPs= constraints.getDomainAndLoadPatternSPs();
+    SFreedom_Constraint *spPtr= nullptr;
+    while((spPtr= theSPs()) != nullptr)
+      {
+        hash_combine(retval, spPtr->getNodeTag());
+        hash_combine(retval, spPtr->getDOF_Number());
+      }
+    MFreedom_ConstraintIter &theMPs= constraints.getMPs();
+    MFreedom_Constraint *mpPtr= nullptr;
+    while((mpPtr= theMPs()) != nullptr)
+      {
+        hash_combine(retval, mpPtr->getNodeConstrained());
+        hash_combine(retval, mpPtr->getNodeRetained());
+        hash_combine(retval, mpPtr->getConstrainedDOFs());
+        hash_combine(retval, mpPtr->getRetainedDOFs());
+      }
+    MRMFreedom_ConstraintIter &theMRMPs= constraints.getMRMPs();
+    MRMFreedom_Constraint *mrmpPtr= nullptr;
+    while((mrmpPtr= theMRMPs()) != nullptr)
+      {
+        hash_combine(retval, mrmpPtr->getNodeConstrained());
+        hash_combine(retval, mrmpPtr->getRetainedNodeTags());
+        hash_combine(retval, mrmpPtr->getConstrainedDOFs());
+      }
+    return retval;
+  }
+
+//! @brief Discard the stored orderings if the topology of the domain
+//! has changed since they were computed. Return true if the
+//! orderings are still valid.
+bool XC::DOF_NumberingCache::check_topology(Domain &dom)
+  {
+    const size_t h= computeTopologyHash(dom);
+    const bool retval= (h==topologyHash);
+    if(!retval)
+      {
+        orderings.clear();
+        topologyHash= h;
+      }
+    return retval;
+  }
+
+//! @brief Enable or disable the cache (disabling it removes the
+//! stored orderings).
+void XC::DOF_NumberingCache::setEnabled(const bool &b)
+  {
+    enabled= b;
+    if(!enabled)
+      orderings.clear();
+  }
+
+//! @brief Return the ordering stored with the given key if it
+//! corresponds to the current topology of the domain (nullptr
+//! otherwise).
+//!
+//! @param dom: domain to compute the topology hash from.
+//! @param key: identifier of the constraint handler and numbering
+//!             algorithm.
+const XC::ID *XC::DOF_NumberingCache::find(Domain &dom, const std::string &key)
+  {
+    const ID *retval= nullptr;
+    if(enabled)
+      {
+        if(check_topology(dom))
+          {
+            std::map<std::string, ID>::const_iterator i= orderings.find(key);
+            if(i!=orderings.end())
+              retval= &(i->second);
+          }
+        if(retval)
+          numHits++;
+        else
+          numMisses++;
+      }
+    return retval;
+  }
+
+//! @brief Store the ordering of the DOF groups computed for the current
+//! topology of the domain.
+//!
+//! @param dom: domain to compute the topology hash from.
+//! @param key: identifier of the constraint handler and numbering
+//!             algorithm.
+//! @param orderedRefs: ordered DOF group tags.
+void XC::DOF_NumberingCache::store(Domain &dom, const std::string &key, const ID &orderedRefs)
+  {
+    if(enabled)
+      {
+        check_topology(dom);
+        orderings[key]= orderedRefs;
+      }
+  }
+
+//! @brief Return the number of stored orderings.
+size_t XC::DOF_NumberingCache::getNumEntries(void) const
+  { return orderings.size(); }
+
+//! @brief Remove the stored orderings and reset the counters.
+void XC::DOF_NumberingCache::clear(void)
+  {
+    orderings.clear();
+    topologyHash= 0;
+    numHits= 0;
+    numMisses= 0;
+  }
+
+//! @brief Return a Python dictionary with the object members values.
+boost::python::dict XC::DOF_NumberingCache::getPyDict(void) const
+  {
+    boost::python::dict retval= CommandEntity::getPyDict();
+    retval["enabled"]= enabled;
+    retval["topologyHash"]= topologyHash;
+    boost::python::dict orderings_dict;
+    for(std::map<std::string, ID>::const_iterator i= orderings.begin(); i!=orderings.end(); i++)
+      orderings_dict[i->first]= i->second.getPyList();
+    retval["orderings"]= orderings_dict;
+    return retval;
+  }
+
+//! @brief Set the values of the object members from a Python dictionary.
+void XC::DOF_NumberingCache::setPyDict(const boost::python::dict &d)
+  {
+    CommandEntity::setPyDict(d);
+    enabled= boost::python::extract<bool>(d["enabled"]);
+    topologyHash= boost::python::extract<size_t>(d["topologyHash"]);
+    orderings.clear();
+    const boost::python::dict orderings_dict= boost::python::extract<boost::python::dict>(d["orderings"]);
+    boost::python::list items= orderings_dict.items();
+    const size_t sz= len(items);
+    for(size_t i= 0; i<sz; i++)
+      {
+        const std::string key= boost::python::extract<std::string>(items[i][0]);
+        ID tmp;
+        tmp.setPyList(boost::python::extract<boost::python::list>(items[i][1]));
+        orderings[key]= tmp;
+      }
+  }
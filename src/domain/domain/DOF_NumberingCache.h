@@ -0,0 +1,92 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DOF_NumberingCache.h
+
+#ifndef DOF_NumberingCache_h
+#define DOF_NumberingCache_h
+
+#include "utility/kernel/CommandEntity.h"
+#include "utility/matrix/ID.h"
+#include <map>
+
+namespace XC {
+class Domain;
+
+//! @ingroup Dom
+//
+//! @brief Cache of the DOF orderings computed for the domain.
+//!
+//! Each new analysis numbers the degrees of freedom of the model, which
+//! means building the graph of the DOF groups and reordering it (RCM,
+//! AMD,...). When several analyses are run on the same mesh (parametric
+//! studies, load combinations solved with a new analysis object each
+//! time,...) the result of that numbering is always the same, so the
+//! DOF numberers store it here and reuse it while the topology of the
+//! domain doesn't change.
+//!
+//! The orderings are validated with a hash of the topology of the domain
+//! (nodes and their number of DOFs, element connectivity and activation,
+//! and constraints), so they survive the reconstruction of the analysis
+//! objects and the serialization of the model. The key of each ordering
+//! identifies the constraint handler and the graph numbering algorithm
+//! that produced it.
+class DOF_NumberingCache: public CommandEntity
+  {
+  private:
+    bool enabled; //!< if false, the orderings are neither stored nor reused.
+    size_t topologyHash; //!< hash of the topology the orderings correspond to.
+    std::map<std::string, ID> orderings; //!< ordered DOF group tags for each key.
+    size_t numHits; //!< number of orderings reused.
+    size_t numMisses; //!< number of orderings not found.
+
+    bool check_topology(Domain &);
+  protected:
+    friend class Domain;
+    DOF_NumberingCache(Domain *owr= nullptr);
+  public:
+    static size_t computeTopologyHash(Domain &);
+
+    inline bool isEnabled(void) const
+      { return enabled; }
+    void setEnabled(const bool &);
+    const ID *find(Domain &, const std::string &);
+    void store(Domain &, const std::string &, const ID &);
+    size_t getNumEntries(void) const;
+    inline size_t getNumHits(void) const
+      { return numHits; }
+    inline size_t getNumMisses(void) const
+      { return numMisses; }
+    void clear(void);
+
+    boost::python::dict getPyDict(void) const;
+    void setPyDict(const boost::python::dict &);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -95,6 +95,7 @@
 #include "domain/mesh/region/MeshRegion.h"
 #include <solution/analysis/analysis/Analysis.h>
 #include "utility/database/FE_Datastore.h"
+#include "utility/database/MemoryDatastore.h"
 #include "utility/actor/objectBroker/FEM_ObjectBroker.h"
 
 #include "preprocessor/Preprocessor.h"
@@ -108,6 +109,8 @@ void XC::Domain::free_mem(void)
     //delete the objects in the domain
     clearAll();
     
+    if(snapshotStore) delete snapshotStore;
+    snapshotStore= nullptr;
     if(theParamIter) delete theParamIter;
     theParamIter= nullptr;
     if(theParameters) delete theParameters;
@@ -152,9 +155,12 @@ bool XC::Domain::check_containers(void) const
 //! @param owr: object that contains this one.
 XC::Domain::Domain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(),callbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0),
+   currentGeoTag(0), hasDomainChangedFlag(false), onlySPsChangedFlag(false),
+   lastNonSPChangeTag(0), modelStamp(0), commitTag(0),
    mesh(this), constraints(this), theRegions(),
-   activeCombinations(), lastChannel(0), lastGeoSendTag(-1)
+   activeCombinations(), lastChannel(0), lastGeoSendTag(-1),
+   snapshotStore(nullptr), snapshots(), lastSnapshotTag(0),
+   numberingCache(this)
   {
     alloc_containers();
     alloc_iters();
@@ -174,9 +180,11 @@ XC::Domain::Domain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh
 //! @param numNodeLockers: number of node lockers.
 XC::Domain::Domain(CommandEntity *owr,int numNodes, int numElements, int numSPs, int numMPs, int numLoadPatterns,int numNodeLockers,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(), callbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0), mesh(this),
+   currentGeoTag(0), hasDomainChangedFlag(false), onlySPsChangedFlag(false),
+   lastNonSPChangeTag(0), modelStamp(0), commitTag(0), mesh(this),
    constraints(this), theRegions(), activeCombinations(), lastChannel(0),
-   lastGeoSendTag(-1)
+   lastGeoSendTag(-1), snapshotStore(nullptr), snapshots(), lastSnapshotTag(0),
+   numberingCache(this)
   {
     alloc_containers();
     alloc_iters();    
@@ -207,14 +215,18 @@ void XC::Domain::clearAll(void)
 
     theRegions.clearAll();
     activeCombinations.clear();
+    clearSnapshots(); // the objects they refer to are gone.
+    numberingCache.clear();
 
     // set the time back to 0.0
     timeTracker.Zero();
 
     // rest the flag to be as initial
     hasDomainChangedFlag = false;
+    onlySPsChangedFlag= false;
 
     currentGeoTag = 0;
+    lastNonSPChangeTag= 0;
     lastGeoSendTag = -1;
     lastChannel = 0;
  }
@@ -238,6 +250,182 @@ void XC::Domain::resetLoadCase(void)
     timeTracker.Zero();
   }
 
+//! @brief Object broker used by the snapshot storage.
+XC::FEM_ObjectBroker XC::Domain::theSnapshotBroker;
+
+//! @brief Send the state of the domain (time, nodes and elements)
+//! through the communicator argument.
+int XC::Domain::send_state(Communicator &comm)
+  {
+    timeTracker.setDbTag(comm);
+    int res= timeTracker.sendSelf(comm);
+    Node *nodePtr= nullptr;
+    NodeIter &theNodes= getNodes();
+    while((res>=0) && ((nodePtr= theNodes()) != nullptr))
+      {
+        nodePtr->setDbTag(comm);
+        res+= nodePtr->sendSelf(comm);
+      }
+    Element *elePtr= nullptr;
+    ElementIter &theElements= getElements();
+    while((res>=0) && ((elePtr= theElements()) != nullptr))
+      {
+        elePtr->setDbTag(comm);
+        res+= elePtr->sendSelf(comm);
+      }
+    return res;
+  }
+
+//! @brief Receive the state of the domain (time, nodes and elements)
+//! through the communicator argument.
+int XC::Domain::recv_state(const Communicator &comm)
+  {
+    int res= timeTracker.recvSelf(comm);
+    Node *nodePtr= nullptr;
+    NodeIter &theNodes= getNodes();
+    while((res>=0) && ((nodePtr= theNodes()) != nullptr))
+      res+= nodePtr->recvSelf(comm);
+    Element *elePtr= nullptr;
+    ElementIter &theElements= getElements();
+    while((res>=0) && ((elePtr= theElements()) != nullptr))
+      res+= elePtr->recvSelf(comm);
+    return res;
+  }
+
+//! @brief Store the current state of the domain (pseudo-time, nodes
+//! and elements with their materials) in memory with the name
+//! being passed as parameter.
+//!
+//! The snapshot can be restored later, even several times, with
+//! restoreSnapshot as long as the nodes, elements and constraints
+//! of the domain don't change. If a snapshot with the same name
+//! already exists it's replaced.
+//! @param name: name of the snapshot.
+int XC::Domain::saveSnapshot(const std::string &name)
+  {
+    int retval= 0;
+    if(!snapshotStore)
+      {
+        Preprocessor *preprocessor= getPreprocessor();
+        if(preprocessor)
+          snapshotStore= new MemoryDatastore("snapshots", *preprocessor, theSnapshotBroker);
+        else
+	  {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; preprocessor not set, can't create the storage."
+		      << Color::def << std::endl;
+	    return -1;
+	  }
+      }
+    removeSnapshot(name);
+    SnapshotData snapshot;
+    snapshot.storeTag= ++lastSnapshotTag;
+    snapshot.geoTag= hasDomainChanged();
+    snapshot.commitTag= commitTag;
+    snapshotStore->clearDbTags();
+    Communicator comm(snapshot.storeTag, *snapshotStore);
+    retval= send_state(comm);
+    if(retval<0)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; failed to store the snapshot: '" << name << "'."
+		  << Color::def << std::endl;
+        snapshotStore->removeCommit(snapshot.storeTag);
+      }
+    else
+      snapshots[name]= snapshot;
+    return retval;
+  }
+
+//! @brief Return the domain to the state stored with the name
+//! being passed as parameter (see saveSnapshot).
+//!
+//! The trial state of nodes and elements is set equal to the
+//! committed state of the snapshot and the loads are applied
+//! for its pseudo-time.
+//! @param name: name of the snapshot.
+int XC::Domain::restoreSnapshot(const std::string &name)
+  {
+    std::map<std::string, SnapshotData>::const_iterator i= snapshots.find(name);
+    if(i==snapshots.end())
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; snapshot: '" << name << "' not found."
+		  << Color::def << std::endl;
+        return -1;
+      }
+    const SnapshotData &snapshot= i->second;
+    if(hasDomainChanged()!=snapshot.geoTag)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; the domain has changed since the snapshot: '"
+		  << name << "' was taken, it can't be restored."
+		  << Color::def << std::endl;
+        return -2;
+      }
+    snapshotStore->clearDbTags();
+    Communicator comm(snapshot.storeTag, *snapshotStore, theSnapshotBroker);
+    int retval= recv_state(comm);
+    if(retval<0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; failed to restore the snapshot: '" << name << "'."
+		<< Color::def << std::endl;
+    else
+      {
+        commitTag= snapshot.commitTag;
+        // set the current time and load factor to the committed ones.
+        setCurrentTime(timeTracker.getCommittedTime());
+        applyLoad(timeTracker.getCurrentTime());
+        retval= update();
+      }
+    return retval;
+  }
+
+//! @brief Return true if a snapshot with the given name exists.
+bool XC::Domain::hasSnapshot(const std::string &name) const
+  { return (snapshots.find(name)!=snapshots.end()); }
+
+//! @brief Remove the snapshot with the given name.
+bool XC::Domain::removeSnapshot(const std::string &name)
+  {
+    bool retval= false;
+    std::map<std::string, SnapshotData>::iterator i= snapshots.find(name);
+    if(i!=snapshots.end())
+      {
+        if(snapshotStore)
+          snapshotStore->removeCommit(i->second.storeTag);
+        snapshots.erase(i);
+        retval= true;
+      }
+    return retval;
+  }
+
+//! @brief Remove all the snapshots.
+void XC::Domain::clearSnapshots(void)
+  {
+    snapshots.clear();
+    if(snapshotStore)
+      snapshotStore->clearAll();
+  }
+
+//! @brief Return the names of the stored snapshots.
+boost::python::list XC::Domain::getSnapshotNames(void) const
+  {
+    boost::python::list retval;
+    for(std::map<std::string, SnapshotData>::const_iterator i= snapshots.begin(); i!=snapshots.end(); i++)
+      retval.append(i->first);
+    return retval;
+  }
+
+//! @brief Return the memory used to store the snapshots (in bytes).
+size_t XC::Domain::getSnapshotsSize(void) const
+  {
+    size_t retval= 0;
+    if(snapshotStore)
+      retval= snapshotStore->getNumBytes();
+    return retval;
+  }
+
 //! @brief Assigns Stress Reduction Factor for element deactivation.
 void XC::Domain::setDeadSRF(const double &d)
   { Element::setDeadSRF(d); }
@@ -251,6 +439,16 @@ bool XC::Domain::addElement(Element *element)
 bool XC::Domain::addNode(Node * node)
   { return mesh.addNode(node); }
 
+//! @brief Adds to the domain the elements being passed as parameter
+//! (see Mesh::addElements).
+bool XC::Domain::addElements(const std::vector<Element *> &elements)
+  { return mesh.addElements(elements); }
+
+//! @brief Adds to the domain the nodes being passed as parameter
+//! (see Mesh::addNodes).
+bool XC::Domain::addNodes(const std::vector<Node *> &nodes)
+  { return mesh.addNodes(nodes); }
+
 //! @brief Adds a single freedom constraint to the domain.
 //!
 //! To add the single point constraint pointed to by spConstraint to the
@@ -264,7 +462,7 @@ bool XC::Domain::addSFreedom_Constraint(SFreedom_Constraint *spConstraint)
     if(result)
       {
         spConstraint->setDomain(this);
-        this->domainChange();
+        this->spConstraintsChange();
       }
     return true;
   }
@@ -318,7 +516,7 @@ bool XC::Domain::addSFreedom_Constraint(SFreedom_Constraint *spConstraint, int p
       }
 
     spConstraint->setDomain(this);
-    this->domainChange();
+    this->spConstraintsChange();
     return true;
   }
 
@@ -420,7 +618,7 @@ bool XC::Domain::removeSFreedom_Constraint(int theNode, int theDOF, int loadPatt
   {
     const bool retval= constraints.removeSFreedom_Constraint(theNode,theDOF,loadPatternTag);
     if(retval)
-      domainChange();
+      spConstraintsChange();
     return retval;
   }
 
@@ -432,7 +630,7 @@ bool XC::Domain::removeSFreedom_Constraint(int tag)
   {
     const bool retval= constraints.removeSFreedom_Constraint(tag);
     if(retval)
-      domainChange();
+      spConstraintsChange();
     return retval;
   }
 
@@ -542,7 +740,7 @@ bool XC::Domain::addNodeLocker(NodeLocker *nl)
     if(result)
       {
         nl->setDomain(this);
-        domainChange();
+        spConstraintsChange();
       }
     return result;
   }
@@ -650,7 +848,7 @@ bool XC::Domain::removeNodeLocker(int tag)
         // mark the domain has having changed if numSPs > 0
         // as the constraint handlers have to be redone
         if(numSPs>0)
-          domainChange();
+          spConstraintsChange();
       }
     // finally return the node locker
     return result;
@@ -1288,7 +1486,10 @@ double XC::Domain::getTotalMassComponent(const int &dof) const
 //! @brief Set the domain stamp to be \p newStamp. Domain stamp is the
 //! integer returned by hasDomainChanged(). 
 void XC::Domain::setDomainChangeStamp(int newStamp)
-  { currentGeoTag= newStamp; }
+  {
+    currentGeoTag= newStamp;
+    lastNonSPChangeTag= newStamp;
+  }
 
 
 //! @brief Sets a flag indicating that the integer returned in the next call to 
@@ -1299,7 +1500,41 @@ void XC::Domain::setDomainChangeStamp(int newStamp)
 //! invoked whenever a Node, Element or Constraint object is added to the
 //! domain.  
 void XC::Domain::domainChange(void)
-  { hasDomainChangedFlag= true; }
+  {
+    hasDomainChangedFlag= true;
+    onlySPsChangedFlag= false;
+    modelChange();
+  }
+
+//! @brief Increments the model stamp to notify that the properties of
+//! the model (materials, sections, nodal coordinates, activation of
+//! the elements,...) may have changed.
+//!
+//! The objects that keep data computed from those properties (i.e. the
+//! constant part of the tangent, see TangentSplit) check it again only
+//! when the stamp changes, so they don't need to query the elements on
+//! each iteration. The stamp is incremented at the beginning of each
+//! static analysis (the user may have modified the model since the
+//! last one), after running the Python code of the recorders and on
+//! each call to domainChange.
+void XC::Domain::modelChange(void)
+  { modelStamp++; }
+
+//! @brief Sets a flag indicating that the domain has changed but only
+//! in its single freedom constraints (node lockers of a staged
+//! construction, supports added or removed,...).
+//!
+//! The stamp returned by hasDomainChanged() is incremented as with
+//! domainChange(), but the stamp returned by getLastNonSPChangeStamp()
+//! is not, so the analysis can keep the DOF numbering and the
+//! sparsity of the system of equations if its constraint handler is
+//! able to update the single freedom constraints by itself.
+void XC::Domain::spConstraintsChange(void)
+  {
+    if(!hasDomainChangedFlag)
+      onlySPsChangedFlag= true;
+    hasDomainChangedFlag= true;
+  }
 
 //! @brief Returns true if the model has changed.
 //!
@@ -1318,8 +1553,13 @@ int XC::Domain::hasDomainChanged(void)
     if(result)
       {
         currentGeoTag++;
-        mesh.setGraphBuiltFlags(false);
+        if(!onlySPsChangedFlag) // the graphs don't depend on the SPs.
+	  {
+	    lastNonSPChangeTag= currentGeoTag;
+            mesh.setGraphBuiltFlags(false);
+	  }
       }
+    onlySPsChangedFlag= false;
     // return the integer so user can determine if domain has changed
     // since their last call to this method
     return currentGeoTag;
@@ -1449,6 +1689,7 @@ int XC::Domain::recvData(const Communicator &comm)
         // if receiving set lastGeoSendTag to be equal to currentGeoTag
         // at time all the data was sent if not we must clear out the objects and rebuild
         lastGeoSendTag= geoTag; currentGeoTag= geoTag;
+        lastNonSPChangeTag= geoTag;
   
         // mark domainChangeFlag as false
         // this way if restoring froma a database and domain has not changed for the analysis
@@ -1492,6 +1733,7 @@ boost::python::dict XC::Domain::getPyDict(void) const
     retval["paramIndex"]= param_index;
     retval["lastChannel"]= this->lastChannel;
     retval["lastGeoSendTag"]= this->lastGeoSendTag;
+    retval["numberingCache"]= numberingCache.getPyDict();
     return retval;
   }
 
@@ -1503,6 +1745,7 @@ void XC::Domain::setPyDict(const boost::python::dict &d)
     callbackCommit= boost::python::extract<std::string>(d["callbackCommit"]);
     dbTag= boost::python::extract<int>(d["dbTag"]);
     currentGeoTag= boost::python::extract<int>(d["currentGeoTag"]);
+    lastNonSPChangeTag= currentGeoTag;
     hasDomainChangedFlag= boost::python::extract<bool>(d["hasDomainChangedFlag"]);
     commitTag= boost::python::extract<int>(d["commitTag"]);
     mesh.setPyDict(boost::python::extract<boost::python::dict>(d["mesh"]));
@@ -1524,6 +1767,8 @@ void XC::Domain::setPyDict(const boost::python::dict &d)
       this->paramIndex.push_back(boost::python::extract<int>(param_index[i]));
     this->lastChannel= boost::python::extract<int>(d["lastChannel"]);
     this->lastGeoSendTag= boost::python::extract<int>(d["lastGeoSendTag"]);
+    if(d.has_key("numberingCache"))
+      numberingCache.setPyDict(boost::python::extract<boost::python::dict>(d["numberingCache"]));
   }
 
 //! @brief Sends object through the communicator argument.
@@ -65,6 +65,7 @@
 
 #include "utility/recorder/ObjWithRecorders.h"
 #include "PseudoTimeTracker.h"
+#include "DOF_NumberingCache.h"
 #include "../mesh/Mesh.h"
 #include "../constraints/ConstrContainer.h"
 #include "utility/matrix/Vector.h"
@@ -90,6 +91,7 @@ class NodeGraph;
 class ElementGraph;
 class FEM_ObjectBroker;
 class RayleighDampingFactors;
+class MemoryDatastore;
 
 //!  @defgroup Dom Domain of the finite element problem.
 //
@@ -123,6 +125,9 @@ class Domain: public ObjWithRecorders, public DistributedBase
     int dbTag; //!< Tag for the database.
     int currentGeoTag; //!< an integer used to mark if domain has changed
     bool hasDomainChangedFlag; //!< a bool flag used to indicate if GeoTag needs to be ++
+    bool onlySPsChangedFlag; //!< true if the pending change only affects single freedom constraints.
+    int lastNonSPChangeTag; //!< value of currentGeoTag at the last change that was not SP-only.
+    int modelStamp; //!< incremented each time the properties of the model may have changed (see modelChange).
     int commitTag;
     Mesh mesh; //!< Nodes and element container.
     ConstrContainer constraints;//!< Constraint container.
@@ -138,6 +143,21 @@ class Domain: public ObjWithRecorders, public DistributedBase
     int lastChannel;
     int lastGeoSendTag; //!< the value of currentGeoTag when sendSelf was last invoked
 
+    //! @brief Data of a state snapshot.
+    struct SnapshotData
+      {
+        int storeTag; //!< commit tag used to store the snapshot.
+        int geoTag; //!< value of currentGeoTag when the snapshot was taken.
+        int commitTag; //!< value of commitTag when the snapshot was taken.
+      };
+    MemoryDatastore *snapshotStore; //!< in-memory storage for the snapshots.
+    std::map<std::string, SnapshotData> snapshots; //!< named snapshots.
+    int lastSnapshotTag; //!< last commit tag used to store a snapshot.
+    static FEM_ObjectBroker theSnapshotBroker; //!< object broker for the snapshot storage.
+    DOF_NumberingCache numberingCache; //!< DOF orderings reused by successive analyses.
+    int send_state(Communicator &);
+    int recv_state(const Communicator &);
+
     void alloc_containers(void);
     void alloc_iters(void);
     bool check_containers(void) const;
@@ -159,7 +179,9 @@ class Domain: public ObjWithRecorders, public DistributedBase
 
     // methods to populate a domain
     virtual bool addElement(Element *);
+    virtual bool addElements(const std::vector<Element *> &);
     virtual bool addNode(Node *);
+    virtual bool addNodes(const std::vector<Node *> &);
     virtual bool addSFreedom_Constraint(SFreedom_Constraint *);
     virtual bool addMFreedom_Constraint(MFreedom_Constraint *);
     virtual bool addMRMFreedom_Constraint(MRMFreedom_Constraint *);
@@ -289,6 +311,22 @@ class Domain: public ObjWithRecorders, public DistributedBase
 
     void resetLoadCase(void);
 
+     // methods to store and restore the state of the domain
+    int saveSnapshot(const std::string &);
+    int restoreSnapshot(const std::string &);
+    bool hasSnapshot(const std::string &) const;
+    bool removeSnapshot(const std::string &);
+    void clearSnapshots(void);
+    boost::python::list getSnapshotNames(void) const;
+    size_t getSnapshotsSize(void) const;
+
+    //! @brief Return the cache of DOF orderings.
+    inline DOF_NumberingCache &getNumberingCache(void)
+      { return numberingCache; }
+    //! @brief Return the cache of DOF orderings.
+    inline const DOF_NumberingCache &getNumberingCache(void) const
+      { return numberingCache; }
+
      // methods for eigenvalue analysis
     int getNumModes(void) const;
     virtual int setEigenvalues(const Vector &);
@@ -317,8 +355,19 @@ class Domain: public ObjWithRecorders, public DistributedBase
 
      // methods for other objects to determine if model has changed
     virtual void domainChange(void);
+    virtual void spConstraintsChange(void);
     virtual int hasDomainChanged(void);
+    //! @brief Return the stamp of the last change that affected
+    //! something else than the single freedom constraints.
+    inline int getLastNonSPChangeStamp(void) const
+      { return lastNonSPChangeTag; }
     virtual void setDomainChangeStamp(int newStamp);
+    void modelChange(void);
+    //! @brief Return the stamp of the last time the properties of the
+    //! model (materials, sections, nodal coordinates,...) may have
+    //! changed (see modelChange).
+    inline int getModelStamp(void) const
+      { return modelStamp; }
 
     virtual int addRegion(MeshRegion &theRegion);
     virtual MeshRegion *getRegion(int region);
@@ -255,6 +255,16 @@ bool XC::PartitionedDomain::addElement(Element *elePtr)
 
 //! Adds the node pointed to by theNodePtr to the domain.
 //!
+//! @brief Adds the elements one by one, so the subdomains are
+//! processed as in addElement.
+bool XC::PartitionedDomain::addElements(const std::vector<Element *> &elements)
+  {
+    bool retval= true;
+    for(std::vector<Element *>::const_iterator i= elements.begin(); i!= elements.end(); i++)
+      retval= addElement(*i) && retval;
+    return retval;
+  }
+
 //! Adds the node pointed to by theNodePtr to the domain. If \p check
 //! is \p true the domain is responsible for checking that no other
 //! node with a similar tag, node number, exists in any of the
@@ -121,6 +121,7 @@ class PartitionedDomain: public Domain
 
     // public methods to populate a domain	
     virtual  bool addElement(Element *elePtr);
+    virtual  bool addElements(const std::vector<Element *> &);
     virtual  bool addNode(Node *nodePtr);
 
     virtual  bool addLoadPattern(LoadPattern *);            
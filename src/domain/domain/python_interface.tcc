@@ -30,7 +30,16 @@ class_<XC::PseudoTimeTracker, bases<XC::MovableObject>, boost::noncopyable >("Ps
   
   ;
 
+class_<XC::DOF_NumberingCache, bases<XC::CommandEntity>, boost::noncopyable >("DOF_NumberingCache", no_init)
+  .add_property("enabled", &XC::DOF_NumberingCache::isEnabled, &XC::DOF_NumberingCache::setEnabled,"if true, the DOF orderings are stored and reused by the next analyses while the topology of the domain doesn't change.")
+  .add_property("numEntries", &XC::DOF_NumberingCache::getNumEntries,"return the number of stored orderings.")
+  .add_property("numHits", &XC::DOF_NumberingCache::getNumHits,"return the number of times a stored ordering has been reused.")
+  .add_property("numMisses", &XC::DOF_NumberingCache::getNumMisses,"return the number of times the ordering had to be computed.")
+  .def("clear", &XC::DOF_NumberingCache::clear,"remove the stored orderings and reset the counters.")
+  ;
+
 XC::Mesh &(XC::Domain::*getMeshRef)(void)= &XC::Domain::getMesh;
+XC::DOF_NumberingCache &(XC::Domain::*getNumberingCacheRef)(void)= &XC::Domain::getNumberingCache;
 XC::Preprocessor *(XC::Domain::*getPreprocessor)(void)= &XC::Domain::getPreprocessor;
 XC::ConstrContainer &(XC::Domain::*getConstraintsRef)(void)= &XC::Domain::getConstraints;
 XC::Node *(XC::Domain::*getNode)(int)= &XC::Domain::getNode;
@@ -45,6 +54,8 @@ class_<XC::Domain, bases<XC::ObjWithRecorders>, boost::noncopyable >("Domain", n
   .add_property("mesh", make_function( getMeshRef, return_internal_reference<>() ),"returns finite element mesh.")
   .add_property("getConstraints", make_function( getConstraintsRef, return_internal_reference<>() ),"returns mesh constraints.")
   .add_property("getTimeTracker", make_function( get_time_tracker, return_internal_reference<>() ),"returns the pseudo-time tracker of the domain.")
+  .def("modelChange", &XC::Domain::modelChange,"notify that the properties of the model (materials, sections, nodal coordinates...) have changed; call it if they are modified during an analysis from code that is not run by a recorder.")
+  .add_property("modelStamp", &XC::Domain::getModelStamp,"return the stamp of the last time the properties of the model may have changed.")
   .add_property("currentTime", &XC::Domain::getCurrentTime, &XC::Domain::setCurrentTime, "returns the current value of the pseudo-time.")
   .add_property("committedTime", &XC::Domain::getCommittedTime, &XC::Domain::setCommittedTime, "returns the committed value of the pseudo-time.")
   .add_property("currentCombinationName", &XC::Domain::getCurrentCombinationName,"returns current combination/load case name.")
@@ -52,6 +63,14 @@ class_<XC::Domain, bases<XC::ObjWithRecorders>, boost::noncopyable >("Domain", n
   .def("commit",&XC::Domain::commit)
   .def("revertToLastCommit",&XC::Domain::revertToLastCommit)
   .def("revertToStart",&XC::Domain::revertToStart)  
+  .def("saveSnapshot",&XC::Domain::saveSnapshot,"saveSnapshot(name): store the current state of the domain in memory with the given name.")
+  .def("restoreSnapshot",&XC::Domain::restoreSnapshot,"restoreSnapshot(name): return the domain to the state stored with the given name.")
+  .def("hasSnapshot",&XC::Domain::hasSnapshot,"hasSnapshot(name): return true if a snapshot with the given name exists.")
+  .def("removeSnapshot",&XC::Domain::removeSnapshot,"removeSnapshot(name): remove the snapshot with the given name.")
+  .def("clearSnapshots",&XC::Domain::clearSnapshots,"remove all the snapshots.")
+  .def("getSnapshotNames",&XC::Domain::getSnapshotNames,"return the names of the stored snapshots.")
+  .add_property("snapshotsSize",&XC::Domain::getSnapshotsSize,"return the memory used to store the snapshots (in bytes).")
+  .add_property("numberingCache", make_function( getNumberingCacheRef, return_internal_reference<>() ),"return the cache of DOF orderings reused by successive analyses.")
   .def("setLoadConstant", set_load_constant,"Sets currents load patterns as constant in time.")  
   .def("setLoadConstant", set_load_constant_t,"Sets currents load patterns as constant in time, and the domain time to the given value.")  
   .def("setTime",&XC::Domain::setTime,"sets the time on the time tracker.")
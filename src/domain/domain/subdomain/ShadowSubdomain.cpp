@@ -296,6 +296,24 @@ bool XC::ShadowSubdomain::addElement(Element *theEle)
     return true;
   }
 
+//! @brief Sends the elements one by one (see addElement).
+bool XC::ShadowSubdomain::addElements(const std::vector<Element *> &elements)
+  {
+    bool retval= true;
+    for(std::vector<Element *>::const_iterator i= elements.begin(); i!= elements.end(); i++)
+      retval= addElement(*i) && retval;
+    return retval;
+  }
+
+//! @brief Sends the nodes one by one (see addNode).
+bool XC::ShadowSubdomain::addNodes(const std::vector<Node *> &nodes)
+  {
+    bool retval= true;
+    for(std::vector<Node *>::const_iterator i= nodes.begin(); i!= nodes.end(); i++)
+      retval= addNode(*i) && retval;
+    return retval;
+  }
+
 bool XC::ShadowSubdomain::addNode(Node *theNode)
   {
     int tag = theNode->getTag();
@@ -130,7 +130,9 @@ class ShadowSubdomain: public Shadow, public Subdomain
     // which must be rewritten
 
     virtual  bool addElement(Element *);
+    virtual  bool addElements(const std::vector<Element *> &);
     virtual  bool addNode(Node *);
+    virtual  bool addNodes(const std::vector<Node *> &);
     virtual  bool addExternalNode(Node *);
     virtual  bool addSFreedom_Constraint(SFreedom_Constraint *);
     virtual  bool addMFreedom_Constraint(MFreedom_Constraint *);    
@@ -187,6 +187,15 @@ bool XC::Subdomain::addNode(Node *node)
     return result;
   }
 
+//! @brief Adds the nodes one by one as internal nodes (see addNode).
+bool XC::Subdomain::addNodes(const std::vector<Node *> &nodes)
+  {
+    bool retval= true;
+    for(std::vector<Node *>::const_iterator i= nodes.begin(); i!= nodes.end(); i++)
+      retval= addNode(*i) && retval;
+    return retval;
+  }
+
 //! A Method to add the node pointed to by the argument.
 //!
 //! A Method to add the node pointed to by \p thePtr to the
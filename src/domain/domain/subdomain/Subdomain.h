@@ -140,6 +140,7 @@ class Subdomain: public Element, public Domain
     // Domain methods which must be rewritten
     virtual void clearAll(void);
     virtual bool addNode(Node *);
+    virtual bool addNodes(const std::vector<Node *> &);
     virtual bool removeNode(int tag);
     virtual NodeIter &getNodes(void);
     virtual const Node *getNode(int tag) const;
@@ -40,8 +40,7 @@
 #include <domain/domain/single/SingleDomEleIter.h>
 #include <domain/domain/single/SingleDomNodIter.h>
 
-#include <utility/tagged/storage/MapOfTaggedObjects.h>
-#include <utility/tagged/storage/MapOfTaggedObjectsIter.h>
+#include <utility/tagged/storage/VectorOfTaggedObjects.h>
 
 #include <solution/graph/graph/Vertex.h>
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
@@ -52,6 +51,7 @@
 #include "utility/actor/actor/MovableVector.h"
 #include "utility/tagged/DefaultTag.h"
 #include "utility/utils/misc_utils/colormod.h"
+#include "utility/matrix/ID.h"
 
 
 const double XC::Mesh::reactionValueThreshold= 1.0e-6; //Reactions with norm under this value can be considered zero.
@@ -83,8 +83,9 @@ void XC::Mesh::free_mem(void)
 void XC::Mesh::alloc_containers(void)
   {
     // init the arrays for storing the mesh components
-    theNodes= new MapOfTaggedObjects(this,"node");
-    theElements= new MapOfTaggedObjects(this,"element");
+    // (dense vectors with tag lookup through a hash table).
+    theNodes= new VectorOfTaggedObjects(this,"node");
+    theElements= new VectorOfTaggedObjects(this,"element");
   }
 
 //! @brief Allocates memory for iterators.
@@ -117,7 +118,9 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   theBounds(6), lockers(this),
+   contiguousNodalStorage(false), nodalStoreDirty(false),
+   dispStore(4), velStore(2), accelStore(2)
   {
     alloc_containers();
     alloc_iters();
@@ -129,7 +132,9 @@ XC::Mesh::Mesh(CommandEntity *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this),
+   contiguousNodalStorage(false), nodalStoreDirty(false),
+   dispStore(4), velStore(2), accelStore(2)
   {
     // init the iters
     alloc_iters();
@@ -149,7 +154,9 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObj
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    theBounds(6), lockers(this),
+   contiguousNodalStorage(false), nodalStoreDirty(false),
+   dispStore(4), velStore(2), accelStore(2)
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -182,6 +189,12 @@ void XC::Mesh::clearAll(void)
     // Node::getDefaultTag().setTag(0);
     lockers.clearAll();
 
+    // the nodes are gone, so is their storage.
+    dispStore.clear();
+    velStore.clear();
+    accelStore.clear();
+    nodalStoreDirty= contiguousNodalStorage;
+
     // set the bounds around the origin
     theBounds.Zero();
 
@@ -272,6 +285,63 @@ bool XC::Mesh::addElement(Element *element)
     return result;
   }
 
+//! @brief Appends a batch of elements to the mesh.
+//!
+//! Same as addElement but the domain is marked as changed only
+//! once and the k-d tree is updated in a single pass (see
+//! KDTreeElements::insert), which is much cheaper when a whole
+//! structured mesh is added. Returns false if any of the elements
+//! can't be added.
+bool XC::Mesh::addElements(const std::vector<Element *> &elements)
+  {
+    bool retval= true;
+    Domain *dom= getDomain();
+    std::vector<const Element *> added;
+    added.reserve(elements.size());
+    for(std::vector<Element *>::const_iterator i= elements.begin(); i!= elements.end(); i++)
+      {
+        Element *element= *i;
+	if(!element)
+	  {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; pointer to element is null."
+		      << Color::def << std::endl;
+	    retval= false;
+	    continue;
+	  }
+	const int eleTag= element->getTag();
+	if(theElements->getComponentPtr(eleTag))
+	  {
+	    std::clog << getClassName() << "::" << __FUNCTION__
+		      << "; element with tag " << eleTag
+		      << " already exists in model."
+		      << Color::def << std::endl;
+	    retval= false;
+	    continue;
+	  }
+	if(theElements->addComponent(element))
+	  {
+	    element->setDomain(dom);
+	    element->update();
+	    added.push_back(element);
+	  }
+	else
+	  {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; element " << eleTag
+		      << " could not be added to container."
+		      << Color::def << std::endl;
+	    retval= false;
+	  }
+      }
+    if(!added.empty())
+      {
+        dom->domainChange();
+        kdtreeElements.insert(added);
+      }
+    return retval;
+  }
+
 //! @brief Update the domain boundary.
 void XC::Mesh::update_bounds(const Vector &crds)
   {
@@ -346,7 +416,11 @@ bool XC::Mesh::addNode(Node * node)
       }
     bool result= theNodes->addComponent(node);
     if(result)
-      add_node_to_domain(node);
+      {
+        add_node_to_domain(node);
+        if(contiguousNodalStorage)
+          nodalStoreDirty= true; // bind the new node before the next commit.
+      }
     else
       std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
 	        << "; node with tag " << nodTag
@@ -356,6 +430,64 @@ bool XC::Mesh::addNode(Node * node)
   }
 
 
+//! @brief Appends a batch of nodes to the mesh.
+//!
+//! Same as addNode but the domain is marked as changed only once
+//! and the k-d tree is updated in a single pass (see
+//! KDTreeNodes::insert). Returns false if any of the nodes can't
+//! be added.
+bool XC::Mesh::addNodes(const std::vector<Node *> &nodes)
+  {
+    bool retval= true;
+    Domain *dom= getDomain();
+    std::vector<const Node *> added;
+    added.reserve(nodes.size());
+    for(std::vector<Node *>::const_iterator i= nodes.begin(); i!= nodes.end(); i++)
+      {
+        Node *node= *i;
+	if(!node)
+	  {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; pointer to node is null."
+		      << Color::def << std::endl;
+	    retval= false;
+	    continue;
+	  }
+	const int nodTag= node->getTag();
+	if(theNodes->getComponentPtr(nodTag))
+	  {
+	    std::clog << getClassName() << "::" << __FUNCTION__
+		      << "; node with tag " << nodTag
+		      << " already exists in model."
+		      << Color::def << std::endl;
+	    retval= false;
+	    continue;
+	  }
+	if(theNodes->addComponent(node))
+	  {
+	    node->setDomain(dom);
+	    update_bounds(node->getCrds());
+	    added.push_back(node);
+	  }
+	else
+	  {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; node with tag " << nodTag
+		      << " could not be added to container."
+		      << Color::def << std::endl;
+	    retval= false;
+	  }
+      }
+    if(!added.empty())
+      {
+        dom->domainChange();
+        kdtreeNodes.insert(added);
+        if(contiguousNodalStorage)
+          nodalStoreDirty= true; // bind the new nodes before the next commit.
+      }
+    return retval;
+  }
+
 //! @brief Removes from the domain the element identified by the tag being passed as parameter.
 //!
 //! To remove the element whose tag is given by \p tag from the
@@ -415,7 +547,8 @@ bool XC::Mesh::removeNode(int tag)
       }
     // remove the object from the container
     bool res= theNodes->removeComponent(tag);
-    
+    if(res && contiguousNodalStorage)
+      nodalStoreDirty= true; // leave no holes in the storage.
     return res;
   }
 
@@ -885,14 +1018,205 @@ int XC::Mesh::setRayleighDampingFactors(const RayleighDampingFactors &rF)
     return result;
   }
 
+//! @brief Store the response vectors (displacement, velocity and
+//! acceleration) of all the nodes in mesh-wide contiguous arrays.
+//!
+//! The values already stored in the nodes are preserved. The new
+//! arrays are filled before releasing the old ones so the nodes
+//! bound to them can be rebound without loss of data.
+int XC::Mesh::bind_nodal_storage(void)
+  {
+    int retval= 0;
+    size_t numDOFs= 0;
+    Node *nodePtr= nullptr;
+    NodeIter &theNodeIter= this->getNodes();
+    while((nodePtr = theNodeIter()) != 0)
+      numDOFs+= nodePtr->getNumberDOF();
+
+    NodeVectorsStore newDisp(dispStore.getNumVectors(),numDOFs);
+    NodeVectorsStore newVel(velStore.getNumVectors(),numDOFs);
+    NodeVectorsStore newAccel(accelStore.getNumVectors(),numDOFs);
+    size_t offset= 0;
+    NodeIter &theNodeIter2= this->getNodes();
+    while((nodePtr = theNodeIter2()) != 0)
+      {
+        retval+= nodePtr->bindResponseVectors(newDisp, newVel, newAccel, offset);
+        offset+= nodePtr->getNumberDOF();
+      }
+    // std::swap exchanges the buffers so the node pointers remain valid.
+    std::swap(dispStore,newDisp);
+    std::swap(velStore,newVel);
+    std::swap(accelStore,newAccel);
+    nodalStoreDirty= false;
+    if(retval!=0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+	        << "; some nodes could not be bound to the mesh storage."
+		<< Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Copy back the nodal response vectors from the mesh-wide
+//! arrays to the nodes.
+int XC::Mesh::release_nodal_storage(void)
+  {
+    int retval= 0;
+    Node *nodePtr= nullptr;
+    NodeIter &theNodeIter= this->getNodes();
+    while((nodePtr = theNodeIter()) != 0)
+      retval+= nodePtr->releaseResponseVectors();
+    dispStore.clear();
+    velStore.clear();
+    accelStore.clear();
+    nodalStoreDirty= false;
+    return retval;
+  }
+
+//! @brief Bind the nodes again if they have changed since the
+//! last binding.
+int XC::Mesh::update_nodal_storage(void)
+  {
+    int retval= 0;
+    if(contiguousNodalStorage && nodalStoreDirty)
+      retval= bind_nodal_storage();
+    return retval;
+  }
+
+//! @brief Mark the domain as changed after a change in the order of
+//! the nodes or the elements (the DOFs are numbered again and the
+//! contiguous nodal storage is bound again).
+void XC::Mesh::order_changed(void)
+  {
+    if(contiguousNodalStorage)
+      nodalStoreDirty= true;
+    Domain *dom= getDomain();
+    if(dom)
+      dom->domainChange();
+  }
+
+//! @brief Return the container as a VectorOfTaggedObjects (nullptr and
+//! an error message if it's of another type).
+static XC::VectorOfTaggedObjects *get_vector_storage(XC::TaggedObjectStorage *container, const std::string &methodName)
+  {
+    XC::VectorOfTaggedObjects *retval= dynamic_cast<XC::VectorOfTaggedObjects *>(container);
+    if(!retval)
+      std::cerr << Color::red << "Mesh::" << methodName
+		<< "; the container (" << container->getClassName()
+		<< ") can't be reordered."
+		<< Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Store the nodes in the order given by the argument
+//! (i.e. a locality optimized numbering). The nodes that are not
+//! in the list are placed after them and the nodes created from now
+//! on are appended at the end.
+//! @param tags: tags of the nodes in the new order.
+int XC::Mesh::reorderNodes(const ID &tags)
+  {
+    int retval= -1;
+    VectorOfTaggedObjects *v= get_vector_storage(theNodes, __FUNCTION__);
+    if(v)
+      {
+        retval= v->reorder(tags);
+        order_changed();
+      }
+    return retval;
+  }
+
+//! @brief Store the elements in the order given by the argument
+//! (i.e. a locality optimized numbering). The elements that are not
+//! in the list are placed after them and the elements created from now
+//! on are appended at the end.
+//! @param tags: tags of the elements in the new order.
+int XC::Mesh::reorderElements(const ID &tags)
+  {
+    int retval= -1;
+    VectorOfTaggedObjects *v= get_vector_storage(theElements, __FUNCTION__);
+    if(v)
+      {
+        retval= v->reorder(tags);
+        order_changed();
+      }
+    return retval;
+  }
+
+//! @brief If true, the nodes are iterated in increasing tag order
+//! (default), otherwise they are iterated in insertion order (or in
+//! the order given to reorderNodes).
+void XC::Mesh::setNodesSortedByTag(const bool &b)
+  {
+    VectorOfTaggedObjects *v= get_vector_storage(theNodes, __FUNCTION__);
+    if(v && (v->isSortedByTag()!=b))
+      {
+        v->setSortedByTag(b);
+        order_changed();
+      }
+  }
+
+//! @brief Return true if the nodes are iterated in increasing tag order.
+bool XC::Mesh::getNodesSortedByTag(void) const
+  {
+    const VectorOfTaggedObjects *v= dynamic_cast<const VectorOfTaggedObjects *>(theNodes);
+    return (!v || v->isSortedByTag());
+  }
+
+//! @brief If true, the elements are iterated in increasing tag order
+//! (default), otherwise they are iterated in insertion order (or in
+//! the order given to reorderElements).
+void XC::Mesh::setElementsSortedByTag(const bool &b)
+  {
+    VectorOfTaggedObjects *v= get_vector_storage(theElements, __FUNCTION__);
+    if(v && (v->isSortedByTag()!=b))
+      {
+        v->setSortedByTag(b);
+        order_changed();
+      }
+  }
+
+//! @brief Return true if the elements are iterated in increasing tag order.
+bool XC::Mesh::getElementsSortedByTag(void) const
+  {
+    const VectorOfTaggedObjects *v= dynamic_cast<const VectorOfTaggedObjects *>(theElements);
+    return (!v || v->isSortedByTag());
+  }
+
+//! @brief Activate/deactivate the storage of the nodal response vectors
+//! (displacement, velocity and acceleration) in mesh-wide contiguous
+//! arrays.
+//!
+//! When activated, the commit and revert operations are made
+//! on the whole arrays instead of node by node.
+//! @param b: if true store the vectors in the mesh-wide arrays.
+void XC::Mesh::setContiguousNodalStorage(const bool &b)
+  {
+    if(b!=contiguousNodalStorage)
+      {
+        contiguousNodalStorage= b;
+        if(contiguousNodalStorage)
+          bind_nodal_storage();
+        else
+          release_nodal_storage();
+      }
+  }
+
 //! @brief Commits mesh state.
 int XC::Mesh::commit(void)
   {
     // invoke commit on all nodes and elements in the mesh
-    Node *nodePtr= nullptr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      { nodePtr->commitState(); }
+    update_nodal_storage();
+    if(contiguousNodalStorage)
+      {
+        dispStore.commitState();
+        velStore.commitState();
+        accelStore.commitState();
+      }
+    else
+      {
+        Node *nodePtr= nullptr;
+        NodeIter &theNodeIter = this->getNodes();
+        while((nodePtr = theNodeIter()) != 0)
+          { nodePtr->commitState(); }
+      }
 
     Element *elePtr= nullptr;
     ElementIter &theElemIter = this->getElements();
@@ -911,8 +1235,18 @@ int XC::Mesh::revertToLastCommit(void)
 
     Node *nodePtr;
     NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToLastCommit();
+    update_nodal_storage();
+    if(contiguousNodalStorage)
+      {
+        dispStore.revertToLastCommit();
+        velStore.revertToLastCommit();
+        accelStore.revertToLastCommit();
+        while((nodePtr = theNodeIter()) != 0)
+          nodePtr->zeroReactionAndUnbalancedLoad(false);
+      }
+    else
+      while((nodePtr = theNodeIter()) != 0)
+        nodePtr->revertToLastCommit();
 
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();
@@ -932,8 +1266,18 @@ int XC::Mesh::revertToStart(void)
 
     Node *nodePtr;
     NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToStart();
+    update_nodal_storage();
+    if(contiguousNodalStorage)
+      {
+        dispStore.revertToStart();
+        velStore.revertToStart();
+        accelStore.revertToStart();
+        while((nodePtr = theNodeIter()) != 0)
+          nodePtr->zeroReactionAndUnbalancedLoad(true);
+      }
+    else
+      while((nodePtr = theNodeIter()) != 0)
+        nodePtr->revertToStart();
 
     Element *elePtr;
     ElementIter &theElements = this->getElements();
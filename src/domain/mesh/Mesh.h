@@ -35,6 +35,7 @@
 #include "NodeLockers.h"
 #include "solution/graph/graph/Graph.h"
 #include "node/KDTreeNodes.h"
+#include "node/NodeVectorsStore.h"
 #include "element/utils/KDTreeElements.h"
 
 class Pos3d;
@@ -54,6 +55,7 @@ class ElementGraph;
 class FEM_ObjectBroker;
 class TaggedObjectStorage;
 class RayleighDampingFactors;
+class ID;
 
 //! @ingroup Dom
 //
@@ -87,6 +89,12 @@ class Mesh: public MeshComponentContainer
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
 
+    bool contiguousNodalStorage; //!< if true, nodal response vectors are stored in the arrays below.
+    bool nodalStoreDirty; //!< if true, nodes have been added or removed since the last binding.
+    NodeVectorsStore dispStore; //!< mesh-wide storage for nodal displacements.
+    NodeVectorsStore velStore; //!< mesh-wide storage for nodal velocities.
+    NodeVectorsStore accelStore; //!< mesh-wide storage for nodal accelerations.
+
     void alloc_containers(void);
     void alloc_iters(void);
     bool check_containers(void) const;
@@ -96,6 +104,10 @@ class Mesh: public MeshComponentContainer
     void add_element_to_domain(Element *);
     void add_nodes_to_domain(void);
     void add_elements_to_domain(void);
+    int bind_nodal_storage(void);
+    int release_nodal_storage(void);
+    int update_nodal_storage(void);
+    void order_changed(void);
 
     Mesh(const Mesh &other);
     Mesh &operator=(const Mesh &other);
@@ -112,10 +124,12 @@ class Mesh: public MeshComponentContainer
 
     // methods to populate a mesh
     virtual bool addNode(Node *);
+    virtual bool addNodes(const std::vector<Node *> &);
     virtual bool removeNode(int tag);
     bool remove(Node *);
 
     virtual bool addElement(Element *);
+    virtual bool addElements(const std::vector<Element *> &);
     virtual bool removeElement(int tag);
     bool remove(Element *);
 
@@ -185,6 +199,19 @@ class Mesh: public MeshComponentContainer
     virtual Graph &getElementGraph(void);
     virtual Graph &getNodeGraph(void);
 
+    int reorderNodes(const ID &);
+    int reorderElements(const ID &);
+    void setNodesSortedByTag(const bool &);
+    bool getNodesSortedByTag(void) const;
+    void setElementsSortedByTag(const bool &);
+    bool getElementsSortedByTag(void) const;
+
+    void setContiguousNodalStorage(const bool &);
+    //! @brief Return true if the nodal response vectors are stored
+    //! in mesh-wide contiguous arrays.
+    inline bool getContiguousNodalStorage(void) const
+      { return contiguousNodalStorage; }
+
     virtual int commit(void);
     virtual int revertToLastCommit(void);
     virtual int revertToStart(void);
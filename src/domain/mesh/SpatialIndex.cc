@@ -0,0 +1,562 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SpatialIndex.cc
+
+#include "SpatialIndex.h"
+#include "domain/mesh/Mesh.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/ElementIter.h"
+#include "domain/mesh/element/utils/ParticlePos3d.h"
+#include "preprocessor/set_mgmt/SetMeshComp.h"
+#include "utility/geom/pos_vec/Pos3d.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include "utility/utils/misc_utils/colormod.h"
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <map>
+#include <set>
+#include <limits>
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//! @brief Default constructor.
+XC::SpatialIndex::SpatialIndex(void)
+  : CommandEntity(), initialGeometry(true), numThreads(0) {}
+
+//! @brief Remove the indexed nodes and elements.
+void XC::SpatialIndex::clear(void)
+  {
+    nodes.clear();
+    nodeCoords.clear();
+    nodeTree.clear();
+    elements.clear();
+    elementBoxes.clear();
+    elementTree.clear();
+  }
+
+//! @brief Index the nodes and elements of the given set.
+void XC::SpatialIndex::setSet(SetMeshComp &s)
+  {
+    clear();
+    const DqPtrsNode &setNodes= s.getNodes();
+    nodes.reserve(setNodes.size());
+    for(DqPtrsNode::const_iterator i= setNodes.begin(); i!=setNodes.end(); i++)
+      nodes.push_back(*i);
+    DqPtrsElem &setElements= s.getElements();
+    elements.reserve(setElements.size());
+    for(DqPtrsElem::iterator i= setElements.begin(); i!=setElements.end(); i++)
+      elements.push_back(*i);
+    build();
+  }
+
+//! @brief Index the nodes and elements of the whole mesh.
+void XC::SpatialIndex::setMesh(Mesh &mesh)
+  {
+    clear();
+    Node *nodePtr= nullptr;
+    NodeIter &theNodeIter= mesh.getNodes();
+    while((nodePtr= theNodeIter()) != nullptr)
+      nodes.push_back(nodePtr);
+    Element *elemPtr= nullptr;
+    ElementIter &theElemIter= mesh.getElements();
+    while((elemPtr= theElemIter()) != nullptr)
+      elements.push_back(elemPtr);
+    build();
+  }
+
+//! @brief Build recursively the tree for the items in [begin, end).
+//!
+//! The items are split at the median of the centers of their bounding
+//! boxes along the direction in which the centers spread the most.
+//! @param tree: tree to build.
+//! @param perm: item order (reordered so each tree node spans a range).
+//! @param boxes: bounding boxes of the items (6 values for each one).
+int XC::SpatialIndex::build_tree(tree_type &tree, std::vector<size_t> &perm, const std::vector<double> &boxes, const size_t &begin, const size_t &end)
+  {
+    const int retval= tree.size();
+    tree.push_back(TreeNode());
+    double bounds[6]= {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()};
+    double centerMin[3]= {bounds[0], bounds[1], bounds[2]};
+    double centerMax[3]= {bounds[3], bounds[4], bounds[5]};
+    for(size_t i= begin; i<end; i++)
+      {
+        const double *b= &boxes[6*perm[i]];
+        for(size_t k= 0; k<3; k++)
+	  {
+	    bounds[k]= std::min(bounds[k], b[k]);
+	    bounds[k+3]= std::max(bounds[k+3], b[k+3]);
+	    const double c= 0.5*(b[k]+b[k+3]);
+	    centerMin[k]= std::min(centerMin[k], c);
+	    centerMax[k]= std::max(centerMax[k], c);
+	  }
+      }
+    int left= -1, right= -1;
+    if(end-begin>leafSize)
+      {
+        size_t axis= 0;
+	for(size_t k= 1; k<3; k++)
+	  if(centerMax[k]-centerMin[k] > centerMax[axis]-centerMin[axis])
+	    axis= k;
+	const size_t mid= begin+(end-begin)/2;
+	std::nth_element(perm.begin()+begin, perm.begin()+mid, perm.begin()+end,
+			 [&boxes, axis](const size_t &a, const size_t &b)
+			 { return (boxes[6*a+axis]+boxes[6*a+axis+3]) < (boxes[6*b+axis]+boxes[6*b+axis+3]); });
+	left= build_tree(tree, perm, boxes, begin, mid);
+	right= build_tree(tree, perm, boxes, mid, end);
+      }
+    TreeNode &node= tree[retval]; // tree may have been reallocated.
+    std::copy(bounds, bounds+6, node.bounds);
+    node.begin= begin;
+    node.end= end;
+    node.left= left;
+    node.right= right;
+    return retval;
+  }
+
+//! @brief Build the trees for the nodes and the elements.
+void XC::SpatialIndex::build(void)
+  {
+    // Nodes.
+    const size_t numNodes= nodes.size();
+    std::vector<double> boxes(6*numNodes);
+    for(size_t i= 0; i<numNodes; i++)
+      {
+        const Pos3d p= (initialGeometry ? nodes[i]->getInitialPosition3d() : nodes[i]->getCurrentPosition3d());
+	for(size_t k= 0; k<3; k++)
+	  { boxes[6*i+k]= p(k+1); boxes[6*i+k+3]= p(k+1); }
+      }
+    std::vector<size_t> perm(numNodes);
+    std::iota(perm.begin(), perm.end(), 0);
+    if(numNodes>0)
+      build_tree(nodeTree, perm, boxes, 0, numNodes);
+    std::vector<const Node *> sortedNodes(numNodes);
+    nodeCoords.resize(3*numNodes);
+    for(size_t i= 0; i<numNodes; i++)
+      {
+        sortedNodes[i]= nodes[perm[i]];
+	for(size_t k= 0; k<3; k++)
+	  nodeCoords[3*i+k]= boxes[6*perm[i]+k];
+      }
+    nodes.swap(sortedNodes);
+
+    // Elements.
+    const size_t numElements= elements.size();
+    boxes.assign(6*numElements, 0.0);
+    for(size_t i= 0; i<numElements; i++)
+      {
+        double *b= &boxes[6*i];
+	b[0]= b[1]= b[2]= std::numeric_limits<double>::max();
+	b[3]= b[4]= b[5]= -std::numeric_limits<double>::max();
+	const std::deque<Pos3d> positions= elements[i]->getPosNodes(initialGeometry);
+	for(std::deque<Pos3d>::const_iterator j= positions.begin(); j!= positions.end(); j++)
+	  for(size_t k= 0; k<3; k++)
+	    {
+	      b[k]= std::min(b[k], (*j)(k+1));
+	      b[k+3]= std::max(b[k+3], (*j)(k+1));
+	    }
+      }
+    perm.resize(numElements);
+    std::iota(perm.begin(), perm.end(), 0);
+    if(numElements>0)
+      build_tree(elementTree, perm, boxes, 0, numElements);
+    std::vector<Element *> sortedElements(numElements);
+    elementBoxes.resize(6*numElements);
+    for(size_t i= 0; i<numElements; i++)
+      {
+        sortedElements[i]= elements[perm[i]];
+	std::copy(&boxes[6*perm[i]], &boxes[6*perm[i]]+6, &elementBoxes[6*i]);
+      }
+    elements.swap(sortedElements);
+  }
+
+//! @brief Return the number of threads to use in the queries.
+int XC::SpatialIndex::get_num_threads(void) const
+  {
+    int retval= 1;
+#ifdef _OPENMP
+    retval= (numThreads>0) ? numThreads : omp_get_max_threads();
+#endif
+    return retval;
+  }
+
+//! @brief Read the i-th row of the matrix as a position (the third
+//! coordinate is zero if the matrix has only two columns).
+void XC::SpatialIndex::get_position(const Matrix &positions, const size_t &i, double *p)
+  {
+    const size_t nc= std::min(positions.noCols(), 3);
+    p[0]= p[1]= p[2]= 0.0;
+    for(size_t k= 0; k<nc; k++)
+      p[k]= positions(i,k);
+  }
+
+//! @brief Return the squared distance from the point to the box.
+double XC::SpatialIndex::box_dist2(const double *p, const double *bounds)
+  {
+    double retval= 0.0;
+    for(size_t k= 0; k<3; k++)
+      {
+        double d= 0.0;
+	if(p[k]<bounds[k])
+	  d= bounds[k]-p[k];
+	else if(p[k]>bounds[k+3])
+	  d= p[k]-bounds[k+3];
+	retval+= d*d;
+      }
+    return retval;
+  }
+
+//! @brief Compute the k nearest nodes to the given point.
+//! @param p: point coordinates.
+//! @param k: number of nodes to find.
+//! @param result: (squared distance, node index) pairs sorted by distance.
+void XC::SpatialIndex::k_nearest(const double *p, const size_t &k, std::vector<std::pair<double, size_t> > &result) const
+  {
+    result.clear();
+    if(k==0) // nothing to search (and best.top() below needs k>0).
+      return;
+    typedef std::pair<double, size_t> item;
+    std::priority_queue<item> best; // max-heap: farthest candidate on top.
+    std::vector<int> stack;
+    if(!nodeTree.empty())
+      stack.push_back(0);
+    while(!stack.empty())
+      {
+        const TreeNode &node= nodeTree[stack.back()];
+	stack.pop_back();
+	if((best.size()==k) && (box_dist2(p, node.bounds)>best.top().first))
+	  continue;
+	if(node.left<0) // leaf.
+	  {
+	    for(size_t i= node.begin; i<node.end; i++)
+	      {
+		const double *q= &nodeCoords[3*i];
+		const double d2= (p[0]-q[0])*(p[0]-q[0])+(p[1]-q[1])*(p[1]-q[1])+(p[2]-q[2])*(p[2]-q[2]);
+		if(best.size()<k)
+		  best.push(item(d2, i));
+		else if(d2<best.top().first)
+		  {
+		    best.pop();
+		    best.push(item(d2, i));
+		  }
+	      }
+	  }
+	else // visit first the nearest child.
+	  {
+	    const double dl= box_dist2(p, nodeTree[node.left].bounds);
+	    const double dr= box_dist2(p, nodeTree[node.right].bounds);
+	    if(dl<dr)
+	      { stack.push_back(node.right); stack.push_back(node.left); }
+	    else
+	      { stack.push_back(node.left); stack.push_back(node.right); }
+	  }
+      }
+    result.resize(best.size());
+    for(size_t i= best.size(); i>0; i--)
+      {
+        result[i-1]= best.top();
+	best.pop();
+      }
+  }
+
+//! @brief Compute the indexes of the nodes inside the sphere with
+//! center p and radius r.
+void XC::SpatialIndex::in_radius(const double *p, const double &r, std::vector<size_t> &result) const
+  {
+    result.clear();
+    const double r2= r*r;
+    std::vector<int> stack;
+    if(!nodeTree.empty())
+      stack.push_back(0);
+    while(!stack.empty())
+      {
+        const TreeNode &node= nodeTree[stack.back()];
+	stack.pop_back();
+	if(box_dist2(p, node.bounds)>r2)
+	  continue;
+	if(node.left<0) // leaf.
+	  {
+	    for(size_t i= node.begin; i<node.end; i++)
+	      {
+		const double *q= &nodeCoords[3*i];
+		const double d2= (p[0]-q[0])*(p[0]-q[0])+(p[1]-q[1])*(p[1]-q[1])+(p[2]-q[2])*(p[2]-q[2]);
+		if(d2<=r2)
+		  result.push_back(i);
+	      }
+	  }
+	else
+	  { stack.push_back(node.left); stack.push_back(node.right); }
+      }
+  }
+
+//! @brief Compute the indexes of the elements whose bounding box
+//! (enlarged by tol) contains the point.
+void XC::SpatialIndex::element_candidates(const double *p, const double &tol, std::vector<size_t> &result) const
+  {
+    result.clear();
+    const double tol2= tol*tol;
+    std::vector<int> stack;
+    if(!elementTree.empty())
+      stack.push_back(0);
+    while(!stack.empty())
+      {
+        const TreeNode &node= elementTree[stack.back()];
+	stack.pop_back();
+	if(box_dist2(p, node.bounds)>tol2)
+	  continue;
+	if(node.left<0) // leaf.
+	  {
+	    for(size_t i= node.begin; i<node.end; i++)
+	      if(box_dist2(p, &elementBoxes[6*i])<=tol2)
+		result.push_back(i);
+	  }
+	else
+	  { stack.push_back(node.left); stack.push_back(node.right); }
+      }
+  }
+
+//! @brief Compute the k nearest nodes to each of the positions.
+//! @param positions: coordinates of the points (one row for each point).
+//! @param k: number of nodes to search for each point.
+//! @param tags: (output) tags of the nodes sorted by distance (one row
+//!              for each point, -1 if there are less than k nodes).
+//! @param distances: (output) distances to those nodes.
+void XC::SpatialIndex::getKNearestNodes(const Matrix &positions, const size_t &k, Matrix &tags, Matrix &distances) const
+  {
+    const int numPoints= positions.noRows();
+    tags.resize(numPoints, k);
+    distances.resize(numPoints, k);
+    const int nThreads= get_num_threads();
+#pragma omp parallel num_threads(nThreads)
+    {
+      std::vector<std::pair<double, size_t> > found;
+#pragma omp for schedule(dynamic, 64)
+      for(int i= 0; i<numPoints; i++)
+	{
+	  double p[3];
+	  get_position(positions, i, p);
+	  k_nearest(p, k, found);
+	  for(size_t j= 0; j<k; j++)
+	    {
+	      if(j<found.size())
+		{
+		  tags(i,j)= nodes[found[j].second]->getTag();
+		  distances(i,j)= sqrt(found[j].first);
+		}
+	      else
+		{
+		  tags(i,j)= -1;
+		  distances(i,j)= std::numeric_limits<double>::quiet_NaN();
+		}
+	    }
+	}
+    }
+  }
+
+//! @brief Return a tuple containing the tags of the k nearest nodes to
+//! each of the positions and their distances (see getKNearestNodes).
+boost::python::tuple XC::SpatialIndex::getKNearestNodesPy(const Matrix &positions, const size_t &k) const
+  {
+    Matrix tags, distances;
+    getKNearestNodes(positions, k, tags, distances);
+    return boost::python::make_tuple(tags, distances);
+  }
+
+//! @brief Return the tags of the nodes at a distance not greater than r
+//! of each of the positions.
+std::vector<std::vector<int> > XC::SpatialIndex::getNodesInRadius(const Matrix &positions, const double &r) const
+  {
+    const int numPoints= positions.noRows();
+    std::vector<std::vector<int> > retval(numPoints);
+    const int nThreads= get_num_threads();
+#pragma omp parallel num_threads(nThreads)
+    {
+      std::vector<size_t> found;
+#pragma omp for schedule(dynamic, 64)
+      for(int i= 0; i<numPoints; i++)
+	{
+	  double p[3];
+	  get_position(positions, i, p);
+	  in_radius(p, r, found);
+	  std::vector<int> &tags= retval[i];
+	  tags.reserve(found.size());
+	  for(std::vector<size_t>::const_iterator j= found.begin(); j!= found.end(); j++)
+	    tags.push_back(nodes[*j]->getTag());
+	  std::sort(tags.begin(), tags.end());
+	}
+    }
+    return retval;
+  }
+
+//! @brief Return a list containing, for each position, the ID of the
+//! nodes at a distance not greater than r.
+boost::python::list XC::SpatialIndex::getNodesInRadiusPy(const Matrix &positions, const double &r) const
+  {
+    boost::python::list retval;
+    const std::vector<std::vector<int> > tmp= getNodesInRadius(positions, r);
+    for(std::vector<std::vector<int> >::const_iterator i= tmp.begin(); i!= tmp.end(); i++)
+      retval.append(ID(*i));
+    return retval;
+  }
+
+//! @brief Search the element that contains each of the positions.
+//!
+//! The candidate elements (those whose bounding box, enlarged by tol,
+//! contains the point) are searched in parallel. Then each candidate
+//! checks if the point is inside it (see Element::locatePoint; this is
+//! done sequentially, because some elements use internal buffers to
+//! compute the natural coordinates). Only the elements that implement
+//! that check (1D elements, 4-node quadrilaterals and shells, 8-node
+//! bricks) are considered; the other ones are ignored and a warning is
+//! issued once for each element type.
+//! @param positions: coordinates of the points (one row for each point).
+//! @param tol: tolerance for the bounding box search and for the
+//!             distance from the point to 1D and 2D elements.
+//! @param tags: (output) tag of the element containing each point (-1 if
+//!              not found).
+//! @param naturalCoordinates: (output) natural coordinates (r,s,t) of
+//!                            each point in its element.
+void XC::SpatialIndex::getElementsContaining(const Matrix &positions, const double &tol, ID &tags, Matrix &naturalCoordinates) const
+  {
+    const int numPoints= positions.noRows();
+    std::vector<std::vector<size_t> > candidates(numPoints);
+    const int nThreads= get_num_threads();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nThreads)
+    for(int i= 0; i<numPoints; i++)
+      {
+	double p[3];
+	get_position(positions, i, p);
+	element_candidates(p, tol, candidates[i]);
+      }
+    std::set<std::string> unsupported; // element types that can't locate points.
+    tags.resize(numPoints);
+    naturalCoordinates.resize(numPoints, 3);
+    for(int i= 0; i<numPoints; i++)
+      {
+	double p[3];
+	get_position(positions, i, p);
+	const Pos3d pos(p[0], p[1], p[2]);
+	tags[i]= -1;
+	naturalCoordinates(i,0)= naturalCoordinates(i,1)= naturalCoordinates(i,2)= std::numeric_limits<double>::quiet_NaN();
+	for(std::vector<size_t>::const_iterator j= candidates[i].begin(); j!= candidates[i].end(); j++)
+	  {
+	    const Element *elem= elements[*j];
+	    if(!elem->canLocatePoints())
+	      {
+		if(unsupported.insert(elem->getClassName()).second)
+		  std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+			    << "; elements of type: " << elem->getClassName()
+			    << " can't locate points; ignored."
+			    << Color::def << std::endl;
+		continue;
+	      }
+	    ParticlePos3d nc;
+	    if(elem->locatePoint(pos, tol, nc, initialGeometry))
+	      {
+		tags[i]= elem->getTag();
+		naturalCoordinates(i,0)= nc.r_coordinate();
+		naturalCoordinates(i,1)= nc.s_coordinate();
+		naturalCoordinates(i,2)= nc.t_coordinate();
+		break;
+	      }
+	  }
+      }
+  }
+
+//! @brief Return a tuple containing the ID of the elements that contain
+//! each of the positions and the matrix of the natural coordinates of
+//! each position (see getElementsContaining).
+boost::python::tuple XC::SpatialIndex::getElementsContainingPy(const Matrix &positions, const double &tol) const
+  {
+    ID tags;
+    Matrix naturalCoordinates;
+    getElementsContaining(positions, tol, tags, naturalCoordinates);
+    return boost::python::make_tuple(tags, naturalCoordinates);
+  }
+
+//! @brief Return the groups of coincident nodes (nodes at a distance not
+//! greater than tol, directly or through other nodes of the group).
+//! Only the groups with more than one node are returned, each one
+//! sorted by tag.
+std::vector<std::vector<int> > XC::SpatialIndex::getCoincidentNodes(const double &tol) const
+  {
+    const int numNodes= nodes.size();
+    // Neighbours of each node (in parallel).
+    std::vector<std::vector<size_t> > neighbours(numNodes);
+    const int nThreads= get_num_threads();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nThreads)
+    for(int i= 0; i<numNodes; i++)
+      in_radius(&nodeCoords[3*i], tol, neighbours[i]);
+    // Union-find.
+    std::vector<size_t> parent(numNodes);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find_root= [&parent](size_t i)
+      {
+        while(parent[i]!=i)
+	  {
+	    parent[i]= parent[parent[i]];
+	    i= parent[i];
+	  }
+	return i;
+      };
+    for(int i= 0; i<numNodes; i++)
+      for(std::vector<size_t>::const_iterator j= neighbours[i].begin(); j!= neighbours[i].end(); j++)
+        {
+	  const size_t a= find_root(i), b= find_root(*j);
+	  if(a!=b)
+	    parent[std::max(a,b)]= std::min(a,b);
+	}
+    std::map<size_t, std::vector<int> > groups;
+    for(int i= 0; i<numNodes; i++)
+      groups[find_root(i)].push_back(nodes[i]->getTag());
+    std::vector<std::vector<int> > retval;
+    for(std::map<size_t, std::vector<int> >::iterator i= groups.begin(); i!= groups.end(); i++)
+      if(i->second.size()>1)
+	{
+	  std::sort(i->second.begin(), i->second.end());
+	  retval.push_back(i->second);
+	}
+    std::sort(retval.begin(), retval.end());
+    return retval;
+  }
+
+//! @brief Return a list containing the ID of the nodes of each group of
+//! coincident nodes (see getCoincidentNodes).
+boost::python::list XC::SpatialIndex::getCoincidentNodesPy(const double &tol) const
+  {
+    boost::python::list retval;
+    const std::vector<std::vector<int> > tmp= getCoincidentNodes(tol);
+    for(std::vector<std::vector<int> >::const_iterator i= tmp.begin(); i!= tmp.end(); i++)
+      retval.append(ID(*i));
+    return retval;
+  }
@@ -0,0 +1,135 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SpatialIndex.h
+
+#ifndef SpatialIndex_h
+#define SpatialIndex_h
+
+#include "utility/kernel/CommandEntity.h"
+#include <vector>
+#include <string>
+
+namespace XC {
+class Node;
+class Element;
+class Mesh;
+class SetMeshComp;
+class Matrix;
+class Vector;
+class ID;
+
+//! @ingroup Mesh
+//
+//! @brief Static spatial index over the nodes and elements of a set
+//! (or of the whole mesh) that answers batches of queries.
+//!
+//! Unlike KDTreeNodes and KDTreeElements, that are updated each time
+//! a node or an element is added to the mesh, the index is built in a
+//! single pass (balanced k-d tree over the node positions and bounding
+//! volume hierarchy over the element bounding boxes) and it is not
+//! modified afterwards, so the queries can be answered in parallel
+//! (OpenMP). The positions to search for are passed as the rows of a
+//! matrix (two or three columns) and the results are returned as
+//! matrices, vectors or ID's.
+//!
+//! The index must be rebuilt (calling setSet or setMesh again) if the
+//! nodes or the elements change.
+class SpatialIndex: public CommandEntity
+  {
+  public:
+    //! @brief Node of the trees.
+    struct TreeNode
+      {
+        double bounds[6]; //!< bounding box (xmin, ymin, zmin, xmax, ymax, zmax).
+        size_t begin; //!< first item of the node.
+        size_t end; //!< one past the last item of the node.
+        int left; //!< left child (-1 for leaves).
+        int right; //!< right child (-1 for leaves).
+      };
+    typedef std::vector<TreeNode> tree_type;
+  private:
+    bool initialGeometry; //!< if true use the undeformed geometry.
+    int numThreads; //!< number of threads for the queries (0: OpenMP default).
+    static const size_t leafSize= 8; //!< maximum number of items in a leaf.
+
+    std::vector<const Node *> nodes; //!< indexed nodes.
+    std::vector<double> nodeCoords; //!< node coordinates (3 per node, in tree order).
+    tree_type nodeTree; //!< k-d tree over the node positions.
+
+    std::vector<Element *> elements; //!< indexed elements.
+    std::vector<double> elementBoxes; //!< element bounding boxes (6 per element, in tree order).
+    tree_type elementTree; //!< bounding volume hierarchy over the elements.
+
+    void clear(void);
+    void build(void);
+    static int build_tree(tree_type &, std::vector<size_t> &, const std::vector<double> &, const size_t &, const size_t &);
+    static void get_position(const Matrix &, const size_t &, double *);
+    static double box_dist2(const double *, const double *);
+    void k_nearest(const double *, const size_t &, std::vector<std::pair<double, size_t> > &) const;
+    void in_radius(const double *, const double &, std::vector<size_t> &) const;
+    void element_candidates(const double *, const double &, std::vector<size_t> &) const;
+    int get_num_threads(void) const;
+  public:
+    SpatialIndex(void);
+
+    void setSet(SetMeshComp &);
+    void setMesh(Mesh &);
+    //! @brief Return the number of indexed nodes.
+    inline size_t getNumNodes(void) const
+      { return nodes.size(); }
+    //! @brief Return the number of indexed elements.
+    inline size_t getNumElements(void) const
+      { return elements.size(); }
+    //! @brief Return true if the index uses the undeformed geometry.
+    inline bool getInitialGeometry(void) const
+      { return initialGeometry; }
+    //! @brief Use the undeformed geometry (true) or the current one
+    //! (false) the next time the index is built.
+    inline void setInitialGeometry(const bool &b)
+      { initialGeometry= b; }
+    //! @brief Return the number of threads used in the queries.
+    inline int getNumThreads(void) const
+      { return numThreads; }
+    //! @brief Set the number of threads used in the queries
+    //! (0: OpenMP default).
+    inline void setNumThreads(const int &n)
+      { numThreads= n; }
+
+    void getKNearestNodes(const Matrix &, const size_t &, Matrix &, Matrix &) const;
+    boost::python::tuple getKNearestNodesPy(const Matrix &, const size_t &) const;
+    std::vector<std::vector<int> > getNodesInRadius(const Matrix &, const double &) const;
+    boost::python::list getNodesInRadiusPy(const Matrix &, const double &) const;
+    void getElementsContaining(const Matrix &, const double &, ID &, Matrix &) const;
+    boost::python::tuple getElementsContainingPy(const Matrix &, const double &) const;
+    std::vector<std::vector<int> > getCoincidentNodes(const double &) const;
+    boost::python::list getCoincidentNodesPy(const double &) const;
+  };
+
+} // end of XC namespace
+
+#endif
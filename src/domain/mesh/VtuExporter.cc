@@ -0,0 +1,754 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VtuExporter.cc
+
+#include "VtuExporter.h"
+#include "domain/mesh/Mesh.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/ElementIter.h"
+#include "domain/mesh/element/utils/Information.h"
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "utility/recorder/response/Response.h"
+#include "preprocessor/set_mgmt/SetMeshComp.h"
+#include "utility/geom/pos_vec/Pos3d.h"
+#include "utility/geom/pos_vec/Vector3d.h"
+#include "utility/matrix/Vector.h"
+#include "utility/utils/misc_utils/colormod.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <limits>
+#include <list>
+#include <zlib.h>
+#ifdef USE_HDF5
+#include <hdf5.h>
+#endif
+
+namespace {
+//! @brief Raw data of an array of the appended section.
+struct DataArray
+  {
+    std::string name; //!< name of the array.
+    std::string type; //!< VTK type name (Float64, Int64,...).
+    size_t numComponents; //!< number of components.
+    const char *data; //!< pointer to the values.
+    uint64_t numBytes; //!< size of the values in bytes.
+    std::string section; //!< PointData, CellData, Points or Cells.
+  };
+
+template <class T>
+DataArray make_array(const std::string &section, const std::string &name, const std::string &type, const size_t &nc, const std::vector<T> &values)
+  {
+    DataArray retval;
+    retval.section= section; retval.name= name; retval.type= type;
+    retval.numComponents= nc;
+    retval.data= reinterpret_cast<const char *>(values.data());
+    retval.numBytes= values.size()*sizeof(T);
+    return retval;
+  }
+
+//! @brief Return true if the machine stores the words in little endian order.
+bool is_little_endian(void)
+  {
+    const uint16_t one= 1;
+    return (*reinterpret_cast<const uint8_t *>(&one)==1);
+  }
+
+//! @brief Write the data arrays of the given section.
+void write_section(std::ostream &os, const std::vector<DataArray> &arrays, const std::vector<uint64_t> &offsets, const std::string &section, const std::string &indent)
+  {
+    for(size_t i= 0;i<arrays.size();i++)
+      {
+        const DataArray &a= arrays[i];
+        if(a.section==section)
+          {
+            os << indent << "<DataArray type=\"" << a.type << "\"";
+            if(!a.name.empty())
+              os << " Name=\"" << a.name << "\"";
+            os << " NumberOfComponents=\"" << a.numComponents
+               << "\" format=\"appended\" offset=\"" << offsets[i] << "\"/>\n";
+          }
+      }
+  }
+
+//! @brief Compress the values of the array with zlib using the block
+//! layout of vtkZLibDataCompressor: a header with the number of blocks,
+//! the size of the blocks, the size of the last block (zero if it is
+//! full) and the compressed size of each block, followed by the
+//! compressed blocks. Return false if zlib fails.
+bool compress_array(const DataArray &a, std::vector<char> &out)
+  {
+    const uint64_t blockSize= 32768;
+    const uint64_t lastBlockSize= a.numBytes%blockSize;
+    const uint64_t numBlocks= a.numBytes/blockSize+((lastBlockSize>0) ? 1 : 0);
+    std::vector<uint64_t> header(3+numBlocks);
+    header[0]= numBlocks;
+    header[1]= blockSize;
+    header[2]= lastBlockSize;
+    std::vector<char> blocks;
+    for(uint64_t i= 0;i<numBlocks;i++)
+      {
+        const uint64_t sz= ((i+1==numBlocks) && (lastBlockSize>0)) ? lastBlockSize : blockSize;
+        uLongf destLen= compressBound(sz);
+        const size_t pos= blocks.size();
+        blocks.resize(pos+destLen);
+        const int status= compress2(reinterpret_cast<Bytef *>(blocks.data()+pos), &destLen, reinterpret_cast<const Bytef *>(a.data+i*blockSize), sz, Z_DEFAULT_COMPRESSION);
+        if(status!=Z_OK)
+          return false;
+        blocks.resize(pos+destLen);
+        header[3+i]= destLen;
+      }
+    const char *h= reinterpret_cast<const char *>(header.data());
+    out.assign(h, h+header.size()*sizeof(uint64_t));
+    out.insert(out.end(), blocks.begin(), blocks.end());
+    return true;
+  }
+
+#ifdef USE_HDF5
+//! @brief Return the HDF5 type that corresponds to the VTK type name.
+hid_t hdf5_type(const std::string &vtkType)
+  {
+    hid_t retval= H5T_NATIVE_DOUBLE;
+    if(vtkType=="Int64")
+      retval= H5T_NATIVE_INT64;
+    else if(vtkType=="Int32")
+      retval= H5T_NATIVE_INT32;
+    else if(vtkType=="UInt8")
+      retval= H5T_NATIVE_UINT8;
+    return retval;
+  }
+
+//! @brief Write a dataset with n rows and nc columns (a vector if nc==1)
+//! in the given group. Return false if it fails.
+bool write_hdf5_dataset(hid_t group, const std::string &name, hid_t type, const void *data, const hsize_t &n, const hsize_t &nc, bool compressed)
+  {
+    const hsize_t dims[2]= {n, nc};
+    const int rank= (nc>1) ? 2 : 1;
+    const hid_t space= H5Screate_simple(rank, dims, nullptr);
+    const hid_t plist= H5Pcreate(H5P_DATASET_CREATE);
+    if(compressed && (n>0))
+      {
+        const hsize_t chunk[2]= {std::min<hsize_t>(n, 16384), nc};
+        H5Pset_chunk(plist, rank, chunk);
+        H5Pset_deflate(plist, 6);
+      }
+    const hid_t dset= H5Dcreate2(group, name.c_str(), type, space, H5P_DEFAULT, plist, H5P_DEFAULT);
+    herr_t status= -1;
+    if(dset>=0)
+      {
+        status= (n>0) ? H5Dwrite(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) : 0;
+        H5Dclose(dset);
+      }
+    H5Pclose(plist);
+    H5Sclose(space);
+    return ((dset>=0) && (status>=0));
+  }
+#endif
+} // namespace
+
+//! @brief Arrays to write and the storage of their values.
+struct XC::VtuExporter::GridData
+  {
+    std::vector<DataArray> arrays; //!< arrays to write.
+    std::vector<int32_t> nodeTags; //!< tags of the nodes.
+    std::vector<int32_t> elementTags; //!< tags of the elements.
+    std::list<std::vector<double> > fieldValues; //!< values of the fields.
+    std::vector<double> points; //!< point coordinates.
+    std::vector<int64_t> connectivity; //!< point indexes of the cells.
+    std::vector<int64_t> offsets; //!< end of each cell in the connectivity.
+    std::vector<uint8_t> types; //!< VTK types of the cells.
+  };
+
+//! @brief Constructor.
+XC::VtuExporter::VtuExporter(void)
+  : CommandEntity(), deformationFactor(0.0), compressed(true) {}
+
+//! @brief Remove the nodes and elements.
+void XC::VtuExporter::clear(void)
+  {
+    nodes.clear();
+    elements.clear();
+    nodeIndex.clear();
+  }
+
+//! @brief Append the node to the point list (if not already there).
+void XC::VtuExporter::add_node(const Node *n)
+  {
+    if(n && (nodeIndex.find(n->getTag())==nodeIndex.end()))
+      {
+        nodeIndex[n->getTag()]= nodes.size();
+        nodes.push_back(n);
+      }
+  }
+
+//! @brief Append the nodes of the elements that are not in the list yet.
+void XC::VtuExporter::index_element_nodes(void)
+  {
+    for(std::vector<Element *>::const_iterator i= elements.begin(); i!=elements.end(); i++)
+      {
+        const NodePtrs &elemNodes= (*i)->getNodePtrs();
+        for(NodePtrs::const_iterator j= elemNodes.begin(); j!=elemNodes.end(); j++)
+          add_node(*j);
+      }
+  }
+
+//! @brief Write the nodes and elements of the given set.
+void XC::VtuExporter::setSet(SetMeshComp &s)
+  {
+    clear();
+    const DqPtrsNode &setNodes= s.getNodes();
+    for(DqPtrsNode::const_iterator i= setNodes.begin(); i!=setNodes.end(); i++)
+      add_node(*i);
+    DqPtrsElem &setElements= s.getElements();
+    elements.reserve(setElements.size());
+    for(DqPtrsElem::iterator i= setElements.begin(); i!=setElements.end(); i++)
+      elements.push_back(*i);
+    index_element_nodes();
+  }
+
+//! @brief Write the nodes and elements of the whole mesh.
+void XC::VtuExporter::setMesh(Mesh &mesh)
+  {
+    clear();
+    Node *nodePtr= nullptr;
+    NodeIter &theNodeIter= mesh.getNodes();
+    while((nodePtr= theNodeIter()) != nullptr)
+      add_node(nodePtr);
+    Element *elemPtr= nullptr;
+    ElementIter &theElemIter= mesh.getElements();
+    while((elemPtr= theElemIter()) != nullptr)
+      elements.push_back(elemPtr);
+    index_element_nodes();
+  }
+
+//! @brief Append a nodal field to write (disp, rot, vel, accel,
+//! reaction, reactionMoment or mode:i).
+void XC::VtuExporter::addNodalField(const std::string &name)
+  { nodalFields.push_back(name); }
+
+//! @brief Append an element response to write.
+//! @param name: name of the array in the output file.
+//! @param args: arguments of the element response (e.g. ["force"]).
+void XC::VtuExporter::addElementResponse(const std::string &name, const response_args &args)
+  { elementResponses.push_back(std::make_pair(name, args)); }
+
+//! @brief Append an element response to write.
+//! @param name: name of the array in the output file.
+//! @param args: arguments of the element response (e.g. ["force"]).
+void XC::VtuExporter::addElementResponsePy(const std::string &name, const boost::python::list &args)
+  {
+    response_args tmp;
+    const size_t sz= len(args);
+    for(size_t i= 0;i<sz;i++)
+      tmp.push_back(boost::python::extract<std::string>(args[i]));
+    addElementResponse(name, tmp);
+  }
+
+//! @brief Append an element property to write (see class description).
+void XC::VtuExporter::addElementProperty(const std::string &name)
+  { elementProperties.push_back(name); }
+
+//! @brief Remove the fields to write.
+void XC::VtuExporter::clearFields(void)
+  {
+    nodalFields.clear();
+    elementResponses.clear();
+    elementProperties.clear();
+  }
+
+//! @brief Compute the values of the nodal field and return its number
+//! of components (0 if the field is unknown).
+size_t XC::VtuExporter::get_nodal_field(const std::string &name, std::vector<double> &values) const
+  {
+    const size_t numNodes= nodes.size();
+    size_t retval= 3;
+    if((name=="vel") || (name=="accel"))
+      {
+        retval= 0;
+        for(size_t i= 0;i<numNodes;i++)
+          retval= std::max(retval, size_t(nodes[i]->getNumberDOF()));
+        values.assign(numNodes*retval, 0.0);
+        for(size_t i= 0;i<numNodes;i++)
+          {
+            const Vector &v= (name=="vel") ? nodes[i]->getVel() : nodes[i]->getAccel();
+            for(int j= 0;j<v.Size();j++)
+              values[i*retval+j]= v(j);
+          }
+        return retval;
+      }
+    int mode= 0;
+    if(name.compare(0, 5, "mode:")==0)
+      {
+        std::istringstream iss(name.substr(5));
+        iss >> mode;
+        if(!iss || (mode<1))
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; wrong mode number in field: '" << name << "'."
+                      << Color::def << std::endl;
+            return 0;
+          }
+      }
+    else if((name!="disp") && (name!="rot") && (name!="reaction") && (name!="reactionMoment"))
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; unknown nodal field: '" << name << "'."
+                  << Color::def << std::endl;
+        return 0;
+      }
+    values.resize(numNodes*retval);
+    for(size_t i= 0;i<numNodes;i++)
+      {
+        const Node *n= nodes[i];
+        Vector3d v;
+        if(name=="disp")
+          v= n->get3dForceComponents(n->getDisp());
+        else if(name=="rot")
+          v= n->get3dMomentComponents(n->getDisp());
+        else if(name=="reaction")
+          v= n->getReactionForce3d();
+        else if(name=="reactionMoment")
+          v= n->getReactionMoment3d();
+        else if(mode<=n->getNumModes())
+          v= n->getEigenvectorDisp3dComponents(mode);
+        values[3*i]= v.x(); values[3*i+1]= v.y(); values[3*i+2]= v.z();
+      }
+    return retval;
+  }
+
+//! @brief Compute the element response values and return its number
+//! of components. The values of the elements that don't provide
+//! the response are set to NaN.
+size_t XC::VtuExporter::get_element_response(const response_args &args, std::vector<double> &values) const
+  {
+    const size_t numElements= elements.size();
+    std::vector<Vector> tmp(numElements);
+    size_t retval= 0;
+    for(size_t i= 0;i<numElements;i++)
+      {
+        Information eleInfo(1.0);
+        Response *theResponse= elements[i]->setResponse(args, eleInfo);
+        if(theResponse)
+          {
+            theResponse->getResponse();
+            tmp[i]= theResponse->getInformation().getData();
+            retval= std::max(retval, size_t(tmp[i].Size()));
+            delete theResponse;
+          }
+      }
+    values.assign(numElements*retval, std::numeric_limits<double>::quiet_NaN());
+    for(size_t i= 0;i<numElements;i++)
+      for(int j= 0;j<tmp[i].Size();j++)
+        values[i*retval+j]= tmp[i](j);
+    return retval;
+  }
+
+//! @brief Read the values of the element property and return its number
+//! of components. The values of the elements that don't have the
+//! property are set to NaN.
+size_t XC::VtuExporter::get_element_property(const std::string &name, std::vector<double> &values) const
+  {
+    const size_t dotPos= name.find('.');
+    const std::string propName= name.substr(0, dotPos);
+    const std::string attrName= (dotPos==std::string::npos) ? "" : name.substr(dotPos+1);
+    const size_t numElements= elements.size();
+    std::vector<std::vector<double> > tmp(numElements);
+    size_t retval= 0;
+    for(size_t i= 0;i<numElements;i++)
+      {
+        const PythonDict &props= elements[i]->getPropertiesDict();
+        PythonDict::const_iterator it= props.find(propName);
+        if(it==props.end())
+          continue;
+        try
+          {
+            boost::python::object obj= it->second;
+            if(!attrName.empty())
+              {
+                obj= obj.attr(attrName.c_str());
+                if(PyCallable_Check(obj.ptr()))
+                  obj= obj();
+              }
+            boost::python::extract<double> number(obj);
+            if(number.check())
+              tmp[i].push_back(number());
+            else
+              {
+                boost::python::extract<Vector> vector(obj);
+                if(vector.check())
+                  {
+                    const Vector v= vector();
+                    for(int j= 0;j<v.Size();j++)
+                      tmp[i].push_back(v(j));
+                  }
+                else
+                  {
+                    const size_t sz= len(obj);
+                    for(size_t j= 0;j<sz;j++)
+                      tmp[i].push_back(boost::python::extract<double>(obj[j]));
+                  }
+              }
+          }
+        catch(boost::python::error_already_set &)
+          {
+            PyErr_Clear();
+            tmp[i].clear();
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; can't read the value of: '" << name
+                      << "' for element: " << elements[i]->getTag()
+                      << Color::def << std::endl;
+          }
+        retval= std::max(retval, tmp[i].size());
+      }
+    values.assign(numElements*retval, std::numeric_limits<double>::quiet_NaN());
+    for(size_t i= 0;i<numElements;i++)
+      std::copy(tmp[i].begin(), tmp[i].end(), values.begin()+i*retval);
+    return retval;
+  }
+
+//! @brief Compute the arrays to write (return -1 if the grid is wrong).
+int XC::VtuExporter::get_grid_data(GridData &g) const
+  {
+    const size_t numNodes= nodes.size();
+    const size_t numElements= elements.size();
+    std::vector<DataArray> &arrays= g.arrays;
+
+    // Cells (check the connectivity first).
+    g.offsets.resize(numElements);
+    g.types.resize(numElements);
+    for(size_t i= 0;i<numElements;i++)
+      {
+        const Element *e= elements[i];
+        const NodePtrs &elemNodes= e->getNodePtrs();
+        for(NodePtrs::const_iterator j= elemNodes.begin(); j!=elemNodes.end(); j++)
+          {
+            if(!(*j))
+              {
+                std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                          << "; element: " << e->getTag()
+                          << " has a null node pointer (node "
+                          << (j-elemNodes.begin()) << ")."
+                          << Color::def << std::endl;
+                return -1;
+              }
+            g.connectivity.push_back(nodeIndex.find((*j)->getTag())->second);
+          }
+        g.offsets[i]= g.connectivity.size();
+        g.types[i]= e->getVtkCellType();
+      }
+
+    // Point data.
+    g.nodeTags.resize(numNodes);
+    for(size_t i= 0;i<numNodes;i++)
+      g.nodeTags[i]= nodes[i]->getTag();
+    arrays.push_back(make_array("PointData", "node_tag", "Int32", 1, g.nodeTags));
+    for(std::vector<std::string>::const_iterator i= nodalFields.begin(); i!=nodalFields.end(); i++)
+      {
+        g.fieldValues.push_back(std::vector<double>());
+        const size_t nc= get_nodal_field(*i, g.fieldValues.back());
+        if(nc>0)
+          arrays.push_back(make_array("PointData", *i, "Float64", nc, g.fieldValues.back()));
+      }
+
+    // Cell data.
+    g.elementTags.resize(numElements);
+    for(size_t i= 0;i<numElements;i++)
+      g.elementTags[i]= elements[i]->getTag();
+    arrays.push_back(make_array("CellData", "element_tag", "Int32", 1, g.elementTags));
+    for(std::vector<std::pair<std::string, response_args> >::const_iterator i= elementResponses.begin(); i!=elementResponses.end(); i++)
+      {
+        g.fieldValues.push_back(std::vector<double>());
+        const size_t nc= get_element_response(i->second, g.fieldValues.back());
+        if(nc>0)
+          arrays.push_back(make_array("CellData", i->first, "Float64", nc, g.fieldValues.back()));
+      }
+    for(std::vector<std::string>::const_iterator i= elementProperties.begin(); i!=elementProperties.end(); i++)
+      {
+        g.fieldValues.push_back(std::vector<double>());
+        const size_t nc= get_element_property(*i, g.fieldValues.back());
+        if(nc>0)
+          arrays.push_back(make_array("CellData", *i, "Float64", nc, g.fieldValues.back()));
+      }
+
+    // Points.
+    g.points.resize(3*numNodes);
+    for(size_t i= 0;i<numNodes;i++)
+      {
+        const Pos3d p= nodes[i]->getCurrentPosition3d(deformationFactor);
+        g.points[3*i]= p.x(); g.points[3*i+1]= p.y(); g.points[3*i+2]= p.z();
+      }
+    arrays.push_back(make_array("Points", "", "Float64", 3, g.points));
+
+    arrays.push_back(make_array("Cells", "connectivity", "Int64", 1, g.connectivity));
+    arrays.push_back(make_array("Cells", "offsets", "Int64", 1, g.offsets));
+    arrays.push_back(make_array("Cells", "types", "UInt8", 1, g.types));
+    return 0;
+  }
+
+//! @brief Write the grid and the fields to the given .vtu file.
+int XC::VtuExporter::write(const std::string &fileName) const
+  {
+    GridData g;
+    if(get_grid_data(g)!=0)
+      return -1;
+    const std::vector<DataArray> &arrays= g.arrays;
+
+    // Compressed data.
+    std::vector<std::vector<char> > compressedData;
+    if(compressed)
+      {
+        compressedData.resize(arrays.size());
+        for(size_t i= 0;i<arrays.size();i++)
+          if(!compress_array(arrays[i], compressedData[i]))
+            {
+              std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                        << "; error compressing array: '" << arrays[i].name
+                        << "'." << Color::def << std::endl;
+              return -1;
+            }
+      }
+
+    // Offsets of the arrays in the appended data.
+    std::vector<uint64_t> arrayOffsets(arrays.size());
+    uint64_t offset= 0;
+    for(size_t i= 0;i<arrays.size();i++)
+      {
+        arrayOffsets[i]= offset;
+        if(compressed)
+          offset+= compressedData[i].size();
+        else
+          offset+= sizeof(uint64_t)+arrays[i].numBytes;
+      }
+
+    std::ofstream out(fileName.c_str(), std::ios::out | std::ios::binary);
+    if(!out)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    // XML header.
+    const std::string byteOrder= is_little_endian() ? "LittleEndian" : "BigEndian";
+    out << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+        << byteOrder << "\" header_type=\"UInt64\"";
+    if(compressed)
+      out << " compressor=\"vtkZLibDataCompressor\"";
+    out << ">\n"
+        << "  <UnstructuredGrid>\n"
+        << "    <Piece NumberOfPoints=\"" << nodes.size()
+        << "\" NumberOfCells=\"" << elements.size() << "\">\n";
+    out << "      <PointData>\n";
+    write_section(out, arrays, arrayOffsets, "PointData", "        ");
+    out << "      </PointData>\n";
+    out << "      <CellData>\n";
+    write_section(out, arrays, arrayOffsets, "CellData", "        ");
+    out << "      </CellData>\n";
+    out << "      <Points>\n";
+    write_section(out, arrays, arrayOffsets, "Points", "        ");
+    out << "      </Points>\n";
+    out << "      <Cells>\n";
+    write_section(out, arrays, arrayOffsets, "Cells", "        ");
+    out << "      </Cells>\n"
+        << "    </Piece>\n"
+        << "  </UnstructuredGrid>\n"
+        << "  <AppendedData encoding=\"raw\">\n_";
+    // Binary data.
+    for(size_t i= 0;i<arrays.size();i++)
+      {
+        if(compressed)
+          out.write(compressedData[i].data(), compressedData[i].size());
+        else
+          {
+            out.write(reinterpret_cast<const char *>(&(arrays[i].numBytes)), sizeof(uint64_t));
+            if(arrays[i].numBytes>0)
+              out.write(arrays[i].data, arrays[i].numBytes);
+          }
+      }
+    out << "\n  </AppendedData>\n"
+        << "</VTKFile>\n";
+    if(!out)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; error writing file: '" << fileName << "'."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Write the .vtu file for a load combination or time step and
+//! append it to the collection written by writePvd.
+//! @param baseName: name of the file without the step number and the extension.
+//! @param time: time (or index) of the combination in the collection.
+int XC::VtuExporter::writeStep(const std::string &baseName, const double &time)
+  {
+    std::ostringstream fileName;
+    fileName << baseName << '_' << std::setw(6) << std::setfill('0') << collection.size() << ".vtu";
+    const int retval= write(fileName.str());
+    if(retval==0)
+      collection.push_back(std::make_pair(time, fileName.str()));
+    return retval;
+  }
+
+//! @brief Write the ParaView collection file (.pvd) that indexes
+//! the files written by writeStep.
+int XC::VtuExporter::writePvd(const std::string &fileName) const
+  {
+    std::ofstream out(fileName.c_str());
+    if(!out)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    // The names of the data files are relative to the directory of the
+    // collection file.
+    const size_t slashPos= fileName.rfind('/');
+    const std::string dir= (slashPos==std::string::npos) ? "" : fileName.substr(0, slashPos+1);
+    const std::string byteOrder= is_little_endian() ? "LittleEndian" : "BigEndian";
+    out << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"" << byteOrder << "\">\n"
+        << "  <Collection>\n";
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for(std::vector<std::pair<double, std::string> >::const_iterator i= collection.begin(); i!=collection.end(); i++)
+      {
+        std::string dataFile= i->second;
+        if(!dir.empty() && (dataFile.compare(0, dir.size(), dir)==0))
+          dataFile= dataFile.substr(dir.size());
+        out << "    <DataSet timestep=\"" << i->first
+            << "\" group=\"\" part=\"0\" file=\"" << dataFile << "\"/>\n";
+      }
+    out << "  </Collection>\n"
+        << "</VTKFile>\n";
+    return 0;
+  }
+
+//! @brief Forget the files written by writeStep.
+void XC::VtuExporter::clearCollection(void)
+  { collection.clear(); }
+
+//! @brief Write the grid and the fields to the given VTKHDF file
+//! (unstructured grid, one piece). The datasets are compressed
+//! (deflate filter) if the compression is active. Requires a library
+//! built with HDF5.
+int XC::VtuExporter::writeVtkHdf(const std::string &fileName) const
+  {
+#ifdef USE_HDF5
+    GridData g;
+    if(get_grid_data(g)!=0)
+      return -1;
+    const hid_t file= H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    if(file<0)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    bool ok= true;
+    const hid_t root= H5Gcreate2(file, "VTKHDF", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    // Attributes: version and type of the data set.
+    const int64_t version[2]= {1, 0};
+    const hsize_t versionDims[1]= {2};
+    const hid_t versionSpace= H5Screate_simple(1, versionDims, nullptr);
+    const hid_t versionAttr= H5Acreate2(root, "Version", H5T_NATIVE_INT64, versionSpace, H5P_DEFAULT, H5P_DEFAULT);
+    ok= ok && (H5Awrite(versionAttr, H5T_NATIVE_INT64, version)>=0);
+    H5Aclose(versionAttr);
+    H5Sclose(versionSpace);
+    const std::string typeName= "UnstructuredGrid";
+    const hid_t strType= H5Tcopy(H5T_C_S1);
+    H5Tset_size(strType, typeName.size());
+    H5Tset_strpad(strType, H5T_STR_NULLPAD);
+    const hid_t scalarSpace= H5Screate(H5S_SCALAR);
+    const hid_t typeAttr= H5Acreate2(root, "Type", strType, scalarSpace, H5P_DEFAULT, H5P_DEFAULT);
+    ok= ok && (H5Awrite(typeAttr, strType, typeName.c_str())>=0);
+    H5Aclose(typeAttr);
+    H5Sclose(scalarSpace);
+    H5Tclose(strType);
+
+    // Sizes of the piece.
+    const int64_t numPoints= nodes.size();
+    const int64_t numCells= elements.size();
+    const int64_t numConnectivityIds= g.connectivity.size();
+    ok= ok && write_hdf5_dataset(root, "NumberOfPoints", H5T_NATIVE_INT64, &numPoints, 1, 1, false);
+    ok= ok && write_hdf5_dataset(root, "NumberOfCells", H5T_NATIVE_INT64, &numCells, 1, 1, false);
+    ok= ok && write_hdf5_dataset(root, "NumberOfConnectivityIds", H5T_NATIVE_INT64, &numConnectivityIds, 1, 1, false);
+    // VTKHDF offsets start with zero.
+    std::vector<int64_t> offsets(1, 0);
+    offsets.insert(offsets.end(), g.offsets.begin(), g.offsets.end());
+    ok= ok && write_hdf5_dataset(root, "Offsets", H5T_NATIVE_INT64, offsets.data(), offsets.size(), 1, compressed);
+
+    // Arrays.
+    const hid_t pointData= H5Gcreate2(root, "PointData", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    const hid_t cellData= H5Gcreate2(root, "CellData", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    for(std::vector<DataArray>::const_iterator i= g.arrays.begin(); i!=g.arrays.end(); i++)
+      {
+        hid_t group= root;
+        std::string name;
+        if(i->section=="PointData")
+          { group= pointData; name= i->name; }
+        else if(i->section=="CellData")
+          { group= cellData; name= i->name; }
+        else if(i->section=="Points")
+          name= "Points";
+        else if(i->name=="connectivity")
+          name= "Connectivity";
+        else if(i->name=="types")
+          name= "Types";
+        else
+          continue; // offsets already written.
+        const hid_t type= hdf5_type(i->type);
+        const size_t itemSize= H5Tget_size(type);
+        const hsize_t numRows= i->numBytes/(itemSize*i->numComponents);
+        ok= ok && write_hdf5_dataset(group, name, type, i->data, numRows, i->numComponents, compressed);
+      }
+    H5Gclose(cellData);
+    H5Gclose(pointData);
+    H5Gclose(root);
+    ok= (H5Fclose(file)>=0) && ok;
+    if(!ok)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; error writing file: '" << fileName << "'."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    return 0;
+#else
+    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+              << "; can't write: '" << fileName
+              << "', the library has been built without HDF5."
+              << Color::def << std::endl;
+    return -1;
+#endif
+  }
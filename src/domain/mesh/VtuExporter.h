@@ -0,0 +1,134 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VtuExporter.h
+
+#ifndef VtuExporter_h
+#define VtuExporter_h
+
+#include "utility/kernel/CommandEntity.h"
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+namespace XC {
+class Node;
+class Element;
+class Mesh;
+class SetMeshComp;
+
+//! @ingroup Mesh
+//
+//! @brief Writes the nodes and elements of a set (or of the whole mesh)
+//! and their results to VTK XML unstructured grid files (.vtu) using
+//! binary appended data (compressed with zlib by default), and the
+//! ParaView collection file (.pvd) that indexes the files written for
+//! each load combination or time step. The same grid and fields can
+//! also be written to a VTKHDF file (.vtkhdf) if the library has been
+//! built with HDF5.
+//!
+//! Nodal fields:
+//! - disp, rot: translational and rotational components of the displacement.
+//! - vel, accel: velocity and acceleration (all the nodal DOFs).
+//! - reaction, reactionMoment: reaction force and moment.
+//! - mode:i: displacement components of the i-th eigenvector.
+//!
+//! Element fields are obtained either from the element responses
+//! (the same arguments used by the element recorders, like "force" or
+//! "stresses") or from the element properties; in this last case the
+//! name can be of the form "propName.attribute" to read an attribute
+//! of the stored object (e.g. the capacity factor "CF" of the limit
+//! state control variables). If the attribute is a method it's called
+//! without arguments.
+class VtuExporter: public CommandEntity
+  {
+  public:
+    typedef std::vector<std::string> response_args; //!< element response arguments.
+  private:
+    struct GridData;
+    std::vector<const Node *> nodes; //!< nodes to write.
+    std::vector<Element *> elements; //!< elements to write.
+    std::map<int, int64_t> nodeIndex; //!< position of each node (by tag).
+    std::vector<std::string> nodalFields; //!< nodal fields to write.
+    std::vector<std::pair<std::string, response_args> > elementResponses; //!< element responses to write.
+    std::vector<std::string> elementProperties; //!< element properties to write.
+    double deformationFactor; //!< factor for the displacements of the points (0 for the initial geometry).
+    bool compressed; //!< if true, compress the binary data with zlib.
+    std::vector<std::pair<double, std::string> > collection; //!< files written by writeStep.
+
+    void add_node(const Node *);
+    void index_element_nodes(void);
+    size_t get_nodal_field(const std::string &, std::vector<double> &) const;
+    size_t get_element_response(const response_args &, std::vector<double> &) const;
+    size_t get_element_property(const std::string &, std::vector<double> &) const;
+    int get_grid_data(GridData &) const;
+  public:
+    VtuExporter(void);
+
+    void setSet(SetMeshComp &);
+    void setMesh(Mesh &);
+    void clear(void);
+    //! @brief Return the number of points.
+    inline size_t getNumPoints(void) const
+      { return nodes.size(); }
+    //! @brief Return the number of cells.
+    inline size_t getNumCells(void) const
+      { return elements.size(); }
+
+    void addNodalField(const std::string &);
+    void addElementResponse(const std::string &, const response_args &);
+    void addElementResponsePy(const std::string &, const boost::python::list &);
+    void addElementProperty(const std::string &);
+    void clearFields(void);
+
+    //! @brief Return the factor that multiplies the displacements
+    //! to compute the point positions.
+    inline double getDeformationFactor(void) const
+      { return deformationFactor; }
+    //! @brief Set the factor that multiplies the displacements
+    //! to compute the point positions.
+    inline void setDeformationFactor(const double &f)
+      { deformationFactor= f; }
+    //! @brief Return true if the binary data are compressed.
+    inline bool getCompressed(void) const
+      { return compressed; }
+    //! @brief Compress (or not) the binary data.
+    inline void setCompressed(const bool &b)
+      { compressed= b; }
+
+    int write(const std::string &) const;
+    int writeStep(const std::string &, const double &);
+    int writePvd(const std::string &) const;
+    int writeVtkHdf(const std::string &) const;
+    void clearCollection(void);
+  };
+
+} // end of XC namespace
+
+#endif
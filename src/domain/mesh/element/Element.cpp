@@ -385,6 +385,22 @@ void XC::Element::compute_damping_matrix(Matrix &theMatrix) const
       theMatrix.addMatrix(1.0, Kc, rayFactors.getBetaKc());
   }
 
+//! @brief Return true if the tangent stiffness of the element doesn't
+//! depend on its state (linear geometry and linear elastic materials).
+//!
+//! The elements that return true here keep their tangent stiffness
+//! in a cache (see TangentStiffCache) and compute it again only when
+//! the values it depends on change.
+bool XC::Element::hasConstantTangent(void) const
+  { return false; }
+
+//! @brief Return the number of times the tangent stiffness matrix
+//! has been computed again (only meaningful if hasConstantTangent
+//! returns true). Can be used to know if an assembled copy of the
+//! matrix is out of date.
+size_t XC::Element::getTangentStiffVersion(void) const
+  { return 0; }
+
 //! @brief Returns the damping matrix.
 //!
 //! To return the damping matrix. The element is to compute its
@@ -911,6 +927,23 @@ XC::ParticlePos3d XC::Element::getNaturalCoordinates(const Pos3d &, bool initial
     return retval;
   }
 
+//! @brief Return true if the element implements locatePoint.
+bool XC::Element::canLocatePoints(void) const
+  { return false; }
+
+//! @brief Return true if the given position is inside the element.
+//!
+//! This method must be overloaded in the derived classes that
+//! can compute the natural coordinates of a point and decide if
+//! it's inside the element (see canLocatePoints).
+//! @param pos: position to locate.
+//! @param tol: distance tolerance (used for the points of 1D and 2D
+//!             elements that are outside the element line or surface).
+//! @param naturalCoordinates: (output) natural coordinates of the point.
+//! @param initialGeometry: if true, use undeformed element geometry.
+bool XC::Element::locatePoint(const Pos3d &pos, const double &tol, ParticlePos3d &naturalCoordinates, bool initialGeometry) const
+  { return false; }
+
 
 //! @brief Returns interpolation factors for a material point.
 XC::Vector XC::Element::getInterpolationFactors(const ParticlePos3d &) const
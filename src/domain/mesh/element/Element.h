@@ -204,6 +204,8 @@ class Element: public MeshComponent
     //! \f[ K_e = {\frac{\partial f_{R_i}}{\partial U} \vert}_{U_{trial}} \f]
     virtual const Matrix &getTangentStiff(void) const= 0;
     virtual const Matrix &getInitialStiff(void) const= 0;
+    virtual bool hasConstantTangent(void) const;
+    virtual size_t getTangentStiffVersion(void) const;
     virtual const Matrix &getDamp(void) const;
     virtual const Matrix &getMass(void) const;
     virtual Matrix getMass(const Node *) const;
@@ -309,6 +311,8 @@ class Element: public MeshComponent
     virtual double getTributaryVolumeByTag(const int &) const;
 
     virtual ParticlePos3d getNaturalCoordinates(const Pos3d &, bool initialGeometry= true) const;
+    virtual bool canLocatePoints(void) const;
+    virtual bool locatePoint(const Pos3d &, const double &, ParticlePos3d &, bool initialGeometry= true) const;
     virtual Vector getInterpolationFactors(const ParticlePos3d &) const;
     virtual Vector getInterpolationFactors(const Pos3d &) const;
     virtual ParticlePos2d getNaturalCoordinates(const Pos2d &, bool initialGeometry= true) const;
@@ -1034,6 +1034,24 @@ XC::ParticlePos3d XC::Element1D::getNaturalCoordinates(const Pos3d &pt, bool ini
     return ParticlePos3d(2*(localCoord/L)-1.0,0.0,0.0);
   }
       
+//! @brief Return true (the element implements locatePoint).
+bool XC::Element1D::canLocatePoints(void) const
+  { return true; }
+
+//! @brief Return true if the distance from the point to the element
+//! axis is not greater than tol and its projection lies inside the
+//! element.
+//! @param pt: position to locate.
+//! @param tol: distance tolerance.
+//! @param naturalCoordinates: (output) natural coordinates of the point.
+//! @param initialGeometry: if true, use undeformed element geometry.
+bool XC::Element1D::locatePoint(const Pos3d &pt, const double &tol, ParticlePos3d &naturalCoordinates, bool initialGeometry) const
+  {
+    naturalCoordinates= getNaturalCoordinates(pt, initialGeometry);
+    const double limit= 1.0+1e-6;
+    return (std::abs(naturalCoordinates.r_coordinate())<=limit) && (getLineSegment(initialGeometry).dist(pt)<=tol);
+  }
+
 //! @brief Returns interpolation factors for a material point.
 //! @param pos: natural coordinates of the material point.
 XC::Vector XC::Element1D::getInterpolationFactors(const ParticlePos3d &pos) const
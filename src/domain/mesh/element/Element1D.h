@@ -95,6 +95,8 @@ class Element1D: public ElementBase<2>
 
     double getLocalCoordinates(const Pos3d &, bool initialGeometry= true) const;
     ParticlePos3d getNaturalCoordinates(const Pos3d &, bool initialGeometry= true) const;    
+    bool canLocatePoints(void) const;
+    bool locatePoint(const Pos3d &, const double &, ParticlePos3d &, bool initialGeometry= true) const;
     Vector getInterpolationFactors(const ParticlePos3d &) const;
     Vector getInterpolationFactors(const Pos3d &) const;
 
@@ -57,6 +57,7 @@
 #include "FourNodeQuad.h"
 #include <domain/mesh/node/Node.h>
 #include <material/nD/NDMaterial.h>
+#include "material/nD/elastic_isotropic/ElasticIsotropic2D.h"
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/ID.h>
@@ -138,6 +139,7 @@ int XC::FourNodeQuad::resetNodalCoordinates(void)
   {
     // Compute consistent nodal loads due to pressure
     this->setPressureLoadAtNodes();
+    tangentCache.invalidate();
     return 0;
   }
 
@@ -205,6 +207,23 @@ int XC::FourNodeQuad::update(void)
 //! @brief Return the tangent stiffness matrix.
 const XC::Matrix &XC::FourNodeQuad::getTangentStiff(void) const
   {
+    const bool constantTangent= hasConstantTangent();
+    if(constantTangent)
+      {
+        tangentCache.beginKey();
+        tangentCache.addToKey(physicalProperties.getThickness());
+        for(size_t i = 0;i<physicalProperties.size();i++)
+          tangentCache.addToKey(physicalProperties[i]->getTangent());
+        if(tangentCache.isValid())
+          {
+            if(!isDead())
+              return tangentCache.getStiff();
+            K= tangentCache.getStiff();
+            K*=dead_srf;
+            return K;
+          }
+      }
+
     K.Zero();
 
     double dvol;
@@ -260,11 +279,29 @@ const XC::Matrix &XC::FourNodeQuad::getTangentStiff(void) const
               }
             }
       }
+    if(constantTangent)
+      tangentCache.store(K);
     if(isDead())
       K*=dead_srf;
     return K;
   }
 
+//! @brief Return true if the tangent stiffness doesn't depend on the
+//! element state (all the materials are linear elastic).
+bool XC::FourNodeQuad::hasConstantTangent(void) const
+  {
+    const size_t sz= physicalProperties.size();
+    bool retval= (sz>0);
+    for(size_t i= 0;retval && i<sz;i++)
+      retval= (dynamic_cast<const ElasticIsotropic2D *>(physicalProperties[i])!=nullptr);
+    return retval;
+  }
+
+//! @brief Return the number of times the tangent stiffness matrix
+//! has been computed again.
+size_t XC::FourNodeQuad::getTangentStiffVersion(void) const
+  { return tangentCache.getVersion(); }
+
 //! @brief Return the initial tangent stiffness matrix.
 const XC::Matrix &XC::FourNodeQuad::getInitialStiff(void) const
   {
@@ -1021,6 +1058,26 @@ XC::Vector XC::FourNodeQuad::getInterpolationFactors(const ParticlePos2d &pos) c
 XC::Vector XC::FourNodeQuad::getInterpolationFactors(const Pos2d &pos) const
   { return this->getInterpolationFactors(this->getNaturalCoordinates(pos)); }
 
+//! @brief Return true (the element implements locatePoint).
+bool XC::FourNodeQuad::canLocatePoints(void) const
+  { return true; }
+
+//! @brief Return true if the point is inside the element.
+//! @param pos: position to locate (the z coordinate must be zero
+//!             or smaller than tol).
+//! @param tol: distance tolerance.
+//! @param naturalCoordinates: (output) natural coordinates of the point.
+//! @param initialGeometry: if true, use undeformed element geometry.
+bool XC::FourNodeQuad::locatePoint(const Pos3d &pos, const double &tol, ParticlePos3d &naturalCoordinates, bool initialGeometry) const
+  {
+    if(std::abs(pos.z())>tol)
+      return false;
+    const ParticlePos2d nc= getNaturalCoordinates(Pos2d(pos.x(), pos.y()), initialGeometry);
+    naturalCoordinates= ParticlePos3d(nc.r_coordinate(), nc.s_coordinate(), 0.0);
+    const double limit= 1.0+1e-6;
+    return (std::abs(nc.r_coordinate())<=limit) && (std::abs(nc.s_coordinate())<=limit);
+  }
+
 //! @brief Returns interpolation factors for a material point.
 XC::Vector XC::FourNodeQuad::getInterpolationFactors(const Pos3d &pos) const
   {
@@ -62,6 +62,7 @@
 #include "domain/mesh/element/utils/physical_properties/SolidMech2D.h"
 #include "domain/mesh/element/utils/body_forces/BodyForces2D.h"
 #include "domain/mesh/element/utils/fvectors/FVectorQuad.h"
+#include "domain/mesh/element/utils/TangentStiffCache.h"
 
 namespace XC {
 class NDMaterial;
@@ -83,6 +84,7 @@ class FourNodeQuad: public SolidMech4N
     FVectorQuad p0; //!< Reactions in the basic system due to element loads
     mutable std::vector<Vector> eps; //!< strains at gauss points.
     std::vector<Vector> persistentInitialDeformation; //!< Persistent initial strain at element level. Used to store the deformation during the inactive phase of the element (if any).
+    mutable TangentStiffCache tangentCache; //!< Cached tangent stiffness (elastic materials only).
 
     static double matrixData[64]; //!< array data for matrix
     static Matrix K; //!< Element stiffness, and damping matrix.
@@ -122,6 +124,8 @@ class FourNodeQuad: public SolidMech4N
     // public methods to obtain stiffness, mass, damping and residual information    
     const Matrix &getTangentStiff(void) const;
     const Matrix &getInitialStiff(void) const;    
+    bool hasConstantTangent(void) const;
+    size_t getTangentStiffVersion(void) const;
     const Matrix &getMass(void) const;    
 
     const GaussModel &getGaussModel(void) const;
@@ -137,6 +141,8 @@ class FourNodeQuad: public SolidMech4N
 
     Pos2d getCartesianCoordinates(const ParticlePos2d &, bool initialGeometry= true) const;
     ParticlePos2d getNaturalCoordinates(const Pos2d &, bool initialGeometry= true) const;
+    bool canLocatePoints(void) const;
+    bool locatePoint(const Pos3d &, const double &, ParticlePos3d &, bool initialGeometry= true) const;
     Vector getInterpolationFactors(const ParticlePos2d &) const;
     Vector getInterpolationFactors(const Pos2d &) const;
     Vector getInterpolationFactors(const Pos3d &) const;
@@ -586,6 +586,64 @@ namespace
         T(7, 6)= s;		T(7, 7) = c;
       }
 
+    // fills the B matrices of a gauss point from the cached geometry data
+    // (same result as computeBMatrix, without recomputing the jacobian,
+    // the AGQI shape function gradients and the MITC4 interpolation).
+    void fillBMatrix(const XC::ASDShellQ4::GeometryData &geom,
+		     int igauss,
+		     const XC::Vector &N,
+		     XC::Matrix &B,
+		     XC::Matrix &BQ,
+		     XC::Vector &Bd,
+		     bool use_eas)
+      {
+        const std::array<double, 8> &dNdX = geom.dNdX[igauss];
+        const std::array<double, 24> &shear = geom.shear[igauss];
+
+        B.Zero();
+        Bd.Zero();
+        for (int i = 0; i < 4; i++)
+	  {
+            const int index = i * 6;
+            const double dNdx = dNdX[i * 2];
+            const double dNdy = dNdX[i * 2 + 1];
+
+            // membrane
+            B(0, index) = dNdx;
+            B(1, index + 1) = dNdy;
+            B(2, index) = dNdy;
+            B(2, index + 1) = dNdx;
+
+            // drilling (Hughes-Brezzi)
+            Bd(index) = -0.5 * dNdy;
+            Bd(index + 1) = 0.5 * dNdx;
+            Bd(index + 5) = -N(i);
+
+            // bending
+            B(3, index + 4) = -dNdx;
+            B(4, index + 3) = dNdy;
+            B(5, index + 3) = dNdx;
+            B(5, index + 4) = -dNdy;
+
+            // shear (MITC4)
+            for (int j = 0; j < 3; j++)
+	      {
+                B(6, index + 2 + j) = shear[i * 3 + j];
+                B(7, index + 2 + j) = shear[12 + i * 3 + j];
+	      }
+	  }
+
+        // AGQI
+        if (use_eas)
+	  {
+            const std::array<double, 12> &BQg = geom.BQ[igauss];
+            BQ.Zero();
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 4; j++)
+                    BQ(i, j) = BQg[i * 4 + j];
+	  }
+      }
+
 }
 
 void XC::ASDShellQ4::free_crd_transf(void)
@@ -760,6 +818,51 @@ XC::ASDShellQ4 &XC::ASDShellQ4::operator=(const ASDShellQ4 &other)
     return *this;
   }
 
+//! @brief Return true if the element uses the co-rotational
+//! formulation (geometric non-linearity).
+bool XC::ASDShellQ4::isCorotational(void) const
+  { return (m_transformation && !m_transformation->isLinear()); }
+
+//! @brief Set the kinematics of the element (co-rotational if true,
+//! linear otherwise).
+void XC::ASDShellQ4::setCorotational(const bool &corotational)
+  {
+    if(corotational!=isCorotational())
+      {
+        alloc(corotational);
+        Domain *theDomain= getDomain();
+        if(theDomain)
+          {
+            m_transformation->setDomain(theDomain, theNodes.getExternalNodes(), false);
+            this->resetNodalCoordinates();
+          }
+      }
+  }
+
+//! @brief Return true if the element uses the AGQI enhancement of the
+//! membrane strains (enhanced assumed strain).
+bool XC::ASDShellQ4::getUseEAS(void) const
+  { return (m_eas!=nullptr); }
+
+//! @brief Activate or deactivate the AGQI enhancement of the membrane
+//! strains.
+void XC::ASDShellQ4::setUseEAS(const bool &use_eas)
+  {
+    if(use_eas!=getUseEAS())
+      {
+        if(use_eas)
+          {
+            alloc_eas();
+            if(getDomain())
+              AGQIinitialize();
+          }
+        else
+          free_eas();
+        // strain-displacement data must be recomputed
+        m_geometry.invalidate();
+      }
+  }
+
 //! @brief Reinitialize values that depend on the nodal coordinates (for
 //! example after a "manual" change in the nodal coordinates, to impose
 //! an imperfect shape or a precamber.
@@ -808,6 +911,13 @@ int XC::ASDShellQ4::resetNodalCoordinates(void)
             m_angle = -m_angle;
       }
 
+    // reference orientation and center of the co-rotational
+    // transformation
+    m_transformation->revertToStart();
+
+    // strain-displacement data must be recomputed
+    m_geometry.invalidate();
+
     // AGQI internal DOFs
     if(m_eas)
       AGQIinitialize();
@@ -1592,30 +1702,21 @@ int XC::ASDShellQ4::calculateAll(Matrix &LHS, Vector &RHS, int options) const
     ASDShellQ4LocalCoordinateSystem local_cs =
         m_transformation->createLocalCoordinateSystem(UG);
 
-    // Prepare all the parameters needed for the MITC4
-    // and AGQI formulations.
-    // This is to be done here outside the Gauss Loop.
-    auto& mitc = ASDShellQ4Globals::instance().mitc;
-    auto& agq = ASDShellQ4Globals::instance().agq;
-    mitc.compute(reference_cs);
-    if(m_eas)
-        agq.compute(reference_cs);
-
-    // Jacobian
-    auto& jac = ASDShellQ4Globals::instance().jac;
+    // Strain-displacement data that depend only on the reference
+    // geometry (MITC4 and AGQI parameters, jacobians...). They are
+    // computed here only if the reference coordinates have changed.
+    const GeometryData &geom = getGeometryData(reference_cs);
 
     // Some matrices/vectors
     auto& B = ASDShellQ4Globals::instance().B;
     auto& Bd = ASDShellQ4Globals::instance().Bd;
     auto& Bd0 = ASDShellQ4Globals::instance().Bd0;
     auto& BQ = ASDShellQ4Globals::instance().BQ;
-    auto& BQ_mean = ASDShellQ4Globals::instance().BQ_mean;
     auto& BQTD = ASDShellQ4Globals::instance().BQTD;
     auto& DBQ = ASDShellQ4Globals::instance().DBQ;
     auto& B1 = ASDShellQ4Globals::instance().B1;
     auto& B1TD = ASDShellQ4Globals::instance().B1TD;
     auto& N = ASDShellQ4Globals::instance().N;
-    auto& dN = ASDShellQ4Globals::instance().dN;
     auto& E = ASDShellQ4Globals::instance().E;
     auto& S = ASDShellQ4Globals::instance().S;
     auto& D = ASDShellQ4Globals::instance().D;
@@ -1641,15 +1742,20 @@ int XC::ASDShellQ4::calculateAll(Matrix &LHS, Vector &RHS, int options) const
         if(m_eas)
             AGQIupdate(UL);
 
-    // AGQI begin gauss loop (computes the BQ_mean correction matrix)
+    // AGQI begin gauss loop
     if(m_eas)
-        AGQIbeginGaussLoop(reference_cs);
+        AGQIbeginGaussLoop();
 
     // Drilling strain-displacement matrix at center for reduced
     // integration
     shapeFunctions(0.0, 0.0, N);
-    shapeFunctionsNaturalDerivatives(0.0, 0.0, dN);
-    computeBdrilling(reference_cs, 0.0, 0.0, jac, agq, N, dN, Bd0, m_eas);
+    Bd0.Zero();
+    for (int i = 0; i < 4; i++)
+      {
+        Bd0(i * 6) = -0.5 * geom.dNdX0[i * 2 + 1];
+        Bd0(i * 6 + 1) = 0.5 * geom.dNdX0[i * 2];
+        Bd0(i * 6 + 5) = -N(i);
+      }
     static Vector drill_dstrain(8);
     static Vector drill_dstress(8);
     static Vector drill_dstress_el(8);
@@ -1658,16 +1764,11 @@ int XC::ASDShellQ4::calculateAll(Matrix &LHS, Vector &RHS, int options) const
     for (int igauss = 0; igauss < 4; igauss++)
       {
         // Current integration point data
-        const double xi = XI[igauss];
-        const double eta = ETA[igauss];
-        const double w = WTS[igauss];
-        shapeFunctions(xi, eta, N);
-        shapeFunctionsNaturalDerivatives(xi, eta, dN);
-        jac.calculate(reference_cs, dN);
-        const double dA = w * jac.detJ;
+        shapeFunctions(XI[igauss], ETA[igauss], N);
+        const double dA = geom.dA[igauss];
 
         // Strain-displacement matrix
-        computeBMatrix(reference_cs, xi, eta, jac, agq, mitc, N, dN, BQ_mean, B, BQ, Bd, m_eas);
+        fillBMatrix(geom, igauss, N, B, BQ, Bd, m_eas);
 
         // The drilling according to Hughes-Brezzi plays and important role in
 	// warped shells and the stiffness should be equal to the initial
@@ -1907,7 +2008,7 @@ void XC::ASDShellQ4::AGQIupdate(const Vector &UL) const
     m_eas->Q.addMatrixVector(1.0, m_eas->KQQ_inv, temp, -1.0);
   }
 
-void XC::ASDShellQ4::AGQIbeginGaussLoop(const ASDShellQ4LocalCoordinateSystem& reference_cs) const
+void XC::ASDShellQ4::AGQIbeginGaussLoop(void) const
   {
     // set to zero vectors and matrices for the static condensation
     // of internal DOFs before proceding with gauss integration
@@ -1915,27 +2016,102 @@ void XC::ASDShellQ4::AGQIbeginGaussLoop(const ASDShellQ4LocalCoordinateSystem& r
     m_eas->KUQ.Zero();
     m_eas->KQQ_inv.Zero();
     m_eas->Q_residual.Zero();
+  }
 
-    // Some matrices/vectors
-    auto& N = ASDShellQ4Globals::instance().N;
-    auto& dN = ASDShellQ4Globals::instance().dN;
+//! @brief Return the strain-displacement data that depend only on the
+//! reference geometry of the element, computing them again if the
+//! reference coordinates have changed.
+const XC::ASDShellQ4::GeometryData &XC::ASDShellQ4::getGeometryData(const ASDShellQ4LocalCoordinateSystem& reference_cs) const
+  {
+    const bool use_eas = (m_eas != nullptr);
+    std::array<double, 8> crds;
+    for (int i = 0; i < 4; i++)
+      {
+        crds[i] = reference_cs.X(i);
+        crds[i + 4] = reference_cs.Y(i);
+      }
+    if (m_geometry.valid && (m_geometry.eas == use_eas) && (m_geometry.crds == crds))
+        return m_geometry;
+
+    // Prepare all the parameters needed for the MITC4
+    // and AGQI formulations.
+    auto& mitc = ASDShellQ4Globals::instance().mitc;
+    auto& agq = ASDShellQ4Globals::instance().agq;
+    mitc.compute(reference_cs);
+    if (use_eas)
+        agq.compute(reference_cs);
 
     // Jacobian
     auto& jac = ASDShellQ4Globals::instance().jac;
 
-    // this one is already computed in the caller method
-    auto& agq = ASDShellQ4Globals::instance().agq;
+    // Some matrices/vectors
+    auto& B = ASDShellQ4Globals::instance().B;
+    auto& Bd = ASDShellQ4Globals::instance().Bd;
+    auto& BQ = ASDShellQ4Globals::instance().BQ;
+    auto& BQ_mean = ASDShellQ4Globals::instance().BQ_mean;
+    auto& N = ASDShellQ4Globals::instance().N;
+    auto& dN = ASDShellQ4Globals::instance().dN;
+    auto& dNdX = ASDShellQ4Globals::instance().dNdX;
 
     // The AGQI uses incompatible modes and only the weak patch test is passed.
     // Here we computed the mean Bq matrix for the enhanced strains. It will be subtracted
     // from the gauss-wise Bq matrices to make this element pass the strict patch test:
     // BQ = BQ - 1/A*int{BQ*dV}
-    auto& BQ_mean = ASDShellQ4Globals::instance().BQ_mean;
     BQ_mean.Zero();
-    double Atot = 0.0;
+    if (use_eas)
+      {
+        double Atot = 0.0;
+        std::array<double, 4> L;
+        for (int igauss = 0; igauss < 4; igauss++)
+          {
+            // Current integration point data
+            const double xi = XI[igauss];
+            const double eta = ETA[igauss];
+            const double w = WTS[igauss];
+            shapeFunctions(xi, eta, N);
+            shapeFunctionsNaturalDerivatives(xi, eta, dN);
+            jac.calculate(reference_cs, dN);
+            double dA = w * jac.detJ;
+            Atot += dA;
+
+            // area coordinates of the gauss point (Eq 7)
+            L[0] = 0.25 * (1.0 - xi) * (agq.g[1] * (1.0 - eta) + agq.g[2] * (1.0 + eta));
+            L[1] = 0.25 * (1.0 - eta) * (agq.g[3] * (1.0 - xi) + agq.g[2] * (1.0 + xi));
+            L[2] = 0.25 * (1.0 + xi) * (agq.g[0] * (1.0 - eta) + agq.g[3] * (1.0 + eta));
+            L[3] = 0.25 * (1.0 + eta) * (agq.g[0] * (1.0 - xi) + agq.g[1] * (1.0 + xi));
+
+            // strain matrix for internal dofs
+            for (int i = 0; i < 2; i++)
+              { 
+                int j = i + 1; if (j > 3) j = 0;
+                int k = j + 1; if (k > 3) k = 0;
+                const double NQX = (agq.b[i] * L[k] + agq.b[k] * L[i]) / agq.A / 2.0;
+                const double NQY = (agq.c[i] * L[k] + agq.c[k] * L[i]) / agq.A / 2.0;
+                const int index1 = i * 2;
+                const int index2 = index1 + 1;
+                BQ_mean(0, index1) += NQX * dA;
+                BQ_mean(1, index2) += NQY * dA;
+                BQ_mean(2, index1) += NQY * dA;
+                BQ_mean(2, index2) += NQX * dA;
+              }
+          }
+        // Average
+        BQ_mean /= Atot;
+      }
+
+    // Drilling strain-displacement matrix at center for reduced
+    // integration
+    shapeFunctions(0.0, 0.0, N);
+    shapeFunctionsNaturalDerivatives(0.0, 0.0, dN);
+    jac.calculate(reference_cs, dN);
+    computeBdrilling(reference_cs, 0.0, 0.0, jac, agq, N, dN, Bd, use_eas);
+    for (int i = 0; i < 4; i++)
+      {
+        m_geometry.dNdX0[i * 2] = dNdX(i, 0);
+        m_geometry.dNdX0[i * 2 + 1] = dNdX(i, 1);
+      }
 
     // Gauss loop
-    std::array<double, 4> L;
     for (int igauss = 0; igauss < 4; igauss++)
       {
         // Current integration point data
@@ -1945,32 +2121,33 @@ void XC::ASDShellQ4::AGQIbeginGaussLoop(const ASDShellQ4LocalCoordinateSystem& r
         shapeFunctions(xi, eta, N);
         shapeFunctionsNaturalDerivatives(xi, eta, dN);
         jac.calculate(reference_cs, dN);
-        double dA = w * jac.detJ;
-        Atot += dA;
-
-        // area coordinates of the gauss point (Eq 7)
-        L[0] = 0.25 * (1.0 - xi) * (agq.g[1] * (1.0 - eta) + agq.g[2] * (1.0 + eta));
-        L[1] = 0.25 * (1.0 - eta) * (agq.g[3] * (1.0 - xi) + agq.g[2] * (1.0 + xi));
-        L[2] = 0.25 * (1.0 + xi) * (agq.g[0] * (1.0 - eta) + agq.g[3] * (1.0 + eta));
-        L[3] = 0.25 * (1.0 + eta) * (agq.g[0] * (1.0 - xi) + agq.g[1] * (1.0 + xi));
+        m_geometry.dA[igauss] = w * jac.detJ;
 
-        // strain matrix for internal dofs
-        for (int i = 0; i < 2; i++)
-	  { 
-            int j = i + 1; if (j > 3) j = 0;
-            int k = j + 1; if (k > 3) k = 0;
-            const double NQX = (agq.b[i] * L[k] + agq.b[k] * L[i]) / agq.A / 2.0;
-            const double NQY = (agq.c[i] * L[k] + agq.c[k] * L[i]) / agq.A / 2.0;
-            const int index1 = i * 2;
-            const int index2 = index1 + 1;
-            BQ_mean(0, index1) += NQX * dA;
-            BQ_mean(1, index2) += NQY * dA;
-            BQ_mean(2, index1) += NQY * dA;
-            BQ_mean(2, index2) += NQX * dA;
-        }
-    }
+        // Strain-displacement matrix
+        computeBMatrix(reference_cs, xi, eta, jac, agq, mitc, N, dN, BQ_mean, B, BQ, Bd, use_eas);
 
-    // Average
-    BQ_mean /= Atot;
-}
+        // Store the terms that depend on the geometry
+        for (int i = 0; i < 4; i++)
+	  {
+            const int index = i * 6;
+            m_geometry.dNdX[igauss][i * 2] = B(0, index);
+            m_geometry.dNdX[igauss][i * 2 + 1] = B(1, index + 1);
+            for (int j = 0; j < 3; j++)
+	      {
+                m_geometry.shear[igauss][i * 3 + j] = B(6, index + 2 + j);
+                m_geometry.shear[igauss][12 + i * 3 + j] = B(7, index + 2 + j);
+	      }
+	  }
+        if (use_eas)
+	  {
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 4; j++)
+                    m_geometry.BQ[igauss][i * 4 + j] = BQ(i, j);
+	  }
+      }
 
+    m_geometry.crds = crds;
+    m_geometry.eas = use_eas;
+    m_geometry.valid = true;
+    return m_geometry;
+  }
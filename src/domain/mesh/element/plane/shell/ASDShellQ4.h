@@ -105,6 +105,7 @@
 #ifndef ASDShellQ4_h
 #define ASDShellQ4_h
 
+#include <array>
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
 #include "utility/matrix/ID.h"
@@ -146,6 +147,25 @@ class ASDShellQ4: public QuadBase4N<SectionFDPhysicalProperties>
         Matrix KQU = Matrix(4, 24); // L = G'*C*B
         Matrix KUQ = Matrix(24, 4); // L^T = B'*C'*G
       };
+
+    // strain-displacement data of the gauss points that depend only
+    // on the reference geometry of the element. They are computed
+    // once and reused until the reference coordinates change.
+    class GeometryData
+      {
+      public:
+        bool valid = false;
+        bool eas = false; // true if computed with the AGQI enhancement.
+        std::array<double, 8> crds = {}; // reference local coordinates (X1..X4, Y1..Y4)
+        std::array<double, 4> dA = {}; // integration weight times jacobian determinant
+        std::array<std::array<double, 8>, 4> dNdX = {}; // cartesian derivatives of the shape functions (node, direction)
+        std::array<double, 8> dNdX0 = {}; // the same at the element center (reduced integration of the drilling terms)
+        std::array<std::array<double, 24>, 4> shear = {}; // MITC4 shear strains (2 rows, DOFs 2, 3 and 4 of each node)
+        std::array<std::array<double, 12>, 4> BQ = {}; // AGQI B matrix for the internal DOFs (3 rows) minus its mean value
+
+        inline void invalidate(void)
+          { valid = false; }
+      };
     
   private:
     // coordinate transformation
@@ -176,6 +196,9 @@ class ASDShellQ4: public QuadBase4N<SectionFDPhysicalProperties>
     DrillingDOFMode m_drill_mode = DrillingDOF_Elastic;
     double m_drill_stab = 0.01;
     NLDrillingData* m_nldrill= nullptr;
+
+    // cached strain-displacement data
+    mutable GeometryData m_geometry;
     
   private:
 
@@ -191,10 +214,11 @@ class ASDShellQ4: public QuadBase4N<SectionFDPhysicalProperties>
     void copy_nldrill(const NLDrillingData &);
     // internal method to compute everything using switches...
     int calculateAll(Matrix& LHS, Vector& RHS, int options) const;
+    const GeometryData &getGeometryData(const ASDShellQ4LocalCoordinateSystem& reference_cs) const;
 
     void AGQIinitialize(void);
     void AGQIupdate(const Vector& UL) const;
-    void AGQIbeginGaussLoop(const ASDShellQ4LocalCoordinateSystem& reference_cs) const;
+    void AGQIbeginGaussLoop(void) const;
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
@@ -221,6 +245,12 @@ class ASDShellQ4: public QuadBase4N<SectionFDPhysicalProperties>
     virtual ~ASDShellQ4();
     Element *getCopy(void) const;
 
+    // formulation
+    bool isCorotational(void) const;
+    void setCorotational(const bool &);
+    bool getUseEAS(void) const;
+    void setUseEAS(const bool &);
+
     // domain
     int resetNodalCoordinates(void);
     void setDomain(Domain* theDomain);
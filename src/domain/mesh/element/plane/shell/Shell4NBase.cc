@@ -679,6 +679,27 @@ XC::ParticlePos3d XC::Shell4NBase::getLocalCoordinatesOfNode(const int &i) const
 XC::ParticlePos3d XC::Shell4NBase::getNaturalCoordinates(const Pos3d &p, bool initialGeometry) const
   { return theCoordTransf->getNaturalCoordinates(p,xl); }
 
+//! @brief Return true (the element implements locatePoint).
+bool XC::Shell4NBase::canLocatePoints(void) const
+  { return true; }
+
+//! @brief Return true if the distance from the point to the element
+//! plane is not greater than tol and its projection lies inside the
+//! element.
+//! @param p: position to locate.
+//! @param tol: distance tolerance.
+//! @param naturalCoordinates: (output) natural coordinates of the point.
+//! @param initialGeometry: if true, use undeformed element geometry.
+bool XC::Shell4NBase::locatePoint(const Pos3d &p, const double &tol, ParticlePos3d &naturalCoordinates, bool initialGeometry) const
+  {
+    naturalCoordinates= getNaturalCoordinates(p, initialGeometry);
+    const double limit= 1.0+1e-6;
+    // NaN coordinates (point far outside) fail the comparisons.
+    return (std::abs(naturalCoordinates.r_coordinate())<=limit)
+      && (std::abs(naturalCoordinates.s_coordinate())<=limit)
+      && (theCoordTransf->getPlane().dist(p)<=tol);
+  }
+
 //! @brief Returns interpolated displacements for a material point.
 XC::Vector XC::Shell4NBase::getInterpolatedDisplacements(const ParticlePos3d &pos) const
   {
@@ -144,6 +144,8 @@ class Shell4NBase: public QuadBase4N<SectionFDPhysicalProperties>
     void computeBasis(void);
     ParticlePos3d getLocalCoordinatesOfNode(const int &) const;
     ParticlePos3d getNaturalCoordinates(const Pos3d &, bool initialGeometry= true) const;
+    bool canLocatePoints(void) const;
+    bool locatePoint(const Pos3d &, const double &, ParticlePos3d &, bool initialGeometry= true) const;
     Pos3d getCartesianCoordinates(const ParticlePos2d &,bool initialGeometry= true) const;    
     Pos3d getCartesianCoordinates(const ParticlePos3d &,bool initialGeometry= true) const;    
     
@@ -58,6 +58,8 @@
 #include <domain/domain/Domain.h>
 #include <domain/mesh/element/utils/coordTransformation/R3vectors.h>
 #include "domain/mesh/element/utils/coordTransformation/ShellCrdTransf3dBase.h"
+#include "material/section/plate_section/ElasticPlateBase.h"
+#include "classTags.h"
 #include "utility/actor/actor/MovableVector.h"
 #include "utility/actor/actor/MovableMatrix.h"
 #include "utility/actor/actor/MovableVectors.h"
@@ -118,6 +120,8 @@ int XC::ShellMITC4Base::resetNodalCoordinates(void)
   {
     //update basis vectors and local coordinates
     this->computeBasis(); 
+    geometry.invalidate();
+    tangentCache.invalidate();
     return 0;
   }
 
@@ -207,223 +211,182 @@ const XC::Matrix XC::ShellMITC4Base::calculateG(void) const
     return G;
   }
 
-//! @brief return secant matrix
-const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
+//! @brief Return the geometry data of the Gauss points (shape functions,
+//! volume elements and MITC4 interpolation of the transverse shear
+//! strains). They are computed again only when the local coordinates
+//! of the nodes change (after a change of the nodal coordinates or
+//! an update of a non-linear coordinate transformation).
+const XC::ShellMITC4Kernels::GeometryData &XC::ShellMITC4Base::getGeometryData(void) const
   {
-    if(!Ki.isEmpty())
-      return Ki;
+    if(!geometry.isValid(xl))
+      {
+        const Matrix G= calculateG();
 
-    static const int ndf= 6; //two membrane plus three bending plus one drill
-    static const int numnodes= 4;
+        const double Ax= -xl[0][0]+xl[0][1]+xl[0][2]-xl[0][3];
+        const double Bx=  xl[0][0]-xl[0][1]+xl[0][2]-xl[0][3];
+        const double Cx= -xl[0][0]-xl[0][1]+xl[0][2]+xl[0][3];
 
-    int i,  j,  k, p, q;
-    int jj, kk;
+        const double Ay= -xl[1][0]+xl[1][1]+xl[1][2]-xl[1][3];
+        const double By=  xl[1][0]-xl[1][1]+xl[1][2]-xl[1][3];
+        const double Cy= -xl[1][0]-xl[1][1]+xl[1][2]+xl[1][3];
 
-    double volume= 0.0;
+        const double alpha= atan2(Ay,Ax);
+        const double beta= M_PI/2-atan2(Cx,Cy);
+        const double Rot[2][2]= {{sin(beta), -sin(alpha)}, {-cos(beta), cos(alpha)}};
 
-    static double xsj;  // determinant of the jacobian matrix 
-    static double dvol[ngauss]; //volume element
-    static double shp[3][numnodes];  //shape functions at a gauss point
+        double xsj; // determinant of the jacobian matrix.
+        double sx[2][2]; //inverse jacobian matrix.
+        for(int i= 0; i<ngauss; i++)
+          {
+            const GaussPoint &gp= getGaussModel().getGaussPoints()[i];
+            const double r= gp.r_coordinate();
+            const double s= gp.s_coordinate();
+            ShellMITC4Kernels::GaussPointData &gpData= geometry.gaussPoints[i];
+
+            //get shape functions
+            shape2d(r, s, xl, gpData.shp, xsj, sx);
+            //volume element
+            gpData.dvol= gp.weight() * xsj;
+
+            double r1= Cx + r*Bx;
+            double r3= Cy + r*By;
+            r1= sqrt(r1*r1 + r3*r3)/(8*xsj);
+            double r2= Ax + s*Bx;
+            r3= Ay + s*By;
+            r2= sqrt(r2*r2 + r3*r3)/(8*xsj);
+
+            // Bs= Rot*Bsv with Bsv= Ms*G (scaled) where:
+            // Ms(0,1)= 1-s, Ms(0,3)= 1+s, Ms(1,0)= 1-r, Ms(1,2)= 1+r
+            for(int j= 0; j<12; j++)
+              {
+                const double Bsv0= ((1-s)*G(1,j)+(1+s)*G(3,j))*r1;
+                const double Bsv1= ((1-r)*G(0,j)+(1+r)*G(2,j))*r2;
+                gpData.Bs[0][j]= Rot[0][0]*Bsv0+Rot[0][1]*Bsv1;
+                gpData.Bs[1][j]= Rot[1][0]*Bsv0+Rot[1][1]*Bsv1;
+              }
+          }
+        geometry.setCoordinates(xl);
+      }
+    return geometry;
+  }
 
-    //  static double Shape[3][numnodes][ngauss]; //all the shape functions
+//! @brief Compute the B matrices of the nodes at a Gauss point
+//! using the current basis vectors of the coordinate transformation.
+//!
+//! @param gp: geometry data of the Gauss point.
+//! @param B: B matrix of each node (output).
+//! @param Bd: drilling B matrix of each node (output).
+void XC::ShellMITC4Base::getNodeBMatrices(const ShellMITC4Kernels::GaussPointData &gp, ShellMITC4Kernels::NodeBMatrix B[], ShellMITC4Kernels::NodeBdrill Bd[]) const
+  {
+    const ShellMITC4Kernels::Basis basis(theCoordTransf->G1(), theCoordTransf->G2(), theCoordTransf->G3());
+    for(int j= 0; j<ShellMITC4Kernels::numNodes; j++)
+      {
+        ShellMITC4Kernels::node_B(gp, basis, j, B[j]);
+        ShellMITC4Kernels::node_Bdrill(gp, basis, j, Bd[j]);
+      }
+  }
 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
+//! @brief Add the stiffness contribution of a Gauss point.
+//!
+//! @param B: B matrix of each node.
+//! @param Bd: drilling B matrix of each node.
+//! @param dd: section tangent multiplied by the volume element.
+//! @param kdrill: drilling stiffness multiplied by the volume element.
+//! @param K: element stiffness in local axes (input/output).
+void XC::ShellMITC4Base::addGaussPointStiffness(const ShellMITC4Kernels::NodeBMatrix B[], const ShellMITC4Kernels::NodeBdrill Bd[], const ShellMITC4Kernels::SectionMatrix &dd, const double &kdrill, ShellMITC4Kernels::ElementMatrix &K) const
+  {
+    static const int ndf= ShellMITC4Kernels::ndf;
+    static const int numnodes= ShellMITC4Kernels::numNodes;
+    double BtDj[ndf][ShellMITC4Kernels::nstress];
+    ShellMITC4Kernels::NodeBdrill kBdj;
+    for(int j= 0; j<numnodes; j++)
+      {
+        //multiply bending terms by (-1.0) for correct statement
+        // of equilibrium
+        ShellMITC4Kernels::BtD(B[j], dd, BtDj);
+        for(int p= 0; p<ndf; p++)
+          kBdj[p]= kdrill*Bd[j][p];
+        for(int k= 0; k<numnodes; k++)
+          ShellMITC4Kernels::add_stiffness(BtDj, B[k], kBdj, Bd[k], K, j*ndf, k*ndf);
+      }
+  }
 
-    //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
-
-    double *drillPointer;
-
-    static double saveB[nstress][ndf][numnodes];
-
-    //-------------------------------------------------------
-
-    stiff.Zero( );
- 
-    Matrix G= calculateG();
-
-
-    Matrix Ms(2,4);
-    Ms.Zero();
-    Matrix Bsv(2,12);
-    Bsv.Zero();
-
-    const double Ax= -xl[0][0]+xl[0][1]+xl[0][2]-xl[0][3];
-    const double Bx=  xl[0][0]-xl[0][1]+xl[0][2]-xl[0][3];
-    const double Cx= -xl[0][0]-xl[0][1]+xl[0][2]+xl[0][3];
-
-    const double Ay= -xl[1][0]+xl[1][1]+xl[1][2]-xl[1][3];
-    const double By=  xl[1][0]-xl[1][1]+xl[1][2]-xl[1][3];
-    const double Cy= -xl[1][0]-xl[1][1]+xl[1][2]+xl[1][3];
-
-    const double alpha= atan2(Ay,Ax);
-    double beta= M_PI/2-atan2(Cx,Cy);
-    Matrix Rot(2,2);
-    Rot.Zero();
-    Rot(0,0)=sin(beta);
-    Rot(0,1)=-sin(alpha);
-    Rot(1,0)=-cos(beta);
-    Rot(1,1)=cos(alpha);
-    Matrix Bs(2,12);
-  
-    double r1= 0;
-    double r2= 0;
-    double r3= 0;
-
-    double sx[2][2]; //inverse jacobian matrix.
-    //gauss loop 
-    for(i=0;i<ngauss;i++)
+//! @brief Return the tangent stiffness matrix.
+//!
+//! If the tangent is constant (see hasConstantTangent) the matrix
+//! is computed again only if the section tangents or the drilling
+//! stiffness have changed. The section strains are updated anyway
+//! when computing the resisting force.
+const XC::Matrix &XC::ShellMITC4Base::getTangentStiff(void) const
+  {
+    if(!hasConstantTangent())
+      return Shell4NBase::getTangentStiff();
+
+    tangentCache.beginKey();
+    tangentCache.addToKey(Ktt);
+    for(int i= 0; i<ngauss; i++)
+      tangentCache.addToKey(physicalProperties[i]->getSectionTangent());
+    if(!tangentCache.isValid())
       {
-        const GaussPoint &gp= getGaussModel().getGaussPoints()[i];
-        r1= Cx + gp.r_coordinate()*Bx;
-        r3= Cy + gp.r_coordinate()*By;
-        r1= r1*r1 + r3*r3;
-        r1= sqrt (r1);
-        r2= Ax + gp.s_coordinate()*Bx;
-        r3= Ay + gp.s_coordinate()*By;
-        r2= r2*r2 + r3*r3;
-        r2= sqrt (r2);
-
-        //get shape functions    
-        shape2d( gp.r_coordinate(), gp.s_coordinate(), xl, shp, xsj, sx);
-        //volume element to also be saved
-        dvol[i]= gp.weight() * xsj;  
-        volume += dvol[i];
-
-        Ms(1,0)=1-gp.r_coordinate();
-        Ms(0,1)=1-gp.s_coordinate();
-        Ms(1,2)=1+gp.r_coordinate();
-        Ms(0,3)=1+gp.s_coordinate();
-        Bsv= Ms*G;
-
-        for( j= 0; j < 12; j++ )
-          {
-            Bsv(0,j)=Bsv(0,j)*r1/(8*xsj);
-            Bsv(1,j)=Bsv(1,j)*r2/(8*xsj);
-          }
-        Bs=Rot*Bsv;
-    
-        // j-node loop to compute strain 
-        for( j= 0; j < numnodes; j++ )
-          {
-            //compute B matrix 
-            Bmembrane= computeBmembrane( j, shp );
-            Bbend= computeBbend( j, shp );
-            for(p= 0; p < 3; p++)
-              {
-                Bshear(0,p)= Bs(0,j*3+p);
-                Bshear(1,p)= Bs(1,j*3+p);
-              }//end for p
-            BJ= assembleB( Bmembrane, Bbend, Bshear );
-
-	    //save the B-matrix
-           for(p=0; p<nstress; p++)
-             {
-               for(q=0; q<ndf; q++ )
-                 saveB[p][q][j]= BJ(p,q);
-             }//end for p
-
-           //drilling B matrix
-           drillPointer= computeBdrill( j, shp );
-           for(p=0; p<ndf; p++ )
-             {
-               //BdrillJ[p]= *drillPointer++;
-               BdrillJ[p]= *drillPointer; //set p-th component
-               drillPointer++;             //pointer arithmetic
-             }//end for p
-          } // end for j
-
-        dd= physicalProperties[i]->getInitialTangent( );
-        dd*= dvol[i];
-
-        //tangent calculations node loops
-
-        jj= 0;
-        for(j=0;j<numnodes;j++)
-          {
-            //extract BJ
-            for(p=0; p<nstress; p++)
-              {
-                for(q=0; q<ndf; q++ )
-                  BJ(p,q)= saveB[p][q][j];
-              }//end for p
+        theCoordTransf->update();
+        formResidAndTangent(1);
+        tangentCache.store(stiff);
+      }
+    else
+      {
+        if(!isDead())
+          return tangentCache.getStiff();
+        stiff= tangentCache.getStiff();
+      }
+    if(isDead())
+      stiff*=dead_srf;
+    return stiff;
+  }
 
-            //multiply bending terms by (-1.0) for correct statement
-            // of equilibrium  
-            for(p=3;p<6;p++)
-              {
-                for(q=3;q<6;q++)
-                  BJ(p,q) *= (-1.0);
-              } //end for p
+//! @brief Return true if the tangent stiffness doesn't depend on the
+//! element state (linear coordinate transformation and elastic
+//! plate sections).
+bool XC::ShellMITC4Base::hasConstantTangent(void) const
+  {
+    bool retval= (theCoordTransf && (theCoordTransf->getClassTag()==CRDTR_TAG_ShellLinearCrdTransf3d));
+    for(size_t i= 0;retval && i<physicalProperties.size();i++)
+      retval= (dynamic_cast<const ElasticPlateBase *>(physicalProperties[i])!=nullptr);
+    return retval;
+  }
 
-            //transpose 
-            //BJtran= transpose( 8, ndf, BJ );
-            for(p=0; p<ndf; p++)
-              {
-                for(q=0; q<nstress; q++) 
-                  BJtran(p,q)= BJ(q,p);
-              }//end for p
+//! @brief Return the number of times the tangent stiffness matrix
+//! has been computed again.
+size_t XC::ShellMITC4Base::getTangentStiffVersion(void) const
+  { return tangentCache.getVersion(); }
 
-            //drilling B matrix
-            drillPointer= computeBdrill( j, shp );
-            for(p=0; p<ndf; p++ )
-              {
-                BdrillJ[p]= *drillPointer;
-                drillPointer++;
-              }//end for p
-
-            //BJtranD= BJtran * dd;
-            BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 );
-      
-            for(p=0; p<ndf; p++) 
-              BdrillJ[p]*= ( Ktt*dvol[i] );
-      
-            kk= 0;
-            for(k= 0; k < numnodes; k++ )
-              {
-                //extract BK
-                for(p=0; p<nstress; p++)
-                  {
-                    for(q=0; q<ndf; q++ )
-                      BK(p,q)= saveB[p][q][k];
-                  }//end for p
-       
-                //stiffJK= BJtranD * BK;
-                // +  transpose( 1,ndf,BdrillJ ) * BdrillK; 
-                stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0 );
-
-                //drilling B matrix
-                drillPointer= computeBdrill( k, shp );
-                for(p=0; p<ndf; p++ )
-                  {
-                    BdrillK[p]= *drillPointer;
-                    drillPointer++;
-                  }//end for p
-        
-                for(p=0;p<ndf;p++)
-                  {
-                   for(q=0;q<ndf;q++)
-                     {
-                       stiff(jj+p,kk+q)+=stiffJK(p,q) + (BdrillJ[p]*BdrillK[q]);
-                     }//end for q
-                  }//end for p   
-                kk += ndf;
-              } // end for k loop
-          jj += ndf;
-        } // end for j loop
- 
+//! @brief return secant matrix
+const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
+  {
+    if(!Ki.isEmpty())
+      return Ki;
+
+    static const int ndf= ShellMITC4Kernels::ndf; //two membrane plus three bending plus one drill
+    static const int numnodes= ShellMITC4Kernels::numNodes;
+
+    const ShellMITC4Kernels::GeometryData &geom= getGeometryData();
+
+    ShellMITC4Kernels::ElementMatrix K= {}; // stiffness in local axes.
+    ShellMITC4Kernels::NodeBMatrix B[numnodes]; // B matrices of the nodes.
+    ShellMITC4Kernels::NodeBdrill Bd[numnodes]; // drilling B matrices of the nodes.
+    ShellMITC4Kernels::SectionMatrix dd; // material tangent.
+
+    //gauss loop
+    for(int i= 0; i<ngauss; i++)
+      {
+        const ShellMITC4Kernels::GaussPointData &gp= geom.gaussPoints[i];
+        getNodeBMatrices(gp, B, Bd);
+        ShellMITC4Kernels::from_matrix(physicalProperties[i]->getInitialTangent(), gp.dvol, dd);
+        addGaussPointStiffness(B, Bd, dd, Ktt*gp.dvol, K);
       } //end for i gauss loop
+
+    for(int p= 0; p<numnodes*ndf; p++)
+      for(int q= 0; q<numnodes*ndf; q++)
+        stiff(p,q)= K[p][q];
     theCoordTransf->getGlobalTangent(stiff);
     Ki= stiff;
     return stiff;
@@ -471,285 +434,91 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
     //  Shear strains gamma02, gamma12 constant through cross section
     //
 
-    static const int ndf= 6; //two membrane plus three bending plus one drill
-    static const int numnodes= 4;
+    static const int ndf= ShellMITC4Kernels::ndf; //two membrane plus three bending plus one drill
+    static const int numnodes= ShellMITC4Kernels::numNodes;
 
-    int i,  j,  k, p, q;
-    int jj, kk;
+    const ShellMITC4Kernels::GeometryData &geom= getGeometryData();
 
-    int success;
-    
-    double volume= 0.0;
-
-    static double xsj;  // determinant jacobian matrix 
-    static double dvol[ngauss]; //volume element
-    static double shp[3][numnodes];  //shape functions at a gauss point
-
-    //  static double Shape[3][numnodes][ngauss]; //all the shape functions
-    static Vector residJ(ndf); //nodeJ residual 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Vector stress(nstress);  //stress resultants
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
-
-    double epsDrill= 0.0;  //drilling "strain"
-    double tauDrill= 0.0; //drilling "stress"
+    //nodal "displacements" 
+    double ul[numnodes][ndf];
+    for(int j= 0; j<numnodes; j++)
+      {
+        const Vector u= theCoordTransf->getBasicTrialDisp(j);
+        for(int p= 0; p<ndf; p++)
+          ul[j][p]= u(p);
+      }
 
     //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
-
-    double *drillPointer;
-
-    static double saveB[nstress][ndf][numnodes];
-
-    //------------------------------------------------------- 
-
-    //zero stiffness and residual 
-    stiff.Zero( );
-    resid.Zero( );
-
-    const Matrix G= calculateG();
-
-    Matrix Ms(2,4);
-    Ms.Zero();
-    Matrix Bsv(2,12);
-    Bsv.Zero();
-
-    const double Ax= -xl[0][0]+xl[0][1]+xl[0][2]-xl[0][3];
-    const double Bx=  xl[0][0]-xl[0][1]+xl[0][2]-xl[0][3];
-    const double Cx= -xl[0][0]-xl[0][1]+xl[0][2]+xl[0][3];
-
-    const double Ay= -xl[1][0]+xl[1][1]+xl[1][2]-xl[1][3];
-    const double By=  xl[1][0]-xl[1][1]+xl[1][2]-xl[1][3];
-    const double Cy= -xl[1][0]-xl[1][1]+xl[1][2]+xl[1][3];
-
-    const double alpha= atan2(Ay,Ax);
-    const double beta= M_PI/2-atan2(Cx,Cy);
-    Matrix Rot(2,2);
-    Rot.Zero();
-    Rot(0,0)=sin(beta);
-    Rot(0,1)=-sin(alpha);
-    Rot(1,0)=-cos(beta);
-    Rot(1,1)=cos(alpha);
-    Matrix Bs(2,12);
-    
-    double r1= 0;
-    double r2= 0;
-    double r3= 0;
-
-    double sx[2][2]; //inverse jacobian matrix.
-    //gauss loop 
-    for(i= 0;i<ngauss;i++)
+    ShellMITC4Kernels::NodeBMatrix B[ngauss][numnodes];
+    ShellMITC4Kernels::NodeBdrill Bd[ngauss][numnodes];
+    double epsDrill[ngauss]; //drilling "strain"
+
+    // compute the strains at all the Gauss points.
+    for(int i= 0; i<ngauss; i++)
       {
-        const GaussPoint &gp= getGaussModel().getGaussPoints()[i];
-        r1= Cx + gp.r_coordinate()*Bx;
-        r3= Cy + gp.r_coordinate()*By;
-        r1= r1*r1 + r3*r3;
-        r1= sqrt (r1);
-        r2= Ax + gp.s_coordinate()*Bx;
-        r3= Ay + gp.s_coordinate()*By;
-        r2= r2*r2 + r3*r3;
-        r2= sqrt (r2);
-
-        //get shape functions    
-        shape2d( gp.r_coordinate(), gp.s_coordinate(), xl, shp, xsj, sx);
-        //volume element to also be saved
-        dvol[i]= gp.weight() * xsj;  
-        volume += dvol[i];
-
-        Ms(1,0)=1-gp.r_coordinate();
-        Ms(0,1)=1-gp.s_coordinate();
-        Ms(1,2)=1+gp.r_coordinate();
-        Ms(0,3)=1+gp.s_coordinate();
-        Bsv= Ms*G;
-
-        for(j=0;j<12;j++)
-          {
-            Bsv(0,j)=Bsv(0,j)*r1/(8*xsj);
-            Bsv(1,j)=Bsv(1,j)*r2/(8*xsj);
-          }
-        Bs=Rot*Bsv;
+        getNodeBMatrices(geom.gaussPoints[i], B[i], Bd[i]);
+        ShellMITC4Kernels::SectionVector strain= {};
+        epsDrill[i]= 0.0;
+        for(int j= 0; j<numnodes; j++)
+          ShellMITC4Kernels::add_strain(B[i][j], Bd[i][j], ul[j], strain, epsDrill[i]);
+        Vector &strainVector= this->strains[i];
+        strainVector.resize(nstress);
+        for(int p= 0; p<nstress; p++)
+          strainVector(p)= strain[p];
+      }
 
-	//! @brief Get the strain at Gauss point i.
+    // send the strains to the materials.
+    for(int i= 0; i<ngauss; i++)
+      {
 	Vector &strain= this->strains[i];
-	strain= Vector(nstress, 0.0); //zero the strains.
-	
-        epsDrill= 0.0;
-
-        // j-node loop to compute strain 
-        for(j=0;j<numnodes;j++)
-          {
-            //compute B matrix 
-            Bmembrane= computeBmembrane( j, shp );
-            Bbend= computeBbend( j, shp );
-
-            for(p=0;p<3;p++)
-              {
-                Bshear(0,p)= Bs(0,j*3+p);
-                Bshear(1,p)= Bs(1,j*3+p);
-              }//end for p
-            BJ= assembleB( Bmembrane, Bbend, Bshear );
-
-            //save the B-matrix
-            for(p=0; p<nstress; p++)
-              {
-                for(q=0; q<ndf; q++ )
-                  saveB[p][q][j]= BJ(p,q);
-              }//end for p
-
-            //nodal "displacements" 
-            const Vector &ul= theCoordTransf->getBasicTrialDisp(j);
-
-            //compute the strain
-            //strain += (BJ*ul); 
-            strain.addMatrixVector(1.0, BJ,ul,1.0 );
-
-            //drilling B matrix
-            drillPointer= computeBdrill( j, shp );
-            for(p=0; p<ndf; p++ )
-              {
-                BdrillJ[p]= *drillPointer; //set p-th component
-                drillPointer++;             //pointer arithmetic
-              }//end for p
-
-            //drilling "strain" 
-            for(p=0;p<ndf;p++)
-              epsDrill +=  BdrillJ[p]*ul(p);
-          } // end for j
-    
-
-        // send the strain to the material
 	// Check if there are initial strains.
 	if(!persistentInitialDeformation.empty())
 	  { strain-= persistentInitialDeformation[i]; }		 
-        success= const_cast<SectionForceDeformation *>(physicalProperties[i])->setTrialSectionDeformation(strain);
+        const_cast<SectionForceDeformation *>(physicalProperties[i])->setTrialSectionDeformation(strain);
+      }
 
-        //compute the stress
-        stress= physicalProperties[i]->getStressResultant( );
+    //residual and tangent calculations
+    ShellMITC4Kernels::ElementMatrix K= {}; // stiffness in local axes.
+    double R[numnodes][ndf]= {}; // residual in local axes.
+    ShellMITC4Kernels::SectionVector stress; //stress resultants
+    ShellMITC4Kernels::SectionMatrix dd; //material tangent
+    for(int i= 0; i<ngauss; i++)
+      {
+        const double dvol= geom.gaussPoints[i].dvol;
 
+        //compute the stress multiplied by volume element
+        ShellMITC4Kernels::from_vector(physicalProperties[i]->getStressResultant(), dvol, stress);
         //drilling "stress" 
-        tauDrill= Ktt * epsDrill;
+        const double tauDrill= Ktt * epsDrill[i] * dvol;
 
-        //multiply by volume element
-        stress*= dvol[i];
-        tauDrill*= dvol[i];
+        for(int j= 0; j<numnodes; j++)
+          ShellMITC4Kernels::add_residual(B[i][j], Bd[i][j], stress, tauDrill, R[j]);
 
-        if( tang_flag == 1 )
+        if(tang_flag == 1)
           {
-            dd= physicalProperties[i]->getSectionTangent( );
-            dd *= dvol[i];
+            ShellMITC4Kernels::from_matrix(physicalProperties[i]->getSectionTangent(), dvol, dd);
+            addGaussPointStiffness(B[i], Bd[i], dd, Ktt*dvol, K);
           } //end if tang_flag
+      } //end for i gauss loop
 
+    for(int j= 0, jj= 0; j<numnodes; j++, jj+= ndf)
+      for(int p= 0; p<ndf; p++)
+        resid(jj+p)= R[j][p];
+    for(int p= 0; p<numnodes*ndf; p++)
+      for(int q= 0; q<numnodes*ndf; q++)
+        stiff(p,q)= K[p][q];
 
-        //residual and tangent calculations node loops
-
-        jj= 0;
-        for(j=0;j<numnodes;j++)
-          {
-            //extract BJ
-            for(p=0; p<nstress;p++)
-              {
-                for(q=0;q<ndf;q++)
-                  BJ(p,q)= saveB[p][q][j];
-              }//end for p
-
-            //multiply bending terms by (-1.0) for correct statement
-            // of equilibrium  
-            for(p= 3;p<6;p++)
-              {
-                for(q=3;q<6;q++) 
-                  BJ(p,q) *= (-1.0);
-              } //end for p
-
-            //transpose 
-            for(p=0; p<ndf; p++)
-              {
-                for(q=0; q<nstress; q++) 
-                  BJtran(p,q)= BJ(q,p);
-              }//end for p
-
-            residJ.addMatrixVector(0.0, BJtran,stress,1.0 );
-
-            //drilling B matrix
-            drillPointer= computeBdrill( j, shp );
-            for(p=0; p<ndf; p++ )
-              {
-                BdrillJ[p]= *drillPointer;
-                drillPointer++;
-              }//end for p
-
-            //residual including drill
-            for(p=0;p<ndf;p++)
-              resid( jj + p ) += ( residJ(p) + BdrillJ[p]*tauDrill );
-
-            if(tang_flag==1)
-              {
-                BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 );
-                for(p=0; p<ndf; p++) 
-                  BdrillJ[p] *= ( Ktt*dvol[i] );
-
-                kk= 0;
-                for(k=0;k<numnodes;k++)
-                  {
-                    //extract BK
-                    for(p=0; p<nstress; p++)
-                      {
-                        for(q=0; q<ndf; q++ )
-                          BK(p,q)= saveB[p][q][k];
-                      }//end for p
-            
-                     //drilling B matrix
-                     drillPointer= computeBdrill( k, shp );
-                     for(p=0; p<ndf; p++ )
-                       {
-                         BdrillK[p]= *drillPointer;
-                         drillPointer++;
-                       }//end for p
- 
-                    //stiffJK= BJtranD * BK;
-                    // +  transpose( 1,ndf,BdrillJ ) * BdrillK; 
-                    stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0);
-
-                    for(p=0;p<ndf;p++)
-                      {
-                        for(q=0;q<ndf;q++)
-                          {
-                            stiff(jj+p,kk+q) += stiffJK(p,q) + (BdrillJ[p]*BdrillK[q]);
-                          }//end for q
-                      }//end for p
-                    kk+= ndf;
-                  } // end for k loop
-              } // end if tang_flag 
-          jj+= ndf;
-        } // end for j loop
-      } //end for i gauss loop
     // Self weigth
     if(applyLoad == 1)
       {
 	const int nShape= 3;
-	const int numberNodes= 4;
 	const int massIndex= nShape - 1;
 	double temp;
 	//If defined, apply self-weight
 	static Vector momentum(ndf);
-	double ddvol = 0;
-	for(i = 0;i<ngauss;i++)
+	for(int i = 0;i<ngauss;i++)
 	  {
-	    //get shape functions    
-            const GaussPoint &gp= getGaussModel().getGaussPoints()[i];
-            shape2d(gp.r_coordinate(), gp.s_coordinate(), xl, shp, xsj, sx);
-
-	    //volume element to also be saved
-	    ddvol= gp.weight() * xsj;  
+            const ShellMITC4Kernels::GaussPointData &gp= geom.gaussPoints[i];
 
 	    //node loop to compute accelerations
 	    momentum.Zero( );
@@ -765,10 +534,10 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
 
 
 	    //residual and tangent calculations node loops
-	    for(j=0, jj=0; j<numberNodes; j++, jj+=ndf )
+	    for(int j=0, jj=0; j<numnodes; j++, jj+=ndf )
 	      {
-  	        temp = shp[massIndex][j] * ddvol;
-  	        for( p = 0; p < 3; p++ )
+  	        temp = gp.shp[massIndex][j] * gp.dvol;
+  	        for(int p = 0; p < 3; p++ )
 		  resid( jj+p ) += ( temp * momentum(p) );
 	      }
 	  }
@@ -777,215 +546,6 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
     return;
   }
 
-//! @brief compute Bdrill
-double *XC::ShellMITC4Base::computeBdrill( int node, const double shp[3][4]) const
-  {
-
-    //static Matrix Bdrill(1,6);
-    static double Bdrill[6];
-
-    static double B1;
-    static double B2;
-    static double B6;
-
-
-//---Bdrill Matrix in standard {1,2,3} mechanics notation---------
-//
-//             -                                       -
-//   Bdrill= | -0.5*N,2   +0.5*N,1    0    0    0   -N |   (1x6)
-//             -                                       -
-//
-//----------------------------------------------------------------
-
-    //  Bdrill.Zero( );
-
-    //Bdrill(0,0)= -0.5*shp[1][node];
-
-    //Bdrill(0,1)= +0.5*shp[0][node];
-
-    //Bdrill(0,5)=     -shp[2][node];
-
-
-    B1= -0.5*shp[1][node];
-    B2= +0.5*shp[0][node];
-    B6= -shp[2][node];
-   
-    const Vector &g1= theCoordTransf->G1();
-    const Vector &g2= theCoordTransf->G2();
-
-    Bdrill[0]= B1*g1[0] + B2*g2[0];
-    Bdrill[1]= B1*g1[1] + B2*g2[1];
-    Bdrill[2]= B1*g1[2] + B2*g2[2];
-
-    const Vector &g3= theCoordTransf->G3();
-    Bdrill[3]= B6*g3[0];
-    Bdrill[4]= B6*g3[1];
-    Bdrill[5]= B6*g3[2];
-
-    return Bdrill;
-  }
-
-//! @brief compute Bmembrane matrix
-const XC::Matrix &XC::ShellMITC4Base::computeBmembrane( int node, const double shp[3][4] ) const
-  {
-
-    static Matrix Bmembrane(3,2);
-
-//---Bmembrane matrix in standard {1,2,3} mechanics notation---------
-//
-//                -             -
-//               | +N,1      0   |
-// Bmembrane=    |   0     +N,2  |    (3x2)
-//               | +N,2    +N,1  |
-//                -             -
-//
-//  three(3) strains and two(2) displacements (for plate)
-//-------------------------------------------------------------------
-
-    Bmembrane.Zero( );
-
-    Bmembrane(0,0)= shp[0][node];
-    Bmembrane(1,1)= shp[1][node];
-    Bmembrane(2,0)= shp[1][node];
-    Bmembrane(2,1)= shp[0][node];
-
-    return Bmembrane;
-  }
-
-//! @brief assemble a B matrix
-//! @param Bmembrane: membrane B matrix (3x2)
-//! @param Bbend:  plate bending B matrix (3x2)
-//! @param Bshear: plate shear B matrix (2x3)
-const XC::Matrix &XC::ShellMITC4Base::assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const
-  {
-
-    static Matrix B(8,6);
-    static Matrix BmembraneShell(3,3);
-    static Matrix BbendShell(3,3);
-    static Matrix BshearShell(2,6);
-    static Matrix Gmem(2,3);
-    static Matrix Gshear(3,6);
-
-//
-// For Shell :
-//
-//---B Matrices in standard {1,2,3} mechanics notation---------
-//
-//            -                     _
-//           | Bmembrane  |     0    |
-//           | --------------------- |
-//    B=     |     0      |  Bbend   |   (8x6)
-//           | --------------------- |
-//           |         Bshear        |
-//            -           -         -
-//
-//-------------------------------------------------------------
-//
-//
-
-
-    //shell modified membrane terms
-
-    const Vector &g1= theCoordTransf->G1();
-    Gmem(0,0)= g1[0];
-    Gmem(0,1)= g1[1];
-    Gmem(0,2)= g1[2];
-
-    const Vector &g2= theCoordTransf->G2();
-    Gmem(1,0)= g2[0];
-    Gmem(1,1)= g2[1];
-    Gmem(1,2)= g2[2];
-
-    //BmembraneShell= Bmembrane * Gmem;
-    BmembraneShell.addMatrixProduct(0.0, Bmembrane,Gmem,1.0 );
-
-
-    //shell modified bending terms
-    Matrix &Gbend= Gmem;
-
-    //BbendShell= Bbend * Gbend;
-    BbendShell.addMatrixProduct(0.0, Bbend,Gbend,1.0 );
-
-
-    //shell modified shear terms
-    Gshear.Zero( );
-
-    const Vector &g3= theCoordTransf->G3();
-    Gshear(0,0)= g3[0];
-    Gshear(0,1)= g3[1];
-    Gshear(0,2)= g3[2];
-
-    Gshear(1,3)= g1[0];
-    Gshear(1,4)= g1[1];
-    Gshear(1,5)= g1[2];
-
-    Gshear(2,3)= g2[0];
-    Gshear(2,4)= g2[1];
-    Gshear(2,5)= g2[2];
-
-    //BshearShell= Bshear * Gshear;
-    BshearShell.addMatrixProduct(0.0, Bshear,Gshear,1.0 );
-
-    B.Zero( );
-
-    //assemble B from sub-matrices
-
-    //membrane terms
-    for(int p= 0; p < 3; p++ )
-      {
-        for(int q= 0; q < 3; q++ )
-          B(p,q)= BmembraneShell(p,q);
-      } //end for p
-
-
-    //bending terms
-    int pp;
-    for(int p= 3; p < 6; p++ )
-      {
-        pp= p - 3;
-        for(int q= 3; q < 6; q++ )
-          B(p,q)= BbendShell(pp,q-3);
-      } // end for p
-
-
-    //shear terms
-    for(int p= 0; p < 2; p++ )
-      {
-        pp= p + 6;
-        for(int q= 0; q < 6; q++ )
-          { B(pp,q)= BshearShell(p,q); } // end for q
-      } //end for p
-
-    return B;
-  }
-
-//! @brief compute Bbend matrix
-const XC::Matrix &XC::ShellMITC4Base::computeBbend( int node, const double shp[3][4] ) const
-  {
-
-      static XC::Matrix Bbend(3,2);
-
-//---Bbend matrix in standard {1,2,3} mechanics notation---------
-//
-//            -             -
-//   Bbend=  |    0    -N,1  |
-//           |  +N,2     0   |    (3x2)
-//           |  +N,1   -N,2  |
-//            -             -
-//
-//  three(3) curvatures and two(2) rotations (for plate)
-//----------------------------------------------------------------
-
-      Bbend.Zero( );
-
-      Bbend(0,1)= -shp[0][node];
-      Bbend(1,0)=  shp[1][node];
-      Bbend(2,0)=  shp[0][node];
-      Bbend(2,1)= -shp[1][node];
-
-      return Bbend;
-  }
-
 //! @brief Send members through the communicator argument.
 int XC::ShellMITC4Base::sendData(Communicator &comm)
   {
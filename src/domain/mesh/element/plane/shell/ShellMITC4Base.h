@@ -31,6 +31,8 @@
 #define ShellMITC4Base_h
 
 #include "Shell4NBase.h"
+#include "ShellMITC4Kernels.h"
+#include "domain/mesh/element/utils/TangentStiffCache.h"
 
 namespace XC {
 
@@ -47,14 +49,14 @@ class ShellMITC4Base: public Shell4NBase
     mutable std::vector<Vector> strains; //!< strains at gauss points.
     std::vector<Vector> persistentInitialDeformation; //!< Persistent initial strain at element level. Used to store the deformation during the inactive phase of the element (if any).
     static ShellBData BData; //!< B-bar data
-
+    mutable ShellMITC4Kernels::GeometryData geometry; //!< shape functions and MITC4 shear interpolation at the Gauss points.
+    mutable TangentStiffCache tangentCache; //!< Cached tangent stiffness (linear transformation and elastic sections only).
 
     void formResidAndTangent(int tang_flag) const;
     const Matrix calculateG(void) const;
-    double *computeBdrill(int node, const double shp[3][4]) const;
-    const Matrix& assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const;
-    const Matrix& computeBmembrane(int node, const double shp[3][4] ) const;
-    const Matrix& computeBbend(int node, const double shp[3][4] ) const;
+    const ShellMITC4Kernels::GeometryData &getGeometryData(void) const;
+    void getNodeBMatrices(const ShellMITC4Kernels::GaussPointData &, ShellMITC4Kernels::NodeBMatrix B[], ShellMITC4Kernels::NodeBdrill Bd[]) const;
+    void addGaussPointStiffness(const ShellMITC4Kernels::NodeBMatrix B[], const ShellMITC4Kernels::NodeBdrill Bd[], const ShellMITC4Kernels::SectionMatrix &dd, const double &kdrill, ShellMITC4Kernels::ElementMatrix &K) const;
     int sendData(Communicator &);
     int recvData(const Communicator &);
 
@@ -73,7 +75,10 @@ class ShellMITC4Base: public Shell4NBase
     void setDomain(Domain *theDomain);
   
     //return stiffness matrix 
+    const Matrix &getTangentStiff(void) const;
     const Matrix &getInitialStiff(void) const;
+    bool hasConstantTangent(void) const;
+    size_t getTangentStiffVersion(void) const;
 
     void alive(void);
 
@@ -0,0 +1,295 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ShellMITC4Kernels.h
+
+#ifndef ShellMITC4Kernels_h
+#define ShellMITC4Kernels_h
+
+#include <array>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+
+namespace XC {
+
+//! @ingroup PlaneElements
+//
+//! @brief Fixed-size kernels used in the Gauss point loop of the
+//! MITC4 shell elements (see ShellMITC4Base).
+//!
+//! The shape functions, the volume elements and the MITC4 interpolation
+//! of the transverse shear strains depend only on the local coordinates
+//! of the nodes, so they are stored in a GeometryData object that is
+//! computed once and reused until those coordinates change. The
+//! strain-displacement matrices are then rebuilt from them using the
+//! current basis vectors of the coordinate transformation.
+class ShellMITC4Kernels
+  {
+  public:
+    static const int numNodes= 4; //!< number of nodes.
+    static const int ndf= 6; //!< two membrane plus three bending plus one drill.
+    static const int nstress= 8; //!< three membrane, three moment, two shear.
+    static const int ngauss= 4; //!< number of Gauss points.
+    typedef double NodeBMatrix[nstress][ndf]; //!< B matrix of a node.
+    typedef double NodeBdrill[ndf]; //!< drilling B matrix of a node.
+    typedef double SectionVector[nstress]; //!< section stress or strain.
+    typedef double SectionMatrix[nstress][nstress]; //!< section tangent.
+    typedef double ElementMatrix[numNodes*ndf][numNodes*ndf]; //!< element stiffness.
+
+    //! @brief Geometry data of a Gauss point.
+    struct GaussPointData
+      {
+        double shp[3][numNodes]; //!< shape function derivatives (local axes) and values.
+        double dvol; //!< volume element (weight times jacobian determinant).
+        double Bs[2][3*numNodes]; //!< MITC4 interpolation of the transverse shear strains.
+      };
+
+    //! @brief Geometry data of the element.
+    class GeometryData
+      {
+        double xl[2][numNodes]; //!< local coordinates used to compute the data.
+        bool valid; //!< true if the data have been computed.
+      public:
+        std::array<GaussPointData, ngauss> gaussPoints; //!< data of each Gauss point.
+
+        GeometryData(void)
+          : valid(false) {}
+        //! @brief Mark the data as out of date.
+        inline void invalidate(void)
+          { valid= false; }
+        //! @brief Return true if the data correspond to the given local coordinates.
+        bool isValid(const double x[2][numNodes]) const
+          {
+            if(!valid)
+              return false;
+            for(int i= 0; i<2; i++)
+              for(int j= 0; j<numNodes; j++)
+                if(xl[i][j]!=x[i][j])
+                  return false;
+            return true;
+          }
+        //! @brief Store the local coordinates used to compute the data.
+        void setCoordinates(const double x[2][numNodes])
+          {
+            for(int i= 0; i<2; i++)
+              for(int j= 0; j<numNodes; j++)
+                xl[i][j]= x[i][j];
+            valid= true;
+          }
+      };
+
+    //! @brief Basis vectors of the element (see ShellCrdTransf3dBase).
+    struct Basis
+      {
+        double g1[3];
+        double g2[3];
+        double g3[3];
+        Basis(const Vector &v1, const Vector &v2, const Vector &v3)
+          {
+            for(int i= 0; i<3; i++)
+              { g1[i]= v1(i); g2[i]= v2(i); g3[i]= v3(i); }
+          }
+      };
+
+    //! @brief Compute the B matrix of the node.
+    //!
+    //! @verbatim
+    //!            -                     _
+    //!           | Bmembrane  |     0    |
+    //!           | --------------------- |
+    //!    B=     |     0      |  Bbend   |   (8x6)
+    //!           | --------------------- |
+    //!           |         Bshear        |
+    //!            -           -         -
+    //! @endverbatim
+    //!
+    //! @param gp: geometry data of the Gauss point.
+    //! @param basis: basis vectors of the element.
+    //! @param node: node index.
+    //! @param B: B matrix of the node (output).
+    static void node_B(const GaussPointData &gp, const Basis &basis, int node, NodeBMatrix &B)
+      {
+        const double N1= gp.shp[0][node];
+        const double N2= gp.shp[1][node];
+        const double *Bs0= gp.Bs[0]+3*node;
+        const double *Bs1= gp.Bs[1]+3*node;
+        for(int q= 0; q<3; q++)
+          {
+            const double g1= basis.g1[q];
+            const double g2= basis.g2[q];
+            const double g3= basis.g3[q];
+            // membrane terms.
+            B[0][q]= N1*g1;
+            B[1][q]= N2*g2;
+            B[2][q]= N2*g1+N1*g2;
+            B[3][q]= 0.0;
+            B[4][q]= 0.0;
+            B[5][q]= 0.0;
+            // bending terms.
+            B[0][q+3]= 0.0;
+            B[1][q+3]= 0.0;
+            B[2][q+3]= 0.0;
+            B[3][q+3]= -N1*g2;
+            B[4][q+3]= N2*g1;
+            B[5][q+3]= N1*g1-N2*g2;
+            // shear terms.
+            B[6][q]= Bs0[0]*g3;
+            B[7][q]= Bs1[0]*g3;
+            B[6][q+3]= Bs0[1]*g1+Bs0[2]*g2;
+            B[7][q+3]= Bs1[1]*g1+Bs1[2]*g2;
+          }
+      }
+
+    //! @brief Compute the drilling B matrix of the node.
+    //!
+    //! Bdrill= | -0.5*N,2   +0.5*N,1    0    0    0   -N | (1x6)
+    //! expressed in the basis of the element.
+    static void node_Bdrill(const GaussPointData &gp, const Basis &basis, int node, NodeBdrill &Bd)
+      {
+        const double B1= -0.5*gp.shp[1][node];
+        const double B2= +0.5*gp.shp[0][node];
+        const double B6= -gp.shp[2][node];
+        for(int q= 0; q<3; q++)
+          {
+            Bd[q]= B1*basis.g1[q]+B2*basis.g2[q];
+            Bd[q+3]= B6*basis.g3[q];
+          }
+      }
+
+    //! @brief Add the strains produced by the nodal displacements.
+    //!
+    //! @param B: B matrix of the node.
+    //! @param Bd: drilling B matrix of the node.
+    //! @param u: displacements of the node.
+    //! @param strain: section strains (input/output).
+    //! @param epsDrill: drilling "strain" (input/output).
+    static void add_strain(const NodeBMatrix &B, const NodeBdrill &Bd, const double u[ndf], SectionVector &strain, double &epsDrill)
+      {
+        for(int p= 0; p<nstress; p++)
+          {
+            double s= 0.0;
+            for(int q= 0; q<ndf; q++)
+              s+= B[p][q]*u[q];
+            strain[p]+= s;
+          }
+        for(int q= 0; q<ndf; q++)
+          epsDrill+= Bd[q]*u[q];
+      }
+
+    //! @brief Return the sign used for the (p,q) term of the B matrix in
+    //! the equilibrium statements (bending terms are multiplied by -1).
+    static inline double equilibrium_sign(int p, int q)
+      { return ((p>=3) && (p<6) && (q>=3)) ? -1.0 : 1.0; }
+
+    //! @brief Add the nodal forces due to the stresses of the Gauss point.
+    //!
+    //! @param B: B matrix of the node.
+    //! @param Bd: drilling B matrix of the node.
+    //! @param stress: section stresses multiplied by the volume element.
+    //! @param tauDrill: drilling "stress" multiplied by the volume element.
+    //! @param resid: nodal forces (input/output).
+    static void add_residual(const NodeBMatrix &B, const NodeBdrill &Bd, const SectionVector &stress, const double &tauDrill, double resid[ndf])
+      {
+        for(int q= 0; q<ndf; q++)
+          {
+            double r= Bd[q]*tauDrill;
+            for(int p= 0; p<nstress; p++)
+              r+= equilibrium_sign(p,q)*B[p][q]*stress[p];
+            resid[q]+= r;
+          }
+      }
+
+    //! @brief Compute B1^T*D, where B1 is the B matrix with the
+    //! bending terms multiplied by -1.
+    //!
+    //! @param B: B matrix of the node.
+    //! @param dd: section tangent multiplied by the volume element.
+    //! @param BtD: result (6x8).
+    static void BtD(const NodeBMatrix &B, const SectionMatrix &dd, double BtD[ndf][nstress])
+      {
+        // Nonzero rows of the columns of B: membrane
+        // columns (0,1,2,6,7) and bending ones (3,4,5,6,7).
+        static const int rows[2][5]= {{0,1,2,6,7},{3,4,5,6,7}};
+        for(int q= 0; q<ndf; q++)
+          {
+            const int *r= rows[q/3];
+            for(int t= 0; t<nstress; t++)
+              {
+                double s= 0.0;
+                for(int k= 0; k<5; k++)
+                  {
+                    const int p= r[k];
+                    s+= equilibrium_sign(p,q)*B[p][q]*dd[p][t];
+                  }
+                BtD[q][t]= s;
+              }
+          }
+      }
+
+    //! @brief Add the stiffness of the node pair (j,k):
+    //! B1j^T*D*Bk + Bdj^T*ktt*Bdk.
+    //!
+    //! @param BtDj: B1^T*D for node j.
+    //! @param Bk: B matrix of node k.
+    //! @param kBdj: drilling B matrix of node j multiplied by the drilling stiffness and the volume element.
+    //! @param Bdk: drilling B matrix of node k.
+    //! @param K: element stiffness (input/output).
+    //! @param jj: first row of node j.
+    //! @param kk: first column of node k.
+    static void add_stiffness(const double BtDj[ndf][nstress], const NodeBMatrix &Bk, const NodeBdrill &kBdj, const NodeBdrill &Bdk, ElementMatrix &K, int jj, int kk)
+      {
+        static const int rows[2][5]= {{0,1,2,6,7},{3,4,5,6,7}};
+        for(int p= 0; p<ndf; p++)
+          for(int q= 0; q<ndf; q++)
+            {
+              const int *r= rows[q/3];
+              double s= kBdj[p]*Bdk[q];
+              for(int k= 0; k<5; k++)
+                s+= BtDj[p][r[k]]*Bk[r[k]][q];
+              K[jj+p][kk+q]+= s;
+            }
+      }
+
+    //! @brief Copy the values of a section vector.
+    static void from_vector(const Vector &v, const double &factor, SectionVector &retval)
+      {
+        for(int i= 0; i<nstress; i++)
+          retval[i]= factor*v(i);
+      }
+
+    //! @brief Copy the values of a section matrix.
+    static void from_matrix(const Matrix &m, const double &factor, SectionMatrix &retval)
+      {
+        for(int i= 0; i<nstress; i++)
+          for(int j= 0; j<nstress; j++)
+            retval[i][j]= factor*m(i,j);
+      }
+  };
+
+} // end of XC namespace
+
+#endif
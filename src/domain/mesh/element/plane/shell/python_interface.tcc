@@ -72,4 +72,6 @@ class_<XC::ShellNLDKGQ, bases<XC::Shell4NBase>, boost::noncopyable >("ShellNLDKG
 
 class_<XC::ASDShellQ4, bases<QuadBase4N_SFD>, boost::noncopyable >("ASDShellQ4", no_init)
     .def("getSection", make_function(&XC::ASDShellQ4::getSectionPtr, return_internal_reference<>() ), "getSection(i): return the i-th section of the element.")
+    .add_property("corotational", &XC::ASDShellQ4::isCorotational, &XC::ASDShellQ4::setCorotational, "True if the element uses the co-rotational formulation.")
+    .add_property("useEAS", &XC::ASDShellQ4::getUseEAS, &XC::ASDShellQ4::setUseEAS, "True if the element uses the AGQI enhancement of the membrane strains.")
    ;
@@ -88,6 +88,8 @@ class_<XC::Element, XC::Element *,bases<XC::MeshComponent>, boost::noncopyable >
   .def("getNodeResistingForceIncInertiaByTag", make_function(getNodeResistingForceIncInertiaTAG, return_internal_reference<>() ),"getNodeResistingForceIncInertia(nodeTag): returns the generalized force of the element over the given node including inertia effects.")
   .def("getTangentStiff",make_function(getTangentStiffRef, return_internal_reference<>() ),"Return tangent stiffness matrix.")
   .def("getInitialStiff",make_function(getInitialStiffRef, return_internal_reference<>() ),"Return initial stiffness matrix.")
+  .def("hasConstantTangent", &XC::Element::hasConstantTangent,"Return true if the tangent stiffness of the element does not depend on its state (linear geometry and elastic materials).")
+  .add_property("tangentStiffVersion", &XC::Element::getTangentStiffVersion,"Number of times the tangent stiffness matrix has been computed again (only for elements with constant tangent).")
   .add_property("mass", make_function(getMassRef, return_internal_reference<>()) ,"Element mass matrix.")
   .add_property("totalMass", getTotalMassRef, "Returns the sum of the mass matrices corresponding to the nodes.")
   .def("getTotalMassComponent", &XC::Element::getTotalMassComponent,"Return the total mass matrix component for the DOF argument.")
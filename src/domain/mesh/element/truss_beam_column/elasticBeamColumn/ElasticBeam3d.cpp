@@ -74,6 +74,7 @@
 #include "material/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 #include "utility/utils/misc_utils/colormod.h"
+#include "classTags.h"
 
 XC::Matrix XC::ElasticBeam3d::K(12,12);
 XC::Vector XC::ElasticBeam3d::P(12);
@@ -304,13 +305,45 @@ const XC::Matrix &XC::ElasticBeam3d::getTangentStiff(void) const
     q.My2()+= q0[4];
 
     static Matrix retval;
-    retval= theCoordTransf->getGlobalStiffMatrix(kb,q);
+    if(hasConstantTangent())
+      {
+	// The global stiffness depends on kb and on the state of the
+	// coordinate transformation (axes, length and joint offsets).
+	tangentCache.beginKey();
+	tangentCache.addToKey(kb);
+	tangentCache.addToKey(theCoordTransf->getTrfMatrix());
+	tangentCache.addToKey(theCoordTransf->getInitialLength());
+	tangentCache.addToKey(theCoordTransf->getRigidJointOffsetI());
+	tangentCache.addToKey(theCoordTransf->getRigidJointOffsetJ());
+	if(!tangentCache.isValid())
+	  tangentCache.store(theCoordTransf->getGlobalStiffMatrix(kb,q));
+	if(!isDead())
+	  return tangentCache.getStiff();
+	retval= tangentCache.getStiff();
+      }
+    else
+      retval= theCoordTransf->getGlobalStiffMatrix(kb,q);
     if(isDead())
       retval*=dead_srf;
 
     return retval;
   }
 
+//! @brief Return true if the tangent stiffness doesn't depend on the
+//! element state (linear coordinate transformation).
+bool XC::ElasticBeam3d::hasConstantTangent(void) const
+  {
+    bool retval= false;
+    if(theCoordTransf)
+      retval= (theCoordTransf->getClassTag()==CRDTR_TAG_LinearCrdTransf3d);
+    return retval;
+  }
+
+//! @brief Return the number of times the tangent stiffness matrix
+//! has been computed again.
+size_t XC::ElasticBeam3d::getTangentStiffVersion(void) const
+  { return tangentCache.getVersion(); }
+
 //! @brief Return the initial stiffness matrix.
 const XC::Matrix &XC::ElasticBeam3d::getInitialStiff(void) const
   {
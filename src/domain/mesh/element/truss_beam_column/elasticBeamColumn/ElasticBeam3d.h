@@ -66,6 +66,7 @@
 #include "domain/mesh/element/truss_beam_column/EsfBeamColumn3d.h"
 #include "domain/mesh/element/utils/fvectors/FVectorBeamColumn3d.h"
 #include "domain/mesh/element/utils/coordTransformation/CrdTransf3d.h"
+#include "domain/mesh/element/utils/TangentStiffCache.h"
 
 namespace XC {
 class Channel;
@@ -89,6 +90,7 @@ class ElasticBeam3d: public ElasticBeam3dBase
     static Vector P;
     
     static Matrix kb;
+    mutable TangentStiffCache tangentCache; //!< Cached tangent stiffness (linear transformation only).
 
   protected:
     DbTagData &getDbTagData(void) const;
@@ -121,6 +123,8 @@ class ElasticBeam3d: public ElasticBeam3dBase
 
     const Matrix &getTangentStiff(void) const;
     const Matrix &getInitialStiff(void) const;
+    bool hasConstantTangent(void) const;
+    size_t getTangentStiffVersion(void) const;
     const Matrix &getMass(void) const;    
 
     void zeroLoad(void);	
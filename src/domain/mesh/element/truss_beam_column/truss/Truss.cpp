@@ -66,6 +66,7 @@
 #include <domain/mesh/node/Node.h>
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 #include <material/uniaxial/UniaxialMaterial.h>
+#include "material/uniaxial/ElasticMaterial.h"
 #include "material/uniaxial/InitStressMaterial.h"
 #include <material/uniaxial/CableMaterial.h>
 #include <domain/load/ElementalLoad.h>
@@ -376,29 +377,58 @@ const XC::Matrix &XC::Truss::getTangentStiff(void) const
       }
 
     double E = theMaterial->getTangent();
+    const bool constantTangent= hasConstantTangent();
+    if(constantTangent)
+      {
+        // Geometry is part of the key, so no need to invalidate on setDomain.
+        tangentCache.beginKey();
+        tangentCache.addToKey(E*A);
+        tangentCache.addToKey(L);
+        for(int i = 0; i < getNumDIM(); i++)
+          tangentCache.addToKey(cosX[i]);
+        if(tangentCache.isValid() && !isDead())
+          return tangentCache.getStiff();
+      }
 
     // come back later and redo this if too slow
     Matrix &stiff= *theMatrix;
 
-    int numDOF2 = numDOF/2;
-    double temp;
-    double EAoverL = E*A/L;
-    for(int i = 0; i < getNumDIM(); i++)
+    if(constantTangent && tangentCache.isValid())
+      stiff= tangentCache.getStiff();
+    else
       {
-        for(int j = 0; j < getNumDIM(); j++)
-          {
-            temp = cosX[i]*cosX[j]*EAoverL;
-            stiff(i,j) = temp;
-            stiff(i+numDOF2,j) = -temp;
-            stiff(i,j+numDOF2) = -temp;
-            stiff(i+numDOF2,j+numDOF2) = temp;
-          }
+	int numDOF2 = numDOF/2;
+	double temp;
+	double EAoverL = E*A/L;
+	for(int i = 0; i < getNumDIM(); i++)
+	  {
+	    for(int j = 0; j < getNumDIM(); j++)
+	      {
+		temp = cosX[i]*cosX[j]*EAoverL;
+		stiff(i,j) = temp;
+		stiff(i+numDOF2,j) = -temp;
+		stiff(i,j+numDOF2) = -temp;
+		stiff(i+numDOF2,j+numDOF2) = temp;
+	      }
+	  }
+	if(constantTangent)
+	  tangentCache.store(stiff);
       }
     if(isDead())
       stiff*=dead_srf;
     return stiff;
   }
 
+//! @brief Return true if the tangent stiffness doesn't depend on the
+//! element state (linear elastic material).
+bool XC::Truss::hasConstantTangent(void) const
+  { return (dynamic_cast<const ElasticMaterial *>(theMaterial)!=nullptr); }
+
+//! @brief Return the number of times the tangent stiffness matrix
+//! has been computed again.
+size_t XC::Truss::getTangentStiffVersion(void) const
+  { return tangentCache.getVersion(); }
+
 //! @brief Returns the initial tangent stiffness matrix.
 const XC::Matrix &XC::Truss::getInitialStiff(void) const
   {
@@ -64,6 +64,7 @@
 // What: "@(#) Truss.h, revA"
 
 #include "TrussBase.h"
+#include "domain/mesh/element/utils/TangentStiffCache.h"
 
 namespace XC {
 class Channel;
@@ -92,6 +93,7 @@ class Truss: public TrussBase
 // AddingSensitivity:END ///////////////////////////////////////////
     
     double persistentInitialDeformation; //!< Persistent initial strain at element level. Used to store the deformation during the inactive phase of the element (if any).
+    mutable TangentStiffCache tangentCache; //!< Cached tangent stiffness (elastic material only).
 
     void initialize(void);
   protected:
@@ -138,6 +140,8 @@ class Truss: public TrussBase
     const Matrix &getKi(void);
     const Matrix &getTangentStiff(void) const;
     const Matrix &getInitialStiff(void) const;
+    bool hasConstantTangent(void) const;
+    size_t getTangentStiffVersion(void) const;
     const Matrix &getDamp(void) const;    
     const Matrix &getMass(void) const; 
 
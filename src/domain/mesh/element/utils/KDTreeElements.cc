@@ -48,6 +48,31 @@ void XC::KDTreeElements::insert(const Element &n)
     tree_type::insert(n);
   }
 
+//! @brief Insert a batch of elements in the tree.
+//!
+//! Structured meshes generate the elements in lattice order, which
+//! degenerates the tree when they are inserted one by one. If the
+//! batch is large compared with the tree, the tree is rebuilt
+//! (balanced) in a single pass.
+void XC::KDTreeElements::insert(const std::vector<const Element *> &elements)
+  {
+    const size_t sz= elements.size();
+    if(4*sz<size())
+      {
+        for(std::vector<const Element *>::const_iterator i= elements.begin(); i!= elements.end(); i++)
+          tree_type::insert(**i);
+      }
+    else
+      {
+        std::vector<ElemPos> tmp(begin(),end());
+        tmp.reserve(tmp.size()+sz);
+        for(std::vector<const Element *>::const_iterator i= elements.begin(); i!= elements.end(); i++)
+          tmp.push_back(ElemPos(**i));
+        efficient_replace_and_optimise(tmp);
+        pend_optimizar= 0;
+      }
+  }
+
 void XC::KDTreeElements::erase(const Element &n)
   {
     tree_type::erase(n);
@@ -31,6 +31,7 @@
 
 #include "utility/geom/pos_vec/KDTreePos.h"
 #include "utility/kdtree++/kdtree.hpp"
+#include <vector>
 
 class Pos3d;
 
@@ -68,6 +69,7 @@ class KDTreeElements: protected kd_tree::KDTree<3, ElemPos, std::pointer_to_bina
     KDTreeElements(void);
 
     void insert(const Element &);
+    void insert(const std::vector<const Element *> &);
     void erase(const Element &);
     void clear(void);
 
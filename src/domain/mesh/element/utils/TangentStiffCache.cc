@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TangentStiffCache.cc
+
+#include "TangentStiffCache.h"
+#include "utility/matrix/Vector.h"
+
+//! @brief Default constructor.
+XC::TangentStiffCache::TangentStiffCache(void)
+  : pos(0), version(0), valid(false) {}
+
+//! @brief Mark the cached matrix as out of date (i.e. after a change
+//! of the nodal coordinates).
+void XC::TangentStiffCache::invalidate(void)
+  { valid= false; }
+
+//! @brief Start the check of the values the matrix depends on.
+void XC::TangentStiffCache::beginKey(void)
+  { pos= 0; }
+
+//! @brief Check the next value of the key (and store it if it has changed).
+void XC::TangentStiffCache::addToKey(const double &d)
+  {
+    if(pos<key.size())
+      {
+        if(key[pos]!=d)
+          {
+            key[pos]= d;
+            valid= false;
+          }
+      }
+    else
+      {
+        key.push_back(d);
+        valid= false;
+      }
+    pos++;
+  }
+
+//! @brief Check the next values of the key.
+void XC::TangentStiffCache::addToKey(const Vector &v)
+  {
+    const int sz= v.Size();
+    for(int i= 0; i<sz; i++)
+      addToKey(v(i));
+  }
+
+//! @brief Check the next values of the key.
+void XC::TangentStiffCache::addToKey(const Matrix &m)
+  {
+    const int nRows= m.noRows();
+    const int nCols= m.noCols();
+    for(int i= 0; i<nRows; i++)
+      for(int j= 0; j<nCols; j++)
+        addToKey(m(i,j));
+  }
+
+//! @brief Return true if the cached matrix corresponds to the
+//! values passed since the last call to beginKey.
+bool XC::TangentStiffCache::isValid(void)
+  {
+    if(pos!=key.size())
+      {
+        key.resize(pos);
+        valid= false;
+      }
+    return valid;
+  }
+
+//! @brief Store the matrix computed from the current key values.
+const XC::Matrix &XC::TangentStiffCache::store(const Matrix &m)
+  {
+    stiff= m;
+    valid= true;
+    version++;
+    return stiff;
+  }
@@ -0,0 +1,84 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TangentStiffCache.h
+
+#ifndef TangentStiffCache_h
+#define TangentStiffCache_h
+
+#include <vector>
+#include "utility/matrix/Matrix.h"
+
+namespace XC {
+
+class Vector;
+
+//! @ingroup FEMisc
+//
+//! @brief Cached tangent stiffness matrix of an element whose tangent
+//! doesn't change with its state (linear geometry and linear elastic
+//! materials, see Element::hasConstantTangent).
+//!
+//! The cached matrix is tagged with the values it has been computed
+//! from (material tangents, section constants, stiffness reduction
+//! factors...). On each call the element passes those values again
+//! (beginKey, addToKey...) and the matrix is computed again only if
+//! any of them has changed. The geometry dependent data must be put
+//! in the key too (lengths, local axes...) or the cache must be
+//! invalidated explicitly when the nodal coordinates change.
+//! Each time the matrix is computed again its version number is
+//! incremented, so the clients that keep assembled copies of it can
+//! know if they are out of date.
+class TangentStiffCache
+  {
+    Matrix stiff; //!< cached stiffness matrix.
+    std::vector<double> key; //!< values used to compute the matrix.
+    size_t pos; //!< position of the next value of the key.
+    size_t version; //!< number of times the matrix has been computed.
+    bool valid; //!< true if the matrix corresponds to the key values.
+  public:
+    TangentStiffCache(void);
+
+    void invalidate(void);
+    void beginKey(void);
+    void addToKey(const double &);
+    void addToKey(const Vector &);
+    void addToKey(const Matrix &);
+    bool isValid(void);
+    const Matrix &store(const Matrix &);
+
+    //! @brief Return the cached matrix.
+    inline const Matrix &getStiff(void) const
+      { return stiff; }
+    //! @brief Return the number of times the matrix has been computed.
+    inline size_t getVersion(void) const
+      { return version; }
+  };
+
+} // end of XC namespace
+
+#endif
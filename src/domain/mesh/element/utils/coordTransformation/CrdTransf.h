@@ -116,6 +116,12 @@ class CrdTransf: public TaggedObject, public MovableObject
     virtual double getInitialLength(void) const= 0;
     virtual double getDeformedLength(void) const= 0;
     double getLength(bool initialGeometry= true) const;
+    //! @brief Return the rigid joint offset of the I node.
+    inline const Vector &getRigidJointOffsetI(void) const
+      { return nodeIOffset; }
+    //! @brief Return the rigid joint offset of the J node.
+    inline const Vector &getRigidJointOffsetJ(void) const
+      { return nodeJOffset; }
     
     virtual int commitState(void) = 0;
     virtual int revertToLastCommit(void) = 0;        
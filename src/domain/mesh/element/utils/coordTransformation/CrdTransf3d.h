@@ -110,6 +110,10 @@ class CrdTransf3d: public CrdTransf
     int initialize(Node *node1Pointer, Node *node2Pointer);
     virtual void set_xz_vector(const Vector &vecInLocXZPlane);
     Vector get_xz_vector(void) const;
+    //! @brief Return the transformation matrix as it is (local axes
+    //! as rows) without computing it again.
+    inline const Matrix &getTrfMatrix(void) const
+      { return R; }
     const Vector &getI(void) const;
     const Vector &getJ(void) const;
     const Vector &getK(void) const;
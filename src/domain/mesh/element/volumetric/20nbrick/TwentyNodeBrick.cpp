@@ -193,6 +193,17 @@ XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
 
   }
 
+//! @brief Constructor used by the element handler (the nodes
+//! are set afterwards).
+//!
+//! @param tag: element identifier.
+//! @param ptr_mat: material to copy at each integration point.
+XC::TwentyNodeBrick::TwentyNodeBrick(int tag, const NDMaterial *ptr_mat)
+  : TwentyNodeBrick(tag, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                    const_cast<NDMaterial *>(ptr_mat), BodyForces3D(), 0.0, 0.0)
+  {}
+
 //====================================================================
 XC::TwentyNodeBrick::TwentyNodeBrick ():ElementBase<20>(0, ELE_TAG_TwentyNodeBrick ),
 Ki(0), bf(), rho(0.0), pressure(0.0), mmodel(0)
@@ -2689,31 +2700,22 @@ int XC::TwentyNodeBrick::revertToStart()
 //=============================================================================
 const XC::Matrix &XC::TwentyNodeBrick::getTangentStiff(void) const
   {
-     BJtensor stifftensor = getStiffnessTensor();
-     int Ki=0;
-     int Kj=0;
-     static const int nodes_in_brick= getNumExternalNodes();
-     for( int i=1 ; i<=nodes_in_brick ; i++ )
-     {
-        for( int j=1 ; j<=nodes_in_brick ; j++ )
-        {
-           for( int k=1 ; k<=3 ; k++ )
-           {
-              for( int l=1 ; l<=3 ; l++ )
-              {
-                 Ki = k+3*(i-1);
-                 Kj = l+3*(j-1);
-                 K( Ki-1 , Kj-1 ) = stifftensor(i,k,l,j);
-              }
-           }
-        }
-     }
-
-     //std::cerr << " K " << K << std::endl;
-     //K.Output(std::cerr);
-     if(isDead())
+    // Same result as getStiffnessTensor but using fixed-size
+    // arrays instead of BJtensor contractions.
+    const std::vector<Kernels::GaussPoint> &gps= get_gauss_points();
+    const Kernels::NodalArray crds= Kernels::get_coordinates(theNodes);
+    Kernels::NodalArray dhGlobal;
+    K.Zero();
+    for(size_t where= 0; where<gps.size(); where++)
+      {
+        const Kernels::GaussPoint &gp= gps[where];
+        const double det_of_Jacobian= Kernels::global_derivatives(gp.dh, crds, dhGlobal);
+        const BJtensor &Constitutive= (matpoint[where]->matmodel)->getTangentTensor();
+        Kernels::add_stiffness(dhGlobal, Constitutive.data(), gp.weight*det_of_Jacobian, K);
+      }
+    if(isDead())
       K*=dead_srf;
-     return K;
+    return K;
   }
 
 //=============================================================================
@@ -3187,22 +3189,27 @@ const XC::Vector XC::TwentyNodeBrick::FormEquiBodyForce(void)
 //=============================================================================
 const XC::Vector &XC::TwentyNodeBrick::getResistingForce(void) const
   {
-    std::vector<int> force_dim({20,3});
-    BJtensor nodalforces(force_dim,0.0);
-
-    nodalforces = nodal_forces();
+    // Same result as nodal_forces but using fixed-size
+    // arrays instead of BJtensor contractions.
+    const std::vector<Kernels::GaussPoint> &gps= get_gauss_points();
+    const Kernels::NodalArray crds= Kernels::get_coordinates(theNodes);
+    Kernels::NodalArray dhGlobal;
+    Kernels::NodalArray nodalforces;
+    nodalforces.fill(0.0);
+    for(size_t where= 0; where<gps.size(); where++)
+      {
+        const Kernels::GaussPoint &gp= gps[where];
+        const double det_of_Jacobian= Kernels::global_derivatives(gp.dh, crds, dhGlobal);
+        const stresstensor &stress_at_GP= matpoint[where]->getStressTensor();
+        Kernels::add_nodal_forces(dhGlobal, stress_at_GP.data(), gp.weight*det_of_Jacobian, nodalforces);
+      }
 
-    //converting nodalforce XC::BJtensor to vector
-    static const int nodes_in_brick= getNumExternalNodes();
-    for(int i = 0; i< nodes_in_brick; i++)
-      for(int j = 0; j < 3; j++)
-        P(i *3 + j) = nodalforces(i+1, j+1);
+    //converting nodal forces to vector
+    for(int i = 0; i< 60; i++)
+      P(i) = nodalforces[i];
 
-    //std::cerr << "P" << P;
-    //std::cerr << "load" << Q;
     P = P - load;
 
-    //std::cerr << "P-load" << P;
     if(isDead())
       P*=dead_srf;
     return P;
@@ -4454,85 +4461,52 @@ double XC::TwentyNodeBrick::get_Gauss_p_w(short order, short point_numb)
 
 int XC::TwentyNodeBrick::update(void) //Added by Guanzhou, May 7 2004
   {
-    double r  = 0.0;
-    double s  = 0.0;
-    double t  = 0.0;
-
-    short where = 0;
-
-    std::vector<int> dh_dim({20,3});
-    BJtensor dh(dh_dim, 0.0);
-
-    static std::vector<int> disp_dim({20,3});
-    BJtensor incremental_displacements(disp_dim,0.0);
-
-    straintensor incremental_strain;
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor dhGlobal;
-
-    incremental_displacements = incr_disp();
+    const std::vector<Kernels::GaussPoint> &gps= get_gauss_points();
+    const Kernels::NodalArray crds= Kernels::get_coordinates(theNodes);
+    // now in Update we know the incremental displacements so let's find
+    // the incremental strain
+    const Kernels::NodalArray incremental_displacements= Kernels::get_incr_delta_disp(theNodes);
+    Kernels::NodalArray dhGlobal;
+    for(size_t where= 0; where<gps.size(); where++)
+      {
+        Kernels::global_derivatives(gps[where].dh, crds, dhGlobal);
+        const Kernels::Array33 eps= Kernels::strain(dhGlobal, incremental_displacements);
+        const straintensor incremental_strain(eps.data());
+        if( ( (matpoint[where]->matmodel)->setTrialStrainIncr( incremental_strain)) )
+          std::cerr << "XC::TwentyNodeBrick::update (tag: " << this->getTag() << "), update() failed\n";
+      }
+    return 0;
+  }
 
-    for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+//! @brief Return the derivatives of the shape functions and the
+//! integration weights at the Gauss points (computed on first use).
+const std::vector<XC::TwentyNodeBrick::Kernels::GaussPoint> &XC::TwentyNodeBrick::get_gauss_points(void) const
+  {
+    const size_t numGP= r_integration_order*s_integration_order*t_integration_order;
+    if(gaussPoints.size()!=numGP)
       {
-        r = get_Gauss_p_c( r_integration_order, GP_c_r );
-        //--        rw = get_Gauss_p_w( r_integration_order, GP_c_r );
-        for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+        gaussPoints.resize(numGP);
+        for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
           {
-            s = get_Gauss_p_c( s_integration_order, GP_c_s );
-            //--            sw = get_Gauss_p_w( s_integration_order, GP_c_s );
-            for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
-            {
-                t = get_Gauss_p_c( t_integration_order, GP_c_t );
-                //--                tw = get_Gauss_p_w( t_integration_order, GP_c_t );
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
-                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-                // derivatives of local coordiantes with respect to local coordiantes
-                dh = dh_drst_at(r,s,t);
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian = Jacobian_3D(dh);
-                //....                Jacobian.print("J");
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV = Jacobian_3Dinv(dh);
-                //....                JacobianINV.print("JINV");
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                //--                det_of_Jacobian  = Jacobian.determinant();
-                //....  ::printf("determinant of Jacobian is %f\n",Jacobian_determinant );
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                //dhGlobal = dh("ij") * JacobianINV("jk"); // Zhaohui 09-02-2001
-                dhGlobal = dh("ij") * JacobianINV("kj");
-                //....                dhGlobal.print("dh","dhGlobal");
-                //weight
-                //                weight = rw * sw * tw * det_of_Jacobian;
-                //::::   ::printf("\n\nIN THE STIFFNESS TENSOR INTEGRATOR ----**************** where = %d \n", where);
-                //::::   ::printf(" void XC::TwentyNodeBrick::incremental_Update()\n");
-                //::::   ::printf(" GP_c_r = %d,  GP_c_s = %d,  GP_c_t = %d    --->>>  where = %d \n",
-                //::::                      GP_c_r,GP_c_s,GP_c_t,where);
-                //::::   ::printf("WEIGHT = %f", weight);
-                //::::   ::printf("determinant of Jacobian = %f", determinant_of_Jacobian);
-                //::::   matpoint[where].report("Gauss Point\n");
-                // incremental strains at this Gauss point
-                // now in Update we know the incremental displacements so let's find
-                // the incremental strain
-                incremental_strain =
-                    (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-                incremental_strain.null_indices();
-                //incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-
-                // here comes the final_stress calculation actually on only needs to copy stresses
-                // from the iterative data . . .
-                //(GPstress+where)->reportshortpqtheta("\n stress START GAUSS \n");
-
-  if( ( (matpoint[where]->matmodel)->setTrialStrainIncr( incremental_strain)) )
-    std::cerr << "XC::TwentyNodeBrick::update (tag: " << this->getTag() << "), update() failed\n";
-            }
+            const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
+            const double rw = get_Gauss_p_w( r_integration_order, GP_c_r );
+            for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+              {
+                const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
+                const double sw = get_Gauss_p_w( s_integration_order, GP_c_s );
+                for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
+                  {
+                    const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                    const double tw = get_Gauss_p_w( t_integration_order, GP_c_t );
+                    const size_t where =
+                      ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                    gaussPoints[where].dh = Kernels::from_tensor(dh_drst_at(r,s,t));
+                    gaussPoints[where].weight = rw * sw * tw;
+                  }
+              }
           }
       }
-    return 0;
-
+    return gaussPoints;
   }
 
 
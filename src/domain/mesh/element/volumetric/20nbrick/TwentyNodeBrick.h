@@ -55,6 +55,7 @@
 
 #include <domain/mesh/element/ElementBase.h>
 #include "domain/mesh/element/utils/body_forces/BodyForces3D.h"
+#include "domain/mesh/element/volumetric/IsoparametricBrickKernels.h"
 
 
 
@@ -69,6 +70,8 @@ class Node;
 //! @brief Twenty node hexahedral element for three-dimensional problems.
 class TwentyNodeBrick: public ElementBase<20>
   {
+  public:
+    typedef IsoparametricBrickKernels<20> Kernels;
   private:
     // private attributes - a copy for each object of the class
 
@@ -109,6 +112,9 @@ class TwentyNodeBrick: public ElementBase<20>
     
     // this is LM array. This array holds DOFs for this element
     //int  LM[60]; // for 20noded x 3 = 60
+
+    mutable std::vector<Kernels::GaussPoint> gaussPoints; //!< shape function derivatives at the Gauss points.
+    const std::vector<Kernels::GaussPoint> &get_gauss_points(void) const;
   public:
     
     void incremental_Update(void);
@@ -186,6 +192,7 @@ class TwentyNodeBrick: public ElementBase<20>
                    int node_numb_17, int node_numb_18, int node_numb_19, int node_numb_20,
 		    NDMaterial * Globalmmodel, const BodyForces3D &bForces, double r, double p);
 
+    TwentyNodeBrick(int tag, const NDMaterial *ptr_mat);
     TwentyNodeBrick(void);
     Element *getCopy(void) const;
     ~TwentyNodeBrick(void);
@@ -55,6 +55,7 @@
 
 #include <domain/mesh/element/ElementBase.h>
 #include "domain/mesh/element/utils/body_forces/BodyForces3D.h"
+#include "domain/mesh/element/volumetric/IsoparametricBrickKernels.h"
 
 
 
@@ -69,6 +70,8 @@ class stresstensor;
 //! @brief Twenty seven node hexahedral element for three-dimensional problems.
 class TwentySevenNodeBrick: public ElementBase<27>
   {
+  public:
+    typedef IsoparametricBrickKernels<27> Kernels;
   private:
     double determinant_of_Jacobian; //!< Determinant of the jacobian.
     NDMaterial *mmodel; //!< pointer to GLOBAL material models
@@ -102,6 +105,9 @@ class TwentySevenNodeBrick: public ElementBase<27>
     //Matrix J; //!< Jacobian of transformation
     //Matrix L; //!< Inverse of J
     //Matrix B; //!< Strain interpolation matrix
+
+    mutable std::vector<Kernels::GaussPoint> gaussPoints; //!< shape function derivatives at the Gauss points.
+    const std::vector<Kernels::GaussPoint> &get_gauss_points(void) const;
   public:
     TwentySevenNodeBrick(int element_number,
                    int node_numb_1,  int node_numb_2,  int node_numb_3,  int node_numb_4,
@@ -113,6 +119,7 @@ class TwentySevenNodeBrick: public ElementBase<27>
                    int node_numb_25,  int node_numb_26,  int node_numb_27,
                    NDMaterial * Globalmmodel,  const BodyForces3D &,
        double r, double p);
+    TwentySevenNodeBrick(int tag, const NDMaterial *ptr_mat);
     TwentySevenNodeBrick(void);
     Element *getCopy(void) const;
     ~TwentySevenNodeBrick();
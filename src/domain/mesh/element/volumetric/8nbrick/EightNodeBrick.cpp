@@ -207,6 +207,16 @@ XC::EightNodeBrick::EightNodeBrick(int element_number,
       theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8);
   }
 
+//! @brief Constructor used by the element handler (the nodes
+//! are set afterwards).
+//!
+//! @param tag: element identifier.
+//! @param ptr_mat: material to copy at each integration point.
+XC::EightNodeBrick::EightNodeBrick(int tag, const NDMaterial *ptr_mat)
+  : EightNodeBrick(tag, 0, 0, 0, 0, 0, 0, 0, 0,
+                    const_cast<NDMaterial *>(ptr_mat), BodyForces3D(), 0.0, 0.0)
+  {}
+
 //====================================================================
 XC::EightNodeBrick::EightNodeBrick(void)
   :ElementBase<8>(0, ELE_TAG_EightNodeBrick), Ki(0), bf(3), rho(0.0), pressure(0.0), mmodel(0)
@@ -2614,38 +2624,23 @@ int XC::EightNodeBrick::revertToStart(void)
 
 //=============================================================================
 const XC::Matrix &XC::EightNodeBrick::getTangentStiff(void) const
-{
-//BJ/BJ
-//BJ    std::cerr << "\n\n\n\n Print in const XC::Matrix &XC::EightNodeBrick::getTangentStiff ()" <<std::endl; this->Print(std::cerr);
-//BJ//BJ
-
-
-
-     BJtensor stifftensor= getStiffnessTensor();
-     int Ki=0;
-     int Kj=0;
-
-     for( int i=1 ; i<=8 ; i++ )
-     {
-        for( int j=1 ; j<=8 ; j++ )
-        {
-           for( int k=1 ; k<=3 ; k++ )
-           {
-              for( int l=1 ; l<=3 ; l++ )
-              {
-                 Ki= k+3*(i-1);
-                 Kj= l+3*(j-1);
-                 K( Ki-1 , Kj-1 )= stifftensor(i,k,l,j);
-              }
-           }
-        }
-     }
-
-     //std::cerr << " K " << K << std::endl;
-     //K.Output(std::cerr);
+  {
+    // Same result as getStiffnessTensor but using fixed-size
+    // arrays instead of BJtensor contractions.
+    const std::vector<Kernels::GaussPoint> &gps= get_gauss_points();
+    const Kernels::NodalArray crds= Kernels::get_coordinates(theNodes);
+    Kernels::NodalArray dhGlobal;
+    K.Zero();
+    for(size_t where= 0; where<gps.size(); where++)
+      {
+        const Kernels::GaussPoint &gp= gps[where];
+        const double det_of_Jacobian= Kernels::global_derivatives(gp.dh, crds, dhGlobal);
+        const BJtensor &Constitutive= (matpoint[where].matmodel)->getTangentTensor();
+        Kernels::add_stiffness(dhGlobal, Constitutive.data(), gp.weight*det_of_Jacobian, K);
+      }
     if(isDead())
       K*=dead_srf;
-     return K;
+    return K;
   }
 
 //=============================================================================
@@ -2962,27 +2957,28 @@ const XC::Vector XC::EightNodeBrick::FormEquiBodyForce(void)
 //=============================================================================
 const XC::Vector &XC::EightNodeBrick::getResistingForce(void) const
   {
-//BJ//BJ
-//BJ    std::cerr << "\n\n\n\n Print in const XC::Vector &XC::EightNodeBrick::getResistingForce ()" <<std::endl; this->Print(std::cerr);
-//BJ//BJ
-
-    std::vector<int> force_dim({8,3});
-    BJtensor nodalforces(force_dim,0.0);
-
-    nodalforces= nodal_forces();
-
-    //converting nodalforce XC::BJtensor to vector
-    for(int i= 0; i< 8; i++)
-      for(int j= 0; j < 3; j++)
-          P(i *3 + j)= nodalforces(i+1, j+1);
+    // Same result as nodal_forces but using fixed-size
+    // arrays instead of BJtensor contractions.
+    const std::vector<Kernels::GaussPoint> &gps= get_gauss_points();
+    const Kernels::NodalArray crds= Kernels::get_coordinates(theNodes);
+    Kernels::NodalArray dhGlobal;
+    Kernels::NodalArray nodalforces;
+    nodalforces.fill(0.0);
+    for(size_t where= 0; where<gps.size(); where++)
+      {
+        const Kernels::GaussPoint &gp= gps[where];
+        const double det_of_Jacobian= Kernels::global_derivatives(gp.dh, crds, dhGlobal);
+        const stresstensor &stress_at_GP= matpoint[where].getStressTensor();
+        Kernels::add_nodal_forces(dhGlobal, stress_at_GP.data(), gp.weight*det_of_Jacobian, nodalforces);
+      }
 
-    //std::cerr << "P" << P << '\n';
-    //std::cerr << "load" << load << '\n';
+    //converting nodal forces to vector
+    for(int i= 0; i< 24; i++)
+      P(i)= nodalforces[i];
 
     //P= P - load;
     P.addVector(1.0, load, -1.0);
 
-    //std::cerr << "P-load" << P;
     if(isDead())
       P*=dead_srf;
     return P;
@@ -4044,74 +4040,52 @@ double XC::EightNodeBrick::get_Gauss_p_w(short order, short point_numb) const
 
 int XC::EightNodeBrick::update(void) //Note: Guanzhou finished the algorithm consistent with global incremental calculation Mar2005
   {
-
-    double r= 0.0;
-    double s= 0.0;
-    double t= 0.0;
-
-    short where= 0;
-
-    static std::vector<int> dh_dim({8,3});
-    BJtensor dh(dh_dim, 0.0);
-
-    static std::vector<int> disp_dim({8,3});
-    //GZ out XC::BJtensor incr_displacements(disp_dim,0.0);
-
-    //GZ out straintensor incr_strain;
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor dhGlobal;
-
-    //Guanzhou out incr_displacements= incr_disp();//Get incremental disp from domain
-
-    BJtensor trial_disp(disp_dim,0.0);
-    trial_disp= total_disp();//Guanzhou added, get trial disp from domain
-
-    straintensor trial_strain;
-
-
-    for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+    const std::vector<Kernels::GaussPoint> &gps= get_gauss_points();
+    const Kernels::NodalArray crds= Kernels::get_coordinates(theNodes);
+    // now in Update we know the total displacements so let's find
+    // the total strain
+    const Kernels::NodalArray trial_disp= Kernels::get_trial_disp(theNodes);
+    Kernels::NodalArray dhGlobal;
+    for(size_t where= 0; where<gps.size(); where++)
       {
-        r= get_Gauss_p_c( r_integration_order, GP_c_r );
+        Kernels::global_derivatives(gps[where].dh, crds, dhGlobal);
+        const Kernels::Array33 eps= Kernels::strain(dhGlobal, trial_disp);
+        const straintensor trial_strain(eps.data());
+        if( ( (matpoint[where].matmodel)->setTrialStrain(trial_strain)) )
+          std::cerr << "XC::EightNodeBrick::update (tag: " << this->getTag() << "), Update Failed\n";
+      }
+    return 0;
+  }
 
-        for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+//! @brief Return the derivatives of the shape functions and the
+//! integration weights at the Gauss points (computed on first use).
+const std::vector<XC::EightNodeBrick::Kernels::GaussPoint> &XC::EightNodeBrick::get_gauss_points(void) const
+  {
+    const size_t numGP= r_integration_order*s_integration_order*t_integration_order;
+    if(gaussPoints.size()!=numGP)
+      {
+        gaussPoints.resize(numGP);
+        for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
           {
-            s= get_Gauss_p_c( s_integration_order, GP_c_s );
-
-            for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
+            const double r= get_Gauss_p_c( r_integration_order, GP_c_r );
+            const double rw= get_Gauss_p_w( r_integration_order, GP_c_r );
+            for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
               {
-                t= get_Gauss_p_c( t_integration_order, GP_c_t );
-
-                where =
-                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-                // derivatives of local coordiantes with respect to local coordiantes
-                dh= dh_drst_at(r,s,t);
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian= Jacobian_3D(dh);
-                //....                Jacobian.print("J");
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV= Jacobian_3Dinv(dh);
-                //....                JacobianINV.print("JINV");
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                //--                det_of_Jacobian= Jacobian.determinant();
-                //....  ::printf("determinant of Jacobian is %f\n",Jacobian_determinant );
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                dhGlobal= dh("ij") * JacobianINV("kj");
-                // incremental strains at this Gauss point
-                // now in Update we know the total displacements so let's find
-                // the total strain
-                trial_strain =
-                    (dhGlobal("ib")*trial_disp("ia")).symmetrize11();
-                trial_strain.null_indices();
-
-                //Guanzhou out Mar2005 if( ( (matpoint[where].matmodel)->setTrialStrainIncr( incr_strain)) )
-                if( ( (matpoint[where].matmodel)->setTrialStrain(trial_strain)) )
-                  std::cerr << "XC::EightNodeBrick::update (tag: " << this->getTag() << "), Update Failed\n";
+                const double s= get_Gauss_p_c( s_integration_order, GP_c_s );
+                const double sw= get_Gauss_p_w( s_integration_order, GP_c_s );
+                for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
+                  {
+                    const double t= get_Gauss_p_c( t_integration_order, GP_c_t );
+                    const double tw= get_Gauss_p_w( t_integration_order, GP_c_t );
+                    const size_t where=
+                      ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                    gaussPoints[where].dh= Kernels::from_tensor(dh_drst_at(r,s,t));
+                    gaussPoints[where].weight= rw * sw * tw;
+                  }
               }
           }
       }
-    return 0;
+    return gaussPoints;
   }
 
 #endif
@@ -67,6 +67,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "domain/mesh/element/utils/body_forces/BodyForces3D.h"
+#include "domain/mesh/element/volumetric/IsoparametricBrickKernels.h"
 
 namespace XC {
 class Node;
@@ -82,6 +83,8 @@ class BJtensor;
 //! @brief Eight node hexahedral element for three-dimensional problems.
 class EightNodeBrick: public ElementBase<8>
   {
+  public:
+    typedef IsoparametricBrickKernels<8> Kernels;
   private:
     int numDOF; //!< Number of element DOF
 
@@ -144,6 +147,9 @@ class EightNodeBrick: public ElementBase<8>
 
 
     int  LM[24]; //!< for 8noded x 3 = 24
+
+    mutable std::vector<Kernels::GaussPoint> gaussPoints; //!< shape function derivatives at the Gauss points.
+    const std::vector<Kernels::GaussPoint> &get_gauss_points(void) const;
   public:
     EightNodeBrick(int element_number,
                    int node_numb_1, int node_numb_2, int node_numb_3, int node_numb_4,
@@ -153,6 +159,7 @@ class EightNodeBrick: public ElementBase<8>
    // int dir, double surflevel);
    //, EPState *InitEPS);   const std::string &type,
 
+    EightNodeBrick(int tag, const NDMaterial *ptr_mat);
     EightNodeBrick(void);
     Element *getCopy(void) const;
     ~EightNodeBrick(void);
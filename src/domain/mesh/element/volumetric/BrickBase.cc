@@ -538,6 +538,28 @@ XC::ParticlePos3d XC::BrickBase::getNaturalCoordinates(const Pos3d &pos,bool ini
     return retval;
   }
 
+//! @brief Return true (the element implements locatePoint).
+bool XC::BrickBase::canLocatePoints(void) const
+  { return true; }
+
+//! @brief Return true if the point is inside the element.
+//! @param pos: position to locate.
+//! @param tol: distance tolerance (not used).
+//! @param naturalCoordinates: (output) natural coordinates of the point.
+//! @param initialGeometry: if true, use undeformed element geometry.
+bool XC::BrickBase::locatePoint(const Pos3d &pos, const double &tol, ParticlePos3d &naturalCoordinates, bool initialGeometry) const
+  {
+    // initialGeometry not used yet.
+    double pnt[ndm]= {pos.x(),pos.y(),pos.z()};
+    double solution[ndm]= {0.0,0.0,0.0}; // {r,s,t}
+    computeBasis();
+    if(!inverse_coordinate_transform(pnt, xl, solution))
+      return false;
+    naturalCoordinates= ParticlePos3d(solution[0],solution[1],solution[2]);
+    const double limit= 1.0+1e-6;
+    return (std::abs(solution[0])<=limit) && (std::abs(solution[1])<=limit) && (std::abs(solution[2])<=limit);
+  }
+
 //! @brief Zeroes loads on element.
 void XC::BrickBase::zeroLoad(void)
   {
@@ -0,0 +1,222 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//IsoparametricBrickKernels.h
+
+#ifndef IsoparametricBrickKernels_h
+#define IsoparametricBrickKernels_h
+
+#include <array>
+#include <vector>
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/nDarray/BJtensor.h"
+
+namespace XC {
+
+//! @ingroup ElemVol
+//
+//! @brief Fixed-size kernels used in the Gauss point loops of the
+//! NN-node isoparametric bricks (EightNodeBrick, TwentyNodeBrick,
+//! TwentySevenNodeBrick).
+//!
+//! They replace the rank-n tensor contractions (BJtensor) used
+//! to compute the Jacobian, the global derivatives of the shape
+//! functions, the strains, the stiffness matrix and the nodal forces.
+//! Nodal quantities are stored row-major: value(node, direction).
+template <int NN>
+class IsoparametricBrickKernels
+  {
+  public:
+    typedef std::array<double,3*NN> NodalArray; //!< (node, direction) values.
+    typedef std::array<double,9> Array33; //!< 3x3 row-major values.
+
+    //! @brief Shape function derivatives and weight of a Gauss point.
+    struct GaussPoint
+      {
+        NodalArray dh; //!< derivatives of the shape functions with respect to the natural coordinates.
+        double weight; //!< integration weight.
+      };
+
+    //! @brief Copy the values of a (NN,3) tensor.
+    static NodalArray from_tensor(const BJtensor &t)
+      {
+        NodalArray retval;
+        const double *data= t.data();
+        std::copy(data, data+3*NN, retval.begin());
+        return retval;
+      }
+
+    //! @brief Return the coordinates of the nodes.
+    template <class NodePtrs>
+    static NodalArray get_coordinates(const NodePtrs &nodes)
+      {
+        NodalArray retval;
+        for(int i= 0; i<NN; i++)
+          {
+            const Vector &crds= nodes[i]->getCrds();
+            for(int k= 0; k<3; k++)
+              retval[3*i+k]= crds(k);
+          }
+        return retval;
+      }
+
+    //! @brief Return the trial displacements of the nodes.
+    template <class NodePtrs>
+    static NodalArray get_trial_disp(const NodePtrs &nodes)
+      {
+        NodalArray retval;
+        for(int i= 0; i<NN; i++)
+          {
+            const Vector &disp= nodes[i]->getTrialDisp();
+            for(int k= 0; k<3; k++)
+              retval[3*i+k]= disp(k);
+          }
+        return retval;
+      }
+
+    //! @brief Return the displacement increments of the nodes.
+    template <class NodePtrs>
+    static NodalArray get_incr_delta_disp(const NodePtrs &nodes)
+      {
+        NodalArray retval;
+        for(int i= 0; i<NN; i++)
+          {
+            const Vector &disp= nodes[i]->getIncrDeltaDisp();
+            for(int k= 0; k<3; k++)
+              retval[3*i+k]= disp(k);
+          }
+        return retval;
+      }
+
+    //! @brief Compute the derivatives of the shape functions with
+    //! respect to the global coordinates and return the determinant
+    //! of the Jacobian.
+    //!
+    //! @param dh: derivatives with respect to the natural coordinates.
+    //! @param crds: nodal coordinates.
+    //! @param dhGlobal: derivatives with respect to the global coordinates.
+    static double global_derivatives(const NodalArray &dh, const NodalArray &crds, NodalArray &dhGlobal)
+      {
+        // Jacobian: J(j,k)= sum_i dh(i,j)*x(i,k)
+        double J[3][3]= {{0.0,0.0,0.0},{0.0,0.0,0.0},{0.0,0.0,0.0}};
+        for(int i= 0; i<NN; i++)
+          for(int j= 0; j<3; j++)
+            {
+              const double dhij= dh[3*i+j];
+              for(int k= 0; k<3; k++)
+                J[j][k]+= dhij*crds[3*i+k];
+            }
+        const double det= J[0][0]*(J[1][1]*J[2][2]-J[1][2]*J[2][1])
+                        - J[0][1]*(J[1][0]*J[2][2]-J[1][2]*J[2][0])
+                        + J[0][2]*(J[1][0]*J[2][1]-J[1][1]*J[2][0]);
+        const double invDet= 1.0/det;
+        double Jinv[3][3];
+        Jinv[0][0]= (J[1][1]*J[2][2]-J[1][2]*J[2][1])*invDet;
+        Jinv[0][1]= (J[0][2]*J[2][1]-J[0][1]*J[2][2])*invDet;
+        Jinv[0][2]= (J[0][1]*J[1][2]-J[0][2]*J[1][1])*invDet;
+        Jinv[1][0]= (J[1][2]*J[2][0]-J[1][0]*J[2][2])*invDet;
+        Jinv[1][1]= (J[0][0]*J[2][2]-J[0][2]*J[2][0])*invDet;
+        Jinv[1][2]= (J[0][2]*J[1][0]-J[0][0]*J[1][2])*invDet;
+        Jinv[2][0]= (J[1][0]*J[2][1]-J[1][1]*J[2][0])*invDet;
+        Jinv[2][1]= (J[0][1]*J[2][0]-J[0][0]*J[2][1])*invDet;
+        Jinv[2][2]= (J[0][0]*J[1][1]-J[0][1]*J[1][0])*invDet;
+        // dhGlobal(i,k)= sum_j dh(i,j)*Jinv(k,j)
+        for(int i= 0; i<NN; i++)
+          for(int k= 0; k<3; k++)
+            dhGlobal[3*i+k]= dh[3*i]*Jinv[k][0]+dh[3*i+1]*Jinv[k][1]+dh[3*i+2]*Jinv[k][2];
+        return det;
+      }
+
+    //! @brief Return the (symmetric) strain tensor corresponding to
+    //! the nodal displacements argument.
+    static Array33 strain(const NodalArray &dhGlobal, const NodalArray &u)
+      {
+        double grad[3][3]= {{0.0,0.0,0.0},{0.0,0.0,0.0},{0.0,0.0,0.0}};
+        for(int i= 0; i<NN; i++)
+          for(int a= 0; a<3; a++)
+            {
+              const double uia= u[3*i+a];
+              for(int b= 0; b<3; b++)
+                grad[a][b]+= uia*dhGlobal[3*i+b];
+            }
+        Array33 retval;
+        for(int a= 0; a<3; a++)
+          for(int b= 0; b<3; b++)
+            retval[3*a+b]= 0.5*(grad[a][b]+grad[b][a]);
+        return retval;
+      }
+
+    //! @brief Add the contribution of a Gauss point to the stiffness matrix.
+    //!
+    //! K(3*A+I,3*B+J)+= w * sum_{k,l} dhGlobal(A,k)*C(I,k,J,l)*dhGlobal(B,l)
+    //! @param dhGlobal: derivatives of the shape functions with respect to the global coordinates.
+    //! @param C: tangent constitutive tensor (81 row-major values).
+    //! @param w: integration weight.
+    //! @param K: stiffness matrix.
+    static void add_stiffness(const NodalArray &dhGlobal, const double *C, const double &w, Matrix &K)
+      {
+        double tmp[3][3][3]; // tmp(I,J,l)= w*sum_k dhGlobal(A,k)*C(I,k,J,l)
+        for(int A= 0; A<NN; A++)
+          {
+            const double *dhA= &dhGlobal[3*A];
+            for(int I= 0; I<3; I++)
+              for(int J= 0; J<3; J++)
+                for(int l= 0; l<3; l++)
+                  tmp[I][J][l]= w*(dhA[0]*C[((I*3+0)*3+J)*3+l]
+                                  +dhA[1]*C[((I*3+1)*3+J)*3+l]
+                                  +dhA[2]*C[((I*3+2)*3+J)*3+l]);
+            for(int B= 0; B<NN; B++)
+              {
+                const double *dhB= &dhGlobal[3*B];
+                for(int I= 0; I<3; I++)
+                  for(int J= 0; J<3; J++)
+                    K(3*A+I,3*B+J)+= tmp[I][J][0]*dhB[0]+tmp[I][J][1]*dhB[1]+tmp[I][J][2]*dhB[2];
+              }
+          }
+      }
+
+    //! @brief Add the contribution of a Gauss point to the nodal forces.
+    //!
+    //! F(A,a)+= w * sum_b dhGlobal(A,b)*stress(a,b)
+    //! @param dhGlobal: derivatives of the shape functions with respect to the global coordinates.
+    //! @param stress: stress tensor (9 row-major values).
+    //! @param w: integration weight.
+    //! @param F: nodal forces.
+    static void add_nodal_forces(const NodalArray &dhGlobal, const double *stress, const double &w, NodalArray &F)
+      {
+        for(int A= 0; A<NN; A++)
+          {
+            const double *dhA= &dhGlobal[3*A];
+            for(int a= 0; a<3; a++)
+              F[3*A+a]+= w*(dhA[0]*stress[3*a]+dhA[1]*stress[3*a+1]+dhA[2]*stress[3*a+2]);
+          }
+      }
+  };
+
+} // end of XC namespace
+
+#endif
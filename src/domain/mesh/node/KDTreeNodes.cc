@@ -48,6 +48,31 @@ void XC::KDTreeNodes::insert(const Node &n)
     tree_type::insert(n);
   }
 
+//! @brief Insert a batch of nodes in the tree.
+//!
+//! Structured meshes generate the nodes in lattice order, which
+//! degenerates the tree when they are inserted one by one. If the
+//! batch is large compared with the tree, the tree is rebuilt
+//! (balanced) in a single pass.
+void XC::KDTreeNodes::insert(const std::vector<const Node *> &nodes)
+  {
+    const size_t sz= nodes.size();
+    if(4*sz<size())
+      {
+        for(std::vector<const Node *>::const_iterator i= nodes.begin(); i!= nodes.end(); i++)
+          tree_type::insert(**i);
+      }
+    else
+      {
+        std::vector<NodePos> tmp(begin(),end());
+        tmp.reserve(tmp.size()+sz);
+        for(std::vector<const Node *>::const_iterator i= nodes.begin(); i!= nodes.end(); i++)
+          tmp.push_back(NodePos(**i));
+        efficient_replace_and_optimise(tmp);
+        pend_optimizar= 0;
+      }
+  }
+
 void XC::KDTreeNodes::erase(const Node &n)
   {
     tree_type::erase(n);
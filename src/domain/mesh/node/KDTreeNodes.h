@@ -31,6 +31,7 @@
 
 #include "utility/geom/pos_vec/KDTreePos.h"
 #include "utility/kdtree++/kdtree.hpp"
+#include <vector>
 
 class Pos3d;
 
@@ -67,6 +68,7 @@ class KDTreeNodes: protected kd_tree::KDTree<3, NodePos, std::pointer_to_binary_
     KDTreeNodes(void);
 
     void insert(const Node &);
+    void insert(const std::vector<const Node *> &);
     void erase(const Node &);
     void clear(void);
 
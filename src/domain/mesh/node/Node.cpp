@@ -1359,6 +1359,58 @@ int XC::Node::revertToStart(void)
     return 0;
   }
 
+//! @brief Store the displacement, velocity and acceleration vectors
+//! of the node in the mesh-wide arrays of the stores arguments.
+//!
+//! @param dispStore: contiguous storage for displacements.
+//! @param velStore: contiguous storage for velocities.
+//! @param accelStore: contiguous storage for accelerations.
+//! @param offset: position of the first DOF of the node in the stores.
+int XC::Node::bindResponseVectors(NodeVectorsStore &dispStore, NodeVectorsStore &velStore, NodeVectorsStore &accelStore, const size_t &offset)
+  {
+    int retval= disp.bindToStore(dispStore, offset, numberDOF);
+    retval+= vel.bindToStore(velStore, offset, numberDOF);
+    retval+= accel.bindToStore(accelStore, offset, numberDOF);
+    if(retval!=0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; node: " << getTag()
+		<< " can't be bound to the mesh storage."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Copy back the displacement, velocity and acceleration
+//! vectors from the mesh-wide storage.
+int XC::Node::releaseResponseVectors(void)
+  {
+    int retval= disp.releaseStore(numberDOF);
+    retval+= vel.releaseStore(numberDOF);
+    retval+= accel.releaseStore(numberDOF);
+    return retval;
+  }
+
+//! @brief Return true if the response vectors of the node are
+//! stored in the mesh-wide arrays.
+bool XC::Node::hasExternalResponseVectors(void) const
+  { return disp.hasExternalData(); }
+
+//! @brief Zero the reaction (and the unbalanced load
+//! and sensitivities if toStart is true). Used by the
+//! mesh when the response vectors are reverted in bulk.
+void XC::Node::zeroReactionAndUnbalancedLoad(bool toStart)
+  {
+    reaction.Zero();
+    if(toStart)
+      {
+        unbalLoad.Zero();
+        // AddingSensitivity: BEGIN /////////////////////////////////
+        dispSensitivity.Zero();
+        velSensitivity.Zero();
+        accSensitivity.Zero();
+        // AddingSensitivity: END ///////////////////////////////////
+      }
+  }
+
 //! @brief Return the mass matrix of the node.
 //!
 //! Returns the mass matrix set for the node, which is a matrix of size
@@ -69,6 +69,7 @@
 #include "NodeDispVectors.h"
 #include "NodeVelVectors.h"
 #include "NodeAccelVectors.h"
+#include "NodeVectorsStore.h"
 #include "utility/matrix/Matrix.h"
 #include <boost/python/list.hpp>
 
@@ -289,6 +290,12 @@ class Node: public MeshComponent
     virtual int revertToLastCommit();    
     virtual int revertToStart();        
 
+    // contiguous (mesh-wide) storage of the response vectors.
+    int bindResponseVectors(NodeVectorsStore &, NodeVectorsStore &, NodeVectorsStore &, const size_t &);
+    int releaseResponseVectors(void);
+    bool hasExternalResponseVectors(void) const;
+    void zeroReactionAndUnbalancedLoad(bool);
+
     // public methods for dynamic analysis
     virtual const Matrix &getMass(void) const;
     double getMassComponent(const int &) const;
@@ -32,14 +32,23 @@
 
 
 
-void XC::NodeDispVectors::free_mem(void)
+//! @brief Deletes the Vector objects that give access to the values.
+void XC::NodeDispVectors::free_views(void)
   {
-    NodeVectors::free_mem();
     // delete anything that we created with new
     if(incrDisp) delete incrDisp;
     incrDisp= nullptr;
     if(incrDeltaDisp) delete incrDeltaDisp;
     incrDeltaDisp= nullptr;
+    NodeVectors::free_views();
+  }
+
+//! @brief Creates the Vector objects that give access to the values.
+void XC::NodeDispVectors::alloc_views(const size_t &nDOF)
+  {
+    NodeVectors::alloc_views(nDOF);
+    incrDisp = new Vector(&value(2,0), nDOF);
+    incrDeltaDisp = new Vector(&value(3,0), nDOF);
   }
 
 //! @brief Constructor.
@@ -60,7 +69,7 @@ XC::NodeDispVectors &XC::NodeDispVectors::operator=(const NodeDispVectors &other
 
 //! @brief destructor
 XC::NodeDispVectors::~NodeDispVectors(void)
-  { free_mem(); }
+  { free_views(); }
 
 //! @brief Returns displacement increment.
 //! @param nDOF: number of degrees of freedom
@@ -97,7 +106,7 @@ const XC::Vector &XC::NodeDispVectors::getIncrDeltaDisp(const size_t &nDOF) cons
 //! @brief Sets trial values for the displacement components.
 //! @param nDOF: number of degrees of freedom.
 //! @param dof: component of the displacement to set.
-int XC::NodeDispVectors::setTrialDispComponent(const size_t &nDOF,const double &value,const size_t &dof)
+int XC::NodeDispVectors::setTrialDispComponent(const size_t &nDOF,const double &v,const size_t &dof)
   {
     // check vector arg is of correct size
     if(dof < 0 || dof >= nDOF)
@@ -120,10 +129,10 @@ int XC::NodeDispVectors::setTrialDispComponent(const size_t &nDOF,const double &
 
     // perform the assignment .. we don't go through Vector interface
     // as we are sure of size and this way is quicker
-    const double tDisp = value;
-    values[dof+2*nDOF]= tDisp - values[dof+nDOF];
-    values[dof+3*nDOF]= tDisp - values[dof];
-    values[dof]= tDisp;
+    const double tDisp = v;
+    value(2,dof)= tDisp - value(1,dof);
+    value(3,dof)= tDisp - value(0,dof);
+    value(0,dof)= tDisp;
 
     return 0;
   }
@@ -157,9 +166,9 @@ int XC::NodeDispVectors::setTrialDisp(const size_t &nDOF,const Vector &newTrialD
     for(size_t i=0;i<nDOF;i++)
       {
         const double tDisp = newTrialDisp(i);
-        values[i+2*nDOF]= tDisp - values[i+nDOF];
-        values[i+3*nDOF]= tDisp - values[i];
-        values[i] = tDisp;
+        value(2,i)= tDisp - value(1,i);
+        value(3,i)= tDisp - value(0,i);
+        value(0,i)= tDisp;
       }
     return 0;
   }
@@ -188,9 +197,9 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
         for(size_t i=0;i<nDOF;i++)
           {
             const double incrDispI = incrDispl(i);
-            values[i]= incrDispI;
-            values[i+2*nDOF]= incrDispI;
-            values[i+3*nDOF]= incrDispI;
+            value(0,i)= incrDispI;
+            value(2,i)= incrDispI;
+            value(3,i)= incrDispI;
           }
         return 0;
       }
@@ -199,9 +208,9 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
     for(size_t i= 0;i<nDOF;i++)
       {
         double incrDispI = incrDispl(i);
-        values[i]+= incrDispI;
-        values[i+2*nDOF]+= incrDispI;
-        values[i+3*nDOF]= incrDispI;
+        value(0,i)+= incrDispI;
+        value(2,i)+= incrDispI;
+        value(3,i)= incrDispI;
       }
     return 0;
   }
@@ -215,9 +224,9 @@ int XC::NodeDispVectors::commitState(const size_t &nDOF)
       {
         for(size_t i=0; i<nDOF; i++)
           {
-            values[i+nDOF]= values[i];
-            values[i+2*nDOF]= 0.0;
-            values[i+3*nDOF]= 0.0;
+            value(1,i)= value(0,i);
+            value(2,i)= 0.0;
+            value(3,i)= 0.0;
           }
       }
     return 0;
@@ -229,13 +238,13 @@ int XC::NodeDispVectors::commitState(const size_t &nDOF)
 int XC::NodeDispVectors::revertToLastCommit(const size_t &nDOF)
   {
     // check disp exists, if does set trial = last commit, incr = 0
-    if(!values.isEmpty())
+    if(dataPtr)
       {
         for(size_t i=0;i<nDOF;i++)
           {
-            values[i] = values[i+nDOF];
-            values[i+2*nDOF]= 0.0;
-            values[i+3*nDOF]= 0.0;
+            value(0,i)= value(1,i);
+            value(2,i)= 0.0;
+            value(3,i)= 0.0;
           }
       }
     return 0;
@@ -255,11 +264,9 @@ void XC::NodeDispVectors::Print(std::ostream &s,int flag) const
 int XC::NodeDispVectors::createDisp(const size_t &nDOF)
   {
     // trial , committed, incr = (committed-trial)
+    // (the incremental vectors are created in alloc_views).
     NodeVectors::createData(nDOF);
 
-    incrDisp = new Vector(&values[2*nDOF], nDOF);
-    incrDeltaDisp = new Vector(&values[3*nDOF], nDOF);
-
     if(incrDisp == nullptr || incrDeltaDisp == nullptr)
       {
         std::cerr << "WARNING - NodeDispVectors::createDisp() "
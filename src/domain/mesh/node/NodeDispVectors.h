@@ -47,7 +47,8 @@ class NodeDispVectors: public NodeVectors
     Vector *incrDisp;
     Vector *incrDeltaDisp;
   protected:
-    void free_mem(void);
+    virtual void alloc_views(const size_t &);
+    virtual void free_views(void);
   public:
     // constructors
     NodeDispVectors(void);
@@ -61,7 +62,7 @@ class NodeDispVectors: public NodeVectors
     virtual const Vector &getIncrDeltaDisp(const size_t &) const;
 
     // public methods for updating the trial response quantities
-    virtual int setTrialDispComponent(const size_t &nDOF,const double &value,const size_t &dof);
+    virtual int setTrialDispComponent(const size_t &nDOF,const double &v,const size_t &dof);
     virtual int setTrialDisp(const size_t &nDOF,const Vector &);
     virtual int incrTrialDisp(const size_t &nDOF,const Vector &);
 
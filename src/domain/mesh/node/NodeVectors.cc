@@ -27,13 +27,15 @@
 //NodeVectors.cpp
 
 #include <domain/mesh/node/NodeVectors.h>
+#include <domain/mesh/node/NodeVectorsStore.h>
 #include <utility/tagged/TaggedObject.h>
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/ID.h>
 
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 
-void XC::NodeVectors::free_mem(void)
+//! @brief Deletes the Vector objects that give access to the values.
+void XC::NodeVectors::free_views(void)
   {
     // delete anything that we created with new
     if(commitData) delete commitData;
@@ -42,6 +44,23 @@ void XC::NodeVectors::free_mem(void)
     trialData= nullptr;
   }
 
+//! @brief Creates the Vector objects that give access to the values.
+void XC::NodeVectors::alloc_views(const size_t &nDOF)
+  {
+    trialData= new Vector(&value(0,0), nDOF);
+    commitData= new Vector(&value(1,0), nDOF);
+  }
+
+//! @brief Release memory.
+void XC::NodeVectors::free_mem(void)
+  {
+    free_views();
+    values= Vector();
+    dataPtr= nullptr;
+    dataStride= 0;
+    externalData= false;
+  }
+
 void XC::NodeVectors::copy(const NodeVectors &other)
   {
     free_mem();
@@ -49,25 +68,25 @@ void XC::NodeVectors::copy(const NodeVectors &other)
     if(other.commitData)
       {
         const size_t nDOF= other.getVectorsSize();
-        const size_t sz= numVectors*nDOF;
         if(this->createData(nDOF) < 0)
           {
             std::cerr << " FATAL NodeVectors::Node(node *) - ran out of memory for data\n";
             exit(-1);
           }
-        for( size_t i=0;i<sz;i++)
-          values[i] = other.values[i];
+        for(size_t k=0;k<numVectors;k++)
+          for(size_t i=0;i<nDOF;i++)
+            value(k,i)= other.value(k,i);
       }
   }
 
 //! @brief Constructor.
 XC::NodeVectors::NodeVectors(const size_t &nv)
-  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values() {}
+  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values(), dataPtr(nullptr), dataStride(0), externalData(false) {}
 
 
 //! @brief Copy constructor.
 XC::NodeVectors::NodeVectors(const NodeVectors &other)
-  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), commitData(nullptr), trialData(nullptr), values()
+  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), commitData(nullptr), trialData(nullptr), values(), dataPtr(nullptr), dataStride(0), externalData(false)
   { copy(other); }
 
 XC::NodeVectors &XC::NodeVectors::operator=(const NodeVectors &other)
@@ -91,6 +110,64 @@ size_t XC::NodeVectors::getVectorsSize(void) const
       return 0;
   }
 
+//! @brief Store the values in the contiguous arrays of the store
+//! argument, starting at the position given by offset. The current
+//! values (if any) are copied into the store.
+//!
+//! @param store: mesh-wide storage.
+//! @param offset: position of the first component in each of the store arrays.
+//! @param nDOF: number of degrees of freedom.
+int XC::NodeVectors::bindToStore(NodeVectorsStore &store, const size_t &offset, const size_t &nDOF)
+  {
+    if(store.getNumVectors()!=numVectors)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the store has " << store.getNumVectors()
+                  << " vectors, " << numVectors << " expected."
+                  << std::endl;
+        return -1;
+      }
+    if(offset+nDOF>store.getNumDOFs())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; store too small." << std::endl;
+        return -2;
+      }
+    double *newPtr= store.getDataPtr()+offset;
+    const size_t newStride= store.getNumDOFs();
+    for(size_t k=0;k<numVectors;k++)
+      for(size_t i=0;i<nDOF;i++)
+        newPtr[k*newStride+i]= (dataPtr ? value(k,i) : 0.0);
+    free_views();
+    values= Vector();
+    dataPtr= newPtr;
+    dataStride= newStride;
+    externalData= true;
+    alloc_views(nDOF);
+    return 0;
+  }
+
+//! @brief Copy the values back from the store to the object itself.
+//! @param nDOF: number of degrees of freedom.
+int XC::NodeVectors::releaseStore(const size_t &nDOF)
+  {
+    if(externalData)
+      {
+        const size_t sz= numVectors*nDOF;
+        Vector tmp(sz);
+        for(size_t k=0;k<numVectors;k++)
+          for(size_t i=0;i<nDOF;i++)
+            tmp[k*nDOF+i]= value(k,i);
+        free_views();
+        values= tmp;
+        dataPtr= values.getDataPtr();
+        dataStride= nDOF;
+        externalData= false;
+        alloc_views(nDOF);
+      }
+    return 0;
+  }
+
 //! @brief Returns the data vector.
 const XC::Vector &XC::NodeVectors::getData(const size_t &nDOF) const
   {
@@ -136,7 +213,7 @@ const XC::Vector &XC::NodeVectors::getTrialData(void) const
     return *trialData;
   }
 
-int XC::NodeVectors::setTrialData(const size_t &nDOF,const double &value,const size_t &dof)
+int XC::NodeVectors::setTrialData(const size_t &nDOF,const double &v,const size_t &dof)
   {
     // check vector arg is of correct size
     if(dof < 0 || dof >= nDOF)
@@ -147,8 +224,8 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const double &value,const s
 
     // perform the assignment .. we don't go through Vector interface
     // as we are sure of size and this way is quicker
-    if(!values.isEmpty())
-      values[dof]= value;
+    if(dataPtr)
+      value(0,dof)= v;
     return 0;
   }
 
@@ -165,7 +242,7 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const Vector &newTrialData)
     // construct memory and Vectors for trial and committed
     // accel on first call to this method, getTrialData(),
     // getData(), or incrTrialData()
-    if(values.isEmpty())
+    if(!dataPtr)
       {
         if(this->createData(nDOF) < 0)
           {
@@ -177,7 +254,7 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const Vector &newTrialData)
     // perform the assignment .. we don't go through XC::Vector interface
     // as we are sure of size and this way is quicker
     for(size_t i=0;i<nDOF;i++)
-      values[i]= newTrialData(i);
+      value(0,i)= newTrialData(i);
     return 0;
   }
 
@@ -192,7 +269,7 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
       }
 
     // create a copy if no trial exists and add committed
-    if(values.isEmpty())
+    if(!dataPtr)
       {
         if(this->createData(nDOF) < 0)
           {
@@ -202,7 +279,7 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
       }
     // set trial = incr + trial
     for(size_t i= 0;i<nDOF;i++)
-      values[i]+= incrData(i);
+      value(0,i)+= incrData(i);
     return 0;
   }
 
@@ -213,7 +290,7 @@ int XC::NodeVectors::commitState(const size_t &nDOF)
     if(trialData)
       {
         for( size_t i=0; i<nDOF; i++)
-          values[i+nDOF] = values[i];
+          value(1,i)= value(0,i);
       }
     return 0;
   }
@@ -223,10 +300,10 @@ int XC::NodeVectors::commitState(const size_t &nDOF)
 int XC::NodeVectors::revertToLastCommit(const size_t &nDOF)
   {
     // check data exists, if does set trial = last commit, incr = 0
-    if(!values.isEmpty())
+    if(dataPtr)
       {
         for(size_t i=0;i<nDOF;i++)
-          values[i] = values[nDOF+i];
+          value(0,i)= value(1,i);
       }
     return 0;
   }
@@ -236,11 +313,11 @@ int XC::NodeVectors::revertToLastCommit(const size_t &nDOF)
 int XC::NodeVectors::revertToStart(const size_t &nDOF)
   {
     // check data exists, if does set all to zero
-    const size_t sz= numVectors*nDOF;
-    if(!values.isEmpty())
+    if(dataPtr)
       {
-        for(size_t i=0;i<sz;i++)
-          values[i]= 0.0;
+        for(size_t k=0;k<numVectors;k++)
+          for(size_t i=0;i<nDOF;i++)
+            value(k,i)= 0.0;
       }
     return 0;
   }
@@ -250,6 +327,12 @@ int XC::NodeVectors::revertToStart(const size_t &nDOF)
 //! values and the Vector objects for the committed and trial quantities.
 int XC::NodeVectors::createData(const size_t &nDOF)
   {
+    if(externalData && (getVectorsSize()==nDOF))
+      {
+        // values stored in the mesh arrays, just reset them.
+        revertToStart(nDOF);
+        return 0;
+      }
     free_mem();
     // trial , committed, incr = (committed-trial)
     const size_t sz= numVectors*nDOF;
@@ -260,8 +343,9 @@ int XC::NodeVectors::createData(const size_t &nDOF)
         for(size_t i=0;i<sz;i++)
           values[i]= 0.0;
 
-        trialData= new Vector(&values[0], nDOF);
-        commitData= new Vector(&values[nDOF], nDOF);
+        dataPtr= values.getDataPtr();
+        dataStride= nDOF;
+        alloc_views(nDOF);
 
         if(!commitData || !trialData)
           {
@@ -332,7 +416,7 @@ int XC::NodeVectors::recvData(const Communicator &comm)
 
         // set the trial quantities equal to committed
         for(int i=0; i<nDOF; i++)
-          values[i]= values[i+nDOF]; // set trial equal committed
+          value(0,i)= value(1,i); // set trial equal committed
       }
     else if(commitData)
       {
@@ -40,11 +40,17 @@ namespace XC {
 class Vector;
 class Channel;
 class FEM_ObjectBroker;
+class NodeVectorsStore;
 
 //! @ingroup Nod
 //
 //! @brief Vectors to store trial and committed
 //! values of node displacement, velocity, etc.
+//!
+//! The values are stored in the object itself (values member) or,
+//! if the object is bound to a NodeVectorsStore, in the contiguous
+//! arrays of the mesh. In both cases the component i of the k-th
+//! vector is at dataPtr[k*dataStride+i].
 class NodeVectors: public CommandEntity, public MovableObject
   {
   protected:
@@ -53,11 +59,22 @@ class NodeVectors: public CommandEntity, public MovableObject
     Vector *trialData; //!< trial quantities
     
     Vector values; //!< double array holding the displacement/velocity/acceleration.
+    double *dataPtr; //!< pointer to the first component of the trial values.
+    size_t dataStride; //!< distance between the first components of two consecutive vectors.
+    bool externalData; //!< true if the values are stored in a NodeVectorsStore.
 
+    //! @brief Return the i-th component of the k-th vector.
+    inline double &value(const size_t &k, const size_t &i)
+      { return dataPtr[k*dataStride+i]; }
+    //! @brief Return the i-th component of the k-th vector.
+    inline const double &value(const size_t &k, const size_t &i) const
+      { return dataPtr[k*dataStride+i]; }
     DbTagData &getDbTagData(void) const;
     int sendData(Communicator &);
     int recvData(const Communicator &);
     int createData(const size_t &);
+    virtual void alloc_views(const size_t &);
+    virtual void free_views(void);
     void free_mem(void);
     void copy(const NodeVectors &);
   public:
@@ -69,6 +86,14 @@ class NodeVectors: public CommandEntity, public MovableObject
 
     // public methods dealing with the DOF at the node
     size_t getVectorsSize(void) const;
+    //! @brief Return the number of vectors.
+    inline size_t getNumVectors(void) const
+      { return numVectors; }
+    //! @brief Return true if the values are stored in a NodeVectorsStore.
+    inline bool hasExternalData(void) const
+      { return externalData; }
+    int bindToStore(NodeVectorsStore &, const size_t &offset, const size_t &nDOF);
+    int releaseStore(const size_t &nDOF);
 
     // public methods for obtaining committed and trial 
     // response quantities of the node
@@ -78,7 +103,7 @@ class NodeVectors: public CommandEntity, public MovableObject
     const Vector &getCommitData(void) const;
 
     // public methods for updating the trial response quantities
-    virtual int setTrialData(const size_t &nDOF,const double &value,const size_t &dof);
+    virtual int setTrialData(const size_t &nDOF,const double &v,const size_t &dof);
     virtual int setTrialData(const size_t &nDOF,const Vector &);    
     virtual int incrTrialData(const size_t &nDOF,const Vector &);    
     
@@ -0,0 +1,98 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodeVectorsStore.cc
+
+#include "domain/mesh/node/NodeVectorsStore.h"
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param nv: number of arrays (trial, committed and increments).
+//! @param nDOFs: number of components of each array.
+XC::NodeVectorsStore::NodeVectorsStore(const size_t &nv, const size_t &nDOFs)
+  : numVectors(nv), numDOFs(nDOFs), data(nv*nDOFs, 0.0)
+  {}
+
+//! @brief Set the number of components of each array (all the
+//! values are set to zero).
+void XC::NodeVectorsStore::resize(const size_t &nDOFs)
+  {
+    numDOFs= nDOFs;
+    data.assign(numVectors*numDOFs, 0.0);
+  }
+
+//! @brief Release the storage.
+void XC::NodeVectorsStore::clear(void)
+  {
+    numDOFs= 0;
+    std::vector<double> tmp;
+    data.swap(tmp);
+  }
+
+//! @brief Commit state: committed values= trial values, increments= 0.
+void XC::NodeVectorsStore::commitState(void)
+  {
+    if(numVectors>1)
+      {
+        std::copy(getArrayPtr(0), getArrayPtr(0)+numDOFs, getArrayPtr(1));
+        std::fill(getArrayPtr(2 < numVectors ? 2 : numVectors), data.data()+data.size(), 0.0);
+      }
+  }
+
+//! @brief Return to the last committed state: trial values= committed
+//! values, increments= 0.
+void XC::NodeVectorsStore::revertToLastCommit(void)
+  {
+    if(numVectors>1)
+      {
+        std::copy(getArrayPtr(1), getArrayPtr(1)+numDOFs, getArrayPtr(0));
+        std::fill(getArrayPtr(2 < numVectors ? 2 : numVectors), data.data()+data.size(), 0.0);
+      }
+  }
+
+//! @brief Return to the initial state (all values= 0).
+void XC::NodeVectorsStore::revertToStart(void)
+  { std::fill(data.begin(), data.end(), 0.0); }
+
+//! @brief Add the increment argument (numDOFs components) to the
+//! trial values (and to the increments if any).
+void XC::NodeVectorsStore::incrTrial(const double *incr)
+  {
+    double *trial= getArrayPtr(0);
+    for(size_t i= 0; i<numDOFs; i++)
+      trial[i]+= incr[i];
+    if(numVectors>3) // displacements: incr and incrDelta.
+      {
+        double *incrTotal= getArrayPtr(2);
+	double *incrDelta= getArrayPtr(3);
+        for(size_t i= 0; i<numDOFs; i++)
+	  {
+	    incrTotal[i]+= incr[i];
+	    incrDelta[i]= incr[i];
+	  }
+      }
+  }
@@ -0,0 +1,92 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodeVectorsStore.h
+
+#ifndef NodeVectorsStore_h
+#define NodeVectorsStore_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+
+//! @ingroup Nod
+//
+//! @brief Contiguous (mesh-wide) storage for the trial, committed and
+//! incremental values of a nodal response (displacement, velocity or
+//! acceleration).
+//!
+//! The store holds numVectors arrays of numDOFs components each
+//! (struct of arrays): array 0 contains the trial values, array 1 the
+//! committed ones and the remaining arrays (if any) the increments.
+//! Each node bound to the store (see NodeVectors::bindToStore) uses the
+//! components from its offset to offset+number of DOFs of each array,
+//! so commit, revert and increment can be done in bulk.
+class NodeVectorsStore
+  {
+  private:
+    size_t numVectors; //!< number of arrays.
+    size_t numDOFs; //!< number of components of each array.
+    std::vector<double> data; //!< values (numVectors*numDOFs).
+  public:
+    NodeVectorsStore(const size_t &nv= 2, const size_t &nDOFs= 0);
+
+    void resize(const size_t &);
+    void clear(void);
+
+    //! @brief Return the number of arrays.
+    inline size_t getNumVectors(void) const
+      { return numVectors; }
+    //! @brief Return the number of components of each array.
+    inline size_t getNumDOFs(void) const
+      { return numDOFs; }
+    //! @brief Return true if the store is empty.
+    inline bool empty(void) const
+      { return data.empty(); }
+    //! @brief Return a pointer to the first value.
+    inline double *getDataPtr(void)
+      { return data.data(); }
+    //! @brief Return a pointer to the first value.
+    inline const double *getDataPtr(void) const
+      { return data.data(); }
+    //! @brief Return a pointer to the first value of the k-th array.
+    inline double *getArrayPtr(const size_t &k)
+      { return data.data()+k*numDOFs; }
+    //! @brief Return a pointer to the first value of the k-th array.
+    inline const double *getArrayPtr(const size_t &k) const
+      { return data.data()+k*numDOFs; }
+
+    void commitState(void);
+    void revertToLastCommit(void);
+    void revertToStart(void);
+    void incrTrial(const double *);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -69,4 +69,41 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .add_property("totalMass", &XC::Mesh::getTotalMass, "Return the total mass matrix.")
   .def("getTotalMassComponent", &XC::Mesh::getTotalMassComponent,"Return the total mass matrix component for the DOF argument.")
   .def("clearEigenvectors", &XC::Mesh::clearEigenvectors,"Remove the stored eigenvectors.")
+  .def("reorderNodes", &XC::Mesh::reorderNodes,"reorderNodes(tags): store (and iterate) the nodes in the order given by the argument (i.e. a locality optimized numbering).")
+  .def("reorderElements", &XC::Mesh::reorderElements,"reorderElements(tags): store (and iterate) the elements in the order given by the argument (i.e. a locality optimized numbering).")
+  .add_property("nodesSortedByTag", &XC::Mesh::getNodesSortedByTag, &XC::Mesh::setNodesSortedByTag, "If true (default) the nodes are iterated in increasing tag order, otherwise in insertion order (or in the order given to reorderNodes).")
+  .add_property("elementsSortedByTag", &XC::Mesh::getElementsSortedByTag, &XC::Mesh::setElementsSortedByTag, "If true (default) the elements are iterated in increasing tag order, otherwise in insertion order (or in the order given to reorderElements).")
+  .add_property("contiguousNodalStorage", &XC::Mesh::getContiguousNodalStorage, &XC::Mesh::setContiguousNodalStorage, "If true, the displacements, velocities and accelerations of the nodes are stored in mesh-wide contiguous arrays.")
+  ;
+
+class_<XC::VtuExporter, bases<CommandEntity>, boost::noncopyable >("VtuExporter")
+  .def("setSet", &XC::VtuExporter::setSet,"setSet(xcSet): write the nodes and elements of the given set.")
+  .def("setMesh", &XC::VtuExporter::setMesh,"setMesh(mesh): write the nodes and elements of the whole mesh.")
+  .def("clear", &XC::VtuExporter::clear,"remove the nodes and elements.")
+  .add_property("numPoints", &XC::VtuExporter::getNumPoints,"return the number of points to write.")
+  .add_property("numCells", &XC::VtuExporter::getNumCells,"return the number of cells to write.")
+  .def("addNodalField", &XC::VtuExporter::addNodalField,"addNodalField(name): append a nodal field to write (disp, rot, vel, accel, reaction, reactionMoment or mode:i).")
+  .def("addElementResponse", &XC::VtuExporter::addElementResponsePy,"addElementResponse(name, args): append an element response to write; args are the response arguments used by the element recorders (e.g. ['force']).")
+  .def("addElementProperty", &XC::VtuExporter::addElementProperty,"addElementProperty(name): append an element property to write; use 'propName.attribute' to write an attribute of the stored object (e.g. 'ULS_normalStressesResistanceSect1.CF').")
+  .def("clearFields", &XC::VtuExporter::clearFields,"remove the fields to write.")
+  .add_property("deformationFactor", &XC::VtuExporter::getDeformationFactor, &XC::VtuExporter::setDeformationFactor,"factor that multiplies the displacements to compute the position of the points (0: initial geometry).")
+  .add_property("compressed", &XC::VtuExporter::getCompressed, &XC::VtuExporter::setCompressed,"if true (default) the arrays are compressed with zlib.")
+  .def("write", &XC::VtuExporter::write,"write(fileName): write the grid and the fields to a .vtu file.")
+  .def("writeVtkHdf", &XC::VtuExporter::writeVtkHdf,"writeVtkHdf(fileName): write the grid and the fields to a VTKHDF file (requires a library built with HDF5).")
+  .def("writeStep", &XC::VtuExporter::writeStep,"writeStep(baseName, time): write the .vtu file for a load combination or time step and append it to the collection.")
+  .def("writePvd", &XC::VtuExporter::writePvd,"writePvd(fileName): write the ParaView collection file that indexes the files written by writeStep.")
+  .def("clearCollection", &XC::VtuExporter::clearCollection,"forget the files written by writeStep.")
+  ;
+
+class_<XC::SpatialIndex, bases<CommandEntity>, boost::noncopyable >("SpatialIndex")
+  .def("setSet", &XC::SpatialIndex::setSet,"setSet(xcSet): build the index for the nodes and elements of the given set.")
+  .def("setMesh", &XC::SpatialIndex::setMesh,"setMesh(mesh): build the index for the nodes and elements of the whole mesh.")
+  .add_property("numNodes", &XC::SpatialIndex::getNumNodes,"return the number of indexed nodes.")
+  .add_property("numElements", &XC::SpatialIndex::getNumElements,"return the number of indexed elements.")
+  .add_property("initialGeometry", &XC::SpatialIndex::getInitialGeometry, &XC::SpatialIndex::setInitialGeometry,"if true, the index is built using the undeformed geometry (defaults to true).")
+  .add_property("numThreads", &XC::SpatialIndex::getNumThreads, &XC::SpatialIndex::setNumThreads,"number of threads used in the queries (0: OpenMP default).")
+  .def("getKNearestNodes", &XC::SpatialIndex::getKNearestNodesPy,"getKNearestNodes(positions, k): return a tuple with the matrix of the tags of the k nearest nodes to each row of the positions matrix (-1 if not found) and the matrix of their distances.")
+  .def("getNodesInRadius", &XC::SpatialIndex::getNodesInRadiusPy,"getNodesInRadius(positions, r): return a list with the ID of the nodes at a distance not greater than r of each row of the positions matrix.")
+  .def("getElementsContaining", &XC::SpatialIndex::getElementsContainingPy,"getElementsContaining(positions, tol): return a tuple with the ID of the elements that contain each row of the positions matrix (-1 if not found) and the matrix of the natural coordinates of each position.")
+  .def("getCoincidentNodes", &XC::SpatialIndex::getCoincidentNodesPy,"getCoincidentNodes(tol): return a list with the ID of the nodes of each group of coincident nodes.")
   ;
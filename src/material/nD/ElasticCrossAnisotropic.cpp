@@ -81,19 +81,74 @@ rho(rhop)
 }
 
 //! @brief Constructor.
+//! @brief Constructor. The elastic constants must be set before
+//! using the material (see setEh, setEv,...).
 XC::ElasticCrossAnisotropic::ElasticCrossAnisotropic(int tag)
-  : XC::NDMaterial(tag, ND_TAG_ElasticCrossAnisotropic3D), Tepsilon(6), Cepsilon(6)
+  : XC::NDMaterial(tag, ND_TAG_ElasticCrossAnisotropic3D), Tepsilon(6), Cepsilon(6),
+    Dt(BJtensor(def_dim_4, 0.0)), Eh(0.0), Ev(0.0), nuhv(0.0), nuhh(0.0), Ghv(0.0), rho(0.0)
   {
     D.Zero();
   }
 
 ///////////////////////////////////////////////////////////////////////////////
 XC::ElasticCrossAnisotropic::ElasticCrossAnisotropic(void)
-  : Tepsilon(6), Cepsilon(6)
+  : Tepsilon(6), Cepsilon(6),
+    Dt(BJtensor(def_dim_4, 0.0)), Eh(0.0), Ev(0.0), nuhv(0.0), nuhh(0.0), Ghv(0.0), rho(0.0)
   {
     D.Zero();
   }
 
+///////////////////////////////////////////////////////////////////////////////
+//! @brief Recompute the elastic constants tensor if the moduli
+//! are already defined.
+void XC::ElasticCrossAnisotropic::update_tangent_tensor(void)
+  {
+    if((Eh>0.0) && (Ev>0.0) && (Ghv>0.0))
+      this->convertD2TensorEijkl();
+  }
+
+///////////////////////////////////////////////////////////////////////////////
+//! @brief Set the Young's modulus in any horizontal direction.
+void XC::ElasticCrossAnisotropic::setEh(const double &e)
+  {
+    Eh= e;
+    update_tangent_tensor();
+  }
+
+///////////////////////////////////////////////////////////////////////////////
+//! @brief Set the Young's modulus in the vertical direction.
+void XC::ElasticCrossAnisotropic::setEv(const double &e)
+  {
+    Ev= e;
+    update_tangent_tensor();
+  }
+
+///////////////////////////////////////////////////////////////////////////////
+//! @brief Set the Poisson's ratio for strain in the vertical
+//! direction due to a horizontal direct stress.
+void XC::ElasticCrossAnisotropic::setNuhv(const double &nu)
+  {
+    nuhv= nu;
+    update_tangent_tensor();
+  }
+
+///////////////////////////////////////////////////////////////////////////////
+//! @brief Set the Poisson's ratio for strain in any horizontal
+//! direction due to a horizontal direct stress at right angles.
+void XC::ElasticCrossAnisotropic::setNuhh(const double &nu)
+  {
+    nuhh= nu;
+    update_tangent_tensor();
+  }
+
+///////////////////////////////////////////////////////////////////////////////
+//! @brief Set the modulus of shear deformation in a vertical plane.
+void XC::ElasticCrossAnisotropic::setGhv(const double &g)
+  {
+    Ghv= g;
+    update_tangent_tensor();
+  }
+
 ///////////////////////////////////////////////////////////////////////////////
 double XC::ElasticCrossAnisotropic::getrho()
 {
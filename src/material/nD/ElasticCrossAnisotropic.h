@@ -89,6 +89,7 @@ class ElasticCrossAnisotropic: public NDMaterial
 
     void setInitElasticStiffness(void);
     void convertD2TensorEijkl(void);
+    void update_tangent_tensor(void);
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
@@ -98,6 +99,35 @@ class ElasticCrossAnisotropic: public NDMaterial
     ElasticCrossAnisotropic(void);
 
     double getrho();
+    //! @brief Return material density.
+    inline virtual double getRho(void) const
+      { return rho; }
+    //! @brief Set material density.
+    inline virtual void setRho(const double &r)
+      { rho= r; }
+    //! @brief Return the Young's modulus in any horizontal direction.
+    inline double getEh(void) const
+      { return Eh; }
+    void setEh(const double &);
+    //! @brief Return the Young's modulus in the vertical direction.
+    inline double getEv(void) const
+      { return Ev; }
+    void setEv(const double &);
+    //! @brief Return the Poisson's ratio for strain in the vertical
+    //! direction due to a horizontal direct stress.
+    inline double getNuhv(void) const
+      { return nuhv; }
+    void setNuhv(const double &);
+    //! @brief Return the Poisson's ratio for strain in any horizontal
+    //! direction due to a horizontal direct stress at right angles.
+    inline double getNuhh(void) const
+      { return nuhh; }
+    void setNuhh(const double &);
+    //! @brief Return the modulus of shear deformation in a vertical plane.
+    inline double getGhv(void) const
+      { return Ghv; }
+    void setGhv(const double &);
+
     int setTrialStrain(const Vector &v);
     int setTrialStrain(const Vector &v, const Vector &r);
     int setTrialStrainIncr(const Vector &v);
@@ -45,6 +45,15 @@ class_<XC::ElasticIsotropicMaterial, bases<XC::NDMaterial>, boost::noncopyable >
   .def("getInitialStrain", make_function(&XC::ElasticIsotropicMaterial::getInitialStrain, return_internal_reference<>()), "Return the value of the initial strain.")
   ;
 
+class_<XC::ElasticCrossAnisotropic, bases<XC::NDMaterial>, boost::noncopyable >("ElasticCrossAnisotropic", no_init)
+  .add_property("rho", &XC::ElasticCrossAnisotropic::getRho, &XC::ElasticCrossAnisotropic::setRho, "Material density.")
+  .add_property("Eh", &XC::ElasticCrossAnisotropic::getEh, &XC::ElasticCrossAnisotropic::setEh, "Young's modulus in any horizontal direction.")
+  .add_property("Ev", &XC::ElasticCrossAnisotropic::getEv, &XC::ElasticCrossAnisotropic::setEv, "Young's modulus in the vertical direction.")
+  .add_property("nuhv", &XC::ElasticCrossAnisotropic::getNuhv, &XC::ElasticCrossAnisotropic::setNuhv, "Poisson's ratio for strain in the vertical direction due to a horizontal direct stress.")
+  .add_property("nuhh", &XC::ElasticCrossAnisotropic::getNuhh, &XC::ElasticCrossAnisotropic::setNuhh, "Poisson's ratio for strain in any horizontal direction due to a horizontal direct stress at right angles.")
+  .add_property("Ghv", &XC::ElasticCrossAnisotropic::getGhv, &XC::ElasticCrossAnisotropic::setGhv, "Modulus of shear deformation in a vertical plane.")
+  ;
+
 #include "elastic_isotropic/python_interface.tcc"
 
 //class_<XC::FeapMaterial , bases<XC::NDMaterial>, boost::noncopyable >("FeapMaterial", no_init);
@@ -108,6 +108,8 @@ class MatPoint3D: public GaussPoint
                //tensor * p_Tangent_E_tensor = 0,
                );
         
+    MatPoint3D(const MatPoint3D &);
+    MatPoint3D &operator=(const MatPoint3D &);
     // Constructor 1
     ~MatPoint3D(void);
 
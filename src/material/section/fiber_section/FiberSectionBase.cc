@@ -71,22 +71,22 @@ void XC::FiberSectionBase::alloc_section_repres(const FiberSectionRepr *other)
 
 //! @brief Constructor.
 XC::FiberSectionBase::FiberSectionBase(int tag,int num,int classTag,int dim,MaterialHandler *mat_ldr)
-  : PrismaticBarCrossSection(tag, classTag,mat_ldr), eTrial(dim), eInic(dim), eCommit(dim), kr(dim), fibers(num), fiberTag(num+1), section_repres(nullptr)
+  : PrismaticBarCrossSection(tag, classTag,mat_ldr), eTrial(dim), eInic(dim), eCommit(dim), eSection(dim), kr(dim), fibers(num), fiberTag(num+1), section_repres(nullptr)
   {}
 
 //! @brief Constructor.
 XC::FiberSectionBase::FiberSectionBase(int tag, int classTag,int dim,MaterialHandler *mat_ldr)
-  : PrismaticBarCrossSection(tag, classTag,mat_ldr), eTrial(dim), eInic(dim), eCommit(dim), kr(dim), fibers(0), fiberTag(0), section_repres(nullptr)
+  : PrismaticBarCrossSection(tag, classTag,mat_ldr), eTrial(dim), eInic(dim), eCommit(dim), eSection(dim), kr(dim), fibers(0), fiberTag(0), section_repres(nullptr)
   {}
 
 // constructor for blank object that recvSelf needs to be invoked upon
 XC::FiberSectionBase::FiberSectionBase(int classTag,int dim,MaterialHandler *mat_ldr)
-  : PrismaticBarCrossSection(0, classTag,mat_ldr), eTrial(dim), eInic(dim), eCommit(dim), kr(dim),fibers(0), fiberTag(0), section_repres(nullptr)
+  : PrismaticBarCrossSection(0, classTag,mat_ldr), eTrial(dim), eInic(dim), eCommit(dim), eSection(dim), kr(dim),fibers(0), fiberTag(0), section_repres(nullptr)
   {}
 
 //! @brief Copy constructor.
 XC::FiberSectionBase::FiberSectionBase(const FiberSectionBase &other)
-  : PrismaticBarCrossSection(other), eTrial(other.eTrial), eInic(other.eInic), eCommit(other.eCommit), kr(other.kr), fibers(other.fibers), fiberTag(other.fiberTag), section_repres(nullptr)
+  : PrismaticBarCrossSection(other), eTrial(other.eTrial), eInic(other.eInic), eCommit(other.eCommit), eSection(other.eSection), kr(other.kr), fibers(other.fibers), fiberTag(other.fiberTag), section_repres(nullptr)
   {
     if(other.section_repres)
       alloc_section_repres(other.section_repres);
@@ -224,11 +224,12 @@ int XC::FiberSectionBase::setTrialSectionDeformation(const Vector &deforms)
   }
 
 //! @brief Returns material's trial generalized strain.
+//! The result is stored in a member (not in a static variable) so
+//! different sections can be evaluated concurrently.
 const XC::Vector &XC::FiberSectionBase::getSectionDeformation(void) const
   {
-    static Vector retval;
-    retval= eTrial-eInic;
-    return retval;
+    eSection= eTrial-eInic;
+    return eSection;
   }
 
 //! @brief Returns a const pointer to section geometry.
@@ -64,6 +64,7 @@ class FiberSectionBase: public PrismaticBarCrossSection
     Vector eTrial; //!< trial section deformations 
     Vector eInic; //!< initial section deformations 
     Vector eCommit; //!< committed section deformations
+    mutable Vector eSection; //!< trial minus initial section deformations (see getSectionDeformation).
 
     void free_section_repres(void);
     void alloc_section_repres(const FiberSectionRepr *);
@@ -0,0 +1,331 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberSectionBatchSolver.cc
+
+#include "FiberSectionBatchSolver.h"
+#include "material/section/fiber_section/FiberSectionBase.h"
+#include "material/section/fiber_section/fiber/Fiber.h"
+#include "material/section/fiber_section/fiber/FiberSet.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include "utility/utils/misc_utils/colormod.h"
+#include <map>
+#include <cmath>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+//! @brief Solve the (small) system A x= b by Gauss elimination with
+//! partial pivoting; return false if the matrix is singular.
+//!
+//! Matrix::Solve is not used here because it works on a static work
+//! area, so it can't be called from several threads at once.
+bool solve_small(const XC::Matrix &A, const XC::Vector &b, XC::Vector &x)
+  {
+    const int n= A.noRows();
+    std::vector<double> a(n*n);
+    std::vector<double> y(n);
+    double maxAbs= 0.0;
+    for(int i= 0;i<n;i++)
+      {
+        y[i]= b(i);
+        for(int j= 0;j<n;j++)
+          {
+            a[i*n+j]= A(i,j);
+            maxAbs= std::max(maxAbs, std::abs(A(i,j)));
+          }
+      }
+    const double zero= 1e-14*maxAbs;
+    for(int k= 0;k<n;k++)
+      {
+        int p= k;
+        for(int i= k+1;i<n;i++)
+          if(std::abs(a[i*n+k])>std::abs(a[p*n+k]))
+            p= i;
+        if(std::abs(a[p*n+k])<=zero)
+          return false;
+        if(p!=k)
+          {
+            for(int j= 0;j<n;j++)
+              std::swap(a[k*n+j], a[p*n+j]);
+            std::swap(y[k], y[p]);
+          }
+        for(int i= k+1;i<n;i++)
+          {
+            const double f= a[i*n+k]/a[k*n+k];
+            for(int j= k;j<n;j++)
+              a[i*n+j]-= f*a[k*n+j];
+            y[i]-= f*y[k];
+          }
+      }
+    for(int i= n-1;i>=0;i--)
+      {
+        double s= y[i];
+        for(int j= i+1;j<n;j++)
+          s-= a[i*n+j]*x(j);
+        x(i)= s/a[i*n+i];
+      }
+    return true;
+  }
+} // namespace
+
+//! @brief Constructor.
+XC::FiberSectionBatchSolver::FiberSectionBatchSolver(FiberSectionBase *sct)
+  : CommandEntity(), section(sct), maxNumIter(50), tolerance(1e-9), numThreads(0) {}
+
+//! @brief Set the names of the fiber sets to compute the extreme
+//! strains and stresses for.
+void XC::FiberSectionBatchSolver::setFiberSetNames(const boost::python::list &l)
+  {
+    fiberSetNames.clear();
+    const size_t sz= len(l);
+    for(size_t i= 0;i<sz;i++)
+      fiberSetNames.push_back(boost::python::extract<std::string>(l[i]));
+  }
+
+//! @brief Return the names of the fiber sets to compute the extreme
+//! strains and stresses for.
+boost::python::list XC::FiberSectionBatchSolver::getFiberSetNames(void) const
+  {
+    boost::python::list retval;
+    for(std::vector<std::string>::const_iterator i= fiberSetNames.begin(); i!=fiberSetNames.end(); i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Return the indexes (in the fiber container) of the fibers
+//! of the whole section (first item) and of the fibers of each set.
+//!
+//! The fiber sets are not copied with the section, so the fibers are
+//! identified by its position in the container, that is kept in the
+//! copies.
+std::vector<std::vector<size_t> > XC::FiberSectionBatchSolver::get_fiber_set_indexes(void) const
+  {
+    std::vector<std::vector<size_t> > retval(fiberSetNames.size()+1);
+    const std::deque<Fiber *> &fibers= section->getFibers();
+    const size_t numFibers= fibers.size();
+    std::map<const Fiber *, size_t> positions;
+    for(size_t i= 0;i<numFibers;i++)
+      {
+        positions[fibers[i]]= i;
+        retval[0].push_back(i);
+      }
+    FiberSets &sets= section->getFiberSets();
+    for(size_t k= 0;k<fiberSetNames.size();k++)
+      {
+        FiberSets::const_iterator iSet= sets.find(fiberSetNames[k]);
+        if(iSet==sets.end())
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; fiber set: '" << fiberSetNames[k]
+                      << "' not found."
+                      << Color::def << std::endl;
+            continue;
+          }
+        const FiberSet &fs= iSet->second;
+        for(FiberSet::const_iterator j= fs.begin(); j!=fs.end(); j++)
+          {
+            std::map<const Fiber *, size_t>::const_iterator p= positions.find(*j);
+            if(p!=positions.end())
+              retval[k+1].push_back(p->second);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Compute the deformation plane that corresponds to the
+//! given row of the target matrix.
+//! @param sct: section to work with.
+//! @param targets: internal forces.
+//! @param K0: initial tangent stiffness of the section.
+//! @param setIndexes: indexes of the fibers of each set.
+//! @param row: row to solve.
+bool XC::FiberSectionBatchSolver::solve_row(FiberSectionBase &sct, const Matrix &targets, const Matrix &K0, const std::vector<std::vector<size_t> > &setIndexes, const int &row)
+  {
+    const int order= K0.noRows();
+    Vector target(order);
+    for(int j= 0;j<order;j++)
+      target(j)= targets(row,j);
+    sct.revertToStart();
+
+    const double ref= std::max(target.Norm(), 1.0);
+    Vector e(order), de(order), r(order);
+    if(!solve_small(K0, target, e)) // linear estimate.
+      e.Zero();
+    bool retval= false;
+    double rNorm= 0.0;
+    int iter= 0;
+    while(iter<maxNumIter)
+      {
+        iter++;
+        sct.setTrialSectionDeformation(e);
+        r= target-sct.getStressResultant();
+        rNorm= r.Norm();
+        if(rNorm<=tolerance*ref)
+          {
+            retval= true;
+            break;
+          }
+        // Use the initial stiffness if the tangent is singular
+        // (e.g. fully cracked section).
+        if(!solve_small(sct.getSectionTangent(), r, de))
+          if(!solve_small(K0, r, de))
+            break;
+        e+= de;
+      }
+
+    // Store results.
+    for(int j= 0;j<order;j++)
+      deformations(row,j)= e(j);
+    converged(row)= retval ? 1 : 0;
+    numIterations(row)= iter;
+    residuals(row)= rNorm;
+    const std::deque<Fiber *> &fibers= sct.getFibers();
+    for(size_t k= 0;k<setIndexes.size();k++)
+      {
+        const std::vector<size_t> &indexes= setIndexes[k];
+        if(indexes.empty())
+          continue;
+        double strainMin= 0.0, strainMax= 0.0, stressMin= 0.0, stressMax= 0.0;
+        for(std::vector<size_t>::const_iterator i= indexes.begin(); i!=indexes.end(); i++)
+          {
+            const UniaxialMaterial *mat= fibers[*i]->getMaterial();
+            const double strain= mat->getStrain();
+            const double stress= mat->getStress();
+            if(i==indexes.begin())
+              {
+                strainMin= strainMax= strain;
+                stressMin= stressMax= stress;
+              }
+            else
+              {
+                strainMin= std::min(strainMin, strain);
+                strainMax= std::max(strainMax, strain);
+                stressMin= std::min(stressMin, stress);
+                stressMax= std::max(stressMax, stress);
+              }
+          }
+        fiberResults(row,4*k)= strainMin;
+        fiberResults(row,4*k+1)= strainMax;
+        fiberResults(row,4*k+2)= stressMin;
+        fiberResults(row,4*k+3)= stressMax;
+      }
+    return retval;
+  }
+
+//! @brief Compute the deformation plane for each row of the target
+//! matrix. Return the number of rows that didn't converge (or a
+//! negative value in case of error).
+//! @param targets: internal forces (one row for each case, the
+//!                 columns follow the order of the section stress
+//!                 resultant).
+int XC::FiberSectionBatchSolver::solve(const Matrix &targets)
+  {
+    if(!section)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; section not set."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    const int order= section->getOrder();
+    if(targets.noCols()!=order)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; the target matrix has " << targets.noCols()
+                  << " columns but the order of the section is: "
+                  << order << "."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    const int numRows= targets.noRows();
+    deformations= Matrix(numRows, order);
+    converged= ID(numRows);
+    numIterations= ID(numRows);
+    residuals= Vector(numRows);
+    const std::vector<std::vector<size_t> > setIndexes= get_fiber_set_indexes();
+    fiberResults= Matrix(numRows, 4*setIndexes.size());
+    if(numRows==0)
+      return 0;
+    const Matrix K0= section->getInitialTangent(); // copy: computed in a static work area.
+
+    // One copy of the section for each thread. The copies are created
+    // here, before the parallel region, because the properties of their
+    // materials can be shared (see SteelBase); the threads only change
+    // the state of their copy.
+    int nThreads= 1;
+#ifdef _OPENMP
+    nThreads= (numThreads>0) ? numThreads : omp_get_max_threads();
+#endif
+    nThreads= std::max(1, std::min(nThreads, numRows));
+    std::vector<FiberSectionBase *> copies(nThreads, nullptr);
+    for(int t= 0;t<nThreads;t++)
+      copies[t]= dynamic_cast<FiberSectionBase *>(section->getCopy());
+
+    int numFailed= 0;
+#pragma omp parallel for num_threads(nThreads) schedule(dynamic, 16) reduction(+:numFailed)
+    for(int i= 0;i<numRows;i++)
+      {
+        int t= 0;
+#ifdef _OPENMP
+        t= omp_get_thread_num();
+#endif
+        if(!solve_row(*copies[t], targets, K0, setIndexes, i))
+          numFailed++;
+      }
+    for(int t= 0;t<nThreads;t++)
+      delete copies[t];
+    return numFailed;
+  }
+
+//! @brief Return the minimum strain, maximum strain, minimum stress
+//! and maximum stress of the fibers of the given set for the given row.
+//! @param row: row of the target matrix.
+//! @param setName: name of the fiber set (empty for the whole section).
+XC::Vector XC::FiberSectionBatchSolver::getFiberSetResults(const int &row, const std::string &setName) const
+  {
+    Vector retval(4);
+    int k= 0;
+    if(!setName.empty())
+      {
+        std::vector<std::string>::const_iterator i= std::find(fiberSetNames.begin(), fiberSetNames.end(), setName);
+        if(i==fiberSetNames.end())
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; fiber set: '" << setName
+                      << "' not in the list of fiber sets."
+                      << Color::def << std::endl;
+            return retval;
+          }
+        k= (i-fiberSetNames.begin())+1;
+      }
+    if((row>=0) && (row<fiberResults.noRows()))
+      for(int j= 0;j<4;j++)
+        retval(j)= fiberResults(row,4*k+j);
+    return retval;
+  }
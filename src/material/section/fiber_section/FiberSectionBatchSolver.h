@@ -0,0 +1,133 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberSectionBatchSolver.h
+
+#ifndef FiberSectionBatchSolver_h
+#define FiberSectionBatchSolver_h
+
+#include "utility/kernel/CommandEntity.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <vector>
+#include <string>
+
+namespace XC {
+class FiberSectionBase;
+
+//! @ingroup MATSCCFiberModel
+//
+//! @brief Computes the deformation plane of a fiber section for
+//! each row of a matrix of internal forces (targets) without building
+//! any finite element model.
+//!
+//! The columns of the target matrix follow the order of the section
+//! stress resultant (see getResponseType), i.e. N, Mz, My for
+//! FiberSection3d or N, Mz, My, Vy, Vz, T for FiberSectionShear3d.
+//! Each row is solved by the Newton-Raphson method, starting from
+//! the linear (initial stiffness) estimate and from the initial state
+//! of the materials, so the results don't depend on the order of the
+//! rows. The rows are distributed among OpenMP threads, each one
+//! working on its own copy of the section.
+//!
+//! For each row the solver stores the section deformations, the
+//! convergence flag, the number of iterations and, for the whole
+//! section and for each of the requested fiber sets, the minimum
+//! and maximum fiber strains and stresses (the inputs of the crack
+//! width computations).
+class FiberSectionBatchSolver: public CommandEntity
+  {
+  private:
+    FiberSectionBase *section; //!< section to solve.
+    int maxNumIter; //!< maximum number of iterations.
+    double tolerance; //!< relative tolerance for the norm of the unbalanced forces.
+    int numThreads; //!< number of threads (if not positive use the OpenMP default).
+    std::vector<std::string> fiberSetNames; //!< fiber sets to compute the extreme values for.
+
+    Matrix deformations; //!< section deformations (one row for each target).
+    ID converged; //!< 1 if the row converged 0 otherwise.
+    ID numIterations; //!< number of iterations for each row.
+    Vector residuals; //!< norm of the unbalanced forces for each row.
+    Matrix fiberResults; //!< strain min, strain max, stress min and stress max for the whole section and for each fiber set.
+
+    std::vector<std::vector<size_t> > get_fiber_set_indexes(void) const;
+    bool solve_row(FiberSectionBase &, const Matrix &, const Matrix &, const std::vector<std::vector<size_t> > &, const int &);
+  public:
+    FiberSectionBatchSolver(FiberSectionBase *sct= nullptr);
+
+    //! @brief Set the section to solve.
+    inline void setSection(FiberSectionBase *sct)
+      { section= sct; }
+    //! @brief Return the section to solve.
+    inline FiberSectionBase *getSection(void)
+      { return section; }
+    //! @brief Return the maximum number of iterations.
+    inline int getMaxNumIter(void) const
+      { return maxNumIter; }
+    //! @brief Set the maximum number of iterations.
+    inline void setMaxNumIter(const int &n)
+      { maxNumIter= n; }
+    //! @brief Return the relative tolerance.
+    inline double getTolerance(void) const
+      { return tolerance; }
+    //! @brief Set the relative tolerance.
+    inline void setTolerance(const double &tol)
+      { tolerance= tol; }
+    //! @brief Return the number of threads.
+    inline int getNumThreads(void) const
+      { return numThreads; }
+    //! @brief Set the number of threads (if not positive use the
+    //! OpenMP default).
+    inline void setNumThreads(const int &n)
+      { numThreads= n; }
+    void setFiberSetNames(const boost::python::list &);
+    boost::python::list getFiberSetNames(void) const;
+
+    int solve(const Matrix &);
+
+    //! @brief Return the section deformations (one row for each target).
+    inline const Matrix &getDeformations(void) const
+      { return deformations; }
+    //! @brief Return the convergence flags.
+    inline const ID &getConvergenceFlags(void) const
+      { return converged; }
+    //! @brief Return the number of iterations of each row.
+    inline const ID &getNumIterations(void) const
+      { return numIterations; }
+    //! @brief Return the norm of the unbalanced forces of each row.
+    inline const Vector &getResiduals(void) const
+      { return residuals; }
+    //! @brief Return the extreme fiber values (see class description).
+    inline const Matrix &getFiberResults(void) const
+      { return fiberResults; }
+    Vector getFiberSetResults(const int &, const std::string &) const;
+  };
+
+} // end of XC namespace
+
+#endif
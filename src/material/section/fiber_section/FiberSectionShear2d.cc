@@ -40,12 +40,6 @@
 #include "utility/actor/actor/MatrixCommMetaData.h"
 #include "utility/geom/d2/2d_polygons/Polygon2d.h"
 
-XC::Vector XC::FiberSectionShear2d::def(3);
-XC::Vector XC::FiberSectionShear2d::defzero(3);
-XC::Vector XC::FiberSectionShear2d::s(3);
-XC::Matrix XC::FiberSectionShear2d::ks(3,3);
-XC::Matrix XC::FiberSectionShear2d::fs(3,3);
-
 
 //! @brief Frees memory occupied by materials that define
 //! shear and torsion responses.
@@ -73,11 +67,13 @@ void XC::FiberSectionShear2d::setRespVy(const UniaxialMaterial *rvy)
 //! @brief Constructor.
 XC::FiberSectionShear2d::FiberSectionShear2d(int tag, MaterialHandler *mat_ldr)
   : FiberSection2d(tag, SEC_TAG_FiberSectionShear2d, mat_ldr),
-    respVy(nullptr) {}
+    respVy(nullptr),
+    def(3), defzero(3), s(3), ks(3,3), fs(3,3) {}
 
 //! @brief Copy constructor.
 XC::FiberSectionShear2d::FiberSectionShear2d(const FiberSectionShear2d &other)
-  : FiberSection2d(other), respVy(nullptr)
+  : FiberSection2d(other), respVy(nullptr),
+    def(3), defzero(3), s(3), ks(3,3), fs(3,3)
    { setRespVy(other.respVy); }
 
 //! @brief Assignment operator.
@@ -128,7 +124,7 @@ void XC::FiberSectionShear2d::clear(void)
 //! @brief Asigna la initial strain.
 int XC::FiberSectionShear2d::setInitialSectionDeformation(const Vector &def)
   {
-    static Vector v(2);
+    Vector v(2); // not static: the section can be evaluated concurrently.
     v(0)= def(0); v(1)= def(1);
     int ret= FiberSection2d::setInitialSectionDeformation(v);
     if(respVy) ret+= respVy->setInitialStrain(def(2));
@@ -138,7 +134,7 @@ int XC::FiberSectionShear2d::setInitialSectionDeformation(const Vector &def)
 //! @brief Asigna la trial strain.
 int XC::FiberSectionShear2d::setTrialSectionDeformation(const Vector &def)
   {
-    static Vector v(2);
+    Vector v(2); // not static: the section can be evaluated concurrently.
     v(0)= def(0); v(1)= def(1);
     int ret= FiberSection2d::setTrialSectionDeformation(v);
     if(respVy) ret+= respVy->setTrialStrain(def(2));
@@ -43,11 +43,13 @@ class FiberSectionShear2d: public FiberSection2d
   private:
     UniaxialMaterial *respVy;
     
-    static Vector def; //!< Storage for section deformations
-    static Vector defzero; //!< Storage for initial section deformations
-    static Vector s; //!< Storage for stress resultants
-    static Matrix ks;//!< Storage for section stiffness
-    static Matrix fs;//!< Storage for section flexibility
+    // Per-instance storage: the copies of the section can be evaluated
+    // concurrently (see FiberSectionBatchSolver).
+    mutable Vector def; //!< Storage for section deformations
+    mutable Vector defzero; //!< Storage for initial section deformations
+    mutable Vector s; //!< Storage for stress resultants
+    mutable Matrix ks;//!< Storage for section stiffness
+    mutable Matrix fs;//!< Storage for section flexibility
 
     void setRespVy(const UniaxialMaterial *);
     void freeRespVy(void);
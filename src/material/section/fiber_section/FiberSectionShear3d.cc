@@ -40,12 +40,6 @@
 #include "utility/actor/actor/MatrixCommMetaData.h"
 #include "utility/geom/d2/2d_polygons/Polygon2d.h"
 
-XC::Vector XC::FiberSectionShear3d::def(6);
-XC::Vector XC::FiberSectionShear3d::defzero(6);
-XC::Vector XC::FiberSectionShear3d::s(6);
-XC::Matrix XC::FiberSectionShear3d::ks(6,6);
-XC::Matrix XC::FiberSectionShear3d::fs(6,6);
-
 
 //! @brief Frees memory occupied by materials that define
 //! shear and torsion responses.
@@ -128,11 +122,13 @@ void XC::FiberSectionShear3d::setRespVyVzT(const UniaxialMaterial *rvy,const Uni
 //! @brief Constructor.
 XC::FiberSectionShear3d::FiberSectionShear3d(int tag, MaterialHandler *mat_ldr)
   : FiberSection3d(tag, SEC_TAG_FiberSectionShear3d,mat_ldr),
-    respVy(nullptr), respVz(nullptr), respT(nullptr) {}
+    respVy(nullptr), respVz(nullptr), respT(nullptr),
+    def(6), defzero(6), s(6), ks(6,6), fs(6,6) {}
 
 //! @brief Copy constructor.
 XC::FiberSectionShear3d::FiberSectionShear3d(const FiberSectionShear3d &other)
-  : FiberSection3d(other), respVy(nullptr), respVz(nullptr), respT(nullptr)
+  : FiberSection3d(other), respVy(nullptr), respVz(nullptr), respT(nullptr),
+    def(6), defzero(6), s(6), ks(6,6), fs(6,6)
    { setRespVyVzT(other.respVy,other.respVz,other.respT); }
 
 //! @brief Assignment operator.
@@ -238,7 +234,7 @@ void XC::FiberSectionShear3d::clear(void)
 //! @brief Asigna la initial strain.
 int XC::FiberSectionShear3d::setInitialSectionDeformation(const Vector &def)
   {
-    static Vector v(3);
+    Vector v(3); // not static: the section can be evaluated concurrently.
     v(0)= def(0); v(1)= def(1); v(2)= def(2);
     int ret= FiberSection3d::setInitialSectionDeformation(v);
     if(respVy) ret+= respVy->setInitialStrain(def(3));
@@ -250,7 +246,7 @@ int XC::FiberSectionShear3d::setInitialSectionDeformation(const Vector &def)
 //! @brief Asigna la trial strain.
 int XC::FiberSectionShear3d::setTrialSectionDeformation(const Vector &def)
   {
-    static Vector v(3);
+    Vector v(3); // not static: the section can be evaluated concurrently.
     v(0)= def(0); v(1)= def(1); v(2)= def(2);
     int ret= FiberSection3d::setTrialSectionDeformation(v);
     if(respVy) ret+= respVy->setTrialStrain(def(3));
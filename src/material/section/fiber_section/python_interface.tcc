@@ -97,3 +97,18 @@ class_<XC::FiberSectionShear3d , bases<XC::FiberSection3d>, boost::noncopyable >
   .def("getRespT",make_function(&XC::FiberSectionShear3d::getRespT,return_internal_reference<>()),"Return torsion response.")
   .def("setRespVyVzTByName",&XC::FiberSectionShear3d::setRespVyVzTByName)
   ;
+
+class_<XC::FiberSectionBatchSolver, bases<CommandEntity>, boost::noncopyable >("FiberSectionBatchSolver")
+  .add_property("section", make_function(&XC::FiberSectionBatchSolver::getSection, return_internal_reference<>()), &XC::FiberSectionBatchSolver::setSection, "fiber section to solve.")
+  .add_property("maxNumIter", &XC::FiberSectionBatchSolver::getMaxNumIter, &XC::FiberSectionBatchSolver::setMaxNumIter, "maximum number of iterations.")
+  .add_property("tolerance", &XC::FiberSectionBatchSolver::getTolerance, &XC::FiberSectionBatchSolver::setTolerance, "relative tolerance for the norm of the unbalanced forces.")
+  .add_property("numThreads", &XC::FiberSectionBatchSolver::getNumThreads, &XC::FiberSectionBatchSolver::setNumThreads, "number of threads (if not positive use the OpenMP default).")
+  .add_property("fiberSetNames", &XC::FiberSectionBatchSolver::getFiberSetNames, &XC::FiberSectionBatchSolver::setFiberSetNames, "names of the fiber sets to compute the extreme strains and stresses for.")
+  .def("solve", &XC::FiberSectionBatchSolver::solve, "solve(targets): compute the section deformations for each row of the internal forces matrix (columns in the order of the section stress resultant); return the number of rows that didn't converge.")
+  .add_property("deformations", make_function(&XC::FiberSectionBatchSolver::getDeformations, return_internal_reference<>()), "section deformations (one row for each target).")
+  .add_property("convergenceFlags", make_function(&XC::FiberSectionBatchSolver::getConvergenceFlags, return_internal_reference<>()), "1 if the row converged 0 otherwise.")
+  .add_property("numIterations", make_function(&XC::FiberSectionBatchSolver::getNumIterations, return_internal_reference<>()), "number of iterations for each row.")
+  .add_property("residuals", make_function(&XC::FiberSectionBatchSolver::getResiduals, return_internal_reference<>()), "norm of the unbalanced forces for each row.")
+  .add_property("fiberResults", make_function(&XC::FiberSectionBatchSolver::getFiberResults, return_internal_reference<>()), "minimum strain, maximum strain, minimum stress and maximum stress of the fibers of the whole section followed by the same values for each fiber set (one row for each target).")
+  .def("getFiberSetResults", &XC::FiberSectionBatchSolver::getFiberSetResults, "getFiberSetResults(row, setName): return the minimum strain, maximum strain, minimum stress and maximum stress of the fibers of the set (empty name for the whole section).")
+  ;
@@ -72,6 +72,7 @@
 //! @brief Sets all history and state variables to initial values
 int XC::Steel01::setup_parameters(void)
   {
+    const steel_parameters &p= getParameters();
     // History variables
     CminStrain= 0.0;
     CmaxStrain= 0.0;
@@ -88,11 +89,11 @@ int XC::Steel01::setup_parameters(void)
     // State variables
     Cstrain= 0.0;
     Cstress= 0.0;
-    Ctangent= E0;
+    Ctangent= p.E0;
 
     Tstrain= 0.0;
     Tstress= 0.0;
-    Ttangent= E0;
+    Ttangent= p.E0;
     return 0;
   }
 
@@ -111,14 +112,15 @@ XC::Steel01::Steel01(int tag)
 //! @brief Calculates the trial state variables based on the trial strain
 void XC::Steel01::determineTrialState(double dStrain)
   {
-    const double fyOneMinusB= fy * (1.0 - b);
+    const steel_parameters &p= getParameters();
+    const double fyOneMinusB= p.fy * (1.0 - p.b);
     const double Esh= getEsh();
     const double epsy= getEpsy();
 
     const double c1= Esh*Tstrain;
     const double c2= TshiftN*fyOneMinusB;
     const double c3= TshiftP*fyOneMinusB;
-    const double c= Cstress + E0*dStrain;
+    const double c= Cstress + p.E0*dStrain;
 
 //     /**********************************************************
 //        removal of the following lines due to problems with
@@ -147,7 +149,7 @@ void XC::Steel01::determineTrialState(double dStrain)
     Tstress= std::max((c1-c2), std::min((c1+c3),c));
 
     if(fabs(Tstress-c)<DBL_EPSILON)
-      Ttangent = E0;
+      Ttangent = p.E0;
     else
       Ttangent = Esh;
 
@@ -173,7 +175,7 @@ void XC::Steel01::determineTrialState(double dStrain)
         Tloading = -1;
         if(Cstrain > TmaxStrain)
           TmaxStrain = Cstrain;
-        TshiftN= 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+        TshiftN= 1 + p.a1*pow((TmaxStrain-TminStrain)/(2.0*p.a2*epsy),0.8);
       }
 
     // Transition from unloading to loading, i.e. negative strain increment
@@ -183,13 +185,14 @@ void XC::Steel01::determineTrialState(double dStrain)
         Tloading = 1;
         if(Cstrain < TminStrain)
           TminStrain = Cstrain;
-        TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+        TshiftP = 1 + p.a3*pow((TmaxStrain-TminStrain)/(2.0*p.a4*epsy),0.8);
       }
   }
 
 //! @brief Determines if a load reversal has occurred based on the trial strain
 void XC::Steel01::detectLoadReversal(double dStrain)
   {
+    const steel_parameters &p= getParameters();
     // Determine initial loading condition
     if(Tloading == 0 && dStrain != 0.0)
       {
@@ -208,7 +211,7 @@ void XC::Steel01::detectLoadReversal(double dStrain)
        Tloading = -1;
        if(Cstrain > TmaxStrain)
          TmaxStrain = Cstrain;
-       TshiftN= 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+       TshiftN= 1 + p.a1*pow((TmaxStrain-TminStrain)/(2.0*p.a2*epsy),0.8);
      }
 
    // Transition from unloading to loading, i.e. negative strain increment
@@ -218,7 +221,7 @@ void XC::Steel01::detectLoadReversal(double dStrain)
        Tloading = 1;
        if(Cstrain < TminStrain)
          TminStrain = Cstrain;
-       TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+       TshiftP = 1 + p.a3*pow((TmaxStrain-TminStrain)/(2.0*p.a4*epsy),0.8);
      }
   }
 
@@ -293,14 +296,15 @@ int XC::Steel01::recvSelf(const Communicator &comm)
 //! @brief Print stuff.
 void XC::Steel01::Print(std::ostream& s, int flag) const
   {
+    const steel_parameters &p= getParameters();
     s << "Steel01 tag: " << this->getTag() << std::endl;
-    s << "  fy: " << fy << " ";
-    s << "  E0: " << E0 << " ";
-    s << "  b:  " << b << " ";
-    s << "  a1: " << a1 << " ";
-    s << "  a2: " << a2 << " ";
-    s << "  a3: " << a3 << " ";
-    s << "  a4: " << a4 << " ";
+    s << "  fy: " << p.fy << " ";
+    s << "  E0: " << p.E0 << " ";
+    s << "  b:  " << p.b << " ";
+    s << "  a1: " << p.a1 << " ";
+    s << "  a2: " << p.a2 << " ";
+    s << "  a3: " << p.a3 << " ";
+    s << "  a4: " << p.a4 << " ";
   }
 
 // AddingSensitivity:BEGIN ///////////////////////////////////
@@ -318,7 +322,7 @@ int XC::Steel01::setParameter(const std::vector<std::string> &argv, Parameter &p
 int XC::Steel01::updateParameter(int parameterID, Information &info)
   {
     const int up= SteelBase::updateParameter(parameterID,info);
-    Ttangent = E0;          // Initial stiffness
+    Ttangent = getParameters().E0;          // Initial stiffness
     return up;
   }
 
@@ -335,6 +339,7 @@ int XC::Steel01::activateParameter(int passedParameterID)
 
 double XC::Steel01::getStressSensitivity(int gradNumber, bool conditional)
   {
+    const steel_parameters &p= getParameters();
     // Initialize return value
     double gradient = 0.0;
 
@@ -361,9 +366,9 @@ double XC::Steel01::getStressSensitivity(int gradNumber, bool conditional)
     // Compute min and max stress
     double Tstress;
     const double dStrain = Tstrain-Cstrain;
-    const double sigmaElastic = Cstress + E0*dStrain;
-    const double fyOneMinusB = fy * (1.0 - b);
-    const double Esh = b*E0;
+    const double sigmaElastic = Cstress + p.E0*dStrain;
+    const double fyOneMinusB = p.fy * (1.0 - p.b);
+    const double Esh = p.b*p.E0;
     const double c1 = Esh*Tstrain;
     const double c2 = TshiftN*fyOneMinusB;
     const double c3 = TshiftP*fyOneMinusB;
@@ -374,22 +379,22 @@ double XC::Steel01::getStressSensitivity(int gradNumber, bool conditional)
     if( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) )
       {
         Tstress = sigmaMax;
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
-                   + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+        gradient = E0Sensitivity*p.b*Tstrain
+                   + p.E0*bSensitivity*Tstrain
+                   + TshiftP*(fySensitivity*(1-p.b)-p.fy*bSensitivity);
       }
     else
       {
         Tstress = sigmaElastic;
         gradient = CstressSensitivity
                    + E0Sensitivity*(Tstrain-Cstrain)
-                   - E0*CstrainSensitivity;
+                   - p.E0*CstrainSensitivity;
       }
     if(sigmaMin > Tstress)
       {
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
-                   - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+        gradient = E0Sensitivity*p.b*Tstrain
+                   + p.E0*bSensitivity*Tstrain
+                   - TshiftN*(fySensitivity*(1-p.b)-p.fy*bSensitivity);
       }
     return gradient;
   }
@@ -407,6 +412,7 @@ double XC::Steel01::getInitialTangentSensitivity(int gradNumber)
 
 int XC::Steel01::commitSensitivity(double TstrainSensitivity, int gradNumber, int numGrads)
   {
+    const steel_parameters &p= getParameters();
     if(SHVs.isEmpty())
       SHVs= Matrix(2,numGrads);
 
@@ -436,9 +442,9 @@ int XC::Steel01::commitSensitivity(double TstrainSensitivity, int gradNumber, in
     // Compute min and max stress
     double Tstress;
     const double dStrain = Tstrain-Cstrain;
-    const double sigmaElastic = Cstress + E0*dStrain;
-    const double fyOneMinusB = fy * (1.0 - b);
-    const double Esh = b*E0;
+    const double sigmaElastic = Cstress + p.E0*dStrain;
+    const double fyOneMinusB = p.fy * (1.0 - p.b);
+    const double Esh = p.b*p.E0;
     const double c1 = Esh*Tstrain;
     const double c2 = TshiftN*fyOneMinusB;
     const double c3 = TshiftP*fyOneMinusB;
@@ -449,24 +455,24 @@ int XC::Steel01::commitSensitivity(double TstrainSensitivity, int gradNumber, in
     if( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) )
       {
         Tstress = sigmaMax;
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
-                   + E0*b*TstrainSensitivity
-                   + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+        gradient = E0Sensitivity*p.b*Tstrain
+                   + p.E0*bSensitivity*Tstrain
+                   + p.E0*p.b*TstrainSensitivity
+                   + TshiftP*(fySensitivity*(1-p.b)-p.fy*bSensitivity);
       }
     else
       {
         Tstress = sigmaElastic;
         gradient = CstressSensitivity
                    + E0Sensitivity*(Tstrain-Cstrain)
-                   + E0*(TstrainSensitivity-CstrainSensitivity);
+                   + p.E0*(TstrainSensitivity-CstrainSensitivity);
       }
     if(sigmaMin > Tstress)
       {
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
-                   + E0*b*TstrainSensitivity
-                   - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+        gradient = E0Sensitivity*p.b*Tstrain
+                   + p.E0*bSensitivity*Tstrain
+                   + p.E0*p.b*TstrainSensitivity
+                   - TshiftN*(fySensitivity*(1-p.b)-p.fy*bSensitivity);
       }
 
     // Commit history variables
@@ -72,10 +72,11 @@
 //! @brief Sets all history and state variables to initial values
 int XC::Steel02::setup_parameters(void)
   {
-    stvP.setup_parameters(this->E0, this->sigini);
-    stv.setup_parameters(this->E0, 0.0);
+    const steel_parameters &p= getParameters();
+    stvP.setup_parameters(p.E0, this->sigini);
+    stv.setup_parameters(p.E0, 0.0);
 
-    hstvP.setup_parameters(this->E0, this->fy);
+    hstvP.setup_parameters(p.E0, p.fy);
 
     return 0;
   }
@@ -151,8 +152,9 @@ void XC::Steel02::setParamsPy(const boost::python::list &params)
 //! @brief Sets initial strain.
 int XC::Steel02::setInitialStrain(const double &strain)
   {
+    const steel_parameters &p= getParameters();
     ezero= strain;
-    setInitialStress(sigini-ezero*E0);
+    setInitialStress(sigini-ezero*p.E0);
     return 0;
   }
 
@@ -160,8 +162,9 @@ int XC::Steel02::setInitialStrain(const double &strain)
 //! @param strainIncrement: value of the strain increment.
 int XC::Steel02::incrementInitialStrain(const double &strainIncrement)
   {
+    const steel_parameters &p= getParameters();
     ezero+= strainIncrement;
-    setInitialStress(sigini-strainIncrement*E0);
+    setInitialStress(sigini-strainIncrement*p.E0);
     return 0;
   }
 
@@ -181,13 +184,14 @@ XC::UniaxialMaterial *XC::Steel02::getCopy(void) const
 
 int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
   {
-    const double Esh= b*E0;
-    const double epsy= fy/E0;
+    const steel_parameters &p= getParameters();
+    const double Esh= p.b*p.E0;
+    const double epsy= p.fy/p.E0;
 
     // modified C-P. Lamarche 2006
     if(sigini != 0.0)
       {
-        const double epsini= sigini/E0;
+        const double epsini= sigini/p.E0;
         stv.eps= trialStrain+epsini;
       }
     else
@@ -204,7 +208,7 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
       {
         if(fabs(deps) < tol)
           {
-            stv.e= E0;
+            stv.e= p.E0;
             stv.sig= sigini; // modified C-P. Lamarche 2006
             hstv.kon= 3; // modified C-P. Lamarche 2006 flag to impose initial stress/strain
             return 0;
@@ -217,14 +221,14 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
               {
                 hstv.kon= 2;
                 hstv.epss0= hstv.epsmin;
-                hstv.sigs0= -fy;
+                hstv.sigs0= -p.fy;
                 hstv.epspl= hstv.epsmin;
               }
             else
               {
                 hstv.kon= 1;
                 hstv.epss0= hstv.epsmax;
-                hstv.sigs0= fy;
+                hstv.sigs0= p.fy;
                 hstv.epspl= hstv.epsmax;
               }
           }
@@ -233,18 +237,18 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
       {
         if(hstv.kon == 2 && deps<=0.0)
 	  {
-	    const double d1= (hstv.epsmax - hstv.epsmin) / (2.0*(a2 * epsy));
-	    const double shft= 1.0 + a1 * pow(d1, 0.8);
-	    hstv.epss0= (-fy * shft + Esh * epsy * shft - hstv.sigsr + E0 * hstv.epssr) / (E0 - Esh);
-	    hstv.sigs0= -fy * shft + Esh * (hstv.epss0 + epsy * shft);
+	    const double d1= (hstv.epsmax - hstv.epsmin) / (2.0*(p.a2 * epsy));
+	    const double shft= 1.0 + p.a1 * pow(d1, 0.8);
+	    hstv.epss0= (-p.fy * shft + Esh * epsy * shft - hstv.sigsr + p.E0 * hstv.epssr) / (p.E0 - Esh);
+	    hstv.sigs0= -p.fy * shft + Esh * (hstv.epss0 + epsy * shft);
 	    hstv.epspl= hstv.epsmin;
 	  }
 	else if(hstv.kon == 1 && deps>=0.0)
 	  {
-	    const double d1= (hstv.epsmax - hstv.epsmin) / (2.0*(a4 * epsy));
-	    const double shft= 1.0 + a3 * pow(d1, 0.8);
-	    hstv.epss0= (fy * shft - Esh * epsy * shft - hstv.sigsr + E0 * hstv.epssr) / (E0 - Esh);
-	    hstv.sigs0= fy * shft + Esh * (hstv.epss0 - epsy * shft);
+	    const double d1= (hstv.epsmax - hstv.epsmin) / (2.0*(p.a4 * epsy));
+	    const double shft= 1.0 + p.a3 * pow(d1, 0.8);
+	    hstv.epss0= (p.fy * shft - Esh * epsy * shft - hstv.sigsr + p.E0 * hstv.epssr) / (p.E0 - Esh);
+	    hstv.sigs0= p.fy * shft + Esh * (hstv.epss0 - epsy * shft);
 	    hstv.epspl= hstv.epsmax;
 	  }
       }
@@ -265,10 +269,10 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
         //hstv.epsmin= min(stvP.eps, hstv.epsmin);
         if(stvP.eps < hstv.epsmin)
           hstv.epsmin= stvP.eps;
-        const double d1= (hstv.epsmax - hstv.epsmin) / (2.0*(a4 * epsy));
-        const double shft= 1.0 + a3 * pow(d1, 0.8);
-        hstv.epss0= (fy * shft - Esh * epsy * shft - hstv.sigsr + E0 * hstv.epssr) / (E0 - Esh);
-        hstv.sigs0= fy * shft + Esh * (hstv.epss0 - epsy * shft);
+        const double d1= (hstv.epsmax - hstv.epsmin) / (2.0*(p.a4 * epsy));
+        const double shft= 1.0 + p.a3 * pow(d1, 0.8);
+        hstv.epss0= (p.fy * shft - Esh * epsy * shft - hstv.sigsr + p.E0 * hstv.epssr) / (p.E0 - Esh);
+        hstv.sigs0= p.fy * shft + Esh * (hstv.epss0 - epsy * shft);
         hstv.epspl= hstv.epsmax;
       }
     else if (hstv.kon == 1 && deps < 0.0)
@@ -288,10 +292,10 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
           if(stvP.eps > hstv.epsmax)
             hstv.epsmax= stvP.eps;
 
-          const double d1= (hstv.epsmax - hstv.epsmin) / (2.0*(a2 * epsy));
-          const double shft= 1.0 + a1 * pow(d1, 0.8);
-          hstv.epss0= (-fy * shft + Esh * epsy * shft - hstv.sigsr + E0 * hstv.epssr) / (E0 - Esh);
-          hstv.sigs0= -fy * shft + Esh * (hstv.epss0 + epsy * shft);
+          const double d1= (hstv.epsmax - hstv.epsmin) / (2.0*(p.a2 * epsy));
+          const double shft= 1.0 + p.a1 * pow(d1, 0.8);
+          hstv.epss0= (-p.fy * shft + Esh * epsy * shft - hstv.sigsr + p.E0 * hstv.epssr) / (p.E0 - Esh);
+          hstv.sigs0= -p.fy * shft + Esh * (hstv.epss0 + epsy * shft);
           hstv.epspl= hstv.epsmin;
       }
   
@@ -304,10 +308,10 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
     const double dum1= 1.0 + pow(fabs(epsrat),R);
     const double dum2= pow(dum1,(1.0/R));
 
-    stv.sig= b*epsrat +(1.0-b)*epsrat/dum2;
+    stv.sig= p.b*epsrat +(1.0-p.b)*epsrat/dum2;
     stv.sig= stv.sig*(hstv.sigs0-hstv.sigsr)+hstv.sigsr;
 
-    stv.e= b + (1.0-b)/(dum1*dum2);
+    stv.e= p.b + (1.0-p.b)/(dum1*dum2);
     const double factor= (hstv.sigs0-hstv.sigsr)/epsdif;
     if(!std::isnan(factor))
       stv.e*= factor;
@@ -164,15 +164,16 @@ double XC::Steel03::getR(double x_in)
 //! @brief Calculates the trial state variables based on the trial strain
 void XC::Steel03::determineTrialState (double dStrain)
   {
-      double fyOneMinusB = fy * (1.0 - b);
+      const steel_parameters &p= getParameters();
+      double fyOneMinusB = p.fy * (1.0 - p.b);
 
-      double Esh = b*E0;
-      double epsy = fy/E0;
+      double Esh = p.b*p.E0;
+      double epsy = p.fy/p.E0;
       
       double c1 = Esh*Tstrain;
       double c2 = TshiftN*fyOneMinusB;
       double c3 = TshiftP*fyOneMinusB;
-      double c = Cstress + E0*dStrain;
+      double c = Cstress + p.E0*dStrain;
       
       //
       // Determine if a load reversal has occurred due to the trial strain
@@ -185,19 +186,19 @@ void XC::Steel03::determineTrialState (double dStrain)
 	  if (dStrain > 0.0) {
 	    Tloading = 1;
             TbStrain = TmaxStrain;
-            TbStress = fy;
+            TbStress = p.fy;
             Tplastic = TmaxStrain;
           }
 	  else {
 	    Tloading = -1;
             TbStrain = TminStrain;
-            TbStress = -fy;
+            TbStress = -p.fy;
             Tplastic = TminStrain;
           }
 
           double intval = 1+pow(fabs(Tstrain/epsy),TcurR);
-          Tstress = c1+(1-b)*E0*Tstrain/pow(intval,1/TcurR);
-          Ttangent = Esh+E0*(1-b)/pow(intval,1+1/TcurR);
+          Tstress = c1+(1-p.b)*p.E0*Tstrain/pow(intval,1/TcurR);
+          Ttangent = Esh+p.E0*(1-p.b)/pow(intval,1+1/TcurR);
       }
           
       // Transition from loading to unloading, i.e. positive strain increment
@@ -207,11 +208,11 @@ void XC::Steel03::determineTrialState (double dStrain)
 	  if (Cstrain > TmaxStrain)
 	    TmaxStrain = Cstrain;
           Tplastic = TminStrain;
-	  TshiftN = 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+	  TshiftN = 1 + p.a1*pow((TmaxStrain-TminStrain)/(2.0*p.a2*epsy),0.8);
           TrStrain = Cstrain;
           TrStress = Cstress;
-          TbStrain = (c2+c)/E0/(b-1)+Tstrain/(1-b);
-          TbStress = 1/(b-1)*(b*c2+b*c-c1)-c2;
+          TbStrain = (c2+c)/p.E0/(p.b-1)+Tstrain/(1-p.b);
+          TbStress = 1/(p.b-1)*(p.b*c2+p.b*c-c1)-c2;
           TcurR = getR((TbStrain-TminStrain)/epsy);
       }
 
@@ -222,11 +223,11 @@ void XC::Steel03::determineTrialState (double dStrain)
 	  if (Cstrain < TminStrain)
 	    TminStrain = Cstrain;
           Tplastic = TmaxStrain;
-	  TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+	  TshiftP = 1 + p.a3*pow((TmaxStrain-TminStrain)/(2.0*p.a4*epsy),0.8);
           TrStrain = Cstrain;
           TrStress = Cstress;
-          TbStrain = (c3-c)/E0/(1-b)+Tstrain/(1-b);
-          TbStress = 1/(1-b)*(b*c3-b*c+c1)+c3;
+          TbStrain = (c3-c)/p.E0/(1-p.b)+Tstrain/(1-p.b);
+          TbStress = 1/(1-p.b)*(p.b*c3-p.b*c+c1)+c3;
           TcurR = getR((TmaxStrain-TbStrain)/epsy);
       }
       
@@ -237,8 +238,8 @@ void XC::Steel03::determineTrialState (double dStrain)
           double c4c5 = c5/c4;
           double intval = 1+pow(fabs(c6/c4),TcurR);
           
-          Tstress = TrStress+b*c4c5*c6+(1-b)*c4c5*c6/pow(intval,1/TcurR);
-          Ttangent = c4c5*b+c4c5*(1-b)/pow(intval,1+1/TcurR);
+          Tstress = TrStress+p.b*c4c5*c6+(1-p.b)*c4c5*c6/pow(intval,1/TcurR);
+          Ttangent = c4c5*p.b+c4c5*(1-p.b)/pow(intval,1+1/TcurR);
       }
 }
 
@@ -330,14 +331,15 @@ int XC::Steel03::recvSelf(const Communicator &comm)
 //! @brief Print stuff.
 void XC::Steel03::Print(std::ostream& s, int flag) const
   {
+    const steel_parameters &p= getParameters();
     s << "Steel03 tag: " << this->getTag() << std::endl;
-    s << " fy: " << fy << " ";
-    s << "  E0: " << E0 << " ";
-    s << "  b: " << b << " ";
+    s << " fy: " << p.fy << " ";
+    s << "  E0: " << p.E0 << " ";
+    s << "  b: " << p.b << " ";
     s << "  r:  " << r << " cR1: " << cR1 << " cR2: " << cR2 << std::endl;
-    s << "  a1: " << a1 << " ";
-    s << "  a2: " << a2 << " ";
-    s << "  a3: " << a3 << " ";
-    s << "  a4: " << a4 << " ";
+    s << "  a1: " << p.a1 << " ";
+    s << "  a2: " << p.a2 << " ";
+    s << "  a3: " << p.a3 << " ";
+    s << "  a4: " << p.a4 << " ";
   }
 
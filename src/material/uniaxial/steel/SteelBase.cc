@@ -34,15 +34,30 @@
 
 //! @brief Constructor.
 XC::SteelBase::SteelBase(int tag,int classTag,const double &Fy,const double &e0,const double &B,const double &A1,const double &A2,const double &A3,const double &A4, const double &initialStrain)
-  : UniaxialMaterial(tag,classTag), fy(Fy),E0(e0), b(B),
-    a1(A1),a2(A2),a3(A3),a4(A4),
+  : UniaxialMaterial(tag,classTag),
+    parameters(std::make_shared<steel_parameters>(Fy,e0,B,A1,A2,A3,A4)),
     ezero(initialStrain) {}
 
 XC::SteelBase::SteelBase(int tag,int classTag)
-  :UniaxialMaterial(tag,classTag), fy(0.0),E0(0.0),b(0.0),
-   a1(0.0), a2(0.0), a3(0.0), a4(0.0),
+  :UniaxialMaterial(tag,classTag),
+   parameters(std::make_shared<steel_parameters>()),
    ezero(0.0) {}
 
+//! @brief Return the material properties to modify them.
+//!
+//! If the properties are shared with other copies of the material
+//! they are copied first, so the other copies are not affected.
+//! The number of owners returned by use_count is not reliable while
+//! other threads copy or destroy the material, so the properties must
+//! be modified only when no other thread is working with a copy of
+//! the same material (see the SteelBase class documentation).
+XC::steel_parameters &XC::SteelBase::getParametersToModify(void)
+  {
+    if(parameters.use_count()>1)
+      parameters= std::make_shared<steel_parameters>(*parameters);
+    return *parameters;
+  }
+
 //! @brief Sets initial strain.
 //! @param strain: strain value.
 int XC::SteelBase::setInitialStrain(const double &strain)
@@ -66,52 +81,52 @@ void XC::SteelBase::zeroInitialStrain(void)
 //! @brief Assigns initial Young's modulus.
 void XC::SteelBase::setInitialTangent(const double &d)
   {
-    E0= d;
+    getParametersToModify().E0= d;
     setup_parameters(); //Initialize history variables.
   }
 
 //! @brief Returns initial Young's modulus.
 double XC::SteelBase::getInitialTangent(void) const
-  { return E0; }
+  { return parameters->E0; }
 
 //! @brief Assigns yield stress.
 void XC::SteelBase::setFy(const double &d)
   {
-    fy= d;
+    getParametersToModify().fy= d;
     setup_parameters(); //Initialize history variables.
   }
 
 //! @brief Returns yield stress.
 double XC::SteelBase::getFy(void) const
-  { return fy; }
+  { return parameters->fy; }
 
 //! @brief Get first coefficient for isotropic hardening in compression (a1)
 double XC::SteelBase::getA1(void) const
-  { return a1; }
+  { return parameters->a1; }
 //! @brief Set first coefficient for isotropic hardening in compression (a1)
 void XC::SteelBase::setA1(const double &d)
-  { a1= d;}
+  { getParametersToModify().a1= d; }
 
 //! @brief Get second coefficient for isotropic hardening in compression (a2)
 double XC::SteelBase::getA2(void) const
-  { return a2; }
+  { return parameters->a2; }
 //! @brief Set second coefficient for isotropic hardening in compression (a2)
 void XC::SteelBase::setA2(const double &d)
-  { a2= d; }
+  { getParametersToModify().a2= d; }
 
 //! @brief Get first coefficient for isotropic hardening in tension (a3).
 double XC::SteelBase::getA3(void) const
-  { return a3; }
+  { return parameters->a3; }
 //! @brief Set first coefficient for isotropic hardening in tension (a3).
 void XC::SteelBase::setA3(const double &d)
-  { a3= d; }
+  { getParametersToModify().a3= d; }
 
 //! @brief Get second coefficient for isotropic hardening in tension (a4).
 double XC::SteelBase::getA4(void) const
-  { return a4; }
+  { return parameters->a4; }
 //! @brief Set second coefficient for isotropic hardening in tension (a4).
 void XC::SteelBase::setA4(const double &d)
-  { a4= d; }
+  { getParametersToModify().a4= d; }
 
 //! @brief Revert the material to its initial state.
 int XC::SteelBase::revertToStart(void)
@@ -124,8 +139,9 @@ int XC::SteelBase::revertToStart(void)
 int XC::SteelBase::sendData(Communicator &comm)
   {
     int res= UniaxialMaterial::sendData(comm);
-    res+= comm.sendDoubles(fy,E0,b,ezero,getDbTagData(),CommMetaData(2));
-    res+= comm.sendDoubles(a1,a2,a3,a4,getDbTagData(),CommMetaData(3));
+    const steel_parameters &p= getParameters();
+    res+= comm.sendDoubles(p.fy,p.E0,p.b,ezero,getDbTagData(),CommMetaData(2));
+    res+= comm.sendDoubles(p.a1,p.a2,p.a3,p.a4,getDbTagData(),CommMetaData(3));
     return res;
   }
 
@@ -133,8 +149,10 @@ int XC::SteelBase::sendData(Communicator &comm)
 int XC::SteelBase::recvData(const Communicator &comm)
   {
     int res= UniaxialMaterial::recvData(comm);
-    res+= comm.receiveDoubles(fy,E0,b,ezero,getDbTagData(),CommMetaData(2));
-    res+= comm.receiveDoubles(a1,a2,a3,a4,getDbTagData(),CommMetaData(3));
+    steel_parameters p;
+    res+= comm.receiveDoubles(p.fy,p.E0,p.b,ezero,getDbTagData(),CommMetaData(2));
+    res+= comm.receiveDoubles(p.a1,p.a2,p.a3,p.a4,getDbTagData(),CommMetaData(3));
+    parameters= std::make_shared<steel_parameters>(p);
     return res;
   }
 
@@ -143,39 +161,40 @@ int XC::SteelBase::setParameter(const std::vector<std::string> &argv, Parameter
   {
     const size_t argc= argv.size();
     if(argc < 1) return -1;
+    const steel_parameters &p= getParameters();
     if((argv[0]=="sigmaY") || (argv[0]=="fy") || (argv[0]=="Fy"))
       {
-        param.setValue(fy);
+        param.setValue(p.fy);
         return param.addObject(1, this);
       }
     if(argv[0]=="E")
       {
-        param.setValue(E0);
+        param.setValue(p.E0);
         return param.addObject(2, this);
       }
     if(argv[0]=="b")
       {
-        param.setValue(b);
+        param.setValue(p.b);
         return param.addObject(3, this);
       }
     if(argv[0]=="a1")
       {
-        param.setValue(a1);
+        param.setValue(p.a1);
         return param.addObject(4, this);
       }
     if(argv[0]=="a2")
       {
-        param.setValue(a2);
+        param.setValue(p.a2);
         return param.addObject(5, this);
       }
     if(argv[0]=="a3")
       {
-        param.setValue(a3);
+        param.setValue(p.a3);
         return param.addObject(6, this);
       }
     if(argv[0]=="a4")
       {
-        param.setValue(a4);
+        param.setValue(p.a4);
         return param.addObject(7, this);
       }
     return -1;
@@ -188,25 +207,25 @@ int XC::SteelBase::updateParameter(int parameterID, Information &info)
       case -1:
         return -1;
       case 1:
-        this->fy= info.theDouble;
+        getParametersToModify().fy= info.theDouble;
         break;
       case 2:
-        this->E0 = info.theDouble;
+        getParametersToModify().E0 = info.theDouble;
         break;
       case 3:
-        this->b = info.theDouble;
+        getParametersToModify().b = info.theDouble;
         break;
       case 4:
-        this->a1 = info.theDouble;
+        getParametersToModify().a1 = info.theDouble;
         break;
       case 5:
-        this->a2 = info.theDouble;
+        getParametersToModify().a2 = info.theDouble;
         break;
       case 6:
-        this->a3 = info.theDouble;
+        getParametersToModify().a3 = info.theDouble;
         break;
       case 7:
-        this->a4 = info.theDouble;
+        getParametersToModify().a4 = info.theDouble;
         break;
       default:
         return -1;
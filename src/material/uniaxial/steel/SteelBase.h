@@ -30,24 +30,39 @@
 #define SteelBase_h
 
 #include <material/uniaxial/UniaxialMaterial.h>
+#include "material/uniaxial/steel/steel_parameters.h"
+#include <memory>
 
 namespace XC {
 //! @ingroup MatUnx
 //
 //! @brief Base class for steel uniaxial materials.
+//!
+//! The material properties are stored in a steel_parameters object
+//! shared by the copies of the material (the material defined in the
+//! material handler and those of the fibers or integration points that
+//! use it). Each copy stores only its state variables. The properties
+//! are copied before being modified (copy on write), so changing them
+//! in one of the copies doesn't affect the others.
+//!
+//! The sharing is not thread-safe: the copies can be created, used
+//! (their state variables changed) and destroyed from different threads
+//! but the properties of a material can't be modified while other
+//! threads work with copies of it. The per-thread section copies of
+//! FiberSectionBatchSolver are created before the parallel region and
+//! only their state changes inside it.
 class SteelBase: public UniaxialMaterial
   {
+  private:
+    std::shared_ptr<steel_parameters> parameters; //!< Material properties.
   protected:
-    /*** Material Properties ***/
-    double fy;  //!< Yield stress
-    double E0;  //!< Initial stiffness
-    double b;   //!< Hardening ratio (b = Esh/E0)
-    double a1;  //!< increase of compression yield envelope as proportion of yield strength after a plastic strain of a2∗(Fy/E0) (optional)
-    double a2;  //!< coefficient for isotropic hardening in compression (see a1).
-    double a3;  //!< isotropic hardening parameter, increase of tension yield envelope as proportion of yield strength after a plastic strain of a4∗(Fy/E0). (optional)
-    double a4;  //!< coefficient for isotropic hardening in tension (see a3)
     double ezero; //!< Initial strain.
 
+    //! @brief Return the material properties.
+    inline const steel_parameters &getParameters(void) const
+      { return *parameters; }
+    steel_parameters &getParametersToModify(void);
+
     int sendData(Communicator &);
     int recvData(const Communicator &);
 
@@ -76,13 +91,13 @@ class SteelBase: public UniaxialMaterial
     void setA4(const double &);
 
     inline void setHardeningRatio(const double &d)
-      { b= d; }
+      { getParametersToModify().b= d; }
     inline double getHardeningRatio(void) const
-      { return b; }
+      { return parameters->b; }
     inline double getEsh(void) const
-      { return b*E0; }
+      { return parameters->b*parameters->E0; }
     inline double getEpsy(void) const
-      { return fy/E0; }
+      { return parameters->fy/parameters->E0; }
     
     int revertToStart(void);
     
@@ -38,6 +38,7 @@
 //! @brief Sets all history and state variables to initial values
 int XC::SteelBase0103::setup_parameters(void)
   {
+    const steel_parameters &p= getParameters();
     // History variables
     CminStrain= 0.0;
     CmaxStrain= 0.0;
@@ -54,11 +55,11 @@ int XC::SteelBase0103::setup_parameters(void)
     // State variables
     Cstrain= 0.0;
     Cstress= 0.0;
-    Ctangent= E0;
+    Ctangent= p.E0;
 
     Tstrain= 0.0;
     Tstress= 0.0;
-    Ttangent= E0;
+    Ttangent= p.E0;
     return 0;
   }
 
@@ -197,12 +198,13 @@ int XC::SteelBase0103::recvData(const Communicator &comm)
 //! @brief Print stuff.
 void XC::SteelBase0103::Print(std::ostream& s, int flag) const
   {
+    const steel_parameters &p= getParameters();
     s << "SteelBase0103 tag: " << this->getTag() << std::endl;
-    s << "  fy: " << fy << " ";
-    s << "  E0: " << E0 << " ";
-    s << "  b:  " << b << " ";
-    s << "  a1: " << a1 << " ";
-    s << "  a2: " << a2 << " ";
-    s << "  a3: " << a3 << " ";
-    s << "  a4: " << a4 << " ";
+    s << "  fy: " << p.fy << " ";
+    s << "  E0: " << p.E0 << " ";
+    s << "  b:  " << p.b << " ";
+    s << "  a1: " << p.a1 << " ";
+    s << "  a2: " << p.a2 << " ";
+    s << "  a3: " << p.a3 << " ";
+    s << "  a4: " << p.a4 << " ";
   }
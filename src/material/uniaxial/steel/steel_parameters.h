@@ -0,0 +1,58 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+
+#ifndef steel_parameters_h
+#define steel_parameters_h
+
+namespace XC {
+
+//! @brief Material properties of the steel uniaxial materials.
+//!
+//! They don't change during the analysis, so the copies of a material
+//! (one for each fiber or integration point) share the same object
+//! (see SteelBase).
+struct steel_parameters
+  {
+    double fy;  //!< Yield stress
+    double E0;  //!< Initial stiffness
+    double b;   //!< Hardening ratio (b = Esh/E0)
+    double a1;  //!< increase of compression yield envelope as proportion of yield strength after a plastic strain of a2∗(Fy/E0) (optional)
+    double a2;  //!< coefficient for isotropic hardening in compression (see a1).
+    double a3;  //!< isotropic hardening parameter, increase of tension yield envelope as proportion of yield strength after a plastic strain of a4∗(Fy/E0). (optional)
+    double a4;  //!< coefficient for isotropic hardening in tension (see a3)
+
+    steel_parameters(const double &fy= 0.0, const double &E0= 0.0, const double &b= 0.0, const double &a1= 0.0, const double &a2= 0.0, const double &a3= 0.0, const double &a4= 0.0);
+  };
+
+inline steel_parameters::steel_parameters(const double &Fy, const double &e0, const double &B, const double &A1, const double &A2, const double &A3, const double &A4)
+  : fy(Fy), E0(e0), b(B), a1(A1), a2(A2), a3(A3), a4(A4)
+  {}
+
+} // end of XC namespace
+
+#endif
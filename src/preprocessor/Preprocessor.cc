@@ -85,6 +85,20 @@ void XC::Preprocessor::updateSets(Node *new_node)
       }
   }
 
+//! @brief Insert the pointers to the nodes in the "total" set and in the 
+//! sets that are currently opened.
+void XC::Preprocessor::updateSets(const std::vector<Node *> &new_nodes)
+  {
+    sets.get_set_total()->addNodes(new_nodes);
+    MapSet::map_sets &open_sets= sets.get_open_sets();
+    for(MapSet::map_sets::iterator i= open_sets.begin();i!= open_sets.end();i++)
+      {
+        Set *ptr_set= dynamic_cast<Set *>((*i).second);
+        assert(ptr_set);
+        ptr_set->addNodes(new_nodes);
+      }
+  }
+
 //! @brief Insert the pointer to the element in the "total" set and in the 
 //! sets that are currently opened.
 void XC::Preprocessor::updateSets(Element *new_elem)
@@ -99,6 +113,20 @@ void XC::Preprocessor::updateSets(Element *new_elem)
       }
   }
 
+//! @brief Insert the pointers to the elements in the "total" set and in the 
+//! sets that are currently opened.
+void XC::Preprocessor::updateSets(const std::vector<Element *> &new_elems)
+  {
+    sets.get_set_total()->addElements(new_elems);
+    MapSet::map_sets &open_sets= sets.get_open_sets();
+    for(MapSet::map_sets::iterator i= open_sets.begin();i!= open_sets.end();i++)
+      {
+        Set *ptr_set= dynamic_cast<Set *>((*i).second);
+        assert(ptr_set);
+        ptr_set->addElements(new_elems);
+      }
+  }
+
 //! @brief Removes the node from all the sets.
 void XC::Preprocessor::removeFromSets(Node *n)
   {
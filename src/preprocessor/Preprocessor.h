@@ -109,11 +109,13 @@ class Preprocessor: public CommandEntity, public MovableObject
     FE_Datastore *getDataBase(void);
 
     void updateSets(Node *);
+    void updateSets(const std::vector<Node *> &);
     void removeFromSets(Node *);
     void removeFromLoadPatterns(Node *);
     bool remove(Node *);
     bool removeNode(const int &);
     void updateSets(Element *);
+    void updateSets(const std::vector<Element *> &);
     void removeFromSets(Element *);
     void removeFromLoadPatterns(Element *);
     bool remove(Element *);
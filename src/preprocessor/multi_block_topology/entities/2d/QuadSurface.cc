@@ -311,9 +311,26 @@ void XC::QuadSurface::create_nodes(void)
 
         //Populate the interior nodes.
         Pos3dArray node_pos= get_positions(); //Node positions.
+	std::vector<Pos3d> interior_positions;
+	if(n_rows>2 && n_cols>2)
+	  interior_positions.reserve((n_rows-2)*(n_cols-2));
         for(size_t j= 2;j<n_rows;j++) //interior rows.
           for(size_t k= 2;k<n_cols;k++) //interior columns.
-            create_node(node_pos(j,k),1,j,k);
+            interior_positions.push_back(node_pos(j,k));
+	const std::vector<Node *> interior_nodes= create_nodes_at(interior_positions);
+	if(interior_nodes.size()==interior_positions.size())
+	  {
+	    std::vector<Node *>::const_iterator iNode= interior_nodes.begin();
+	    for(size_t j= 2;j<n_rows;j++)
+	      for(size_t k= 2;k<n_cols;k++)
+		ttzNodes(1,j,k)= *(iNode++);
+	  }
+	else
+	  std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		    << "; surface: '" << getName() << "' "
+		    << interior_nodes.size() << " interior node(s) created for "
+		    << interior_positions.size() << " position(s)."
+		    << Color::def << std::endl;
       }
     else
       if(verbosity>2)
@@ -580,7 +580,11 @@ struct ijk_node_key_hash : public std::unary_function<ijk_node_key, std::size_t>
   {
     std::size_t operator()(const ijk_node_key& k) const
     {
-      return std::get<0>(k) ^ std::get<1>(k) ^ std::get<2>(k);
+      // (the xor of the indexes collides for all the permutations).
+      std::size_t retval= std::get<0>(k);
+      retval= retval*1000003 ^ std::get<1>(k);
+      retval= retval*1000003 ^ std::get<2>(k);
+      return retval;
     }
   };
 struct ijk_node_key_equal : public std::binary_function<ijk_node_key, ijk_node_key, bool>
@@ -593,6 +597,88 @@ struct ijk_node_key_equal : public std::binary_function<ijk_node_key, ijk_node_k
  
 typedef std::unordered_map<const ijk_node_key, Pos3d, ijk_node_key_hash, ijk_node_key_equal> map_pending_node_positions;
 
+//! @brief Positions of the block boundary still waiting for
+//! a node.
+//!
+//! The positions are also classified in cubic cells whose side is
+//! the matching tolerance, so the search for the positions that
+//! match a node only visits the 27 cells around it instead of
+//! the whole boundary of the block.
+class pending_node_positions: public map_pending_node_positions
+  {
+    typedef std::tuple<long, long, long> cell_key;
+    struct cell_key_hash
+      {
+	std::size_t operator()(const cell_key& k) const
+	  {
+	    std::size_t retval= std::get<0>(k);
+	    retval= retval*1000003 ^ std::get<1>(k);
+	    retval= retval*1000003 ^ std::get<2>(k);
+	    return retval;
+	  }
+      };
+    typedef std::unordered_map<cell_key, std::vector<ijk_node_key>, cell_key_hash> cell_map;
+    cell_map cells;
+    const double tol2; //!< squared matching distance.
+    const double cellSize;
+
+    cell_key get_cell(const Pos3d &p) const
+      {
+	return std::make_tuple(static_cast<long>(std::floor(p.x()/cellSize)),
+			       static_cast<long>(std::floor(p.y()/cellSize)),
+			       static_cast<long>(std::floor(p.z()/cellSize)));
+      }
+  public:
+    pending_node_positions(const double &tol)
+      : map_pending_node_positions(), tol2(tol*tol), cellSize(tol) {}
+    
+    //! @brief Insert the position for the (i,j,k) node.
+    void insert(const ijk_node_key &key, const Pos3d &pos)
+      {
+	std::pair<iterator, bool> result= map_pending_node_positions::insert(std::make_pair(key, pos));
+	if(result.second) // new position.
+	  cells[get_cell(pos)].push_back(key);
+      }
+    //! @brief Return the keys of the positions that match the given one.
+    std::list<ijk_node_key> find_matches(const Pos3d &pos) const
+      {
+	std::list<ijk_node_key> retval;
+	const cell_key c= get_cell(pos);
+	for(long i= std::get<0>(c)-1; i<=std::get<0>(c)+1; i++)
+	  for(long j= std::get<1>(c)-1; j<=std::get<1>(c)+1; j++)
+	    for(long k= std::get<2>(c)-1; k<=std::get<2>(c)+1; k++)
+	      {
+		cell_map::const_iterator ic= cells.find(std::make_tuple(i,j,k));
+		if(ic!=cells.end())
+		  {
+		    const std::vector<ijk_node_key> &keys= ic->second;
+		    for(std::vector<ijk_node_key>::const_iterator ik= keys.begin(); ik!= keys.end(); ik++)
+		      {
+			const_iterator ip= map_pending_node_positions::find(*ik);
+			if(ip!=end() && (dist2(pos,ip->second)<tol2))
+			  retval.push_back(*ik);
+		      }
+		  }
+	      }
+	return retval;
+      }
+    //! @brief Remove the position of the (i,j,k) node.
+    void erase(const ijk_node_key &key)
+      {
+	const_iterator ip= map_pending_node_positions::find(key);
+	if(ip!=end())
+	  {
+	    cell_map::iterator ic= cells.find(get_cell(ip->second));
+	    if(ic!=cells.end())
+	      {
+		std::vector<ijk_node_key> &keys= ic->second;
+		keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+	      }
+	    map_pending_node_positions::erase(ip);
+	  }
+      }
+  };
+
 //! @brief Create nodes for the block.
 void XC::Block::create_nodes(void)
   {
@@ -607,9 +693,9 @@ void XC::Block::create_nodes(void)
         const size_t n_cols= node_pos.getNumberOfColumns();
         ttzNodes= NodePtrArray3d(n_layers, n_rows, n_cols); //Pointers to node.
 
-	// Populate pending_node_positions with all the position in the faces
+	// Populate pending_positions with all the position in the faces
 	// of the block.
-	map_pending_node_positions pending_node_positions;
+	pending_node_positions pending_positions(1e-2);
 	const std::vector<size_t> layers({1, n_layers}); // First and last layer.
 	for(std::vector<size_t>::const_iterator il= layers.begin(); il!= layers.end(); il++)
 	  {
@@ -618,7 +704,7 @@ void XC::Block::create_nodes(void)
 		{
 		  const size_t i_layer= *il;
 		  const Pos3d &pos= node_pos(i_layer, i, j);
-		  pending_node_positions[std::make_tuple(i_layer, i, j)]= pos;
+		  pending_positions.insert(std::make_tuple(i_layer, i, j), pos);
 		}
 	  }
 	const std::vector<size_t> rows({1, n_rows}); // First and last row.
@@ -629,7 +715,7 @@ void XC::Block::create_nodes(void)
 		{
 		  const size_t i_row= *ir;
 		  const Pos3d &pos= node_pos(i, i_row, j);
-		  pending_node_positions[std::make_tuple(i, i_row, j)]= pos;
+		  pending_positions.insert(std::make_tuple(i, i_row, j), pos);
 		}
 	  }
 	const std::vector<size_t> columns({1, n_cols}); // First and last column.
@@ -640,7 +726,7 @@ void XC::Block::create_nodes(void)
 		{
 		  const size_t i_col= *ic;
 		  const Pos3d &pos= node_pos(i, j, i_col);
-		  pending_node_positions[std::make_tuple(i, j, i_col)]= pos;
+		  pending_positions.insert(std::make_tuple(i, j, i_col), pos);
 		}
 	  }
 	// Vertex nodes.
@@ -648,20 +734,11 @@ void XC::Block::create_nodes(void)
 	  {
 	    const Node *nPtr= getVertex(ivertex)->getNode();
 	    const Pos3d pos= nPtr->getInitialPosition3d();
-	    std::list<ijk_node_key> keys_to_remove;
-	    for(map_pending_node_positions::const_iterator j= pending_node_positions.begin(); j!= pending_node_positions.end(); j++)
+	    const std::list<ijk_node_key> keys_to_remove= pending_positions.find_matches(pos);
+	    for(std::list<ijk_node_key>::const_iterator j= keys_to_remove.begin(); j!= keys_to_remove.end(); j++)
 	      {
-		const Pos3d pB= (*j).second;
-		const double d2= dist2(pos,pB);
-		if(d2<1e-4) // found.
-		  {
-		    const ijk_node_key &key= (*j).first;
-		    const size_t ii= get<0>(key);
-		    const size_t jj= get<1>(key);
-		    const size_t kk= get<2>(key);
-		    ttzNodes(ii, jj, kk)= const_cast<Node *>(nPtr);
-		    keys_to_remove.push_back(key);
-		  }
+		const ijk_node_key &key= *j;
+		ttzNodes(std::get<0>(key), std::get<1>(key), std::get<2>(key))= const_cast<Node *>(nPtr);
 	      }
 	    const size_t num_keys_to_remove= keys_to_remove.size();
 	    if(num_keys_to_remove==0)
@@ -672,7 +749,7 @@ void XC::Block::create_nodes(void)
 			  << Color::def << std::endl;
 	      }
 	    for(std::list<ijk_node_key>::const_iterator k= keys_to_remove.begin(); k!= keys_to_remove.end();k++)
-	      { pending_node_positions.erase(*k); }	    
+	      { pending_positions.erase(*k); }	    
    	  }
 	// Face nodes.
 	for(size_t iface= 0; iface<6; iface++)
@@ -685,31 +762,22 @@ void XC::Block::create_nodes(void)
 	      {
 		const Node *n= *i;
 		const Pos3d pos= n->getInitialPosition3d();
-		std::list<ijk_node_key> keys_to_remove;
-		for(map_pending_node_positions::const_iterator j= pending_node_positions.begin(); j!= pending_node_positions.end(); j++)
+		const std::list<ijk_node_key> keys_to_remove= pending_positions.find_matches(pos);
+		for(std::list<ijk_node_key>::const_iterator j= keys_to_remove.begin(); j!= keys_to_remove.end(); j++)
 		  {
-		    const Pos3d pB= (*j).second;
-		    const double d2= dist2(pos,pB);
-		    if(d2<1e-4) // found.
-		      {
-			const ijk_node_key &key= (*j).first;
-			const size_t ii= get<0>(key);
-			const size_t jj= get<1>(key);
-			const size_t kk= get<2>(key);
-			ttzNodes(ii, jj, kk)= const_cast<Node *>(n);
-		        keys_to_remove.push_back(key);
-		      }
+		    const ijk_node_key &key= *j;
+		    ttzNodes(std::get<0>(key), std::get<1>(key), std::get<2>(key))= const_cast<Node *>(n);
 		  }
 		for(std::list<ijk_node_key>::const_iterator k= keys_to_remove.begin(); k!= keys_to_remove.end();k++)
-		  { pending_node_positions.erase(*k); }
+		  { pending_positions.erase(*k); }
 	      }
 	  }
-	const size_t num_pending_nodes= pending_node_positions.size();
+	const size_t num_pending_nodes= pending_positions.size();
 	if(num_pending_nodes!=0)
 	  {
 	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
 		      << "; some face nodes where not detected: " << std::endl;
-	    for(map_pending_node_positions::const_iterator j= pending_node_positions.begin(); j!= pending_node_positions.end(); j++)
+	    for(map_pending_node_positions::const_iterator j= pending_positions.begin(); j!= pending_positions.end(); j++)
 	      {
 		const Pos3d pos= (*j).second;
 		const ijk_node_key &key= (*j).first;
@@ -722,11 +790,29 @@ void XC::Block::create_nodes(void)
 	    std::cerr << Color::def << std::endl;
 	  }
 	
-        // Interior nodes. 
+        // Interior nodes (created in a single batch).
+	std::vector<Pos3d> interior_positions;
+	if(n_layers>2 && n_rows>2 && n_cols>2)
+	  interior_positions.reserve((n_layers-2)*(n_rows-2)*(n_cols-2));
         for(size_t i= 2;i<n_layers;i++) //interior layers.
           for(size_t j= 2;j<n_rows;j++) //interior rows.
             for(size_t k= 2;k<n_cols;k++) //interior columns.
-              create_node(node_pos(i,j,k),i,j,k);
+              interior_positions.push_back(node_pos(i,j,k));
+	const std::vector<Node *> interior_nodes= create_nodes_at(interior_positions);
+	if(interior_nodes.size()==interior_positions.size())
+	  {
+	    std::vector<Node *>::const_iterator iNode= interior_nodes.begin();
+	    for(size_t i= 2;i<n_layers;i++)
+	      for(size_t j= 2;j<n_rows;j++)
+		for(size_t k= 2;k<n_cols;k++)
+		  ttzNodes(i,j,k)= *(iNode++);
+	  }
+	else
+	  std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		    << "; block: '" << getName() << "' "
+		    << interior_nodes.size() << " interior node(s) created for "
+		    << interior_positions.size() << " position(s)."
+		    << Color::def << std::endl;
 	
 	for(size_t i= 1; i<=n_layers; i++)
 	  for(size_t j= 1; j<=n_rows; j++)
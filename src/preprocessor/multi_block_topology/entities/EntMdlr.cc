@@ -375,6 +375,21 @@ XC::Node *XC::EntMdlr::create_node(const Pos3d &pos,size_t i,size_t j, size_t k)
     return retval;
   }
   
+//! @brief Creates the nodes at the positions being passed as parameter
+//! in a single batch (see NodeHandler::newNodes).
+//! @return the created nodes (in the same order as the positions).
+std::vector<XC::Node *> XC::EntMdlr::create_nodes_at(const std::vector<Pos3d> &positions)
+  {
+    std::vector<Node *> retval;
+    if(getPreprocessor())
+      retval= getPreprocessor()->getNodeHandler().newNodes(positions);
+    else
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; preprocessor undefined."
+		<< Color::def << std::endl;
+    return retval;
+  }
+
 //! @brief Creates nodes at the positions being passed as parameters.
 void XC::EntMdlr::create_nodes(const Pos3dArray3d &positions)
   {
@@ -389,10 +404,27 @@ void XC::EntMdlr::create_nodes(const Pos3dArray3d &positions)
 
 	    if(getPreprocessor())
 	      {
+		std::vector<Pos3d> tmp;
+		tmp.reserve(n_layers*n_rows*n_cols);
 		for( size_t i= 1;i<=n_layers;i++)
 		  for( size_t j= 1;j<=n_rows;j++)
 		    for( size_t k= 1;k<=n_cols;k++)
-		      create_node(positions(i,j,k),i,j,k);
+		      tmp.push_back(positions(i,j,k));
+		const std::vector<Node *> nodes= create_nodes_at(tmp);
+		if(nodes.size()==tmp.size())
+		  {
+		    std::vector<Node *>::const_iterator iNode= nodes.begin();
+		    for( size_t i= 1;i<=n_layers;i++)
+		      for( size_t j= 1;j<=n_rows;j++)
+			for( size_t k= 1;k<=n_cols;k++)
+			  ttzNodes(i,j,k)= *(iNode++);
+		  }
+		else
+		  std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+			    << "; entity: '" << getName() << "' "
+			    << nodes.size() << " node(s) created for "
+			    << tmp.size() << " position(s)."
+			    << Color::def << std::endl;
 		if(verbosity>5)
 		  std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
 			    << "; created " << ttzNodes.NumPtrs() << " node(s)."
@@ -65,6 +65,7 @@ class EntMdlr: public SetEstruct
     friend class MultiBlockTopology;
     virtual void update_topology(void)= 0;
     void create_nodes(const Pos3dArray3d &);
+    std::vector<Node *> create_nodes_at(const std::vector<Pos3d> &);
     Node *create_node(const Pos3d &pos,size_t i=1,size_t j=1, size_t k=1);
     const Node *set_node(size_t i,size_t j, size_t k, Node *);
     bool create_elements(meshing_dir dm);
@@ -40,6 +40,7 @@
 #include "domain/constraints/single_retained_node_constraints/RigidBeam.h"
 #include "domain/constraints/single_retained_node_constraints/RigidRod.h"
 #include "domain/constraints/single_retained_node_constraints/RigidDiaphragm.h"
+#include "domain/constraints/single_retained_node_constraints/MFreedom_Joint2D.h"
 #include "domain/constraints/multiple_retained_node_constraints/GlueNodeToElement.h"
 #include "utility/geom/d1/Line2d.h"
 #include "utility/geom/d2/Plane.h"
@@ -255,6 +256,33 @@ XC::MFreedom_Constraint *XC::BoundaryCondHandler::newRigidRod(const int &retaine
     return mp;
   }
 
+//! @brief Creates a rigid link between the center of a joint and one of
+//! its sides (see MFreedom_Joint2D).
+//! @param retainedNode: tag of the node at the center of the joint (four DOFs).
+//! @param constrainedNode: tag of the node at the side of the joint (three DOFs).
+//! @param mainDOF: DOF of the retained node that rotates the link (2 or 3).
+//! @param fixedEnd: 1 if the rotation of the constrained node is constrained too, 0 otherwise.
+//! @param largeDisp: 0 for a constant constraint matrix, 1 for a matrix updated with the committed displacements, 2 for large displacements with length correction.
+XC::MFreedom_Constraint *XC::BoundaryCondHandler::newJoint2D(const int &retainedNode, const int &constrainedNode, const int &mainDOF, const int &fixedEnd, const int &largeDisp)
+  {
+    MFreedom_Joint2D *mp= nullptr;
+    if(getDomain()->getNode(retainedNode) && getDomain()->getNode(constrainedNode))
+      {
+        mp= new MFreedom_Joint2D(getDomain(),tag_mp_constraint,retainedNode,constrainedNode,mainDOF,fixedEnd,largeDisp);
+        tag_mp_constraint++;
+      }
+    if(mp)
+      {
+        getDomain()->addMFreedom_Constraint(mp);
+        getPreprocessor()->updateSets(mp);
+      }
+    else
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+	        << "; could not create constraint."
+		<< Color::def << std::endl;
+    return mp;
+  }
+
 //! @grief Appends a multi-row, multi-freedom constraint to the model.
 XC::MRMFreedom_Constraint *XC::BoundaryCondHandler::newMRMPConstraint(const ID &retainedNodes, const int &constrainedNode, const ID &constrainedDOF)
   {
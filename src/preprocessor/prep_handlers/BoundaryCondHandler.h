@@ -81,6 +81,7 @@ class BoundaryCondHandler: public PrepHandler
     MFreedom_Constraint *newEqualDOF(const int &, const int &, const ID &);
     MFreedom_Constraint *newRigidBeam(const int &, const int &);
     MFreedom_Constraint *newRigidRod(const int &, const int &);
+    MFreedom_Constraint *newJoint2D(const int &, const int &, const int &, const int &, const int &);
     //MFreedom_Constraint *newRigidDiaphragm(void);
     MRMFreedom_Constraint *newMRMPConstraint(const ID &, const int &, const ID &);
     MRMFreedom_Constraint *newGlueNodeToElement(const Node &, const Element &, const ID &);
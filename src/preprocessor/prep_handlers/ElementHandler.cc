@@ -305,6 +305,33 @@ void XC::ElementHandler::Add(Element *e)
 		<< Color::def << std::endl;
   }
 
+//! @brief Adds the elements setting their identifiers (tags) and
+//! inserts them in the domain and in the sets in a single batch.
+void XC::ElementHandler::Add(const std::vector<Element *> &elements)
+  {
+    std::vector<Element *> tmp;
+    tmp.reserve(elements.size());
+    for(std::vector<Element *>::const_iterator i= elements.begin(); i!= elements.end(); i++)
+      {
+        Element *e= *i;
+	if(e)
+	  {
+	    e->setTag(Element::getDefaultTag().getTag());
+	    Element::getDefaultTag()++;
+	    tmp.push_back(e);
+	  }
+	else
+	  std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		    << "; null pointer to element."
+		    << Color::def << std::endl;
+      }
+    if(!tmp.empty())
+      {
+	getDomain()->addElements(tmp);
+	getPreprocessor()->updateSets(tmp);
+      }
+  }
+
 //! @brief Adds a new element to the model.
 void XC::ElementHandler::new_element(Element *e)
   {
@@ -83,6 +83,7 @@ class ElementHandler: public ProtoElementHandler
       { return seed_elem_handler.getSeedElement(); }
 
     virtual void Add(Element *);
+    void Add(const std::vector<Element *> &);
 
     int getDefaultTag(void) const;
     void setDefaultTag(const int &tag);
@@ -249,6 +249,34 @@ XC::Node *XC::NodeHandler::newNode(const Vector &coo)
     return retval;
   }
 
+//! @brief Create nodes at the positions passed as parameter.
+//!
+//! The nodes receive consecutive tags (in the order of the
+//! positions) and they are added to the domain and to the
+//! sets in a single batch.
+std::vector<XC::Node *> XC::NodeHandler::newNodes(const std::vector<Pos3d> &positions)
+  {
+    std::vector<Node *> retval;
+    const size_t sz= positions.size();
+    if(sz>0)
+      {
+	int tg= getDefaultTag(); //Before seed node creation.
+	if(!seed_node)
+	  newSeedNode();
+	const size_t dim= seed_node->getDim();
+	const int ndof= seed_node->getNumberDOF();
+	retval.reserve(sz);
+	for(std::vector<Pos3d>::const_iterator i= positions.begin(); i!= positions.end(); i++, tg++)
+	  {
+	    const Pos3d &p= *i;
+	    retval.push_back(new_node(tg,dim,ndof,p.x(),p.y(),p.z()));
+	  }
+	getDomain()->addNodes(retval);
+	getPreprocessor()->updateSets(retval);
+      }
+    return retval;
+  }
+
 size_t XC::NodeHandler::getSpaceDim(void) const
   {
     size_t retval= 2; // default value.
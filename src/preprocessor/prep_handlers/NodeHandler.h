@@ -58,6 +58,7 @@ class NodeHandler: public PrepHandler
     Node *newNode(const Pos3d &p);
     Node *newNode(const Pos2d &p);
     Node *newNode(const Vector &);
+    std::vector<Node *> newNodes(const std::vector<Pos3d> &);
     Node *newSeedNode(const size_t &dim= 2, const size_t ndof= 3);
     Node *newNodeIDXYZ(const int &,const double &,const double &,const double &);
     Node *newNodeIDXY(const int &,const double &,const double &);
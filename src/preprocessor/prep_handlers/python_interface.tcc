@@ -144,6 +144,7 @@ class_<XC::BoundaryCondHandler, bases<XC::PrepHandler>, boost::noncopyable >("Bo
   .def("newEqualDOF", &XC::BoundaryCondHandler::newEqualDOF,return_internal_reference<>(),"Imposes the same displacements on two nodes for the given components.")
   .def("newRigidBeam", &XC::BoundaryCondHandler::newRigidBeam,return_internal_reference<>())
   .def("newRigidRod", &XC::BoundaryCondHandler::newRigidRod,return_internal_reference<>())
+  .def("newJoint2D", &XC::BoundaryCondHandler::newJoint2D,return_internal_reference<>(),"newJoint2D(retainedNode, constrainedNode, mainDOF, fixedEnd, largeDisp): creates a rigid link between the center of a joint (node with four DOFs) and one of its sides; largeDisp: 0 for small displacements, 1 for large displacements and 2 for large displacements with length correction.")
   .def("newMRMPConstraint", &XC::BoundaryCondHandler::newMRMPConstraint,return_internal_reference<>(),"Creates a new multi retained nodes constraint.")
   .def("newGlueNodeToElement", &XC::BoundaryCondHandler::newGlueNodeToElement,return_internal_reference<>(),"Glues a node to an element.")
    ;
@@ -35,6 +35,8 @@
 #include "utility/kernel/CommandEntity.h"
 #include <deque>
 #include <set>
+#include <vector>
+#include <unordered_set>
 #include "utility/actor/actor/MovableID.h"
 #include <boost/iterator/indirect_iterator.hpp>
 
@@ -76,6 +78,7 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     void extend(const DqPtrs &);
     //void extend_cond(const DqPtrs &,const std::string &cond);
     bool push_back(T *);
+    std::vector<T *> append(const std::vector<T *> &);
     bool push_front(T *);
     inline bool empty(void) const
       { return lst_ptr::empty(); }
@@ -261,6 +264,36 @@ bool DqPtrs<T>::push_back(T *t)
     return retval;
   }
 
+//! @brief Append the objects that are not already in the container.
+//!
+//! Checking each object with push_back is linear on the size
+//! of the container, so appending a whole mesh that way is
+//! quadratic; here the existing objects are hashed once.
+//! @return the objects actually appended.
+template <class T>
+std::vector<T *> DqPtrs<T>::append(const std::vector<T *> &ts)
+  {
+    std::vector<T *> retval;
+    retval.reserve(ts.size());
+    std::unordered_set<const T *> present(begin(),end());
+    for(typename std::vector<T *>::const_iterator i= ts.begin();i!=ts.end();i++)
+      {
+        T *t= *i;
+        if(t)
+          {
+            if(present.insert(t).second) //It's a new element.
+              {
+                lst_ptr::push_back(t);
+                retval.push_back(t);
+              }
+          }
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; attempt to insert a null pointer." << std::endl;
+      }
+    return retval;
+  }
+
 template <class T>
 bool DqPtrs<T>::push_front(T *t)
   {
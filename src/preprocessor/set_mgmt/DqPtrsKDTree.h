@@ -66,6 +66,7 @@ class DqPtrsKDTree: public DqPtrs<T>
     void extend(const DqPtrsKDTree &);
     //void extend_cond(const DqPtrsKDTree &,const std::string &cond);
     bool push_back(T *);
+    std::vector<T *> append(const std::vector<T *> &);
     bool push_front(T *);
     bool remove(T *);
     void clearAll(void);
@@ -150,6 +151,18 @@ bool XC::DqPtrsKDTree<T,KDTree>::push_back(T *t)
     return retval;
   }
 
+//! @brief Append the objects that are not already in the container
+//! and insert them in the tree in a single batch.
+//! @return the objects actually appended.
+template <class T,class KDTree>
+std::vector<T *> XC::DqPtrsKDTree<T,KDTree>::append(const std::vector<T *> &ts)
+  {
+    const std::vector<T *> retval= DqPtrs<T>::append(ts);
+    if(!retval.empty())
+      kdtree.insert(std::vector<const T *>(retval.begin(),retval.end()));
+    return retval;
+  }
+
 //! @brief Inserts an object at the beginning of the container.
 template <class T,class KDTree>
 bool XC::DqPtrsKDTree<T,KDTree>::push_front(T *t)
@@ -136,13 +136,15 @@ void XC::SetEstruct::add_elements_to_handler(const ElemPtrArray3d &elements)
       {
 	const size_t numberOfRows= elements(1).getNumberOfRows();
 	const size_t cols= elements(1).getNumberOfColumns();
-	ElementHandler &eHandler= getPreprocessor()->getElementHandler();
+	std::vector<Element *> tmp;
+	tmp.reserve(n_layers*numberOfRows*cols);
 	for( size_t i= 1;i<=n_layers;i++)
 	  for( size_t j= 1;j<=numberOfRows;j++)
 	    for( size_t k= 1;k<=cols;k++)
-	      {
-		eHandler.Add(elements(i,j,k));
-	      }
+	      tmp.push_back(elements(i,j,k));
+	// Add them in a single batch.
+	ElementHandler &eHandler= getPreprocessor()->getElementHandler();
+	eHandler.Add(tmp);
       }
   }
 
@@ -251,10 +251,18 @@ void XC::SetMeshComp::clearAll(void)
 void XC::SetMeshComp::addNode(Node *nPtr)
   { nodes.push_back(nPtr); }
 
+//! @brief Adds the pointers to node being passed as parameter.
+void XC::SetMeshComp::addNodes(const std::vector<Node *> &nPtrs)
+  { nodes.append(nPtrs); }
+
 //! @brief Adds the pointer to element being passed as parameter.
 void XC::SetMeshComp::addElement(Element *ePtr)
   { elements.push_back(ePtr); }
 
+//! @brief Adds the pointers to element being passed as parameter.
+void XC::SetMeshComp::addElements(const std::vector<Element *> &ePtrs)
+  { elements.append(ePtrs); }
+
 //! @brief Returns true if the node belongs to the set.
 bool XC::SetMeshComp::In(const Node *n) const
   { return nodes.in(n); }
@@ -125,6 +125,7 @@ class SetMeshComp: public SetBase
       { return nodes.size(); }
     //! @brief Appends a node.
     void addNode(Node *nPtr);
+    void addNodes(const std::vector<Node *> &);
     //! @brief Return the node container.
     virtual const DqPtrsNode &getNodes(void) const
       { return nodes; }
@@ -151,6 +152,7 @@ class SetMeshComp: public SetBase
       { return elements.size(); }
     //! @brief Adds an element.
     void addElement(Element *);
+    void addElements(const std::vector<Element *> &);
     //! @brief Returns the element container.
     virtual const DqPtrsElem &getElements(void) const
       { return elements; }
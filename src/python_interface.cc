@@ -39,6 +39,7 @@ void export_preprocessor_build_model(void);
 void export_preprocessor_sets(void);
 void export_preprocessor_main(void);
 void export_solution(void);
+void export_reliability(void);
 
 BOOST_PYTHON_MODULE(xc)
   {
@@ -79,6 +80,7 @@ BOOST_PYTHON_MODULE(xc)
     export_preprocessor_sets();
     export_preprocessor_main();
     export_solution(); // Solution routines exposition.
+    export_reliability(); // Reliability analysis exposition.
 
     XC::Domain *(XC::FEProblem::*getDomainRef)(void)= &XC::FEProblem::getDomain;
     XC::Preprocessor &(XC::FEProblem::*getPreprocessorRef)(void)= &XC::FEProblem::getPreprocessor;
@@ -91,6 +93,8 @@ BOOST_PYTHON_MODULE(xc)
       .add_property("getSoluProc", make_function( getSoluProcRef, return_internal_reference<>() ),"Return a reference to the solver")
       .add_property("getDatabase", make_function( &XC::FEProblem::getDataBase, return_internal_reference<>() ),"Return a reference to the data base")
       .def("newDatabase", make_function( &XC::FEProblem::defineDatabase, return_internal_reference<>() ),"Create a data base")
+      .def("newOutputHandler", make_function( &XC::FEProblem::newOutputHandler, return_internal_reference<>() ),"newOutputHandler(type, name, fileName): create an output handler for the recorders (types: file, binary_file).")
+      .def("getOutputHandler", make_function( &XC::FEProblem::getOutputHandler, return_internal_reference<>() ),"getOutputHandler(name): return the output handler with the given name.")
       .def("clearAll",&XC::FEProblem::clearAll,"Delete all entities in the FE problem.")
    ;
     def("getXCVersion",XC::getXCVersion);
@@ -65,6 +65,8 @@
 #include <reliability/domain/components/ReliabilityDomain.h>
 #include <reliability/domain/components/RandomVariablePositioner.h>
 #include "solution/analysis/integrator/IncrementalIntegrator.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/utils/misc_utils/colormod.h"
 
 
 XC::SensitivityAlgorithm::SensitivityAlgorithm(ReliabilityDomain *passedReliabilityDomain,
@@ -91,6 +93,41 @@ XC::SensitivityAlgorithm::SensitivityAlgorithm(ReliabilityDomain *passedReliabil
 }
 
 
+//! @brief Return true if the gradients are computed with respect
+//! to the random variables (false if they are computed with respect
+//! to the parameters).
+bool XC::SensitivityAlgorithm::wrtRandomVariables(void) const
+  { return (analysisTypeTag==1 || analysisTypeTag==3); }
+
+//! @brief Activate the positioners that contribute to the gradient
+//! whose number is passed as parameter (and deactivate the rest).
+void XC::SensitivityAlgorithm::activatePositioners(int gradNumber, int numPos)
+  {
+    if(wrtRandomVariables())
+      {
+	for(int posNumber=1; posNumber<=numPos; posNumber++ )
+	  {
+	    RandomVariablePositioner *theRandomVariablePositioner= theReliabilityDomain->getRandomVariablePositionerPtr(posNumber);
+	    // Set sensitivity flag so that only the positioners
+	    // of this random variable contribute to the RHS.
+	    const int rvNumber= theRandomVariablePositioner->getRvNumber();
+	    theRandomVariablePositioner->activate(rvNumber==gradNumber);
+	  }
+      }
+    else
+      {
+	for(int posNumber=1; posNumber<=numPos; posNumber++ )
+	  theReliabilityDomain->getParameterPositionerPtr(posNumber)->activate(true);
+      }
+  }
+
+//! @brief Compute the gradients of the response.
+//!
+//! The tangent is the same for all the gradients, so the right-hand
+//! sides of all of them are assembled first (as the columns of a
+//! matrix) and then solved together using a single factorization.
+//! Once the solutions are known, the sensitivities are saved and
+//! committed gradient by gradient.
 int XC::SensitivityAlgorithm::computeSensitivities(void)
   {
 	// Meaning of analysisTypeTag:
@@ -99,13 +136,6 @@ int XC::SensitivityAlgorithm::computeSensitivities(void)
 	// 3: compute by command wrt. random variables
 	// 4: compute by command wrt. parameters
 
-	
-	// Initial declarations
-	int numGrads, numPos, i, gradNumber, posNumber;
-	RandomVariablePositioner *theRandomVariablePositioner;
-	ParameterPositioner *theParameterPositioner;
-
-
 	// Get pointer to the system of equations (SOE)
 	LinearSOE *theSOE = theAlgorithm->getLinearSOEPtr();
 
@@ -125,14 +155,19 @@ int XC::SensitivityAlgorithm::computeSensitivities(void)
 
 
 	// Get number of random variables and random variable positioners
-	if (analysisTypeTag==1 || analysisTypeTag==3) {
-		numGrads = theReliabilityDomain->getNumberOfRandomVariables();
-		numPos = theReliabilityDomain->getNumberOfRandomVariablePositioners();
-	}
-	else {
-		numPos = theReliabilityDomain->getNumberOfParameterPositioners();
-		numGrads = numPos;
-	}
+	int numGrads= 0, numPos= 0;
+	if(wrtRandomVariables())
+	  {
+	    numGrads = theReliabilityDomain->getNumberOfRandomVariables();
+	    numPos = theReliabilityDomain->getNumberOfRandomVariablePositioners();
+	  }
+	else
+	  {
+	    numPos = theReliabilityDomain->getNumberOfParameterPositioners();
+	    numGrads = numPos;
+	  }
+	if(numGrads<1)
+	  return 0;
 	
 
 	// Zero out the old right-hand side of the SOE
@@ -143,68 +178,47 @@ int XC::SensitivityAlgorithm::computeSensitivities(void)
 	theSensitivityIntegrator->formIndependentSensitivityRHS();
 
 
-	// Loop where one gradient vector is computed per iteration
-	for (gradNumber=1; gradNumber<=numGrads; gradNumber++ )  {
-
-
-		// Clear sensitivity flags
-		for (i=1; i<=numPos; i++ ) {
-			if (analysisTypeTag==1 || analysisTypeTag==3) {
-				theRandomVariablePositioner = theReliabilityDomain->getRandomVariablePositionerPtr(i);
-				theRandomVariablePositioner->activate(false);
-			}
-			else {
-				theParameterPositioner = theReliabilityDomain->getParameterPositionerPtr(i);
-				theParameterPositioner->activate(false);
-			}
-		}
-
-
-		// Loop over positioners to check which are "active" this time
-		// and set flag for phase 1
-		for (posNumber=1; posNumber<=numPos; posNumber++ ) {
-
-			if (analysisTypeTag==1 || analysisTypeTag==3) {
-				// Get the random positioner and its rv#
-				theRandomVariablePositioner = theReliabilityDomain->getRandomVariablePositionerPtr(posNumber);
-				int rvNumber = theRandomVariablePositioner->getRvNumber();
-
-				// Check if rv# of this rv positioner is the same as the gradient#
-				if ( rvNumber==gradNumber ) {
-
-					// Set sensitivity flag so that this one contributes to the RHS
-					theRandomVariablePositioner->activate(true);
-
-				} // End if rv# == gradient#
-			}
-			else {
-				theParameterPositioner = theReliabilityDomain->getParameterPositionerPtr(posNumber);
-				theParameterPositioner->activate(true);
-			}
-
-		} // End loop over r.v. positioners to check if it contributes
-
-
-		// Zero out the old right-hand side
-		theSOE->zeroB();
-
-		
-		// Form new right-hand side
-		theSensitivityIntegrator->formSensitivityRHS(gradNumber);
-
-
-		// Solve the system of equation with the new right-hand side
-		theSOE->solve();
-
-
-		// Save 'v' to the nodes for a "sensNodeDisp node? dof?" command
-		theSensitivityIntegrator->saveSensitivity( theSOE->getX(), gradNumber, numGrads );
-
-
-		// Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
-		theSensitivityIntegrator->commitSensitivity(gradNumber, numGrads);
-
-	} // End loop for each gradient
+	// Phase 1: assemble one right-hand side per gradient.
+	const int numEqn= theSOE->getNumEqn();
+	Matrix rhs(numEqn,numGrads);
+	for(int gradNumber=1; gradNumber<=numGrads; gradNumber++ )
+	  {
+	    activatePositioners(gradNumber, numPos);
+
+	    // Zero out the old right-hand side
+	    theSOE->zeroB();
+
+	    // Form new right-hand side
+	    theSensitivityIntegrator->formSensitivityRHS(gradNumber);
+	    const Vector &b= theSOE->getB();
+	    for(int i= 0;i<numEqn;i++)
+	      rhs(i,gradNumber-1)= b(i);
+	  }
+
+
+	// Phase 2: solve all the right-hand sides with the same
+	// factorization of the tangent (the solutions overwrite them).
+	if(theSOE->solveMultipleRHS(rhs) < 0)
+	  {
+	    std::cerr << Color::red << "SensitivityAlgorithm::" << __FUNCTION__
+		      << "; the solution of the sensitivity equations failed."
+		      << Color::def << std::endl;
+	    return -1;
+	  }
+
+
+	// Phase 3: save and commit the results of each gradient.
+	for(int gradNumber=1; gradNumber<=numGrads; gradNumber++ )
+	  {
+	    activatePositioners(gradNumber, numPos);
+	    
+	    // Save 'v' to the nodes for a "sensNodeDisp node? dof?" command
+	    const Vector v= rhs.getCol(gradNumber-1);
+	    theSensitivityIntegrator->saveSensitivity(v, gradNumber, numGrads);
+
+	    // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
+	    theSensitivityIntegrator->commitSensitivity(gradNumber, numGrads);
+	  }
 
     return 0;
 }
@@ -76,6 +76,9 @@ class SensitivityAlgorithm
     EquiSolnAlgo *theAlgorithm;
     SensitivityIntegrator *theSensitivityIntegrator;
     int analysisTypeTag;
+
+    bool wrtRandomVariables(void) const;
+    void activatePositioners(int gradNumber, int numPos);
   public:
     SensitivityAlgorithm(ReliabilityDomain *passedReliabilityDomain,
 	                 EquiSolnAlgo *passedAlgorithm,
@@ -71,10 +71,14 @@
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include <reliability/analysis/misc/MatrixOperations.h>
+#include "solution/analysis/analysis/forked_worker.h"
 #include <reliability/domain/distributions/NormalRV.h>
 #include <cmath>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "utility/utils/misc_utils/colormod.h"
 
 #include <fstream>
 #include <iomanip>
@@ -110,8 +114,172 @@ XC::SamplingAnalysis::SamplingAnalysis(	ReliabilityDomain *passedReliabilityDoma
 	fileName= passedFileName;
 	startPoint = pStartPoint;
 	analysisTypeTag = passedAnalysisTypeTag;
+	numberOfWorkers = 1;
 }
 
+//! @brief Set the number of processes used to evaluate the samples.
+//!
+//! If greater than one, the samples are evaluated in batches
+//! of numberOfWorkers samples, each one in a forked copy
+//! of the process (so each worker has its own copy of the
+//! finite element domain). The samples are always generated
+//! (and the statistics computed) in the parent process in the
+//! same order, so the results do not depend on the number of workers.
+//! The workers don't invoke the recorders and run the OpenMP regions
+//! with a single thread (see setup_forked_worker).
+void XC::SamplingAnalysis::setNumberOfWorkers(const int &n)
+  { numberOfWorkers= std::max(n,1); }
+
+//! @brief Return the number of processes used to evaluate the samples.
+int XC::SamplingAnalysis::getNumberOfWorkers(void) const
+  { return numberOfWorkers; }
+
+//! @brief Run the analysis for the x argument and compute the values
+//! of the limit-state functions (-1.0 for all of them if the finite
+//! element analysis fails).
+int XC::SamplingAnalysis::evaluate_sample(const Vector &x, Vector &gValues)
+  {
+    const int numLsf= theReliabilityDomain->getNumberOfLimitStateFunctions();
+    gValues.resize(numLsf);
+    // Evaluate limit-state function
+    bool FEconvergence= true;
+    int result= theGFunEvaluator->runGFunAnalysis(x);
+    if(result < 0)
+      {
+        // In this case a failure happened during the analysis
+        // Hence, register this as failure
+        FEconvergence= false;
+      }
+    // Loop over number of limit-state functions
+    for(int lsf=0; lsf<numLsf; lsf++ )
+      {
+        // Set tag of "active" limit-state function
+        theReliabilityDomain->setTagOfActiveLimitStateFunction(lsf+1);
+        // Get value of limit-state function
+        result= theGFunEvaluator->evaluateG(x);
+        if(result < 0)
+          {
+	    std::cerr << Color::red << "SamplingAnalysis::" << __FUNCTION__
+		      << "; could not tokenize limit-state function."
+		      << Color::def << std::endl;
+	    return -1;
+	  }
+        gValues(lsf)= (FEconvergence ? theGFunEvaluator->getG() : -1.0);
+      }
+    return 0;
+  }
+
+//! @brief Compute the values of the limit-state functions for each
+//! of the samples in xs.
+//!
+//! When numberOfWorkers > 1 the samples are distributed among
+//! forked processes that send back the results through pipes (see
+//! setup_forked_worker). In both cases all the samples are evaluated
+//! and -1 is returned if any of them fails.
+int XC::SamplingAnalysis::evaluate_batch(const std::vector<Vector> &xs, std::vector<Vector> &gValues)
+  {
+    const size_t numSamples= xs.size();
+    gValues.resize(numSamples);
+    const size_t numWorkers= std::min(size_t(numberOfWorkers), numSamples);
+    if(numWorkers<2)
+      {
+        int retval= 0;
+        for(size_t i= 0; i<numSamples; i++)
+          if(evaluate_sample(xs[i], gValues[i])<0)
+	    retval= -1;
+        return retval;
+      }
+
+    const int numLsf= theReliabilityDomain->getNumberOfLimitStateFunctions();
+    const size_t recordSize= numLsf+1; // status + g values.
+    std::vector<pid_t> pids(numWorkers,-1);
+    std::vector<int> fds(numWorkers,-1);
+    std::cout.flush(); std::cerr.flush();
+    for(size_t w= 0; w<numWorkers; w++)
+      {
+        int fd[2];
+        if(pipe(fd)!=0)
+          continue; // evaluated by the parent below.
+        const pid_t pid= fork();
+        if(pid==0) // worker process.
+          {
+            close(fd[0]);
+            setup_forked_worker();
+            std::vector<double> record(recordSize);
+            Vector g(numLsf);
+            for(size_t i= w; i<numSamples; i+= numWorkers)
+              {
+                record[0]= evaluate_sample(xs[i], g);
+                for(int lsf= 0; lsf<numLsf; lsf++)
+                  record[lsf+1]= g(lsf);
+                const char *buf= reinterpret_cast<const char *>(record.data());
+                size_t remaining= recordSize*sizeof(double);
+                while(remaining>0)
+                  {
+                    const ssize_t n= write(fd[1], buf, remaining);
+                    if(n<=0)
+                      _exit(1);
+                    buf+= n; remaining-= n;
+                  }
+              }
+            close(fd[1]);
+            _exit(0);
+          }
+        close(fd[1]);
+        if(pid<0)
+          close(fd[0]);
+        else
+          {
+            pids[w]= pid;
+            fds[w]= fd[0];
+          }
+      }
+
+    int retval= 0;
+    std::vector<double> record(recordSize);
+    for(size_t w= 0; w<numWorkers; w++)
+      {
+        for(size_t i= w; i<numSamples; i+= numWorkers)
+          {
+            bool received= false;
+            if(fds[w]>=0)
+              {
+                char *buf= reinterpret_cast<char *>(record.data());
+                size_t remaining= recordSize*sizeof(double);
+                while(remaining>0)
+                  {
+                    const ssize_t n= read(fds[w], buf, remaining);
+                    if(n<=0)
+                      break;
+                    buf+= n; remaining-= n;
+                  }
+                received= (remaining==0);
+              }
+            if(received)
+              {
+                if(record[0]<0)
+                  retval= -1;
+                gValues[i].resize(numLsf);
+                for(int lsf= 0; lsf<numLsf; lsf++)
+                  gValues[i](lsf)= record[lsf+1];
+              }
+            else // worker not available or failed: evaluate here.
+              {
+                if(evaluate_sample(xs[i], gValues[i])<0)
+                  retval= -1;
+              }
+          }
+        if(fds[w]>=0)
+          close(fds[w]);
+        if(pids[w]>0)
+          {
+            int status= 0;
+            waitpid(pids[w], &status, 0);
+          }
+      }
+    return retval;
+  }
+
 
 
 
@@ -292,7 +460,11 @@ int XC::SamplingAnalysis::analyze(void)
     Vector temp1;
     double temp2;
     double denumerator;
-    bool FEconvergence;
+    std::vector<Vector> batchU; // samples in standard normal space.
+    std::vector<Vector> batchX; // samples in original space.
+    std::vector<Vector> batchG; // values of the limit-state functions.
+    std::vector<int> batchSeeds;
+    size_t nextInBatch= 0;
 
 
     // Prepare output file
@@ -309,72 +481,66 @@ int XC::SamplingAnalysis::analyze(void)
 	}
 
 		
-	// Create array of standard normal random numbers
-	if (isFirstSimulation) {
-	  result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
-	}
-	else {
-	  result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
-	}
-	seed = theRandomNumberGenerator->getSeed();
-	if (result < 0) {
-	  std::cerr << "XC::SamplingAnalysis::analyze() - could not generate" << std::endl
-		    << " random numbers for simulation." << std::endl;
-	  return -1;
-	}
-	randomArray = theRandomNumberGenerator->getGeneratedNumbers();
-
-	// Compute the point in standard normal space
-	u = startPointY + chol_covariance * randomArray;
-                
-	// Transform into original space
-	result = theProbabilityTransformation->set_u(u);
-	if (result < 0) {
-	  std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
-		    << " set the u-vector for xu-transformation. " << std::endl;
-	  return -1;
-	}
-
-		
-	result = theProbabilityTransformation->transform_u_to_x();
-	if (result < 0) {
-	  std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
-		    << " transform u to x. " << std::endl;
-	  return -1;
-	}
-	x = theProbabilityTransformation->get_x();
-
-	// Evaluate limit-state function
-	FEconvergence = true;
-	result = theGFunEvaluator->runGFunAnalysis(x);
-	if (result < 0) {
-	  // In this case a failure happened during the analysis
-	  // Hence, register this as failure
-	  FEconvergence = false;
-	}
+	// Generate (and evaluate) the next batch of samples
+	if(nextInBatch>=batchU.size())
+	  {
+	    const int batchSize= std::max(1,std::min(numberOfWorkers, numberOfSimulations-k+1));
+	    batchU.resize(batchSize);
+	    batchX.resize(batchSize);
+	    batchSeeds.resize(batchSize);
+	    for(int b= 0; b<batchSize; b++)
+	      {
+		// Create array of standard normal random numbers
+		if (isFirstSimulation && b==0) {
+		  result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
+		}
+		else {
+		  result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
+		}
+		batchSeeds[b] = theRandomNumberGenerator->getSeed();
+		if (result < 0) {
+		  std::cerr << "XC::SamplingAnalysis::analyze() - could not generate" << std::endl
+			    << " random numbers for simulation." << std::endl;
+		  return -1;
+		}
+		randomArray = theRandomNumberGenerator->getGeneratedNumbers();
+
+		// Compute the point in standard normal space
+		batchU[b] = startPointY + chol_covariance * randomArray;
+
+		// Transform into original space
+		result = theProbabilityTransformation->set_u(batchU[b]);
+		if (result < 0) {
+		  std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
+			    << " set the u-vector for xu-transformation. " << std::endl;
+		  return -1;
+		}
+
+
+		result = theProbabilityTransformation->transform_u_to_x();
+		if (result < 0) {
+		  std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
+			    << " transform u to x. " << std::endl;
+		  return -1;
+		}
+		batchX[b] = theProbabilityTransformation->get_x();
+	      }
+	    // Evaluate limit-state functions
+	    if(evaluate_batch(batchX, batchG)<0)
+	      return -1;
+	    nextInBatch= 0;
+	  }
+	u = batchU[nextInBatch];
+	x = batchX[nextInBatch];
+	seed = batchSeeds[nextInBatch];
+	const Vector &gValues= batchG[nextInBatch];
+	nextInBatch++;
 
 
 	// Loop over number of limit-state functions
 	for (int lsf=0; lsf<numLsf; lsf++ ) {
 
-
-	  // Set tag of "active" limit-state function
-	  theReliabilityDomain->setTagOfActiveLimitStateFunction(lsf+1);
-
-
-	  // Get value of limit-state function
-	  result = theGFunEvaluator->evaluateG(x);
-	  if (result < 0) {
-	    std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
-		      << " tokenize limit-state function. " << std::endl;
-	    return -1;
-	  }
-	  gFunctionValue = theGFunEvaluator->getG();
-	  if (!FEconvergence) {
-	    gFunctionValue = -1.0;
-	  }
-
-
+	  gFunctionValue = gValues(lsf);
 			
 	  // ESTIMATION OF FAILURE PROBABILITY
 	  if (analysisTypeTag == 1) {
@@ -67,6 +67,7 @@
 #include <reliability/analysis/randomNumber/RandomNumberGenerator.h>
 
 #include <fstream>
+#include <vector>
 using std::ofstream;
 
 namespace XC {
@@ -90,6 +91,10 @@ private:
 	std::string fileName;
 	Vector *startPoint;
 	int analysisTypeTag;
+	int numberOfWorkers; //!< number of processes used to evaluate the samples.
+
+	int evaluate_sample(const Vector &x, Vector &gValues);
+	int evaluate_batch(const std::vector<Vector> &xs, std::vector<Vector> &gValues);
 
 public:
 	SamplingAnalysis(	ReliabilityDomain *passedReliabilityDomain,
@@ -104,6 +109,8 @@ public:
 						Vector *startPoint,
 						int analysisTypeTag);
 
+	void setNumberOfWorkers(const int &);
+	int getNumberOfWorkers(void) const;
 	int analyze(void);
 };
 } // end of XC namespace
@@ -0,0 +1,120 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LatinHypercubeGenerator.cpp
+
+#include "LatinHypercubeGenerator.h"
+#include <reliability/domain/distributions/NormalRV.h>
+#include <algorithm>
+#include "utility/utils/misc_utils/colormod.h"
+
+//! @brief Constructor.
+//!
+//! @param nSamples: number of strata in each dimension.
+XC::LatinHypercubeGenerator::LatinHypercubeGenerator(int nSamples)
+  :RandomNumberGenerator(), generatedNumbers(), seed(1),
+   numberOfSamples(std::max(nSamples,1)), currentSample(0) {}
+
+//! @brief Create a new design for n dimensions.
+//!
+//! If no seed is given the seed of the previous design is incremented,
+//! so consecutive designs are different but each of them can be
+//! reproduced from its seed (see getSeed).
+void XC::LatinHypercubeGenerator::new_design(int n, int seedIn)
+  {
+    if(seedIn!=0)
+      seed= seedIn;
+    else if(!permutations.empty())
+      seed++;
+    engine.seed(seed);
+    permutations.resize(n);
+    for(int j= 0; j<n; j++)
+      {
+        std::vector<int> &perm= permutations[j];
+        perm.resize(numberOfSamples);
+        for(int i= 0; i<numberOfSamples; i++)
+          perm[i]= i;
+        std::shuffle(perm.begin(), perm.end(), engine);
+      }
+    currentSample= 0;
+  }
+
+//! @brief Put in generatedNumbers the next sample of the design
+//! (values in the [0,1) interval).
+int XC::LatinHypercubeGenerator::generate_uniform(int n, int seedIn)
+  {
+    if(n<1)
+      {
+	std::cerr << Color::red << "LatinHypercubeGenerator::" << __FUNCTION__
+		  << "; wrong number of dimensions: " << n
+		  << Color::def << std::endl;
+        return -1;
+      }
+    // Start a new design if the seed is given, the number of dimensions
+    // changes or all the strata have been used.
+    if((seedIn!=0) || (n!=int(permutations.size())) || (currentSample>=numberOfSamples))
+      new_design(n, seedIn);
+    std::uniform_real_distribution<double> unif(0.0,1.0);
+    generatedNumbers.resize(n);
+    for(int j=0; j<n; j++)
+      generatedNumbers(j)= (permutations[j][currentSample]+unif(engine))/numberOfSamples;
+    currentSample++;
+    return 0;
+  }
+
+//! @brief Generate n uniformly distributed numbers between lower and upper.
+int XC::LatinHypercubeGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+  {
+    const int retval= generate_uniform(n, seedIn);
+    if(retval==0)
+      for(int j=0; j<n; j++)
+        generatedNumbers(j)= (upper-lower)*generatedNumbers(j) + lower;
+    return retval;
+  }
+
+//! @brief Generate n standard normal numbers.
+int XC::LatinHypercubeGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+  {
+    const int retval= generate_uniform(n, seedIn);
+    if(retval==0)
+      {
+        NormalRV aStdNormRV(1,0.0,1.0,0.0);
+        for(int j=0; j<n; j++)
+          {
+            const double u= std::min(std::max(generatedNumbers(j),0.0000001),0.9999999);
+            generatedNumbers(j)= aStdNormRV.getInverseCDFvalue(u);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Return generated numbers.
+const XC::Vector &XC::LatinHypercubeGenerator::getGeneratedNumbers(void) const
+  { return generatedNumbers; }
+
+//! @brief Return the seed of the current design.
+int XC::LatinHypercubeGenerator::getSeed(void) const
+  { return seed; }
@@ -0,0 +1,69 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LatinHypercubeGenerator.h
+
+#ifndef LatinHypercubeGenerator_h
+#define LatinHypercubeGenerator_h
+
+#include "RandomNumberGenerator.h"
+#include <random>
+#include <vector>
+
+namespace XC {
+//! @ingroup ReliabilityAnalysis
+// 
+//! @brief Latin hypercube sample generator.
+//!
+//! The unit interval is divided in numberOfSamples strata of equal
+//! probability for each dimension and each stratum is sampled exactly
+//! once (in random order) every numberOfSamples calls. The numbers are
+//! drawn from a std::mt19937 engine, so the sequence depends only
+//! on the seed.
+class LatinHypercubeGenerator: public RandomNumberGenerator
+  {
+  private:
+    Vector generatedNumbers;
+    int seed; //!< seed of the current design.
+    int numberOfSamples; //!< number of strata.
+    int currentSample; //!< index of the next sample of the design.
+    std::mt19937 engine;
+    std::vector<std::vector<int> > permutations; //!< stratum of each sample (for each dimension).
+
+    void new_design(int n, int seedIn);
+    int generate_uniform(int n, int seedIn);
+  public:
+    LatinHypercubeGenerator(int numberOfSamples= 100);
+
+    int	generate_nIndependentStdNormalNumbers(int n, int seed=0);
+    int generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+    const Vector &getGeneratedNumbers(void) const;
+    int getSeed(void) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,178 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SobolSequenceGenerator.cpp
+
+#include "SobolSequenceGenerator.h"
+#include <reliability/domain/distributions/NormalRV.h>
+#include <algorithm>
+#include "utility/utils/misc_utils/colormod.h"
+
+namespace {
+//! @brief Primitive polynomials and initial direction numbers
+//! (S. Joe and F. Y. Kuo) for dimensions 2 to 16: degree s,
+//! coefficients a and initial values m_1...m_s.
+struct SobolInitData
+  {
+    unsigned s;
+    unsigned a;
+    unsigned m[6];
+  };
+
+const SobolInitData sobolInitData[]=
+  {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}}
+  };
+
+const int numBits= 32;
+}
+
+//! @brief Constructor.
+XC::SobolSequenceGenerator::SobolSequenceGenerator(void)
+  :RandomNumberGenerator(), generatedNumbers(), index(1) {}
+
+//! @brief Compute the direction numbers for n dimensions and
+//! place the generator at the startIndex point of the sequence.
+int XC::SobolSequenceGenerator::initialize(int n, int startIndex)
+  {
+    if((n<1) || (n>maxDimension))
+      {
+	std::cerr << Color::red << "SobolSequenceGenerator::" << __FUNCTION__
+		  << "; number of dimensions: " << n
+		  << " out of range [1," << maxDimension << "]."
+		  << Color::def << std::endl;
+        return -1;
+      }
+    directions.resize(n);
+    // First dimension: all the m_k are equal to one.
+    directions[0].resize(numBits);
+    for(int k= 0; k<numBits; k++)
+      directions[0][k]= uint32_t(1) << (numBits-1-k);
+    for(int j= 1; j<n; j++)
+      {
+        const SobolInitData &d= sobolInitData[j-1];
+        const int s= d.s;
+        std::vector<uint32_t> &v= directions[j];
+        v.resize(numBits);
+        for(int k= 0; k<std::min(s,numBits); k++)
+          v[k]= uint32_t(d.m[k]) << (numBits-1-k);
+        for(int k= s; k<numBits; k++)
+          {
+            v[k]= v[k-s] ^ (v[k-s] >> s);
+            for(int i= 1; i<s; i++)
+              if((d.a >> (s-1-i)) & 1)
+                v[k]^= v[k-i];
+          }
+      }
+    // Point number startIndex: XOR of the direction numbers
+    // corresponding to the bits of its Gray code.
+    index= std::max(startIndex,1);
+    const uint32_t gray= index ^ (index >> 1);
+    state.assign(n,0);
+    for(int j= 0; j<n; j++)
+      for(int k= 0; k<numBits; k++)
+        if((gray >> k) & 1)
+          state[j]^= directions[j][k];
+    return 0;
+  }
+
+//! @brief Put in generatedNumbers the next point of the sequence
+//! (values in the [0,1) interval).
+int XC::SobolSequenceGenerator::generate_uniform(int n, int seedIn)
+  {
+    int retval= 0;
+    if((seedIn!=0) || (n!=int(state.size())))
+      retval= initialize(n, (seedIn!=0) ? seedIn : index);
+    if(retval==0)
+      {
+        const double scale= 1.0/4294967296.0; // 2^-32
+        generatedNumbers.resize(n);
+        for(int j= 0; j<n; j++)
+          generatedNumbers(j)= state[j]*scale;
+        // Advance (Gray code order): flip the direction number
+        // corresponding to the lowest zero bit of the index.
+        int c= 0;
+        uint32_t value= index;
+        while(value & 1)
+          {
+            value>>= 1;
+            c++;
+          }
+        if(c<numBits)
+          for(int j= 0; j<n; j++)
+            state[j]^= directions[j][c];
+        index++;
+      }
+    return retval;
+  }
+
+//! @brief Generate n uniformly distributed numbers between lower and upper.
+int XC::SobolSequenceGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+  {
+    const int retval= generate_uniform(n, seedIn);
+    if(retval==0)
+      for(int j=0; j<n; j++)
+        generatedNumbers(j)= (upper-lower)*generatedNumbers(j) + lower;
+    return retval;
+  }
+
+//! @brief Generate n standard normal numbers.
+int XC::SobolSequenceGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+  {
+    const int retval= generate_uniform(n, seedIn);
+    if(retval==0)
+      {
+        NormalRV aStdNormRV(1,0.0,1.0,0.0);
+        for(int j=0; j<n; j++)
+          {
+            const double u= std::min(std::max(generatedNumbers(j),0.0000001),0.9999999);
+            generatedNumbers(j)= aStdNormRV.getInverseCDFvalue(u);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Return generated numbers.
+const XC::Vector &XC::SobolSequenceGenerator::getGeneratedNumbers(void) const
+  { return generatedNumbers; }
+
+//! @brief Return the index of the next point of the sequence.
+int XC::SobolSequenceGenerator::getSeed(void) const
+  { return index; }
@@ -0,0 +1,68 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SobolSequenceGenerator.h
+
+#ifndef SobolSequenceGenerator_h
+#define SobolSequenceGenerator_h
+
+#include "RandomNumberGenerator.h"
+#include <vector>
+#include <cstdint>
+
+namespace XC {
+//! @ingroup ReliabilityAnalysis
+// 
+//! @brief Sobol low discrepancy (quasi-random) sequence generator.
+//!
+//! Points are generated in Gray code order using the direction numbers
+//! of S. Joe and F. Y. Kuo (new-joe-kuo-6) for up to
+//! maxDimension dimensions. The "seed" is the index of the point
+//! in the sequence, so the sequence can be resumed from getSeed().
+//! The first point (the origin) is never returned.
+class SobolSequenceGenerator: public RandomNumberGenerator
+  {
+  private:
+    Vector generatedNumbers;
+    uint32_t index; //!< index of the next point of the sequence.
+    std::vector<std::vector<uint32_t> > directions; //!< direction numbers (for each dimension).
+    std::vector<uint32_t> state; //!< current point (integer representation).
+
+    int initialize(int n, int startIndex);
+    int generate_uniform(int n, int seedIn);
+  public:
+    static const int maxDimension= 16;
+    SobolSequenceGenerator(void);
+
+    int	generate_nIndependentStdNormalNumbers(int n, int seed=0);
+    int generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+    const Vector &getGeneratedNumbers(void) const;
+    int getSeed(void) const;
+  };
+} // end of XC namespace
+
+#endif
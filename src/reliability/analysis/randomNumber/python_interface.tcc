@@ -0,0 +1,38 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::RandomNumberGenerator, boost::noncopyable >("RandomNumberGenerator", no_init)
+  .def("generateStdNormalNumbers", &XC::RandomNumberGenerator::generate_nIndependentStdNormalNumbers, "generateStdNormalNumbers(n, seed): generate n independent standard normal numbers (seed= 0 continues the current sequence).")
+  .def("generateUniformNumbers", &XC::RandomNumberGenerator::generate_nIndependentUniformNumbers, "generateUniformNumbers(n, lower, upper, seed): generate n independent numbers uniformly distributed between lower and upper (seed= 0 continues the current sequence).")
+  .add_property("generatedNumbers", make_function(&XC::RandomNumberGenerator::getGeneratedNumbers, return_internal_reference<>() ), "Return the last generated numbers.")
+  .add_property("seed", &XC::RandomNumberGenerator::getSeed, "Return the seed to use to resume the sequence.")
+  ;
+
+class_<XC::CStdLibRandGenerator, bases<XC::RandomNumberGenerator>, boost::noncopyable >("CStdLibRandGenerator")
+  ;
+
+class_<XC::LatinHypercubeGenerator, bases<XC::RandomNumberGenerator>, boost::noncopyable >("LatinHypercubeGenerator", init<int>("LatinHypercubeGenerator(numberOfSamples): Latin hypercube sample generator, numberOfSamples being the number of strata in each dimension."))
+  ;
+
+class_<XC::SobolSequenceGenerator, bases<XC::RandomNumberGenerator>, boost::noncopyable >("SobolSequenceGenerator", "Sobol low discrepancy sequence generator (the seed is the index of the point in the sequence).")
+  ;
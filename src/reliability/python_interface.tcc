@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+#include "analysis/randomNumber/python_interface.tcc"
+
+class_<XC::ReliabilityAnalysis, boost::noncopyable >("ReliabilityAnalysis", no_init)
+  .def("analyze", &XC::ReliabilityAnalysis::analyze, "Run the analysis.")
+  ;
+
+class_<XC::SamplingAnalysis, bases<XC::ReliabilityAnalysis>, boost::noncopyable >("SamplingAnalysis", no_init)
+  .add_property("numberOfWorkers", &XC::SamplingAnalysis::getNumberOfWorkers, &XC::SamplingAnalysis::setNumberOfWorkers, "Number of processes used to evaluate the samples of each batch (1: evaluate them in this process). The forked processes don't invoke the recorders and use a single OpenMP thread.")
+  ;
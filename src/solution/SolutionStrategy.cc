@@ -74,7 +74,9 @@ bool XC::SolutionStrategy::alloc_soln_algo(const std::string &nmb)
   {
     free_soln_algo();
 
-    if(nmb=="bfgs_soln_algo")
+    if(nmb=="adaptive_newton_soln_algo")
+      theSolnAlgo= new AdaptiveNewton(this);
+    else if(nmb=="bfgs_soln_algo")
       theSolnAlgo= new BFGS(this);
     else if(nmb=="broyden_soln_algo")
       theSolnAlgo= new Broyden(this);
@@ -0,0 +1,432 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.cc
+
+#include "AdaptiveNewton.h"
+#include <solution/analysis/algorithm/equiSolnAlgo/line_search/BisectionLineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/line_search/InitialInterpolatedLineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/line_search/RegulaFalsiLineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/line_search/SecantLineSearch.h>
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/integrator/IncrementalIntegrator.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <solution/analysis/convergenceTest/ConvergenceTest.h>
+#include "solution/SolutionStrategy.h"
+#include "utility/utils/misc_utils/colormod.h"
+
+//! @brief Constructor.
+XC::AdaptiveNewton::AdaptiveNewton(SolutionStrategy *owr,int theTangentToUse)
+  : NewtonBased(owr,EquiALGORITHM_TAGS_AdaptiveNewton,theTangentToUse),
+    refreshRatio(0.5), keepTangent(true), accelerator(3),
+    theLineSearch(nullptr), mustRefresh(true), numEqns(0),
+    numIterations(0), numTangents(0), numLineSearches(0), numRetries(0) {}
+
+//! @brief Copy constructor.
+XC::AdaptiveNewton::AdaptiveNewton(const AdaptiveNewton &other)
+  : NewtonBased(other), refreshRatio(other.refreshRatio),
+    keepTangent(other.keepTangent), accelerator(other.accelerator),
+    theLineSearch(nullptr), mustRefresh(true), numEqns(0),
+    numIterations(0), numTangents(0), numLineSearches(0), numRetries(0)
+  { copy_line_search(other.theLineSearch); }
+
+//! @brief Assignment operator.
+XC::AdaptiveNewton &XC::AdaptiveNewton::operator=(const AdaptiveNewton &other)
+  {
+    NewtonBased::operator=(other);
+    refreshRatio= other.refreshRatio;
+    keepTangent= other.keepTangent;
+    accelerator= other.accelerator;
+    mustRefresh= true;
+    copy_line_search(other.theLineSearch);
+    return *this;
+  }
+
+//! @brief Virtual constructor.
+XC::SolutionAlgorithm *XC::AdaptiveNewton::getCopy(void) const
+  { return new AdaptiveNewton(*this); }
+
+//! @brief Destructor.
+XC::AdaptiveNewton::~AdaptiveNewton(void)
+  { free_line_search(); }
+
+//! @brief Release the line search object.
+void XC::AdaptiveNewton::free_line_search(void)
+  {
+    if(theLineSearch)
+      {
+        delete theLineSearch;
+        theLineSearch= nullptr;
+      }
+  }
+
+//! @brief Copy the line search object argument.
+void XC::AdaptiveNewton::copy_line_search(const LineSearch *ptr)
+  {
+    free_line_search();
+    if(ptr)
+      {
+        theLineSearch= ptr->getCopy();
+        theLineSearch->set_owner(this);
+      }
+  }
+
+//! @brief Sets the line search method to use (none to disable it).
+//! @param lineSearchMethod: string identifying the method.
+bool XC::AdaptiveNewton::setLineSearchMethod(const std::string &lineSearchMethod)
+  {
+    free_line_search();
+    bool retval= true;
+    if(lineSearchMethod=="bisection_line_search")
+      theLineSearch= new BisectionLineSearch();
+    else if(lineSearchMethod=="initial_interpolated_line_search")
+      theLineSearch= new InitialInterpolatedLineSearch();
+    else if(lineSearchMethod=="regula_falsi_line_search")
+      theLineSearch= new RegulaFalsiLineSearch();
+    else if(lineSearchMethod=="secant_line_search")
+      theLineSearch= new SecantLineSearch();
+    else if(lineSearchMethod!="none")
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; can't set the line search method: '"
+                  << lineSearchMethod << "'"
+                  << Color::def << std::endl;
+        retval= false;
+      }
+    if(theLineSearch)
+      theLineSearch->set_owner(this);
+    return retval;
+  }
+
+//! @brief Return the contraction ratio that triggers the formation
+//! of a new tangent.
+double XC::AdaptiveNewton::getRefreshRatio(void) const
+  { return refreshRatio; }
+
+//! @brief Set the contraction ratio that triggers the formation
+//! of a new tangent (a value of zero makes the algorithm equivalent
+//! to Newton-Raphson).
+void XC::AdaptiveNewton::setRefreshRatio(const double &r)
+  { refreshRatio= r; }
+
+//! @brief Return true if the tangent is kept between steps.
+bool XC::AdaptiveNewton::getKeepTangent(void) const
+  { return keepTangent; }
+
+//! @brief Set if the tangent is kept between steps.
+void XC::AdaptiveNewton::setKeepTangent(const bool &b)
+  { keepTangent= b; }
+
+//! @brief Return the maximum dimension of the Krylov subspace.
+int XC::AdaptiveNewton::getMaxDimension(void) const
+  { return accelerator.getMaxDimension(); }
+
+//! @brief Set the maximum dimension of the Krylov subspace (zero
+//! disables the acceleration).
+void XC::AdaptiveNewton::setMaxDimension(const int &maxDim)
+  {
+    accelerator.setMaxDimension(maxDim);
+    numEqns= 0; // force resizing.
+  }
+
+//! @brief Return the number of iterations performed.
+int XC::AdaptiveNewton::getNumIterations(void) const
+  { return numIterations; }
+
+//! @brief Return the number of times the tangent has been formed.
+int XC::AdaptiveNewton::getNumTangents(void) const
+  { return numTangents; }
+
+//! @brief Return the number of factorizations avoided with respect to
+//! the Newton-Raphson method (that forms the tangent on each iteration).
+int XC::AdaptiveNewton::getNumFactorizationsSaved(void) const
+  { return std::max(numIterations-numTangents,0); }
+
+//! @brief Return the number of line searches.
+int XC::AdaptiveNewton::getNumLineSearches(void) const
+  { return numLineSearches; }
+
+//! @brief Return the number of times the iterations have been
+//! restarted with a new tangent after failing with the old one.
+int XC::AdaptiveNewton::getNumRetries(void) const
+  { return numRetries; }
+
+//! @brief Reset the counters.
+void XC::AdaptiveNewton::resetCounters(void)
+  {
+    numIterations= 0;
+    numTangents= 0;
+    numLineSearches= 0;
+    numRetries= 0;
+  }
+
+//! @brief The tangent must be formed again when the domain changes.
+int XC::AdaptiveNewton::domainChanged(void)
+  {
+    mustRefresh= true;
+    return NewtonBased::domainChanged();
+  }
+
+//! @brief Form the tangent.
+int XC::AdaptiveNewton::form_tangent(IncrementalIntegrator &theIntegrator)
+  {
+    const int retval= theIntegrator.formTangent(tangent);
+    if(retval < 0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; the Integrator failed in formTangent()"
+                << Color::def << std::endl;
+    else
+      numTangents++;
+    mustRefresh= false;
+    return retval;
+  }
+
+//! @brief Return the ratio between the last two norms computed by
+//! the convergence test (zero if not available).
+double XC::AdaptiveNewton::get_contraction_ratio(const ConvergenceTest &theTest) const
+  {
+    double retval= 0.0;
+    const Vector &norms= theTest.getNorms();
+    // test() increments the counter when convergence is not achieved.
+    const int i= theTest.getCurrentIter()-2;
+    if((i>0) && (i<norms.Size()))
+      {
+        const double previous= norms(i-1);
+        if(previous>0.0)
+          retval= norms(i)/previous;
+      }
+    return retval;
+  }
+
+//! @brief Solve the current step.
+//!
+//! @return a positive number (the number of iterations) if
+//! convergence is achieved, -1 if the integrator fails in
+//! formTangent(), -2 if it fails in formUnbalance(), -3 if the
+//! solution of the system of equations or the convergence test fail
+//! and -4 if the integrator fails in update().
+int XC::AdaptiveNewton::solveCurrentStep(void)
+  {
+    // set up some pointers and check they are valid
+    AnalysisModel *theAnaModel= getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator= getIncrementalIntegratorPtr();
+    LinearSOE *theSOE= getLinearSOEPtr();
+    ConvergenceTest *theTest= getConvergenceTestPtr();
+
+    if((theAnaModel == nullptr) || (theIntegrator == nullptr) || (theSOE == nullptr) || (theTest == nullptr))
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__ << std::endl;
+	if(theAnaModel==nullptr)
+	  std::cerr << "  undefined model." << std::endl;
+	if(theIntegrator==nullptr)
+	  std::cerr << "  undefined integrator." << std::endl;
+	if(theSOE==nullptr)
+	  std::cerr << "  undefined system of equations." << std::endl;
+	if(theTest==nullptr)
+	  std::cerr << "  undefined convergence test." << std::endl;
+	std::cerr << Color::def;
+        return -5;
+      }
+
+    const int n= theSOE->getNumEqn();
+    if(n!=numEqns)
+      {
+        numEqns= n;
+        mustRefresh= true;
+      }
+    const bool accelerate= (accelerator.getMaxDimension()>0);
+    if(accelerate)
+      accelerator.setSize(numEqns);
+    const int maxDimension= accelerator.getMaxDimension();
+
+    if(theIntegrator->formUnbalance() < 0)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; the Integrator failed in formUnbalance()"
+	          << Color::def << std::endl;
+        return -2;
+      }
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->set_owner(getSolutionStrategy());
+    if(theTest->start() < 0)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; the ConvergenceTest object failed in start()"
+	          << Color::def << std::endl;
+        return -3;
+      }
+
+    bool freshTangent= false; // tangent formed in the last iteration.
+    if(mustRefresh || !keepTangent)
+      {
+        if(form_tangent(*theIntegrator) < 0)
+          return -1;
+        freshTangent= true;
+      }
+    if(theLineSearch)
+      theLineSearch->newStep(*theSOE);
+
+    int dim= 0; // current dimension of the Krylov subspace.
+    Vector stepIncrement(numEqns); // corrections applied in this step.
+    bool retried= false;
+    double ratio= 0.0;
+    int result= -1;
+    do
+      {
+        if(dim > maxDimension) // restart the acceleration.
+          dim= 0;
+        const bool usedFreshTangent= freshTangent;
+        const bool applyLineSearch= (theLineSearch && usedFreshTangent);
+        Vector resid0;
+        if(applyLineSearch)
+          resid0= theSOE->getB();
+
+        if(theSOE->solve() < 0)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; the LinearSysOfEqn failed in solve()"
+		      << Color::def << std::endl;
+            return -3;
+          }
+        const Vector *dx= &theSOE->getX();
+        if(accelerate)
+          {
+            if(accelerator.leastSquares(dim,theSOE->getX()) < 0)
+              {
+                std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                          << "; the accelerator failed in leastSquares()"
+                          << Color::def << std::endl;
+                return -1;
+              }
+            dx= &accelerator.getCorrection(dim);
+            dim++;
+          }
+        const double s0= (applyLineSearch ? -((*dx)^resid0) : 0.0);
+        if(theIntegrator->update(*dx) < 0)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; the Integrator failed in update()"
+		      << Color::def << std::endl;
+            return -4;
+          }
+        if(theIntegrator->formUnbalance() < 0)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; the Integrator failed in formUnbalance()"
+		      << Color::def << std::endl;
+            return -2;
+          }
+        // The subspace is empty after forming the tangent, so dx is
+        // the solution of the SOE (the direction of the line search).
+        if(applyLineSearch)
+          {
+            const double s= -(theSOE->getX()^theSOE->getB());
+            theLineSearch->search(s0, s, *theSOE, *theIntegrator);
+            numLineSearches++;
+          }
+        // The line search leaves the correction it has applied in X.
+        stepIncrement+= (applyLineSearch ? theSOE->getX() : *dx);
+        numIterations++;
+        freshTangent= false;
+
+        this->record(0); //Call the record(...) method of all the recorders.
+        result= theTest->test();
+        if(result == -1)
+          {
+            ratio= get_contraction_ratio(*theTest);
+            if(ratio>refreshRatio)
+              {
+                if(form_tangent(*theIntegrator) < 0)
+                  return -1;
+                freshTangent= true;
+                dim= 0;
+              }
+          }
+        else if((result == -2) && !retried && !usedFreshTangent)
+          {
+            // failed with an old tangent: undo the corrections of
+            // this step, form the tangent again and restart.
+            retried= true;
+            numRetries++;
+            stepIncrement*= -1.0;
+            if(theIntegrator->update(stepIncrement) < 0)
+              {
+                std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                          << "; the Integrator failed in update()"
+                          << Color::def << std::endl;
+                return -4;
+              }
+            stepIncrement.Zero();
+            if(theIntegrator->formUnbalance() < 0)
+              {
+                std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                          << "; the Integrator failed in formUnbalance()"
+                          << Color::def << std::endl;
+                return -2;
+              }
+            if(form_tangent(*theIntegrator) < 0)
+              return -1;
+            freshTangent= true;
+            dim= 0;
+            if(theTest->start() < 0)
+              return -3;
+            result= -1;
+          }
+      }
+    while(result == -1);
+
+    if(result == -2)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; the ConvergenceTest object failed in test()\n"
+                  << "convergence test message: "
+                  << theTest->getStatusMsg(1)
+		  << Color::def << std::endl;
+        mustRefresh= true;
+        return -3;
+      }
+    // Form the tangent at the beginning of the next step if the
+    // convergence has been slow.
+    if(ratio>refreshRatio)
+      mustRefresh= true;
+
+    // note - if positive result we are returning what the convergence
+    // test returned which should be the number of iterations
+    return result;
+  }
+
+//! @brief Print stuff.
+void XC::AdaptiveNewton::Print(std::ostream &s, int flag) const
+  {
+    s << "AdaptiveNewton";
+    s << "\n\tRefresh ratio: " << refreshRatio;
+    s << "\n\tMax subspace dimension: " << accelerator.getMaxDimension();
+    s << "\n\tIterations: " << numIterations
+      << " tangents: " << numTangents
+      << " factorizations saved: " << getNumFactorizationsSaved()
+      << std::endl;
+  }
@@ -0,0 +1,115 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.h
+
+#ifndef AdaptiveNewton_h
+#define AdaptiveNewton_h
+
+#include <solution/analysis/algorithm/equiSolnAlgo/NewtonBased.h>
+#include "KrylovAccelerator.h"
+
+namespace XC {
+class LineSearch;
+
+//! @ingroup EQSolAlgo
+//
+//! @brief Newton algorithm that decides on each iteration whether
+//! the tangent must be formed (and factorized) again.
+//!
+//! The decision is based on the contraction ratio of the norms
+//! computed by the convergence test \f$\rho_k= \|n_k\|/\|n_{k-1}\|\f$:
+//! <ul>
+//! <li> While \f$\rho_k\f$ remains below the refresh ratio the last
+//!      factorization is reused (modified Newton), and the corrections
+//!      are improved with a Krylov subspace accelerator (see
+//!      KrylovAccelerator).</li>
+//! <li> If \f$\rho_k\f$ exceeds the refresh ratio the tangent is formed
+//!      again (Newton-Raphson).</li>
+//! <li> If a line search method has been defined, it is applied to the
+//!      iterations that follow the formation of the tangent.</li>
+//! <li> If the convergence test fails with an old tangent, the trial
+//!      increment of the step is undone, the tangent is formed again
+//!      and the iterations restarted once.</li>
+//! </ul>
+//! The tangent can be kept between steps: it is formed at the beginning
+//! of the step only if the previous one ended with a poor contraction
+//! ratio or if the domain has changed. For mildly nonlinear problems
+//! most of the factorizations of the Newton-Raphson method are avoided.
+class AdaptiveNewton: public NewtonBased
+  {
+  private:
+    double refreshRatio; //!< contraction ratio that triggers a new tangent.
+    bool keepTangent; //!< if true keep the tangent between steps.
+    KrylovAccelerator accelerator; //!< Krylov subspace accelerator.
+    LineSearch *theLineSearch; //!< line search (optional).
+    bool mustRefresh; //!< if true form the tangent at the start of the next step.
+    int numEqns; //!< number of equations of the last step.
+
+    // Counters.
+    int numIterations; //!< number of iterations.
+    int numTangents; //!< number of tangent formations.
+    int numLineSearches; //!< number of line searches.
+    int numRetries; //!< number of iterations restarted with a new tangent.
+
+    void free_line_search(void);
+    void copy_line_search(const LineSearch *);
+    int form_tangent(IncrementalIntegrator &);
+    double get_contraction_ratio(const ConvergenceTest &) const;
+
+    friend class SolutionStrategy;
+    friend class FEM_ObjectBroker;
+    AdaptiveNewton(SolutionStrategy *,int tangent = CURRENT_TANGENT);
+    AdaptiveNewton(const AdaptiveNewton &);
+    AdaptiveNewton &operator=(const AdaptiveNewton &);
+    virtual SolutionAlgorithm *getCopy(void) const;
+  public:
+    ~AdaptiveNewton(void);
+
+    double getRefreshRatio(void) const;
+    void setRefreshRatio(const double &);
+    bool getKeepTangent(void) const;
+    void setKeepTangent(const bool &);
+    int getMaxDimension(void) const;
+    void setMaxDimension(const int &);
+    bool setLineSearchMethod(const std::string &);
+
+    int getNumIterations(void) const;
+    int getNumTangents(void) const;
+    int getNumFactorizationsSaved(void) const;
+    int getNumLineSearches(void) const;
+    int getNumRetries(void) const;
+    void resetCounters(void);
+
+    int domainChanged(void);
+    int solveCurrentStep(void);
+    void Print(std::ostream &s, int flag =0) const;    
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,165 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovAccelerator.cc
+
+#include "KrylovAccelerator.h"
+#include "utility/matrix/Matrix.h"
+#include <iostream>
+#include "utility/utils/misc_utils/colormod.h"
+
+extern "C" int dgels_(char *T, int *M, int *N, int *NRHS,
+                      double *A, int *LDA, double *B, int *LDB,
+                      double *WORK, int *LWORK, int *INFO);
+
+//! @brief Constructor.
+//!
+//! @param maxDim: maximum dimension of the subspace.
+XC::KrylovAccelerator::KrylovAccelerator(const int &maxDim)
+  : v(0), Av(0), AvData(0), rData(0), work(0), lwork(0),
+    numEqns(0), maxDimension(maxDim)
+  { if(maxDimension < 0) maxDimension = 0; }
+
+//! @brief Return the maximum dimension of the subspace.
+int XC::KrylovAccelerator::getMaxDimension(void) const
+  { return maxDimension; }
+
+//! @brief Set the maximum dimension of the subspace.
+void XC::KrylovAccelerator::setMaxDimension(const int &maxDim)
+  {
+    maxDimension= maxDim;
+    if(maxDimension < 0)
+      maxDimension = 0;
+    v.clear();
+    Av.clear();
+  }
+
+//! @brief Allocate the storage for the number of equations argument.
+void XC::KrylovAccelerator::setSize(const int &n)
+  {
+    if(maxDimension > n) // maxDimension not bigger than system size.
+      maxDimension = n;
+    if(n!=numEqns)
+      {
+        v.clear();
+        Av.clear();
+      }
+    numEqns= n;
+    const Vector templateVector(numEqns);  
+    if(v.empty())
+      v= std::vector<Vector>(maxDimension+1, templateVector);
+
+    if(Av.empty())
+      Av= std::vector<Vector>(maxDimension+1, templateVector);
+
+    AvData.resize(maxDimension*numEqns);
+
+    // The LAPACK least squares subroutine overwrites the RHS vector
+    // with the solution vector ... these vectors are not the same
+    // size, so we need to use the max size
+    rData.resize((numEqns > maxDimension) ? numEqns : maxDimension);
+
+    // Length of work vector should be >= 2*min(numEqns,maxDimension)
+    // See dgels subroutine documentation
+    lwork= 2 * ((numEqns < maxDimension) ? numEqns : maxDimension);
+
+    work.resize(lwork);
+  }
+
+//! @brief Compute the k-th update vector from the solution r obtained
+//! with the (not updated) tangent.
+//!
+//! @param k: current dimension of the subspace.
+//! @param r: solution of the system of equations.
+int XC::KrylovAccelerator::leastSquares(const int &k, const Vector &r)
+  {
+    // v_{k+1} = w_{k+1} + q_{k+1}
+    v[k]= r;
+    Av[k]= r;
+
+    // Subspace is empty
+    if(k == 0)
+      return 0;
+
+    // Compute Av_k = f(y_{k-1}) - f(y_k) = r_{k-1} - r_k
+    Av[k-1].addVector(1.0, r, -1.0);
+
+    // Put subspace vectors into AvData
+    Matrix A(AvData.getDataPtr(), numEqns, k);
+    for(int i = 0; i < k; i++)
+      {
+	Vector &Ai = Av[i];
+	for(int j = 0; j < numEqns; j++)
+	  A(j,i)= Ai(j);
+      }
+
+    // Put residual vector into rData (need to save r for later!)
+    Vector B(rData.getDataPtr(), numEqns);
+    B= r;
+
+    // No transpose
+    char trans[]= "N";
+
+    // The number of right hand side vectors
+    int nrhs = 1;
+
+    // Leading dimension of the right hand side vector
+    int ldb = (numEqns > k) ? numEqns : k;
+
+    // Subroutine error flag
+    int info = 0;
+
+    int kk= k;
+    // Call the LAPACK least squares subroutine
+    dgels_(trans, &numEqns, &kk, &nrhs, AvData.getDataPtr(), &numEqns, rData.getDataPtr(), &ldb, work.getDataPtr(), &lwork, &info);
+
+    // Check for error returned by subroutine
+    if(info < 0)
+      {
+	std::cerr << Color::red << "KrylovAccelerator::" << __FUNCTION__
+		  << "error code " << info
+		  << " returned by LAPACK dgels."
+	          << Color::def << std::endl;
+	return info;
+      }
+
+    // Compute the correction vector
+    double cj;
+    for(int j = 0; j < k; j++)
+      {
+
+	// Solution to least squares is written to rData
+	cj = rData[j];
+
+	// Compute w_{k+1} = c_1 v_1 + ... + c_k v_k
+	v[k].addVector(1.0, v[j], cj);
+
+	// Compute least squares residual q_{k+1} = r_k - (c_1 Av_1 + ... + c_k Av_k)
+	v[k].addVector(1.0, Av[j], -cj);
+      }
+
+    return 0;
+  }
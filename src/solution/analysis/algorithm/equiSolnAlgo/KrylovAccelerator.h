@@ -0,0 +1,72 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovAccelerator.h
+
+#ifndef KrylovAccelerator_h
+#define KrylovAccelerator_h
+
+#include "utility/matrix/Vector.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup EQSolAlgo
+//
+//! @brief Krylov subspace accelerator for the modified Newton method.
+//!
+//! Computes corrections of the solutions obtained with a tangent
+//! that is not updated, using a least squares fit on the subspace
+//! defined by the previous corrections. The accelerator is described
+//! by Carlson and Miller in "Design and Application of a 1D GWMFE Code"
+//! from SIAM Journal of Scientific Computing (Vol. 19, No. 3,
+//! pp. 728-765, May 1998).
+class KrylovAccelerator
+  {
+  private:
+    std::vector<Vector> v; //!< update vectors.
+    std::vector<Vector> Av; //!< subspace vectors.
+    Vector AvData; //!< least squares matrix data (LAPACK).
+    Vector rData; //!< least squares right hand side data (LAPACK).
+    Vector work; //!< LAPACK work array.
+    int lwork; //!< length of the work array.
+    int numEqns; //!< number of equations.
+    int maxDimension; //!< maximum dimension of the subspace.
+  public:
+    KrylovAccelerator(const int &maxDim= 3);
+
+    int getMaxDimension(void) const;
+    void setMaxDimension(const int &);
+    void setSize(const int &);
+    int leastSquares(const int &, const Vector &);
+    //! @brief Return the k-th update vector (accelerated correction).
+    inline const Vector &getCorrection(const int &k) const
+      { return v[k]; }
+  };
+} // end of XC namespace
+
+#endif
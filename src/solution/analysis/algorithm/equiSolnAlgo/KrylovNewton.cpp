@@ -73,23 +73,17 @@
 //! @brief Constructor
 XC::KrylovNewton::KrylovNewton(SolutionStrategy *owr,int theTangentToUse, int maxDim)
   :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_KrylovNewton),
-   tangent(theTangentToUse), v(0), Av(0), AvData(0), rData(0), work(0), lwork(0),
-   numEqns(0), maxDimension(maxDim)
-  { if(maxDimension < 0) maxDimension = 0; }
+   tangent(theTangentToUse), accelerator(maxDim), numEqns(0) {}
 
 //! @brief Virtual constructor.
 XC::SolutionAlgorithm *XC::KrylovNewton::getCopy(void) const
   { return new KrylovNewton(*this); }
 
 int XC::KrylovNewton::getMaxDimension(void) const
-  { return maxDimension; }
+  { return accelerator.getMaxDimension(); }
 
 void XC::KrylovNewton::setMaxDimension(const int &maxDim)
-  {
-    maxDimension= maxDim;
-    if(maxDimension < 0)
-      maxDimension = 0;
-  }
+  { accelerator.setMaxDimension(maxDim); }
   
 
 //! @brief resuelve el paso actual.
@@ -119,28 +113,8 @@ int XC::KrylovNewton::solveCurrentStep(void)
 
     // Get size information from SOE
     numEqns  = theSOE->getNumEqn();
-    if(maxDimension > numEqns) // maxDimension not bigger than system size.
-      maxDimension = numEqns;
-
-    const Vector templateVector(numEqns);  
-    if(v.empty())
-      v= std::vector<Vector>(maxDimension+1, templateVector);
-
-    if(Av.empty())
-      Av= std::vector<Vector>(maxDimension+1, templateVector);
-
-    AvData.resize(maxDimension*numEqns);
-
-    // The LAPACK least squares subroutine overwrites the RHS vector
-    // with the solution vector ... these vectors are not the same
-    // size, so we need to use the max size
-    rData.resize((numEqns > maxDimension) ? numEqns : maxDimension);
-
-    // Length of work vector should be >= 2*min(numEqns,maxDimension)
-    // See dgels subroutine documentation
-    lwork= 2 * ((numEqns < maxDimension) ? numEqns : maxDimension);
-
-    work.resize(lwork);
+    accelerator.setSize(numEqns);
+    const int maxDimension= accelerator.getMaxDimension();
 
     // Evaluate system residual R(y_0)
     if(theIntegrator->formUnbalance() < 0)
@@ -205,7 +179,7 @@ int XC::KrylovNewton::solveCurrentStep(void)
           }
 
         // Solve least squares A w_{k+1} = r_k
-        if(this->leastSquares(dim) < 0)
+        if(accelerator.leastSquares(dim,theSOE->getX()) < 0)
           {
             std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
                       << "; the Integrator failed in leastSquares()"
@@ -213,7 +187,7 @@ int XC::KrylovNewton::solveCurrentStep(void)
             return -1;
           }
         // Update system with v_k
-        if(theIntegrator->update(v[dim]) < 0)
+        if(theIntegrator->update(accelerator.getCorrection(dim)) < 0)
           {
             std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
                       << "; the Integrator failed in update()"
@@ -262,83 +236,6 @@ int XC::KrylovNewton::recvSelf(const Communicator &comm)
 void XC::KrylovNewton::Print(std::ostream &s, int flag) const
   {
     s << "KrylovNewton";
-    s << "\n\tMax subspace dimension: " << maxDimension;
+    s << "\n\tMax subspace dimension: " << accelerator.getMaxDimension();
     s << "\n\tNumber of equations: " << numEqns << std::endl;
   }
-
-extern "C" int dgels_(char *T, int *M, int *N, int *NRHS,
-                      double *A, int *LDA, double *B, int *LDB,
-                      double *WORK, int *LWORK, int *INFO);
-
-int XC::KrylovNewton::leastSquares(int k)
-  {
-    LinearSOE *theSOE = this->getLinearSOEPtr();
-    const Vector &r = theSOE->getX();
-
-    // v_{k+1} = w_{k+1} + q_{k+1}
-    v[k]= r;
-    Av[k]= r;
-
-    // Subspace is empty
-    if(k == 0)
-      return 0;
-
-    // Compute Av_k = f(y_{k-1}) - f(y_k) = r_{k-1} - r_k
-    Av[k-1].addVector(1.0, r, -1.0);
-
-    // Put subspace vectors into AvData
-    Matrix A(AvData.getDataPtr(), numEqns, k);
-    for(int i = 0; i < k; i++)
-      {
-	Vector &Ai = Av[i];
-	for(int j = 0; j < numEqns; j++)
-	  A(j,i)= Ai(j);
-      }
-
-    // Put residual vector into rData (need to save r for later!)
-    Vector B(rData.getDataPtr(), numEqns);
-    B= r;
-
-    // No transpose
-    char trans[]= "N";
-
-    // The number of right hand side vectors
-    int nrhs = 1;
-
-    // Leading dimension of the right hand side vector
-    int ldb = (numEqns > k) ? numEqns : k;
-
-    // Subroutine error flag
-    int info = 0;
-
-    // Call the LAPACK least squares subroutine
-    dgels_(trans, &numEqns, &k, &nrhs, AvData.getDataPtr(), &numEqns, rData.getDataPtr(), &ldb, work.getDataPtr(), &lwork, &info);
-
-    // Check for error returned by subroutine
-    if(info < 0)
-      {
-	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
-		  << "error code " << info
-		  << " returned by LAPACK dgels."
-	          << Color::def << std::endl;
-	return info;
-      }
-
-    // Compute the correction vector
-    double cj;
-    for(int j = 0; j < k; j++)
-      {
-
-	// Solution to least squares is written to rData
-	cj = rData[j];
-
-	// Compute w_{k+1} = c_1 v_1 + ... + c_k v_k
-	v[k].addVector(1.0, v[j], cj);
-
-	// Compute least squares residual q_{k+1} = r_k - (c_1 Av_1 + ... + c_k Av_k)
-	v[k].addVector(1.0, Av[j], -cj);
-      }
-
-    return 0;
-  }
-
@@ -64,6 +64,7 @@
 // pp. 728-765, May 1998)
 
 #include "EquiSolnAlgo.h"
+#include "KrylovAccelerator.h"
 #include "utility/matrix/Vector.h"
 #include "solution/analysis/integrator/IncrementalIntegrator.h"
 
@@ -86,26 +87,10 @@ class KrylovNewton: public EquiSolnAlgo
   private:
     int tangent;
 
-    // Storage for update vectors
-    std::vector<Vector> v;
-    // Storage for subspace vectors
-    std::vector<Vector> Av;
-
-    // Array data sent to LAPACK subroutine
-    Vector AvData;
-    Vector rData;
-    Vector work;
-
-    // Length of work array
-    int lwork;
+    KrylovAccelerator accelerator; //!< Krylov subspace accelerator.
 
     // Size information
     int numEqns;
-    int maxDimension;
-
-    // Private lsq routine to do Krylov updates
-    // dimension is the current dimension of the subspace
-    int leastSquares(int dimension);
 
     friend class SolutionStrategy;
     friend class FEM_ObjectBroker;
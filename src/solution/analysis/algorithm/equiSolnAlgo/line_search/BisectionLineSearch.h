@@ -84,6 +84,7 @@ namespace XC {
 class BisectionLineSearch: public LineSearch
   {
     friend class NewtonLineSearch;
+    friend class AdaptiveNewton;
     friend class FEM_ObjectBroker;
     BisectionLineSearch(void);
     LineSearch *getCopy(void) const;
@@ -87,6 +87,7 @@ class Vector;
 class RegulaFalsiLineSearch: public LineSearch
   {
     friend class NewtonLineSearch;
+    friend class AdaptiveNewton;
     friend class FEM_ObjectBroker;
     RegulaFalsiLineSearch(void);
     LineSearch *getCopy(void) const;
@@ -81,6 +81,7 @@ class Vector;
 class SecantLineSearch: public LineSearch
   {
     friend class NewtonLineSearch;
+    friend class AdaptiveNewton;
     friend class FEM_ObjectBroker;
     SecantLineSearch(void);
     virtual LineSearch *getCopy(void) const;
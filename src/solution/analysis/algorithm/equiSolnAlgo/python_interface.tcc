@@ -49,4 +49,17 @@ class_<XC::NewtonRaphson, bases<XC::NewtonBased>, boost::noncopyable >("NewtonRa
 
 class_<XC::PeriodicNewton, bases<XC::NewtonBased>, boost::noncopyable >("PeriodicNewton", no_init);
 
+class_<XC::AdaptiveNewton, bases<XC::NewtonBased>, boost::noncopyable >("AdaptiveNewton", no_init)
+  .add_property("refreshRatio", &XC::AdaptiveNewton::getRefreshRatio, &XC::AdaptiveNewton::setRefreshRatio,"contraction ratio of the convergence test norms above which the tangent is formed again (default = 0.5).")
+  .add_property("keepTangent", &XC::AdaptiveNewton::getKeepTangent, &XC::AdaptiveNewton::setKeepTangent,"if true the tangent is kept between steps while the convergence rate is good (default = True).")
+  .add_property("maxDimension", &XC::AdaptiveNewton::getMaxDimension, &XC::AdaptiveNewton::setMaxDimension,"max dimension of the Krylov subspace used to accelerate the iterations with an old tangent; zero disables the acceleration (default = 3).")
+  .def("setLineSearchMethod", &XC::AdaptiveNewton::setLineSearchMethod, "set the line search method to apply after forming the tangent (none, bisection_line_search, initial_interpolated_line_search, regula_falsi_line_search, secant_line_search)")
+  .add_property("numIterations", &XC::AdaptiveNewton::getNumIterations,"return the number of iterations performed.")
+  .add_property("numTangents", &XC::AdaptiveNewton::getNumTangents,"return the number of times the tangent has been formed.")
+  .add_property("numFactorizationsSaved", &XC::AdaptiveNewton::getNumFactorizationsSaved,"return the number of factorizations avoided with respect to the Newton-Raphson method.")
+  .add_property("numLineSearches", &XC::AdaptiveNewton::getNumLineSearches,"return the number of line searches.")
+  .add_property("numRetries", &XC::AdaptiveNewton::getNumRetries,"return the number of times the iterations have been restarted with a new tangent.")
+  .def("resetCounters", &XC::AdaptiveNewton::resetCounters,"reset the counters.")
+  ;
+
 #include "line_search/python_interface.tcc"
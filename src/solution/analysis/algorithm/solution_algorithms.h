@@ -28,6 +28,7 @@
 
 //Headers for the solution algorithms.
 #include "solution/analysis/algorithm/equiSolnAlgo/EquiSolnAlgo.h"
+#include <solution/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/BFGS.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/Broyden.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/KrylovNewton.h>
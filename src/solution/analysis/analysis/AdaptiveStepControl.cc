@@ -0,0 +1,170 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveStepControl.cc
+
+#include "AdaptiveStepControl.h"
+#include <boost/python/dict.hpp>
+#include <algorithm>
+#include <iostream>
+#include "utility/utils/misc_utils/colormod.h"
+
+//! @brief Default constructor.
+XC::AdaptiveStepControl::AdaptiveStepControl(void)
+  : active(false), cutbackFactor(0.5), growthFactor(1.5), minRatio(1.0/1024.0),
+    maxRatio(1.0), growthIterations(3), ratio(1.0), numCutbacks(0), history() {}
+
+//! @brief Set the factor that multiplies the step size when the
+//! step fails (0<f<1).
+void XC::AdaptiveStepControl::setCutbackFactor(const double &f)
+  {
+    if((f>0.0) && (f<1.0))
+      cutbackFactor= f;
+    else
+      std::cerr << Color::red << "AdaptiveStepControl::" << __FUNCTION__
+		<< "; cutback factor must be in (0,1), value: "
+		<< f << " ignored." << Color::def << std::endl;
+  }
+
+//! @brief Set the factor that multiplies the step size when the
+//! step converges with few iterations (f>=1).
+void XC::AdaptiveStepControl::setGrowthFactor(const double &f)
+  {
+    if(f>=1.0)
+      growthFactor= f;
+    else
+      std::cerr << Color::red << "AdaptiveStepControl::" << __FUNCTION__
+		<< "; growth factor must be >= 1, value: "
+		<< f << " ignored." << Color::def << std::endl;
+  }
+
+//! @brief Set the minimum step ratio (0<r<=1).
+void XC::AdaptiveStepControl::setMinRatio(const double &r)
+  {
+    if((r>0.0) && (r<=1.0))
+      minRatio= r;
+    else
+      std::cerr << Color::red << "AdaptiveStepControl::" << __FUNCTION__
+		<< "; minimum ratio must be in (0,1], value: "
+		<< r << " ignored." << Color::def << std::endl;
+  }
+
+//! @brief Set the maximum step ratio (r>=1).
+void XC::AdaptiveStepControl::setMaxRatio(const double &r)
+  {
+    if(r>=1.0)
+      maxRatio= r;
+    else
+      std::cerr << Color::red << "AdaptiveStepControl::" << __FUNCTION__
+		<< "; maximum ratio must be >= 1, value: "
+		<< r << " ignored." << Color::def << std::endl;
+  }
+
+//! @brief Prepare the object for a new call to analyze (the history
+//! is kept until clearHistory is called).
+void XC::AdaptiveStepControl::start(void)
+  {
+    ratio= 1.0;
+    numCutbacks= 0;
+  }
+
+//! @brief Return the ratio to use in the next step, clipped so
+//! the analysis does not go beyond its end.
+//!
+//! @param remaining: remaining part of the analysis (expressed in
+//!                   nominal steps).
+double XC::AdaptiveStepControl::getStepRatio(const double &remaining) const
+  {
+    double retval= ratio;
+    // avoid leaving a tiny step at the end of the analysis.
+    if(retval>=remaining*(1.0-1e-9))
+      retval= remaining;
+    return retval;
+  }
+
+//! @brief Reduce the step after a failure. Return false if the step
+//! can't be reduced any more (the analysis fails).
+bool XC::AdaptiveStepControl::cutback(void)
+  {
+    bool retval= false;
+    if(ratio>minRatio)
+      {
+        ratio= std::max(ratio*cutbackFactor, minRatio);
+	numCutbacks++;
+	retval= true;
+      }
+    return retval;
+  }
+
+//! @brief Register a converged step and increase the step size if it
+//! converged with few iterations.
+//!
+//! @param t: time (or load factor) at the end of the step.
+//! @param r: ratio used in the step.
+//! @param numIter: number of iterations needed to converge.
+void XC::AdaptiveStepControl::stepConverged(const double &t, const double &r, const int &numIter)
+  {
+    history.push_back(StepRecord(t,r,numIter,numCutbacks));
+    // don't grow just after a cutback, the step would fail again.
+    if((numCutbacks==0) && (numIter<=growthIterations))
+      ratio= std::min(ratio*growthFactor, maxRatio);
+    numCutbacks= 0;
+  }
+
+//! @brief Return the total number of iterations in the history.
+int XC::AdaptiveStepControl::getTotalIterations(void) const
+  {
+    int retval= 0;
+    for(std::vector<StepRecord>::const_iterator i= history.begin(); i!=history.end(); i++)
+      retval+= (*i).numIterations;
+    return retval;
+  }
+
+//! @brief Return the total number of cutbacks in the history.
+int XC::AdaptiveStepControl::getTotalCutbacks(void) const
+  {
+    int retval= 0;
+    for(std::vector<StepRecord>::const_iterator i= history.begin(); i!=history.end(); i++)
+      retval+= (*i).numCutbacks;
+    return retval;
+  }
+
+//! @brief Return the step history in a Python list of dictionaries
+//! with keys: time, ratio, numIterations and numCutbacks.
+boost::python::list XC::AdaptiveStepControl::getHistoryPy(void) const
+  {
+    boost::python::list retval;
+    for(std::vector<StepRecord>::const_iterator i= history.begin(); i!=history.end(); i++)
+      {
+        boost::python::dict d;
+	d["time"]= (*i).time;
+	d["ratio"]= (*i).ratio;
+	d["numIterations"]= (*i).numIterations;
+	d["numCutbacks"]= (*i).numCutbacks;
+	retval.append(d);
+      }
+    return retval;
+  }
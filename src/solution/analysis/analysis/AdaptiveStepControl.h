@@ -0,0 +1,116 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveStepControl.h
+
+#ifndef AdaptiveStepControl_h
+#define AdaptiveStepControl_h
+
+#include <vector>
+#include <boost/python/list.hpp>
+
+namespace XC {
+
+//! @ingroup AnalysisType
+//
+//! @brief Automatic step size control with cutback for the incremental
+//! analyses (static and direct integration ones).
+//!
+//! The step size is expressed as a ratio with respect to the nominal
+//! step (load increment of the integrator or time step passed to
+//! analyze). When a step fails to converge the domain is reverted to the
+//! last commit and the ratio is multiplied by the cutback factor (i.e.
+//! the step is bisected with the default value). When a step converges
+//! with few iterations the ratio is increased by the growth factor up
+//! to the maximum ratio.
+class AdaptiveStepControl
+  {
+  public:
+    //! @brief Record of a converged step.
+    struct StepRecord
+      {
+        double time; //!< pseudo-time (load factor) or time at the end of the step.
+        double ratio; //!< step size relative to the nominal one.
+        int numIterations; //!< number of iterations needed to converge.
+        int numCutbacks; //!< number of failed attempts before convergence.
+        StepRecord(const double &t, const double &r, const int &ni, const int &nc)
+	  : time(t), ratio(r), numIterations(ni), numCutbacks(nc) {}
+      };
+  private:
+    bool active; //!< if true, use adaptive step control.
+    double cutbackFactor; //!< factor that multiplies the step on failure.
+    double growthFactor; //!< factor that multiplies the step on easy convergence.
+    double minRatio; //!< minimum value of the step ratio.
+    double maxRatio; //!< maximum value of the step ratio.
+    int growthIterations; //!< maximum number of iterations to grow the step.
+
+    double ratio; //!< current step ratio.
+    int numCutbacks; //!< number of consecutive cutbacks in the current step.
+    std::vector<StepRecord> history; //!< converged steps.
+  public:
+    AdaptiveStepControl(void);
+
+    inline bool isActive(void) const
+      { return active; }
+    inline void setActive(const bool &b)
+      { active= b; }
+    inline double getCutbackFactor(void) const
+      { return cutbackFactor; }
+    void setCutbackFactor(const double &);
+    inline double getGrowthFactor(void) const
+      { return growthFactor; }
+    void setGrowthFactor(const double &);
+    inline double getMinRatio(void) const
+      { return minRatio; }
+    void setMinRatio(const double &);
+    inline double getMaxRatio(void) const
+      { return maxRatio; }
+    void setMaxRatio(const double &);
+    inline int getGrowthIterations(void) const
+      { return growthIterations; }
+    inline void setGrowthIterations(const int &i)
+      { growthIterations= i; }
+
+    void start(void);
+    double getStepRatio(const double &) const;
+    bool cutback(void);
+    void stepConverged(const double &, const double &, const int &);
+
+    inline const std::vector<StepRecord> &getHistory(void) const
+      { return history; }
+    inline size_t getNumSteps(void) const
+      { return history.size(); }
+    int getTotalIterations(void) const;
+    int getTotalCutbacks(void) const;
+    inline void clearHistory(void)
+      { history.clear(); }
+    boost::python::list getHistoryPy(void) const;
+  };
+
+} // end of XC namespace
+
+#endif
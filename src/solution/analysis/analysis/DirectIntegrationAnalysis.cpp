@@ -141,6 +141,12 @@ int XC::DirectIntegrationAnalysis::initialize(void)
     return 0;
   }
 
+//! @brief Run the analysis for each of the records and scale
+//! factors of the ground motion batch, starting always from the
+//! current state of the model (see GroundMotionBatch).
+int XC::DirectIntegrationAnalysis::analyzeGroundMotionBatch(void)
+  { return groundMotionBatch.run(*this); }
+
 //! @brief Performs the analysis.
 //!
 //! @param numSteps: number of steps in the analysis.
@@ -160,6 +166,12 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
     assert(solution_strategy);
     CommandEntity *old= solution_strategy->Owner();
     solution_strategy->set_owner(this);
+    if(stepControl.isActive())
+      {
+        result= analyze_adaptive(numSteps, dT);
+        solution_strategy->set_owner(old);
+        return result;
+      }
     Domain *the_Domain = solution_strategy->getDomainPtr();
     for(int i=0; i<numSteps; i++)
       {
@@ -246,6 +258,103 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
     return result;
   }
 
+//! @brief Try to perform a time step of size \p dt.
+//!
+//! On failure the domain and the integrator are reverted to the last
+//! committed state (so the step can be tried again with a smaller
+//! size) and a negative number is returned (-1 means the analysis can't
+//! go on whatever the step size).
+int XC::DirectIntegrationAnalysis::try_adaptive_step(const double &dt)
+  {
+    Domain *the_Domain= solution_strategy->getDomainPtr();
+    TransientIntegrator *theIntegrator= solution_strategy->getTransientIntegratorPtr();
+    if(newStepDomain(solution_strategy->getModelWrapperPtr()->getAnalysisModelPtr(),dt) < 0)
+      {
+	the_Domain->revertToLastCommit();
+	return -2;
+      }
+    if(checkDomainChange() < 0)
+      {
+	the_Domain->revertToLastCommit();
+	return -1;
+      }
+    int result= theIntegrator->newStep(dt);
+    if(result < 0)
+      result= -2;
+    else
+      {
+        result= solution_strategy->getEquiSolutionAlgorithmPtr()->solveCurrentStep();
+	if(result < 0)
+	  result= -3;
+      }
+// AddingSensitivity:BEGIN ////////////////////////////////////
+#ifdef _RELIABILITY
+    if((result>=0) && theSensitivityAlgorithm)
+      {
+	if(theSensitivityAlgorithm->computeSensitivities() < 0)
+	  result= -5;
+      }
+#endif
+// AddingSensitivity:END //////////////////////////////////////
+    if(result>=0)
+      {
+        result= theIntegrator->commit();
+	if(result < 0)
+	  result= -4;
+      }
+    if(result < 0)
+      {
+	the_Domain->revertToLastCommit();	    
+	theIntegrator->revertToLastStep();
+      }
+    return result;
+  }
+
+//! @brief Performs the analysis using adaptive time step control.
+//!
+//! The analysis covers the time interval numSteps*dT. When a step fails
+//! the state is reverted to the last commit and the time step is cut
+//! back; when it converges with few iterations the next time step
+//! grows (see AdaptiveStepControl).
+//!
+//! @param numSteps: number of nominal steps in the analysis.
+//! @param dT: nominal time increment.
+int XC::DirectIntegrationAnalysis::analyze_adaptive(int numSteps, double dT)
+  {
+    const ConvergenceTest *theTest= getConvergenceTestPtr();
+    Domain *the_Domain= solution_strategy->getDomainPtr();
+    stepControl.start();
+    int result= 0;
+    double progress= 0.0; // number of nominal steps performed.
+    while(progress<numSteps)
+      {
+        const double remaining= numSteps-progress;
+        const double ratio= stepControl.getStepRatio(remaining);
+	result= try_adaptive_step(ratio*dT);
+	if(result == -1) // can't go on.
+	  break;
+	else if(result < 0)
+	  {
+	    if(!stepControl.cutback())
+	      {
+		std::cerr << getClassName() << "::" << __FUNCTION__
+			  << "; the step failed with the minimum size ratio: "
+			  << ratio << " at time "
+			  << the_Domain->getTimeTracker().getCurrentTime()
+			  << std::endl;
+		break;
+	      }
+	  }
+	else
+	  {
+	    progress= (ratio<remaining) ? progress+ratio : numSteps;
+	    const int numIter= (theTest ? theTest->getNumTests() : 1);
+	    stepControl.stepConverged(the_Domain->getTimeTracker().getCurrentTime(), ratio, numIter);
+	  }
+      }
+    return result;
+  }
+
 //! @brief Execute the changes following a change in the domain.
 //!
 //! This is a method invoked by a domain which indicates to the analysis
@@ -65,6 +65,8 @@
 // What: "@(#) DirectIntegrationAnalysis.h, revA"
 
 #include <solution/analysis/analysis/TransientAnalysis.h>
+#include <solution/analysis/analysis/AdaptiveStepControl.h>
+#include <solution/analysis/analysis/GroundMotionBatch.h>
 
 namespace XC {
 class ConvergenceTest;
@@ -86,12 +88,17 @@ class DirectIntegrationAnalysis: public TransientAnalysis
   {
   private:
     int domainStamp;
+    AdaptiveStepControl stepControl; //!< adaptive time step control.
+    GroundMotionBatch groundMotionBatch; //!< suite of ground motions to analyze.
     // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
     SensitivityAlgorithm *theSensitivityAlgorithm;
 #endif
     // AddingSensitivity:END ///////////////////////////////
   protected:
+    int try_adaptive_step(const double &);
+    int analyze_adaptive(int numSteps, double dT);
+
     friend class SolutionProcedure;
     DirectIntegrationAnalysis(SolutionStrategy *analysis_aggregation);
     Analysis *getCopy(void) const;
@@ -102,6 +109,19 @@ class DirectIntegrationAnalysis: public TransientAnalysis
 
     int analyze(int numSteps, double dT);
     int initialize(void);
+    //! @brief Return the adaptive time step control.
+    inline AdaptiveStepControl &getAdaptiveStepControl(void)
+      { return stepControl; }
+    //! @brief Return the adaptive time step control.
+    inline const AdaptiveStepControl &getAdaptiveStepControl(void) const
+      { return stepControl; }
+    //! @brief Return the ground motion batch.
+    inline GroundMotionBatch &getGroundMotionBatch(void)
+      { return groundMotionBatch; }
+    //! @brief Return the ground motion batch.
+    inline const GroundMotionBatch &getGroundMotionBatch(void) const
+      { return groundMotionBatch; }
+    int analyzeGroundMotionBatch(void);
 
     int domainChanged(void);
 
@@ -0,0 +1,383 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//GroundMotionBatch.cc
+
+#include "GroundMotionBatch.h"
+#include "DirectIntegrationAnalysis.h"
+#include "solution/analysis/integrator/TransientIntegrator.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/load/pattern/load_patterns/UniformExcitation.h"
+#include "domain/load/groundMotion/GroundMotionRecord.h"
+#include "domain/load/pattern/time_series/PathSeries.h"
+#include "utility/recorder/EnvelopeData.h"
+#include "forked_worker.h"
+#include "utility/utils/misc_utils/colormod.h"
+#include <cmath>
+#include <unistd.h>
+#include <sys/wait.h>
+
+//! @brief Name of the snapshot that stores the initial state.
+static const std::string batch_snapshot_name= "ground_motion_batch_initial_state";
+
+//! @brief Constructor.
+XC::GroundMotionBatch::GroundMotionBatch(void)
+  : pattern(nullptr), records(), scaleFactors(1), nodeTags(),
+    responseType("disp"), analysisTimeStep(0.0), numberOfWorkers(1)
+  { scaleFactors(0)= 1.0; }
+
+//! @brief Append a ground acceleration record.
+//! @param accel: acceleration values.
+//! @param dt: time step of the record.
+void XC::GroundMotionBatch::addRecord(const Vector &accel, const double &dt)
+  {
+    if(dt<=0.0)
+      std::cerr << Color::red << "GroundMotionBatch::" << __FUNCTION__
+                << "; the time step must be positive; record ignored."
+                << Color::def << std::endl;
+    else
+      records.push_back(Record(accel, dt));
+  }
+
+//! @brief Remove the records and the results.
+void XC::GroundMotionBatch::clearRecords(void)
+  {
+    records.clear();
+    envelopes.clear();
+    status.clear();
+  }
+
+//! @brief Set the type of the response to compute the envelopes for.
+//! @param t: disp, vel or accel.
+void XC::GroundMotionBatch::setResponseType(const std::string &t)
+  {
+    if((t=="disp") || (t=="vel") || (t=="accel"))
+      responseType= t;
+    else
+      std::cerr << Color::red << "GroundMotionBatch::" << __FUNCTION__
+                << "; unknown response type: '" << t
+                << "'. Valid values are disp, vel and accel."
+                << Color::def << std::endl;
+  }
+
+//! @brief Return the number of values in the envelope (sum of the
+//! number of DOFs of the nodes).
+size_t XC::GroundMotionBatch::getNumColumns(const Domain &dom) const
+  {
+    size_t retval= 0;
+    const int numNodes= nodeTags.Size();
+    for(int i= 0;i<numNodes;i++)
+      {
+        const Node *theNode= dom.getNode(nodeTags(i));
+        if(theNode)
+          retval+= theNode->getNumberDOF();
+        else
+          std::cerr << Color::red << "GroundMotionBatch::" << __FUNCTION__
+                    << "; node: " << nodeTags(i) << " not found."
+                    << Color::def << std::endl;
+      }
+    return retval;
+  }
+
+//! @brief Put the committed response of the nodes in the vector.
+void XC::GroundMotionBatch::get_response(const Domain &dom, Vector &values) const
+  {
+    int cnt= 0;
+    const int numNodes= nodeTags.Size();
+    for(int i= 0;i<numNodes;i++)
+      {
+        const Node *theNode= dom.getNode(nodeTags(i));
+        if(theNode)
+          {
+            const Vector &r= (responseType=="vel") ? theNode->getVel() : ((responseType=="accel") ? theNode->getAccel() : theNode->getDisp());
+            const int sz= r.Size();
+            for(int j= 0;j<sz;j++,cnt++)
+              values(cnt)= r(j);
+          }
+      }
+  }
+
+//! @brief Make the pattern apply the given record scaled by
+//! the given factor, starting at the current time of the domain.
+int XC::GroundMotionBatch::set_record(const Record &rec, const double &startTime) const
+  {
+    GroundMotionRecord *gmr= dynamic_cast<GroundMotionRecord *>(&pattern->getGroundMotionRecord());
+    if(!gmr)
+      {
+        std::cerr << Color::red << "GroundMotionBatch::" << __FUNCTION__
+                  << "; the ground motion of the pattern is not a record."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    const PathSeries accelSeries(rec.accel, rec.dt, 1.0, false, false, startTime);
+    MotionHistory &history= gmr->getHistory();
+    history.setAccelHistory(&accelSeries);
+    history.setDelta(rec.dt);
+    return 0;
+  }
+
+//! @brief Run the analysis that corresponds to the given index
+//! (record index times the number of scale factors plus the scale
+//! factor index) from the initial state.
+//! @param analysis: direct integration analysis.
+//! @param runIndex: index of the run.
+//! @param envelope: envelope of the nodal response (returned).
+int XC::GroundMotionBatch::run_one(DirectIntegrationAnalysis &analysis, const size_t &runIndex, Matrix &envelope) const
+  {
+    Domain *dom= analysis.getDomainPtr();
+    const size_t numScales= scaleFactors.Size();
+    const Record &rec= records[runIndex/numScales];
+    const double factor= scaleFactors(runIndex%numScales);
+
+    // Back to the initial state.
+    int retval= dom->restoreSnapshot(batch_snapshot_name);
+    if(retval<0)
+      return retval;
+    retval= analysis.checkDomainChange();
+    if(retval<0)
+      return retval;
+    analysis.getTransientIntegratorPtr()->domainChanged(); // read the restored state.
+
+    const double baseFactor= pattern->getFactor();
+    retval= set_record(rec, dom->getTimeTracker().getCurrentTime());
+    if(retval<0)
+      return retval;
+    pattern->setFactor(baseFactor*factor);
+
+    const double dt= (analysisTimeStep>0.0) ? analysisTimeStep : rec.dt;
+    const double duration= (rec.accel.Size()-1)*rec.dt;
+    const int numSteps= std::max(int(ceil(duration/dt-1e-9)),0);
+    const size_t numColumns= getNumColumns(*dom);
+    EnvelopeData env;
+    env.setup(numColumns);
+    Vector values(numColumns);
+    for(int i= 0;i<numSteps;i++)
+      {
+        retval= analysis.analyze(1, dt);
+        if(retval<0)
+          break;
+        get_response(*dom, values);
+        env.update(values);
+      }
+    envelope= *env.getData();
+    pattern->setFactor(baseFactor);
+    return retval;
+  }
+
+//! @brief Run the analyses in this process.
+int XC::GroundMotionBatch::run_serial(DirectIntegrationAnalysis &analysis)
+  {
+    int retval= 0;
+    const size_t numRuns= getNumRuns();
+    for(size_t i= 0;i<numRuns;i++)
+      {
+        status[i]= run_one(analysis, i, envelopes[i]);
+        if(status[i]<0)
+          retval= -1;
+      }
+    return retval;
+  }
+
+//! @brief Distribute the runs among forked processes that send
+//! back the results through pipes (see setup_forked_worker).
+int XC::GroundMotionBatch::run_parallel(DirectIntegrationAnalysis &analysis)
+  {
+    const size_t numRuns= getNumRuns();
+    const size_t numWorkers= std::min(size_t(numberOfWorkers), numRuns);
+    const size_t numColumns= getNumColumns(*analysis.getDomainPtr());
+    const size_t recordSize= 1+3*numColumns; // status + envelope.
+    std::vector<pid_t> pids(numWorkers,-1);
+    std::vector<int> fds(numWorkers,-1);
+    std::cout.flush(); std::cerr.flush();
+    for(size_t w= 0; w<numWorkers; w++)
+      {
+        int fd[2];
+        if(pipe(fd)!=0)
+          continue; // computed by the parent below.
+        const pid_t pid= fork();
+        if(pid==0) // worker process.
+          {
+            close(fd[0]);
+            setup_forked_worker();
+            std::vector<double> record(recordSize);
+            Matrix envelope(3,numColumns);
+            for(size_t i= w; i<numRuns; i+= numWorkers)
+              {
+                record[0]= run_one(analysis, i, envelope);
+                for(size_t j= 0;j<numColumns;j++)
+                  for(size_t k= 0;k<3;k++)
+                    record[1+3*j+k]= (envelope.noCols()==int(numColumns)) ? envelope(k,j) : 0.0;
+                const char *buf= reinterpret_cast<const char *>(record.data());
+                size_t remaining= recordSize*sizeof(double);
+                while(remaining>0)
+                  {
+                    const ssize_t n= write(fd[1], buf, remaining);
+                    if(n<=0)
+                      _exit(1);
+                    buf+= n; remaining-= n;
+                  }
+              }
+            close(fd[1]);
+            _exit(0);
+          }
+        close(fd[1]);
+        if(pid<0)
+          close(fd[0]);
+        else
+          {
+            pids[w]= pid;
+            fds[w]= fd[0];
+          }
+      }
+
+    int retval= 0;
+    std::vector<double> record(recordSize);
+    for(size_t w= 0; w<numWorkers; w++)
+      {
+        for(size_t i= w; i<numRuns; i+= numWorkers)
+          {
+            bool received= false;
+            if(fds[w]>=0)
+              {
+                char *buf= reinterpret_cast<char *>(record.data());
+                size_t remaining= recordSize*sizeof(double);
+                while(remaining>0)
+                  {
+                    const ssize_t n= read(fds[w], buf, remaining);
+                    if(n<=0)
+                      break;
+                    buf+= n; remaining-= n;
+                  }
+                received= (remaining==0);
+              }
+            if(received)
+              {
+                status[i]= int(record[0]);
+                envelopes[i]= Matrix(3,numColumns);
+                for(size_t j= 0;j<numColumns;j++)
+                  for(size_t k= 0;k<3;k++)
+                    envelopes[i](k,j)= record[1+3*j+k];
+              }
+            else // worker not available or failed: run here.
+              status[i]= run_one(analysis, i, envelopes[i]);
+            if(status[i]<0)
+              retval= -1;
+          }
+        if(fds[w]>=0)
+          close(fds[w]);
+        if(pids[w]>0)
+          {
+            int wstatus= 0;
+            waitpid(pids[w], &wstatus, 0);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Run the analysis for each record and scale factor
+//! starting from the current state of the domain, that is
+//! restored at the end.
+int XC::GroundMotionBatch::run(DirectIntegrationAnalysis &analysis)
+  {
+    if(!pattern)
+      {
+        std::cerr << Color::red << "GroundMotionBatch::" << __FUNCTION__
+                  << "; uniform excitation pattern not set."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    GroundMotionRecord *gmr= dynamic_cast<GroundMotionRecord *>(&pattern->getGroundMotionRecord());
+    Domain *dom= analysis.getDomainPtr();
+    if(!gmr || !dom)
+      {
+        std::cerr << Color::red << "GroundMotionBatch::" << __FUNCTION__
+                  << "; domain or ground motion record not available."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    const size_t numRuns= getNumRuns();
+    envelopes.assign(numRuns, Matrix());
+    status.assign(numRuns, 0);
+    if(numRuns==0)
+      return 0;
+    const MotionHistory initialHistory= gmr->getHistory();
+    int retval= dom->saveSnapshot(batch_snapshot_name);
+    if(retval<0)
+      return retval;
+
+    if(numberOfWorkers>1)
+      retval= run_parallel(analysis);
+    else
+      retval= run_serial(analysis);
+
+    // Leave the model as it was.
+    gmr->getHistory()= initialHistory;
+    if(dom->restoreSnapshot(batch_snapshot_name)>=0)
+      {
+        analysis.checkDomainChange();
+        analysis.getTransientIntegratorPtr()->domainChanged();
+      }
+    dom->removeSnapshot(batch_snapshot_name);
+    return retval;
+  }
+
+//! @brief Return the envelope (rows: minimum, maximum and maximum
+//! absolute value) computed for the given record and scale factor.
+const XC::Matrix &XC::GroundMotionBatch::getEnvelope(const size_t &iRecord, const size_t &iScale) const
+  {
+    static const Matrix empty;
+    const size_t i= iRecord*scaleFactors.Size()+iScale;
+    if((iScale<size_t(scaleFactors.Size())) && (i<envelopes.size()))
+      return envelopes[i];
+    std::cerr << Color::red << "GroundMotionBatch::" << __FUNCTION__
+              << "; no results for record: " << iRecord
+              << " and scale factor: " << iScale << "."
+              << Color::def << std::endl;
+    return empty;
+  }
+
+//! @brief Return the result of the analysis for the given record
+//! and scale factor (negative if it failed).
+int XC::GroundMotionBatch::getStatus(const size_t &iRecord, const size_t &iScale) const
+  {
+    const size_t i= iRecord*scaleFactors.Size()+iScale;
+    if((iScale<size_t(scaleFactors.Size())) && (i<status.size()))
+      return status[i];
+    return -1;
+  }
+
+//! @brief Return the peak absolute value of the response for the
+//! given record and scale factor.
+double XC::GroundMotionBatch::getPeak(const size_t &iRecord, const size_t &iScale) const
+  {
+    double retval= 0.0;
+    const Matrix &env= getEnvelope(iRecord, iScale);
+    if(env.noRows()>2)
+      for(int j= 0;j<env.noCols();j++)
+        retval= std::max(retval, env(2,j));
+    return retval;
+  }
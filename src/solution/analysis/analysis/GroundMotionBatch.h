@@ -0,0 +1,134 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//GroundMotionBatch.h
+
+#ifndef GroundMotionBatch_h
+#define GroundMotionBatch_h
+
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include <vector>
+#include <string>
+
+namespace XC {
+class DirectIntegrationAnalysis;
+class UniformExcitation;
+class Domain;
+
+//! @ingroup AnalysisType
+//
+//! @brief Runs the direct integration analysis of the same model for
+//! a suite of ground motion records (and intensity levels), starting
+//! each run from the same initial state.
+//!
+//! The initial state is stored in a domain snapshot before the first
+//! run and restored before each one of them. For each run (record and
+//! scale factor) the envelope (minimum, maximum and maximum absolute
+//! value) of the selected response of the given nodes is stored.
+//! If the number of workers is greater than one, the runs are
+//! distributed among forked copies of the process (each one with its
+//! own copy of the domain) that send back the envelopes through pipes.
+//! fork() copies only the calling thread, so the workers don't invoke
+//! the recorders (their output is written only by the runs performed
+//! in the parent process) and
+//! run the OpenMP regions with a single thread. Other threads started
+//! by the parent (e.g. from Python) are not available in the workers,
+//! so the analysis must not depend on them.
+class GroundMotionBatch
+  {
+  public:
+    //! @brief Ground acceleration record.
+    struct Record
+      {
+        Vector accel; //!< acceleration values.
+        double dt; //!< time step of the record.
+        Record(const Vector &a, const double &t)
+          : accel(a), dt(t) {}
+      };
+  private:
+    UniformExcitation *pattern; //!< pattern that applies the records.
+    std::vector<Record> records; //!< ground acceleration records.
+    Vector scaleFactors; //!< intensity levels.
+    ID nodeTags; //!< nodes to compute the envelopes for.
+    std::string responseType; //!< disp, vel or accel.
+    double analysisTimeStep; //!< if not positive, use the record time step.
+    int numberOfWorkers; //!< number of processes used to run the analyses.
+
+    std::vector<Matrix> envelopes; //!< envelope for each run.
+    std::vector<int> status; //!< result of each run (0: ok).
+
+    size_t getNumColumns(const Domain &) const;
+    void get_response(const Domain &, Vector &) const;
+    int set_record(const Record &, const double &) const;
+    int run_one(DirectIntegrationAnalysis &, const size_t &, Matrix &) const;
+    int run_serial(DirectIntegrationAnalysis &);
+    int run_parallel(DirectIntegrationAnalysis &);
+  public:
+    GroundMotionBatch(void);
+
+    inline void setPattern(UniformExcitation *p)
+      { pattern= p; }
+    inline UniformExcitation *getPattern(void)
+      { return pattern; }
+    void addRecord(const Vector &, const double &);
+    inline size_t getNumRecords(void) const
+      { return records.size(); }
+    void clearRecords(void);
+    inline const Vector &getScaleFactors(void) const
+      { return scaleFactors; }
+    inline void setScaleFactors(const Vector &v)
+      { scaleFactors= v; }
+    inline const ID &getNodeTags(void) const
+      { return nodeTags; }
+    inline void setNodeTags(const ID &tags)
+      { nodeTags= tags; }
+    inline const std::string &getResponseType(void) const
+      { return responseType; }
+    void setResponseType(const std::string &);
+    inline double getAnalysisTimeStep(void) const
+      { return analysisTimeStep; }
+    inline void setAnalysisTimeStep(const double &dt)
+      { analysisTimeStep= dt; }
+    inline int getNumberOfWorkers(void) const
+      { return numberOfWorkers; }
+    inline void setNumberOfWorkers(const int &n)
+      { numberOfWorkers= std::max(n,1); }
+
+    inline size_t getNumRuns(void) const
+      { return records.size()*scaleFactors.Size(); }
+    int run(DirectIntegrationAnalysis &);
+
+    const Matrix &getEnvelope(const size_t &, const size_t &) const;
+    int getStatus(const size_t &, const size_t &) const;
+    double getPeak(const size_t &, const size_t &) const;
+  };
+
+} // end of XC namespace
+
+#endif
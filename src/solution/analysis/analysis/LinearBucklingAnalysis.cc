@@ -73,6 +73,7 @@ int XC::LinearBucklingAnalysis::analyze(int numSteps)
     CommandEntity *oldE= eigen_solu->Owner();
     eigen_solu->set_owner(this);
     linearBucklingEigenAnalysis.set_owner(getSolutionProcedure());
+    getDomainPtr()->modelChange(); // the model may have been modified since the last call.
 
     int result = 0;
 
@@ -33,10 +33,18 @@
 
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include "solution/system_of_eqn/eigenSOE/EigenSOE.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/DOF_GrpIter.h"
+#include "solution/analysis/model/dof_grp/DOF_Group.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/node/Node.h"
+#include "utility/utils/misc_utils/colormod.h"
 
 //! @brief Constructor.
 XC::ModalAnalysis::ModalAnalysis(SolutionStrategy *analysis_aggregation)
-  :EigenAnalysis(analysis_aggregation), espectro() {}
+  :EigenAnalysis(analysis_aggregation), espectro(), modalResponse() {}
 
 //! @brief Returns the acceleration that corresponds to the period
 //! being passed as parameter.
@@ -90,3 +98,168 @@ XC::Matrix XC::ModalAnalysis::getCQCModalCrossCorrelationCoefficients(const Vect
     return retval;
   }
 
+
+//! @brief Return the influence vector for a ground motion acting
+//! along the given degree of freedom (ones in the equations that
+//! correspond to that DOF in every node).
+//! @param dof: index of the degree of freedom.
+XC::Vector XC::ModalAnalysis::getInfluenceVector(const int &dof) const
+  {
+    AnalysisModel *theModel= getAnalysisModelPtr();
+    Vector retval;
+    if(theModel)
+      {
+        retval.resize(theModel->getNumEqn());
+        retval.Zero();
+        DOF_GrpIter &theDOFGrps= theModel->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while((dofPtr= theDOFGrps()) != nullptr)
+          {
+            if(dofPtr->getNodeTag()<0) // Lagrange multipliers.
+              continue;
+            const ID &id= dofPtr->getID();
+            if(dof<id.Size())
+              {
+                const int eq= id(dof);
+                if(eq>=0)
+                  retval(eq)= 1.0;
+              }
+          }
+      }
+    else
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; analysis model not set."
+                << Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Return the participation factors of the computed modes
+//! for an excitation along the given degree of freedom:
+//! \f$\Gamma_i= \phi_i^T M r/\phi_i^T M \phi_i\f$.
+//! @param dof: index of the degree of freedom.
+XC::Vector XC::ModalAnalysis::getParticipationFactors(const int &dof) const
+  {
+    const int nm= getNumModes();
+    Vector retval(nm);
+    const EigenSOE *ptr_soe= getEigenSOEPtr();
+    if(ptr_soe)
+      {
+        const Vector r= getInfluenceVector(dof);
+        for(int i= 1;i<=nm;i++)
+          {
+            const Vector &phi= ptr_soe->getEigenvector(i);
+            const Vector Mphi= ptr_soe->getMassProduct(phi);
+            const double m= phi^Mphi;
+            if(m!=0.0)
+              retval(i-1)= (Mphi^r)/m;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Compute the response history of the structure for the
+//! ground acceleration record being passed as parameter using the
+//! modes computed previously (see analyze). The structure must be
+//! linear.
+//! @param accel: ground acceleration values (one for each time step).
+//! @param dt: time step of the record.
+//! @param dof: index of the degree of freedom excited by the record.
+//! @param zetas: damping ratio for each mode (if there are less values
+//!              than modes the last one is repeated).
+//! @param method: integration method of the modal equations
+//!                (piecewise_linear or newmark).
+int XC::ModalAnalysis::computeGroundMotionResponse(const Vector &accel, const double &dt, const int &dof, const Vector &zetas, const std::string &method)
+  {
+    const int nm= getNumModes();
+    if(nm<1)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; no modes computed yet; call analyze first."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    modalResponse.setup(getAngularFrequencies(), zetas, getParticipationFactors(dof));
+    return modalResponse.integrate(accel, dt, method);
+  }
+
+//! @brief Return the relative displacement history (with respect to the
+//! ground) of the given node and degree of freedom.
+//! @param nodeTag: identifier of the node.
+//! @param dof: index of the degree of freedom.
+XC::Vector XC::ModalAnalysis::getNodeDispHistory(const int &nodeTag, const int &dof) const
+  {
+    const size_t numSteps= modalResponse.getNumSteps();
+    Vector retval(numSteps);
+    const Domain *dom= getDomainPtr();
+    const Node *theNode= (dom ? dom->getNode(nodeTag) : nullptr);
+    if(theNode)
+      {
+        const Matrix &q= modalResponse.getModalDisplacements();
+        const int nm= std::min(int(modalResponse.getNumModes()),theNode->getNumModes());
+        for(int i= 0;i<nm;i++)
+          {
+            const Vector ev= theNode->getEigenvector(i+1);
+            if(dof<ev.Size())
+              {
+                const double phi= ev(dof);
+                if(phi!=0.0)
+                  for(size_t j= 0;j<numSteps;j++)
+                    retval(j)+= phi*q(j,i);
+              }
+          }
+      }
+    else
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; node: " << nodeTag << " not found."
+                << Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Put the (relative) displacements and velocities that correspond
+//! to the given time step of the modal response in the domain and
+//! commit its state, so the element responses can be recovered (and
+//! the recorders are called).
+//! @param step: index of the time step.
+int XC::ModalAnalysis::updateDomain(const int &step)
+  {
+    if((step<0) || (size_t(step)>=modalResponse.getNumSteps()))
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; step: " << step << " out of range [0,"
+                  << modalResponse.getNumSteps() << ")."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    AnalysisModel *theModel= getAnalysisModelPtr();
+    const EigenSOE *ptr_soe= getEigenSOEPtr();
+    if(!theModel || !ptr_soe)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; analysis model or eigen SOE not set."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    const Vector q= modalResponse.getModalDisplacements(step);
+    const Vector dq= modalResponse.getModalVelocities(step);
+    const int numEqn= theModel->getNumEqn();
+    Vector U(numEqn), V(numEqn);
+    const int nm= q.Size();
+    for(int i= 0;i<nm;i++)
+      {
+        const Vector &phi= ptr_soe->getEigenvector(i+1);
+        U.addVector(1.0,phi,q(i));
+        V.addVector(1.0,phi,dq(i));
+      }
+    theModel->setDisp(U);
+    theModel->setVel(V);
+    int retval= -1;
+    Domain *dom= getDomainPtr();
+    if(dom)
+      {
+        dom->setCurrentTime(step*modalResponse.getTimeStep());
+        retval= dom->update();
+        if(retval>=0)
+          retval= dom->commit(); // the recorders are called here.
+      }
+    return retval;
+  }
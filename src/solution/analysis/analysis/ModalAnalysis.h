@@ -33,6 +33,7 @@
 
 #include "EigenAnalysis.h"
 #include "utility/geom/d1/function_from_points/FunctionFromPointsR_R.h"
+#include "ModalSuperposition.h"
 
 namespace XC {
 class Matrix;
@@ -40,10 +41,20 @@ class Matrix;
 //! @ingroup AnalysisType
 //
 //! @brief Modal analysis.
+//!
+//! Besides the response spectrum computations, once the modes
+//! are obtained this object can compute the response history of the
+//! structure under a ground acceleration record by modal superposition
+//! (the structure must be linear). The reduced system is integrated
+//! for each record and the physical response is recovered only for
+//! the nodes (or the time steps) where it's needed.
 class ModalAnalysis: public EigenAnalysis
   {
   protected:
     FunctionFromPointsR_R espectro;
+    ModalSuperposition modalResponse; //!< modal response history.
+
+    Vector getInfluenceVector(const int &) const;
 
     friend class SolutionProcedure;
     ModalAnalysis(SolutionStrategy *analysis_aggregation);
@@ -60,6 +71,14 @@ class ModalAnalysis: public EigenAnalysis
 
     //Equivalent static load.
     Vector getEquivalentStaticLoad(int mode) const;
+
+    //Modal superposition.
+    Vector getParticipationFactors(const int &) const;
+    int computeGroundMotionResponse(const Vector &, const double &, const int &, const Vector &, const std::string &method= "piecewise_linear");
+    inline const ModalSuperposition &getModalResponse(void) const
+      { return modalResponse; }
+    Vector getNodeDispHistory(const int &, const int &) const;
+    int updateDomain(const int &);
   };
 
 } // end of XC namespace
@@ -0,0 +1,219 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalSuperposition.cc
+
+#include "ModalSuperposition.h"
+#include "utility/utils/misc_utils/colormod.h"
+#include <cmath>
+
+//! @brief Constructor.
+XC::ModalSuperposition::ModalSuperposition(void)
+  : omegas(), zetas(), gammas(), dt(0.0), disp(), vel() {}
+
+//! @brief Set the properties of the reduced system.
+//! @param w: angular frequencies of the modes.
+//! @param z: damping ratios of the modes.
+//! @param g: participation factors for the excitation direction.
+void XC::ModalSuperposition::setup(const Vector &w, const Vector &z, const Vector &g)
+  {
+    omegas= w;
+    gammas= g;
+    const int nm= omegas.Size();
+    zetas= Vector(nm);
+    const int nz= z.Size();
+    for(int i= 0;i<nm;i++)
+      zetas(i)= (i<nz) ? z(i) : (nz>0 ? z(nz-1) : 0.0); // repeat the last value.
+    clear();
+  }
+
+//! @brief Remove the computed response.
+void XC::ModalSuperposition::clear(void)
+  {
+    disp= Matrix();
+    vel= Matrix();
+  }
+
+//! @brief Exact integration of the i-th mode equation assuming the
+//! excitation varies linearly between time steps (Nigam-Jennings
+//! recurrence, see table 5.2.1 of the book "Dynamics of Structures" from
+//! A. K. Chopra). 
+void XC::ModalSuperposition::integrate_piecewise_linear(const size_t &i, const Vector &accel)
+  {
+    const double w= omegas(i);
+    const double z= zetas(i);
+    const double g= gammas(i);
+    const double k= w*w; // unit modal mass.
+    const double sq= sqrt(1.0-z*z);
+    const double wd= w*sq;
+    const double e= exp(-z*w*dt);
+    const double s= sin(wd*dt);
+    const double c= cos(wd*dt);
+    const double zs= z/sq;
+    const double A= e*(zs*s+c);
+    const double B= e*s/wd;
+    const double C= (2*z/(w*dt)+e*(((1-2*z*z)/(wd*dt)-zs)*s-(1+2*z/(w*dt))*c))/k;
+    const double D= (1-2*z/(w*dt)+e*((2*z*z-1)/(wd*dt)*s+2*z/(w*dt)*c))/k;
+    const double Ap= -e*w/sq*s;
+    const double Bp= e*(c-zs*s);
+    const double Cp= (-1/dt+e*((w/sq+zs/dt)*s+c/dt))/k;
+    const double Dp= (1-e*(zs*s+c))/(k*dt);
+    const size_t numSteps= accel.Size();
+    double u= 0.0, v= 0.0;
+    double p= -g*accel(0);
+    disp(0,i)= u; vel(0,i)= v;
+    for(size_t j= 1;j<numSteps;j++)
+      {
+        const double pNext= -g*accel(j);
+        const double uNext= A*u+B*v+C*p+D*pNext;
+        v= Ap*u+Bp*v+Cp*p+Dp*pNext;
+        u= uNext;
+        p= pNext;
+        disp(j,i)= u; vel(j,i)= v;
+      }
+  }
+
+//! @brief Integration of the i-th mode equation using the Newmark
+//! average acceleration method (unconditionally stable).
+void XC::ModalSuperposition::integrate_newmark(const size_t &i, const Vector &accel)
+  {
+    const double gamma= 0.5;
+    const double beta= 0.25;
+    const double w= omegas(i);
+    const double cc= 2.0*zetas(i)*w; // unit modal mass.
+    const double k= w*w;
+    const double g= gammas(i);
+    const double kHat= k+gamma/(beta*dt)*cc+1.0/(beta*dt*dt);
+    const double a1= 1.0/(beta*dt)+gamma/beta*cc;
+    const double a2= 1.0/(2.0*beta)+dt*(gamma/(2.0*beta)-1.0)*cc;
+    const size_t numSteps= accel.Size();
+    double u= 0.0, v= 0.0;
+    double p= -g*accel(0);
+    double a= p-cc*v-k*u;
+    disp(0,i)= u; vel(0,i)= v;
+    for(size_t j= 1;j<numSteps;j++)
+      {
+        const double pNext= -g*accel(j);
+        const double du= (pNext-p+a1*v+a2*a)/kHat;
+        const double dv= gamma/(beta*dt)*du-gamma/beta*v+dt*(1.0-gamma/(2.0*beta))*a;
+        const double da= du/(beta*dt*dt)-v/(beta*dt)-a/(2.0*beta);
+        u+= du; v+= dv; a+= da;
+        p= pNext;
+        disp(j,i)= u; vel(j,i)= v;
+      }
+  }
+
+//! @brief Integrate the modal equations for the ground acceleration
+//! record being passed as parameter.
+//! @param accel: ground acceleration values (one for each time step).
+//! @param timeStep: time step of the record.
+//! @param method: integration method (piecewise_linear or newmark).
+int XC::ModalSuperposition::integrate(const Vector &accel, const double &timeStep, const std::string &method)
+  {
+    const bool newmark= (method=="newmark");
+    if(!newmark && (method!="piecewise_linear"))
+      {
+        std::cerr << Color::red << "ModalSuperposition::" << __FUNCTION__
+                  << "; unknown integration method: '" << method
+                  << "'. Valid values are piecewise_linear and newmark."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    if(timeStep<=0.0)
+      {
+        std::cerr << Color::red << "ModalSuperposition::" << __FUNCTION__
+                  << "; time step must be positive."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    dt= timeStep;
+    const int numModes= getNumModes();
+    const int numSteps= accel.Size();
+    disp= Matrix(numSteps,numModes);
+    vel= Matrix(numSteps,numModes);
+    if(numSteps==0)
+      return 0;
+    // The modal equations are uncoupled.
+#pragma omp parallel for schedule(dynamic)
+    for(int i= 0;i<numModes;i++)
+      {
+        const bool underdamped= (omegas(i)>0.0) && (zetas(i)<1.0);
+        if(newmark || !underdamped)
+          integrate_newmark(i,accel);
+        else
+          integrate_piecewise_linear(i,accel);
+      }
+    return 0;
+  }
+
+//! @brief Return the modal displacements at the given time step.
+XC::Vector XC::ModalSuperposition::getModalDisplacements(const size_t &step) const
+  {
+    const int numModes= getNumModes();
+    Vector retval(numModes);
+    if(step<getNumSteps())
+      for(int i= 0;i<numModes;i++)
+        retval(i)= disp(step,i);
+    else
+      std::cerr << Color::red << "ModalSuperposition::" << __FUNCTION__
+                << "; step: " << step << " out of range [0,"
+                << getNumSteps() << ")."
+                << Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Return the modal velocities at the given time step.
+XC::Vector XC::ModalSuperposition::getModalVelocities(const size_t &step) const
+  {
+    const int numModes= getNumModes();
+    Vector retval(numModes);
+    if(step<getNumSteps())
+      for(int i= 0;i<numModes;i++)
+        retval(i)= vel(step,i);
+    else
+      std::cerr << Color::red << "ModalSuperposition::" << __FUNCTION__
+                << "; step: " << step << " out of range [0,"
+                << getNumSteps() << ")."
+                << Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Return the displacement history of the given mode
+//! (zero based index).
+XC::Vector XC::ModalSuperposition::getModalDisplacementHistory(const size_t &mode) const
+  {
+    const size_t numSteps= getNumSteps();
+    Vector retval(numSteps);
+    if(mode<getNumModes())
+      for(size_t j= 0;j<numSteps;j++)
+        retval(j)= disp(j,mode);
+    else
+      std::cerr << Color::red << "ModalSuperposition::" << __FUNCTION__
+                << "; mode: " << mode << " out of range [0,"
+                << getNumModes() << ")."
+                << Color::def << std::endl;
+    return retval;
+  }
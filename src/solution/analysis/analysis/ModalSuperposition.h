@@ -0,0 +1,88 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalSuperposition.h
+
+#ifndef ModalSuperposition_h
+#define ModalSuperposition_h
+
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include <string>
+
+namespace XC {
+
+//! @ingroup AnalysisType
+//
+//! @brief Response history of the reduced (modal) system.
+//!
+//! Once the modes are computed, each one of them behaves as an
+//! uncoupled single degree of freedom oscillator:
+//! \f[ \ddot{q}_i + 2\zeta_i\omega_i\dot{q}_i + \omega_i^2 q_i= -\Gamma_i\ddot{u}_g(t) \f]
+//! This object integrates those equations (exact solution for a
+//! piecewise-linear excitation or Newmark average acceleration method)
+//! and stores the modal coordinates so the physical response can be
+//! recovered (only) where it's needed.
+class ModalSuperposition
+  {
+  private:
+    Vector omegas; //!< angular frequencies of the modes.
+    Vector zetas; //!< damping ratios of the modes.
+    Vector gammas; //!< participation factors of the modes for the excitation direction.
+    double dt; //!< time step.
+    Matrix disp; //!< modal displacements (one row per time step, one column per mode).
+    Matrix vel; //!< modal velocities (one row per time step, one column per mode).
+
+    void integrate_piecewise_linear(const size_t &, const Vector &);
+    void integrate_newmark(const size_t &, const Vector &);
+  public:
+    ModalSuperposition(void);
+
+    void setup(const Vector &omegas, const Vector &zetas, const Vector &gammas);
+    int integrate(const Vector &accel, const double &dt, const std::string &method= "piecewise_linear");
+    void clear(void);
+
+    inline size_t getNumModes(void) const
+      { return omegas.Size(); }
+    inline size_t getNumSteps(void) const
+      { return disp.noRows(); }
+    inline const double &getTimeStep(void) const
+      { return dt; }
+    inline const Vector &getParticipationFactors(void) const
+      { return gammas; }
+    inline const Matrix &getModalDisplacements(void) const
+      { return disp; }
+    inline const Matrix &getModalVelocities(void) const
+      { return vel; }
+    Vector getModalDisplacements(const size_t &) const;
+    Vector getModalVelocities(const size_t &) const;
+    Vector getModalDisplacementHistory(const size_t &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -77,7 +77,7 @@ const std::string stepNumberMessage= "In a static analysis, a number of steps gr
 
 //! @brief Constructor.
 XC::StaticAnalysis::StaticAnalysis(SolutionStrategy *analysis_aggregation)
-  :Analysis(analysis_aggregation), domainStamp(0)
+  :Analysis(analysis_aggregation), domainStamp(0), numSP_Updates(0)
   {
     // AddingSensitivity:BEGIN ////////////////////////////////////
 #ifdef _RELIABILITY
@@ -135,6 +135,47 @@ int XC::StaticAnalysis::new_domain_step(int num_step)
     return result;
   }
 
+//! @brief Return true if, since the last call to domainChanged, the
+//! domain has changed only in its single freedom constraints (node
+//! lockers of a staged construction,...) and the constraint handler
+//! can deal with that without renumbering the model.
+bool XC::StaticAnalysis::only_sps_changed(void)
+  {
+    bool retval= false;
+    const ConstraintHandler *theHandler= getConstraintHandlerPtr();
+    const AnalysisModel *theModel= getAnalysisModelPtr();
+    if(theHandler && theModel && (domainStamp!=0))
+      {
+	retval= theHandler->supportsIncrementalSP_Update()
+	  && (theModel->getNumDOF_Groups()>0)
+	  && (getDomainPtr()->getLastNonSPChangeStamp()<=domainStamp);
+      }
+    return retval;
+  }
+
+//! @brief Update the analysis objects after a change in the domain
+//! (whose new stamp is the argument).
+//!
+//! If only the single freedom constraints have changed the DOF numbering
+//! and the system of equations are kept (see spConstraintsChanged),
+//! otherwise domainChanged is invoked.
+int XC::StaticAnalysis::update_domain_stamp(int stamp)
+  {
+    int retval= 0;
+    if(only_sps_changed())
+      {
+	retval= spConstraintsChanged();
+	if(retval<0) // try again from scratch.
+	  retval= domainChanged();
+	else
+	  numSP_Updates++;
+      }
+    else
+      retval= domainChanged();
+    domainStamp= stamp;
+    return retval;
+  }
+
 //! @brief Check if the domain has changed after the last analysis step.
 //! It's used in run_analysis_step method.
 int XC::StaticAnalysis::check_domain_change(int num_step,int numSteps)
@@ -144,8 +185,7 @@ int XC::StaticAnalysis::check_domain_change(int num_step,int numSteps)
 
     if(stamp != domainStamp)
       {
-        domainStamp= stamp;
-        result= domainChanged();
+        result= update_domain_stamp(stamp);
 
         if(result < 0)
           {
@@ -300,17 +340,140 @@ int XC::StaticAnalysis::analyze(int numSteps)
     assert(solution_strategy);
     CommandEntity *old= solution_strategy->Owner();
     solution_strategy->set_owner(this);
+    getDomainPtr()->modelChange(); // the model may have been modified since the last call.
     int result= 0;
-    for(int i=0; i<numSteps; i++)
+    bool adaptive= stepControl.isActive();
+    if(adaptive && !getStaticIntegratorPtr()->supportsStepScaling())
       {
-        result= run_analysis_step(i,numSteps);
-        if(result < 0) //Fallo en run_analysis_step.
-          break;
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; the integrator: "
+		  << getStaticIntegratorPtr()->getClassName()
+		  << " doesn't support adaptive step control."
+		  << " Fixed steps will be used."
+		  << Color::def << std::endl;
+	adaptive= false;
       }
+    if(adaptive)
+      result= analyze_adaptive(numSteps);
+    else
+      for(int i=0; i<numSteps; i++)
+	{
+	  result= run_analysis_step(i,numSteps);
+	  if(result < 0) //Fallo en run_analysis_step.
+	    break;
+	}
     solution_strategy->set_owner(old);
     return result;
   }
 
+//! @brief Try to perform a step whose size is the nominal increment
+//! of the integrator multiplied by the argument.
+//!
+//! On failure the domain and the integrator are reverted to the last
+//! committed state (so the step can be tried again with a smaller
+//! size) and a negative number is returned (-1 means the analysis can't
+//! go on whatever the step size).
+//!
+//! @param ratio: step size relative to the nominal one.
+int XC::StaticAnalysis::try_adaptive_step(const double &ratio)
+  {
+    Domain *theDomain= getDomainPtr();
+    StaticIntegrator *theIntegrator= getStaticIntegratorPtr();
+    theIntegrator->setStepScale(ratio);
+    if(newStepDomain(getAnalysisModelPtr()) < 0)
+      {
+        theDomain->revertToLastCommit();
+        return -2;
+      }
+    const int stamp= theDomain->hasDomainChanged();
+    if(stamp != domainStamp)
+      {
+        if(update_domain_stamp(stamp) < 0)
+	  {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; domainChanged failed."
+		      << Color::def << std::endl;
+	    theDomain->revertToLastCommit();
+	    return -1;
+	  }
+      }
+    int result= theIntegrator->newStep();
+    if(result < 0)
+      result= -2;
+    else
+      {
+        result= getEquiSolutionAlgorithmPtr()->solveCurrentStep();
+	if(result < 0)
+	  result= -3;
+      }
+// AddingSensitivity:BEGIN ////////////////////////////////////
+#ifdef _RELIABILITY
+    if((result>=0) && theSensitivityAlgorithm)
+      {
+        if(theSensitivityAlgorithm->computeSensitivities() < 0)
+	  result= -5;
+      }
+#endif
+// AddingSensitivity:END //////////////////////////////////////
+    if(result>=0)
+      {
+        result= theIntegrator->commit();
+	if(result < 0)
+	  result= -4;
+      }
+    if(result < 0)
+      {
+        theDomain->revertToLastCommit();
+        theIntegrator->revertToLastStep();
+      }
+    return result;
+  }
+
+//! @brief Performs the analysis using adaptive step control.
+//!
+//! The analysis covers the same range as \p numSteps nominal steps of
+//! the integrator. When a step fails the state is reverted to the last
+//! commit and the step is cut back; when it converges with few
+//! iterations the next step grows (see AdaptiveStepControl).
+//!
+//! @param numSteps: number of nominal steps.
+int XC::StaticAnalysis::analyze_adaptive(int numSteps)
+  {
+    StaticIntegrator *theIntegrator= getStaticIntegratorPtr();
+    const ConvergenceTest *theTest= getConvergenceTestPtr();
+    stepControl.start();
+    int result= 0;
+    double progress= 0.0; // number of nominal steps performed.
+    while(progress<numSteps)
+      {
+        const double remaining= numSteps-progress;
+        const double ratio= stepControl.getStepRatio(remaining);
+	result= try_adaptive_step(ratio);
+	if(result == -1) // can't go on.
+	  break;
+	else if(result < 0)
+	  {
+	    if(!stepControl.cutback())
+	      {
+		std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+			  << "; the step failed with the minimum size ratio: "
+			  << ratio << " with domain at load factor "
+			  << getDomainPtr()->getTimeTracker().getCurrentTime()
+			  << "." << Color::def << std::endl;
+		break;
+	      }
+	  }
+	else
+	  {
+	    progress= (ratio<remaining) ? progress+ratio : numSteps;
+	    const int numIter= (theTest ? theTest->getNumTests() : 1);
+	    stepControl.stepConverged(getDomainPtr()->getTimeTracker().getCurrentTime(), ratio, numIter);
+	  }
+      }
+    theIntegrator->setStepScale(1.0);
+    return result;
+  }
+
 int XC::StaticAnalysis::initialize(void)
   {
     Domain *the_Domain= this->getDomainPtr();
@@ -319,8 +482,7 @@ int XC::StaticAnalysis::initialize(void)
     int stamp= the_Domain->hasDomainChanged();
     if(stamp != domainStamp)
       {
-        domainStamp= stamp;
-        if(this->domainChanged() < 0)
+        if(this->update_domain_stamp(stamp) < 0)
           {
             std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
 		      << "; domainChanged() failed."
@@ -340,6 +502,40 @@ int XC::StaticAnalysis::initialize(void)
     return 0;
   }
 
+//! @brief Method invoked during the analysis when only the single
+//! freedom constraints of the domain have changed.
+//!
+//! Asks the constraint handler to update the objects that enforce those
+//! constraints (see ConstraintHandler::updateSPs). The DOF numbering and
+//! the size and sparsity of the system of equations remain untouched,
+//! which avoids the full setup performed by domainChanged() in each
+//! stage of a staged construction analysis. The integrator and the
+//! solution algorithm are notified so they discard the data computed
+//! from the replaced FE_Elements (see
+//! IncrementalIntegrator::spConstraintsChanged).
+int XC::StaticAnalysis::spConstraintsChanged(void)
+  {
+    const int result= getConstraintHandlerPtr()->updateSPs();
+    if(result < 0)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; ConstraintHandler::updateSPs() failed."
+	          << Color::def << std::endl;
+        return -1;
+      }
+    // The penalty elements have changed, the integrator and the
+    // algorithms that keep the tangent between steps must form it again.
+    if(getStaticIntegratorPtr()->spConstraintsChanged() < 0)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; Integrator::spConstraintsChanged() failed."
+	          << Color::def << std::endl;
+        return -1;
+      }
+    getEquiSolutionAlgorithmPtr()->domainChanged();
+    return result;
+  }
+
 //! @brief Method invoked during the analysis to deal with domain changes.
 //!
 //! This is a method invoked by the analysis during the analysis method if
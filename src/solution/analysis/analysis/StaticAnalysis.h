@@ -63,6 +63,7 @@
 // What: "@(#) StaticAnalysis.h, revA"
 
 #include <solution/analysis/analysis/Analysis.h>
+#include <solution/analysis/analysis/AdaptiveStepControl.h>
 
 namespace XC {
 class ConvergenceTest;
@@ -80,6 +81,8 @@ class StaticAnalysis: public Analysis
   {
   protected:
     int domainStamp;
+    int numSP_Updates; //!< number of domain changes solved by updating the SP constraints only.
+    AdaptiveStepControl stepControl; //!< adaptive step size control.
 
 // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
@@ -88,12 +91,16 @@ class StaticAnalysis: public Analysis
 // AddingSensitivity:END ///////////////////////////////
 
     int new_domain_step(int num_step);
+    bool only_sps_changed(void);
+    int update_domain_stamp(int stamp);
     int check_domain_change(int num_step,int numSteps);
     int new_integrator_step(int num_step);
     int solve_current_step(int num_step);
     int compute_sensitivities_step(int num_step);
     int commit_step(int num_step);
     int run_analysis_step(int num_step,int numSteps);
+    int try_adaptive_step(const double &);
+    int analyze_adaptive(int numSteps);
 
     friend class SolutionProcedure;
     StaticAnalysis(SolutionStrategy *analysis_aggregation);
@@ -105,8 +112,19 @@ class StaticAnalysis: public Analysis
     void clearAll(void);	    
     
     virtual int analyze(int numSteps);
+    //! @brief Return the adaptive step control.
+    inline AdaptiveStepControl &getAdaptiveStepControl(void)
+      { return stepControl; }
+    //! @brief Return the adaptive step control.
+    inline const AdaptiveStepControl &getAdaptiveStepControl(void) const
+      { return stepControl; }
     int initialize(void);
     int domainChanged(void);
+    int spConstraintsChanged(void);
+    //! @brief Return the number of domain changes solved by updating
+    //! the single freedom constraints only.
+    inline int getNumSP_Updates(void) const
+      { return numSP_Updates; }
 
     int setNumberer(DOF_Numberer &theNumberer);
     int setAlgorithm(EquiSolnAlgo &theAlgorithm);
@@ -0,0 +1,45 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.  
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//forked_worker.cc
+
+#include "forked_worker.h"
+#include "utility/recorder/RecorderContainer.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//! @brief Prepare a forked copy of the process to run analyses
+//! (called by the worker right after fork()).
+//!
+//! fork() copies only the calling thread, so the worker must not use
+//! anything that depends on the other threads of the parent: the
+//! recorders of the process are suspended (they would write to the
+//! files of the parent, run its Python code or wait for the writer
+//! thread of a binary output handler) and the OpenMP regions run with
+//! a single thread (the thread pool of the parent doesn't exist in
+//! the worker).
+void XC::setup_forked_worker(void)
+  {
+    RecorderContainer::setAllRecordersSuspended(true);
+#ifdef _OPENMP
+    omp_set_num_threads(1);
+#endif
+  }
@@ -30,9 +30,27 @@ class_<XC::Analysis, XC::Analysis *, bases<CommandEntity>, boost::noncopyable >(
   .add_property("eigenSOE", make_function(&XC::Analysis::getEigenSOEPtr, return_internal_reference<>() ), "return a reference to the eigen system of equations.")
   ;
 
+class_<XC::AdaptiveStepControl, boost::noncopyable >("AdaptiveStepControl", no_init)
+  .add_property("active", &XC::AdaptiveStepControl::isActive, &XC::AdaptiveStepControl::setActive, "Get/set the activation of the adaptive step control.")
+  .add_property("cutbackFactor", &XC::AdaptiveStepControl::getCutbackFactor, &XC::AdaptiveStepControl::setCutbackFactor, "Get/set the factor that multiplies the step size when a step fails (default 0.5).")
+  .add_property("growthFactor", &XC::AdaptiveStepControl::getGrowthFactor, &XC::AdaptiveStepControl::setGrowthFactor, "Get/set the factor that multiplies the step size when a step converges with few iterations (default 1.5).")
+  .add_property("minRatio", &XC::AdaptiveStepControl::getMinRatio, &XC::AdaptiveStepControl::setMinRatio, "Get/set the minimum step size relative to the nominal one.")
+  .add_property("maxRatio", &XC::AdaptiveStepControl::getMaxRatio, &XC::AdaptiveStepControl::setMaxRatio, "Get/set the maximum step size relative to the nominal one.")
+  .add_property("growthIterations", &XC::AdaptiveStepControl::getGrowthIterations, &XC::AdaptiveStepControl::setGrowthIterations, "Get/set the maximum number of iterations of a step that allows the next one to grow.")
+  .add_property("numSteps", &XC::AdaptiveStepControl::getNumSteps, "Return the number of converged steps in the history.")
+  .add_property("totalIterations", &XC::AdaptiveStepControl::getTotalIterations, "Return the total number of iterations in the history.")
+  .add_property("totalCutbacks", &XC::AdaptiveStepControl::getTotalCutbacks, "Return the total number of cutbacks in the history.")
+  .def("getStepHistory", &XC::AdaptiveStepControl::getHistoryPy, "Return the history of converged steps as a list of dictionaries (time, ratio, numIterations, numCutbacks).")
+  .def("clearHistory", &XC::AdaptiveStepControl::clearHistory, "Clear the step history.")
+  ;
+
+XC::AdaptiveStepControl &(XC::StaticAnalysis::*getStaticAdaptiveStepControl)(void)= &XC::StaticAnalysis::getAdaptiveStepControl;
 class_<XC::StaticAnalysis, bases<XC::Analysis>, boost::noncopyable >("StaticAnalysis", no_init)
   .def("analyze", &XC::StaticAnalysis::analyze,"Performs the analysis. A number of steps greater than 1 is useless if the loads are constant.")
   .def("initialize", &XC::StaticAnalysis::initialize,"Initialize analysis.")
+  .def("domainChanged", &XC::StaticAnalysis::domainChanged,"Set up the analysis objects from scratch after a change in the domain.")
+  .add_property("numSPUpdates", &XC::StaticAnalysis::getNumSP_Updates,"Return the number of domain changes solved by updating the single freedom constraints only (without renumbering).")
+  .add_property("adaptiveStepControl", make_function(getStaticAdaptiveStepControl, return_internal_reference<>() ),"return a reference to the adaptive step control.")
     ;
 
 class_<XC::EigenAnalysis , bases<XC::Analysis>, boost::noncopyable >("EigenAnalysis", no_init)
@@ -98,9 +116,26 @@ class_<XC::IllConditioningAnalysis, bases<XC::EigenAnalysis>, boost::noncopyable
   .def("getEigenvalue", make_function(&XC::IllConditioningAnalysis::getEigenvalue, return_value_policy<copy_const_reference>()) )
   ;
 
+XC::Vector (XC::ModalSuperposition::*getModalDisplacementsAtStep)(const size_t &) const= &XC::ModalSuperposition::getModalDisplacements;
+XC::Vector (XC::ModalSuperposition::*getModalVelocitiesAtStep)(const size_t &) const= &XC::ModalSuperposition::getModalVelocities;
+class_<XC::ModalSuperposition, boost::noncopyable >("ModalSuperposition", no_init)
+  .add_property("numModes", &XC::ModalSuperposition::getNumModes, "Return the number of modes of the reduced system.")
+  .add_property("numSteps", &XC::ModalSuperposition::getNumSteps, "Return the number of computed time steps.")
+  .add_property("timeStep", make_function(&XC::ModalSuperposition::getTimeStep, return_value_policy<copy_const_reference>()), "Return the time step.")
+  .add_property("participationFactors", make_function(&XC::ModalSuperposition::getParticipationFactors, return_internal_reference<>()), "Return the participation factors for the excitation direction.")
+  .def("getModalDisplacements", getModalDisplacementsAtStep, "Return the modal displacements at the given time step.")
+  .def("getModalVelocities", getModalVelocitiesAtStep, "Return the modal velocities at the given time step.")
+  .def("getModalDisplacementHistory", &XC::ModalSuperposition::getModalDisplacementHistory, "Return the displacement history of the given mode (zero based index).")
+  ;
+
 class_<XC::ModalAnalysis , bases<XC::EigenAnalysis>, boost::noncopyable >("ModalAnalysis", no_init)
   .add_property("spectrum", make_function(&XC::ModalAnalysis::getSpectrum,return_internal_reference<>()),&XC::ModalAnalysis::setSpectrum,"Response spectrum,") 
   .def("getCQCModalCrossCorrelationCoefficients",&XC::ModalAnalysis::getCQCModalCrossCorrelationCoefficients,"Returns CQC correlation coefficients.")
+  .def("getParticipationFactors",&XC::ModalAnalysis::getParticipationFactors,"getParticipationFactors(dof): return the participation factors of the modes for an excitation along the given DOF.")
+  .def("computeGroundMotionResponse",&XC::ModalAnalysis::computeGroundMotionResponse,"computeGroundMotionResponse(accelerations, dt, dof, dampingRatios, method): compute the response history for a ground acceleration record by modal superposition; method can be 'piecewise_linear' (exact for linear variation of the acceleration between steps) or 'newmark' (average acceleration).")
+  .add_property("modalResponse", make_function(&XC::ModalAnalysis::getModalResponse,return_internal_reference<>()),"Return the modal response history.")
+  .def("getNodeDispHistory",&XC::ModalAnalysis::getNodeDispHistory,"getNodeDispHistory(nodeTag, dof): return the displacement history (relative to the ground) of the node DOF.")
+  .def("updateDomain",&XC::ModalAnalysis::updateDomain,"updateDomain(step): put the displacements and velocities of the given step in the domain and commit them to recover the element responses.")
   ;
 
 
@@ -110,7 +145,29 @@ class_<XC::TransientAnalysis, bases<XC::Analysis>, boost::noncopyable >("Transie
   .def("analyze", &XC::TransientAnalysis::analyze,"analyze(nSteps,dT) performs the analysis.")
   ;
 
-class_<XC::DirectIntegrationAnalysis, bases<XC::TransientAnalysis>, boost::noncopyable >("DirectIntegrationAnalysis", no_init);
+class_<XC::GroundMotionBatch, boost::noncopyable >("GroundMotionBatch", "Runs the direct integration analysis of the same model for a suite of ground motion records and scale factors. With more than one worker the runs are performed in forked copies of the process, which copy only the calling thread: the workers don't invoke the recorders and use a single OpenMP thread.", no_init)
+  .add_property("pattern", make_function(&XC::GroundMotionBatch::getPattern, return_internal_reference<>() ), &XC::GroundMotionBatch::setPattern,"uniform excitation load pattern that applies the records.")
+  .def("addRecord", &XC::GroundMotionBatch::addRecord,"addRecord(accelerations, dt): append a ground acceleration record.")
+  .add_property("numRecords", &XC::GroundMotionBatch::getNumRecords,"return the number of records.")
+  .def("clearRecords", &XC::GroundMotionBatch::clearRecords,"remove the records and the results.")
+  .add_property("scaleFactors", make_function(&XC::GroundMotionBatch::getScaleFactors, return_internal_reference<>() ), &XC::GroundMotionBatch::setScaleFactors,"scale factors to apply to each record.")
+  .add_property("nodeTags", make_function(&XC::GroundMotionBatch::getNodeTags, return_internal_reference<>() ), &XC::GroundMotionBatch::setNodeTags,"tags of the nodes whose response envelope is computed.")
+  .add_property("responseType", make_function(&XC::GroundMotionBatch::getResponseType, return_value_policy<copy_const_reference>() ), &XC::GroundMotionBatch::setResponseType,"nodal response to compute the envelopes for (disp, vel or accel).")
+  .add_property("analysisTimeStep", &XC::GroundMotionBatch::getAnalysisTimeStep, &XC::GroundMotionBatch::setAnalysisTimeStep,"time step of the analysis (if not positive the time step of each record is used).")
+  .add_property("numberOfWorkers", &XC::GroundMotionBatch::getNumberOfWorkers, &XC::GroundMotionBatch::setNumberOfWorkers,"number of processes that run the analyses. If greater than one, the analyses run in forked copies of the process: they don't invoke the recorders (no file output, no Python callbacks) and use a single OpenMP thread; threads started by the parent are not available in them.")
+  .add_property("numRuns", &XC::GroundMotionBatch::getNumRuns,"return the number of analyses (records times scale factors).")
+  .def("getEnvelope", &XC::GroundMotionBatch::getEnvelope, return_internal_reference<>(),"getEnvelope(iRecord, iScale): return the envelope of the response (rows: minimum, maximum and maximum absolute value).")
+  .def("getStatus", &XC::GroundMotionBatch::getStatus,"getStatus(iRecord, iScale): return the result of the analysis (negative if it failed).")
+  .def("getPeak", &XC::GroundMotionBatch::getPeak,"getPeak(iRecord, iScale): return the peak absolute value of the response.")
+  ;
+
+XC::AdaptiveStepControl &(XC::DirectIntegrationAnalysis::*getTransientAdaptiveStepControl)(void)= &XC::DirectIntegrationAnalysis::getAdaptiveStepControl;
+XC::GroundMotionBatch &(XC::DirectIntegrationAnalysis::*getGroundMotionBatchRef)(void)= &XC::DirectIntegrationAnalysis::getGroundMotionBatch;
+class_<XC::DirectIntegrationAnalysis, bases<XC::TransientAnalysis>, boost::noncopyable >("DirectIntegrationAnalysis", no_init)
+  .add_property("adaptiveStepControl", make_function(getTransientAdaptiveStepControl, return_internal_reference<>() ),"return a reference to the adaptive time step control.")
+  .add_property("groundMotionBatch", make_function(getGroundMotionBatchRef, return_internal_reference<>() ),"return a reference to the batch of ground motions.")
+  .def("analyzeGroundMotionBatch", &XC::DirectIntegrationAnalysis::analyzeGroundMotionBatch,"run the analysis for each record and scale factor of the ground motion batch starting from the current state.")
+  ;
 
 class_<XC::VariableTimeStepDirectIntegrationAnalysis, bases<XC::DirectIntegrationAnalysis>, boost::noncopyable >("VariableTimeStepDirectIntegrationAnalysis", no_init);
 
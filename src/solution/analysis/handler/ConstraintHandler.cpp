@@ -91,6 +91,21 @@ int XC::ConstraintHandler::update(void)
 int XC::ConstraintHandler::applyLoad(void)
   { return 0; }
 
+//! @brief Return true if the handler is able to take into account
+//! changes in the single freedom constraints of the domain without
+//! renumbering the degrees of freedom (see updateSPs).
+bool XC::ConstraintHandler::supportsIncrementalSP_Update(void) const
+  { return false; }
+
+//! @brief Update the objects that enforce the single freedom constraints
+//! after the constraints of the domain have changed, keeping the DOF
+//! numbering and the connectivity of the model.
+//!
+//! Returns 0 if successful, a negative number otherwise (the default
+//! implementation always fails so the analysis must call handle() again).
+int XC::ConstraintHandler::updateSPs(void)
+  { return -1; }
+
 //! @brief Return a pointer to the model wrapper.
 XC::ModelWrapper *XC::ConstraintHandler::getModelWrapper(void)
   { return dynamic_cast<ModelWrapper *>(Owner()); }
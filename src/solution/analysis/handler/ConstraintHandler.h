@@ -138,6 +138,8 @@ class ConstraintHandler: public MovableObject, public CommandEntity
     virtual int update(void);
     virtual int applyLoad(void);
     virtual int doneNumberingDOF(void);
+    virtual bool supportsIncrementalSP_Update(void) const;
+    virtual int updateSPs(void);
     virtual void clearAll(void);    
   };
 } // end of XC namespace
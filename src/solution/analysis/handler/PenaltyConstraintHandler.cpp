@@ -76,6 +76,7 @@
 #include <solution/analysis/model/fe_ele/penalty/PenaltySFreedom_FE.h>
 #include <solution/analysis/model/fe_ele/penalty/PenaltyMFreedom_FE.h>
 #include <solution/analysis/model/fe_ele/penalty/PenaltyMRMFreedom_FE.h>
+#include "utility/utils/misc_utils/colormod.h"
 
 
 //! @brief Constructor.
@@ -83,7 +84,8 @@
 //! @param sp: factor to be used with the single freedom constraints.
 //! @param mp: factor to be used with the multi-freedom constraints.
 XC::PenaltyConstraintHandler::PenaltyConstraintHandler(ModelWrapper *owr,const double &sp, const double &mp)
-  :FactorsConstraintHandler(owr,HANDLER_TAG_PenaltyConstraintHandler,sp,mp) {}
+  :FactorsConstraintHandler(owr,HANDLER_TAG_PenaltyConstraintHandler,sp,mp),
+   spFE_Tags(), nextFE_Tag(0) {}
 
 //! @brief Virtual constructor.
 XC::ConstraintHandler *XC::PenaltyConstraintHandler::getCopy(void) const
@@ -196,12 +198,9 @@ int XC::PenaltyConstraintHandler::handle(const ID *nodesLast)
 
     // create the PenaltySFreedom_FE for the SFreedom_Constraints and
     // add to the AnalysisModel
-    SFreedom_ConstraintIter &theSPss = theDomain->getConstraints().getDomainAndLoadPatternSPs();
-    while((spPtr = theSPss()) != 0)
-      {
-        fePtr= theModel->createPenaltySFreedom_FE(numFeEle, *spPtr, alphaSP);
-        numFeEle++;
-      }
+    nextFE_Tag= numFeEle;
+    createSP_FEs();
+    numFeEle= nextFE_Tag;
 
     // create the PenaltyMFreedom_FE for the MFreedom_Constraints and
     // add to the AnalysisModel
@@ -222,7 +221,74 @@ int XC::PenaltyConstraintHandler::handle(const ID *nodesLast)
 	fePtr= theModel->createPenaltyMRMFreedom_FE(numFeEle, *mrmpPtr, alphaMP);
         numFeEle++;
       }
+    nextFE_Tag= numFeEle;
     return count3;
   }
 
+//! @brief Create a PenaltySFreedom_FE for each single freedom constraint
+//! of the domain (and its load patterns) and add them to the AnalysisModel.
+//!
+//! Returns the objects created.
+std::vector<XC::FE_Element *> XC::PenaltyConstraintHandler::createSP_FEs(void)
+  {
+    std::vector<FE_Element *> retval;
+    Domain *theDomain= this->getDomainPtr();
+    AnalysisModel *theModel= this->getAnalysisModelPtr();
+    spFE_Tags.clear();
+    SFreedom_ConstraintIter &theSPs= theDomain->getConstraints().getDomainAndLoadPatternSPs();
+    SFreedom_Constraint *spPtr= nullptr;
+    while((spPtr = theSPs()) != 0)
+      {
+        FE_Element *fePtr= theModel->createPenaltySFreedom_FE(nextFE_Tag, *spPtr, alphaSP);
+	if(fePtr)
+	  {
+	    spFE_Tags.push_back(nextFE_Tag);
+	    retval.push_back(fePtr);
+	  }
+        nextFE_Tag++;
+      }
+    return retval;
+  }
+
+//! @brief The penalty method doesn't need to renumber the degrees of
+//! freedom when the single freedom constraints change.
+bool XC::PenaltyConstraintHandler::supportsIncrementalSP_Update(void) const
+  { return true; }
+
+//! @brief Replace the PenaltySFreedom_FE objects by new ones that
+//! correspond to the current single freedom constraints of the domain.
+//!
+//! The penalty elements of the single freedom constraints only add
+//! terms to the diagonal of the system of equations, so neither the
+//! DOF numbering nor the sparsity pattern need to be recomputed when
+//! nodes are locked or released (i.e. staged construction).
+int XC::PenaltyConstraintHandler::updateSPs(void)
+  {
+    AnalysisModel *theModel= this->getAnalysisModelPtr();
+    if((!getDomainPtr()) || (!theModel))
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+	          << "; domain or model was not set."
+		  << Color::def << std::endl;
+        return -1;
+      }
+    for(std::vector<int>::const_iterator i= spFE_Tags.begin(); i!=spFE_Tags.end(); i++)
+      theModel->removeFE_Element(*i);
+    int retval= 0;
+    // set the equation numbers of the new elements.
+    const std::vector<FE_Element *> newFEs= createSP_FEs();
+    for(std::vector<FE_Element *>::const_iterator i= newFEs.begin(); i!=newFEs.end(); i++)
+      if((*i)->setID()<0)
+	retval= -1;
+    return retval;
+  }
+
+//! @brief Forget the penalty elements (the model deletes them).
+void XC::PenaltyConstraintHandler::clearAll(void)
+  {
+    FactorsConstraintHandler::clearAll();
+    spFE_Tags.clear();
+    nextFE_Tag= 0;
+  }
+
 
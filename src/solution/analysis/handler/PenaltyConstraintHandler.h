@@ -67,6 +67,7 @@
 #define PenaltyConstraintHandler_h
 
 #include <solution/analysis/handler/FactorsConstraintHandler.h>
+#include <vector>
 
 namespace XC {
 class FE_Element;
@@ -86,12 +87,20 @@ const double DefaultPenaltyFactor= 1e7; //10^(p/2) being p the number of decimal
 //! constraints by modifying the tangent matrix and residual vector. 
 class PenaltyConstraintHandler: public FactorsConstraintHandler
   {
+    std::vector<int> spFE_Tags; //!< tags of the PenaltySFreedom_FE objects.
+    int nextFE_Tag; //!< tag for the next FE_Element to create.
+
+    std::vector<FE_Element *> createSP_FEs(void);
+
     friend class ModelWrapper;
     friend class FEM_ObjectBroker;
     PenaltyConstraintHandler(ModelWrapper *,const double &alphaSP= DefaultPenaltyFactor, const double &alphaMP= DefaultPenaltyFactor);
     ConstraintHandler *getCopy(void) const;
   public:
     int handle(const ID *nodesNumberedLast =0);
+    bool supportsIncrementalSP_Update(void) const;
+    int updateSPs(void);
+    void clearAll(void);
   };
 } // end of XC namespace
 
@@ -84,7 +84,7 @@
 //! @param owr: pointer to the model wrapper that owns the handler.
 XC::TransformationConstraintHandler::TransformationConstraintHandler(ModelWrapper *owr)
   :ConstraintHandler(owr,HANDLER_TAG_TransformationConstraintHandler),
- theFEs(), theDOFs(),numDOF(0),numConstrainedNodes(0) {}
+ theFEs(), theDOFs(),numDOF(0),numConstrainedNodes(0), sparseT() {}
 
 
 //! @brief Virtual constructor.
@@ -233,10 +233,10 @@ int XC::TransformationConstraintHandler::handle(const ID *nodesLast)
                           tDofPtr->addSFreedom_Constraint(*(sFreedomConstraints[i]));
                       }
                   }
-                // add the DOF to the array
-                theDOFs[numDOF++]= dofPtr;
-                numConstrainedNodes++;
               }
+            // add the DOF to the array
+            theDOFs[numDOF++]= dofPtr;
+            numConstrainedNodes++;
           }
 
 	//Multi retained node, multi-freedom constraints.
@@ -261,10 +261,10 @@ int XC::TransformationConstraintHandler::handle(const ID *nodesLast)
                               tDofPtr->addSFreedom_Constraint(*(sFreedomConstraints[i]));
                           }
                       }
-                    // add the DOF to the array
-                    theDOFs[numDOF++]= dofPtr;
-                    numConstrainedNodes++;
                   }
+                // add the DOF to the array
+                theDOFs[numDOF++]= dofPtr;
+                numConstrainedNodes++;
               }
           }
 
@@ -428,6 +428,7 @@ void XC::TransformationConstraintHandler::clearAll(void)
     // delete the arrays
     theFEs.clear();
     theDOFs.clear();
+    sparseT.clear();
 
     // reset the numbers
     numDOF= 0;
@@ -458,6 +459,13 @@ int XC::TransformationConstraintHandler::enforceSPs(void)
 	TransformationDOF_Group *theDof= dynamic_cast<TransformationDOF_Group *>(theDOFs[numDOF-k]);
 	theDof->enforceSPs(0);
       }
+    // update the transformation of time-varying constraints
+    // before the elements use it.
+    for(int k=1; k<=numConstrainedNodes; k++)
+      {
+	const TransformationDOF_Group *theDof= dynamic_cast<const TransformationDOF_Group *>(theDOFs[numDOF-k]);
+	theDof->updateSparseT(sparseT);
+      }
     for(std::set<FE_Element *>::iterator j=theFEs.begin(); j!=theFEs.end(); j++)
       (*j)->updateElement();
     return 0;
@@ -472,6 +480,15 @@ int XC::TransformationConstraintHandler::doneNumberingDOF(void)
         theDof->doneID();
       }
 
+    // assemble the global (sparse) transformation matrix
+    // once the equation numbers are known.
+    sparseT.clear();
+    for(int i=1; i<=numConstrainedNodes; i++)
+      {
+        TransformationDOF_Group *theDof= dynamic_cast<TransformationDOF_Group *>(theDOFs[numDOF-i]);
+        theDof->setSparseT(sparseT);
+      }
+
     // iterate through the XC::FE_Element getting them to set their IDs
     AnalysisModel *theModel=this->getAnalysisModelPtr();
     FE_EleIter &theEle= theModel->getFEs();
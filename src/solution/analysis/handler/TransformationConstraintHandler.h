@@ -68,6 +68,7 @@
 #define TransformationConstraintHandler_h
 
 #include <solution/analysis/handler/ConstraintHandler.h>
+#include "solution/analysis/model/SparseTransformation.h"
 
 namespace XC {
 class FE_Element;
@@ -95,6 +96,7 @@ class TransformationConstraintHandler: public ConstraintHandler
     int numConstrainedNodes; //!< number of constrained nodes.
 
     int numTransformationFEs; //!< number of TransformationFE elements.
+    SparseTransformation sparseT; //!< global transformation matrix (block diagonal).
 
     friend class ModelWrapper;
     friend class FEM_ObjectBroker;
@@ -108,6 +110,10 @@ class TransformationConstraintHandler: public ConstraintHandler
     int enforceSPs(void);    
     int doneNumberingDOF(void);        
 
+    //! @brief Return the global transformation matrix.
+    const SparseTransformation &getSparseTransformation(void) const
+      { return sparseT; }
+
     int sendSelf(Communicator &);
     int recvSelf(const Communicator &);
   };
@@ -65,13 +65,14 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include "domain/domain/Domain.h"
 
 
 //! @brief Constructor.
 //!
 //! @param owr: set of objects used to perform the analysis.
 XC::IncrementalIntegrator::IncrementalIntegrator(SolutionStrategy *owr,int classTag)
-  : Integrator(owr,classTag), statusFlag(CURRENT_TANGENT) {}
+  : Integrator(owr,classTag), statusFlag(CURRENT_TANGENT), splitTangent(false) {}
 
 //! @brief Get the value of the flag to compute the tangent stiffness: CURRENT_TANGENT: 0; INITIAL_TANGENT: 1; CURRENT_SECANT: 2; INITIAL_THEN_CURRENT_TANGENT: 3; NO_TANGENT: 4; SECOND_TANGENT: 5; HALL_TANGENT: 6
 int XC::IncrementalIntegrator::getTangFlag(void) const
@@ -81,6 +82,115 @@ int XC::IncrementalIntegrator::getTangFlag(void) const
 void XC::IncrementalIntegrator::setTangFlag(const int &i)
   { statusFlag= i; }
 
+//! @brief Return true if the tangent can be formed as a constant part
+//! assembled once plus a variable part assembled on each iteration
+//! (see TangentSplit). This is not possible when the element
+//! contributions depend on factors that change from one step
+//! to the next.
+bool XC::IncrementalIntegrator::supportsTangentSplit(void) const
+  { return false; }
+
+//! @brief Return true if the constant part of the tangent is assembled
+//! only once.
+bool XC::IncrementalIntegrator::getSplitTangent(void) const
+  { return splitTangent; }
+
+//! @brief If true, the contributions of the elements whose tangent
+//! doesn't depend on their state (see Element::hasConstantTangent)
+//! are assembled only once and kept in the system of equations; on
+//! each iteration only the contributions of the rest of the elements
+//! are assembled. Useful for models with local nonlinearities
+//! (isolators, gaps, contact springs...) in a large linear structure.
+void XC::IncrementalIntegrator::setSplitTangent(const bool &b)
+  {
+    splitTangent= b;
+    tangentSplit.clear();
+  }
+
+//! @brief Return the classification of the FE_Elements used when
+//! the constant part of the tangent is assembled only once.
+const XC::TangentSplit &XC::IncrementalIntegrator::getTangentSplit(void) const
+  { return tangentSplit; }
+
+//! @brief Forget the classification of the FE_Elements, so the constant
+//! part of the tangent is assembled again on the next iteration (i.e.
+//! after the FE_Elements of the analysis model have changed).
+void XC::IncrementalIntegrator::clearTangentSplit(void)
+  { tangentSplit.clear(); }
+
+//! @brief Make the required changes when only the single freedom
+//! constraints of the domain have changed (see
+//! StaticAnalysis::spConstraintsChanged).
+//!
+//! The system of equations keeps its size in that case, so the data
+//! that is discarded by LinearSOE::setSize must be discarded here: the
+//! classification of the FE_Elements used to split the tangent (the
+//! penalty elements have been replaced) and the copy of the constant
+//! part of the tangent stored in the system of equations.
+int XC::IncrementalIntegrator::spConstraintsChanged(void)
+  {
+    clearTangentSplit();
+    LinearSOE *theSOE= getLinearSOEPtr();
+    if(theSOE)
+      theSOE->clearStoredA();
+    return 0;
+  }
+
+//! @brief Add the tangents of the given FE_Elements to the system
+//! of equations.
+int XC::IncrementalIntegrator::addFETangents(LinearSOE &theSOE, const TangentSplit::fe_container &fes)
+  {
+    int result= 0;
+    for(TangentSplit::fe_container::const_iterator i= fes.begin(); i!=fes.end(); i++)
+      {
+        FE_Element *elePtr= *i;
+        if(theSOE.addA(elePtr->getTangent(this),elePtr->getID()) < 0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+	  	      << "; WARNING failed in addA for ID "
+		      << elePtr->getID();	    
+	    result = -3;
+	  }
+      }
+    return result;
+  }
+
+//! @brief Form the tangent as K0 + K1 where K0 is the contribution of
+//! the elements whose tangent doesn't depend on their state and K1 the
+//! contribution of the rest of them. K0 is assembled only when it's
+//! out of date (first call, change of the system size, change of the
+//! element tangents, FE_Elements added or removed...), otherwise it's copied from the values stored
+//! in the system of equations.
+int XC::IncrementalIntegrator::formSplitTangent(AnalysisModel &mdl, LinearSOE &theSOE)
+  {
+    int result= 0;
+    const Domain *theDomain= mdl.getDomainPtr();
+    const int modelStamp= (theDomain ? theDomain->getModelStamp() : -1);
+    if(theDomain && tangentSplit.isValid(mdl, theSOE, statusFlag, modelStamp))
+      theSOE.restoreA();
+    else
+      {
+        theSOE.zeroA();
+        tangentSplit.classify(mdl);
+        result= addFETangents(theSOE, tangentSplit.getConstantFEs());
+        if(theSOE.storeA())
+          tangentSplit.setAssembled(mdl, theSOE, statusFlag, modelStamp);
+        else
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; the system of equations: "
+	              << theSOE.getClassName()
+		      << " can't store the constant part of the tangent."
+	              << " Tangent split disabled." << std::endl;
+	    splitTangent= false;
+	  }
+      }
+    const int r= addFETangents(theSOE, tangentSplit.getVariableFEs());
+    if(r<0)
+      result= r;
+    return result;
+  }
+
 //! @brief Builds tangent stiffness matrix.
 //!
 //! Invoked to form the structure tangent matrix. The method first loops
@@ -115,6 +225,9 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
 	return -1;
       }
 
+    if(splitTangent && supportsTangentSplit())
+      return formSplitTangent(*mdl, *theSOE);
+
     theSOE->zeroA(); //Zeroes the matrix elements.
     
     // the loops to form and add the tangents are broken into two for 
@@ -67,6 +67,7 @@
 // What: "@(#) IncrementalIntegrator.h, revA"
 
 #include <solution/analysis/integrator/Integrator.h>
+#include "solution/analysis/integrator/TangentSplit.h"
 
 namespace XC {
 class LinearSOE;
@@ -110,6 +111,11 @@ class IncrementalIntegrator: public Integrator
     virtual int formNodalUnbalance(void);        
     virtual int formElementResidual(void);
     int statusFlag;
+    bool splitTangent; //!< if true, assemble the constant part of the tangent only once (see TangentSplit).
+    TangentSplit tangentSplit; //!< classification of the FE_Elements when splitTangent is true.
+
+    int addFETangents(LinearSOE &, const TangentSplit::fe_container &);
+    int formSplitTangent(AnalysisModel &, LinearSOE &);
 
     IncrementalIntegrator(SolutionStrategy *,int classTag);
   public:
@@ -122,6 +128,12 @@ class IncrementalIntegrator: public Integrator
 
     int getTangFlag(void) const;
     void setTangFlag(const int &);
+    virtual bool supportsTangentSplit(void) const;
+    bool getSplitTangent(void) const;
+    void setSplitTangent(const bool &);
+    const TangentSplit &getTangentSplit(void) const;
+    void clearTangentSplit(void);
+    virtual int spConstraintsChanged(void);
 
     // pure virtual methods to define the FE_ELe and DOF_Group contributions
     //! @brief To inform the FE\_Element how to build its tangent matrix for
@@ -75,6 +75,23 @@
 XC::StaticIntegrator::StaticIntegrator(SolutionStrategy *owr,int clasTag)
   :IncrementalIntegrator(owr,clasTag) {}
 
+//! @brief Return true if the integrator can scale the size of its
+//! steps (used by the adaptive step control of StaticAnalysis).
+bool XC::StaticIntegrator::supportsStepScaling(void) const
+  { return false; }
+
+//! @brief Return true if the tangent can be formed as a constant part
+//! assembled once plus a variable part (see TangentSplit). The element
+//! contributions are their stiffness matrices so it's possible when
+//! using the current tangent.
+bool XC::StaticIntegrator::supportsTangentSplit(void) const
+  { return (statusFlag==CURRENT_TANGENT); }
+
+//! @brief Set the factor that multiplies the nominal increment of the next
+//! steps. Returns -1 because the integrator doesn't support it.
+int XC::StaticIntegrator::setStepScale(const double &)
+  { return -1; }
+
 //! @brief Asks the element  being passed as parameter to build
 //! its tangent stiffness matrix.
 //!
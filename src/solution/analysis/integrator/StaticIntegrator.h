@@ -149,6 +149,10 @@ class StaticIntegrator: public IncrementalIntegrator
     virtual int formNodUnbalance(DOF_Group *theDof);    
     
     virtual int newStep(void) =0;
+
+    virtual bool supportsStepScaling(void) const;
+    virtual bool supportsTangentSplit(void) const;
+    virtual int setStepScale(const double &);
   };
 } // end of XC namespace
 
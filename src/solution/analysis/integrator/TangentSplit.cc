@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TangentSplit.cc
+
+#include "TangentSplit.h"
+#include "domain/mesh/element/Element.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/FE_EleIter.h"
+#include "solution/system_of_eqn/linearSOE/LinearSOE.h"
+
+//! @brief Constructor.
+XC::TangentSplit::ConstantTangentRecord::ConstantTangentRecord(const Element *e, const size_t &v, const bool &a)
+  : element(e), version(v), alive(a) {}
+
+//! @brief Default constructor.
+XC::TangentSplit::TangentSplit(void)
+  : soe(nullptr), statusFlag(-1), modelStamp(-1), feChangeCounter(0), valid(false),
+    numAssemblies(0) {}
+
+//! @brief Forget the classification and mark K0 as not assembled
+//! (the number of assemblies is kept).
+void XC::TangentSplit::clear(void)
+  {
+    records.clear();
+    constantFEs.clear();
+    variableFEs.clear();
+    soe= nullptr;
+    statusFlag= -1;
+    modelStamp= -1;
+    feChangeCounter= 0;
+    valid= false;
+  }
+
+//! @brief Classify the FE_Elements of the model depending on the
+//! behaviour of their tangent. The FE_Elements without a domain element
+//! (i.e. the ones that impose multi-freedom constraints) and the ones
+//! whose transformation changes from one step to the next (see
+//! FE_Element::hasConstantTransformation) are assembled on each iteration.
+void XC::TangentSplit::classify(AnalysisModel &mdl)
+  {
+    clear();
+    FE_Element *fePtr= nullptr;
+    FE_EleIter &theEles= mdl.getFEs();
+    while((fePtr= theEles()) != nullptr)
+      {
+        Element *elem= fePtr->getElement();
+        if(elem && !elem->isSubdomain() && elem->hasConstantTangent() && fePtr->hasConstantTransformation())
+          constantFEs.push_back(fePtr);
+        else
+          variableFEs.push_back(fePtr);
+      }
+  }
+
+//! @brief Record the state of the elements once their contributions
+//! have been assembled and stored as K0 in the system of equations.
+//!
+//! @param mdl: analysis model that owns the FE_Elements.
+//! @param theSOE: system of equations that stores K0.
+//! @param flag: flag used to compute the tangent (see IncrementalIntegrator).
+//! @param stamp: model stamp of the domain (see Domain::getModelStamp).
+void XC::TangentSplit::setAssembled(const AnalysisModel &mdl, const LinearSOE &theSOE, const int &flag, const int &stamp)
+  {
+    records.clear();
+    records.reserve(constantFEs.size());
+    for(fe_container::const_iterator i= constantFEs.begin(); i!=constantFEs.end(); i++)
+      {
+        const Element *elem= (*i)->getElement();
+        records.push_back(ConstantTangentRecord(elem, elem->getTangentStiffVersion(), elem->isAlive()));
+      }
+    soe= &theSOE;
+    statusFlag= flag;
+    modelStamp= stamp;
+    feChangeCounter= mdl.getFE_ChangeCounter();
+    valid= true;
+    numAssemblies++;
+  }
+
+//! @brief Return true if the elements assembled in K0 haven't changed.
+//!
+//! The check asks each element for its tangent (which, for these
+//! elements, only verifies the values it depends on and computes the
+//! matrix again only if any of them has changed) and compares its
+//! version with the one assembled.
+bool XC::TangentSplit::check_elements(void) const
+  {
+    bool retval= true;
+    for(std::vector<ConstantTangentRecord>::const_iterator i= records.begin(); retval && i!=records.end(); i++)
+      {
+        const Element *elem= i->element;
+        if(!elem->hasConstantTangent() || (elem->isAlive()!=i->alive))
+          retval= false;
+        else
+          {
+            elem->getTangentStiff(); // update the cached matrix if needed.
+            retval= (elem->getTangentStiffVersion()==i->version);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Return true if the K0 stored in the system of equations
+//! is up to date.
+//!
+//! If FE_Elements have been added to or removed from the analysis
+//! model (e.g. penalty elements replaced by
+//! PenaltyConstraintHandler::updateSPs) the classification is out of
+//! date and the pointers it keeps may be dangling, so K0 must be
+//! assembled again.
+//!
+//! The elements are checked (see check_elements) only if the model
+//! stamp of the domain has changed since the last check, that is,
+//! once at the beginning of each analysis or after the recorders have
+//! run Python code. On the rest of the iterations only the system of
+//! equations and the tangent flag are compared.
+//!
+//! @param mdl: analysis model that owns the FE_Elements.
+//! @param theSOE: system of equations.
+//! @param flag: flag used to compute the tangent (see IncrementalIntegrator).
+//! @param stamp: model stamp of the domain (see Domain::getModelStamp).
+bool XC::TangentSplit::isValid(const AnalysisModel &mdl, const LinearSOE &theSOE, const int &flag, const int &stamp)
+  {
+    bool retval= valid && (soe==&theSOE) && (statusFlag==flag) && theSOE.hasStoredA() && (feChangeCounter==mdl.getFE_ChangeCounter());
+    if(retval && (stamp!=modelStamp))
+      {
+        retval= check_elements();
+        if(retval)
+          modelStamp= stamp;
+      }
+    return retval;
+  }
@@ -0,0 +1,112 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TangentSplit.h
+
+#ifndef TangentSplit_h
+#define TangentSplit_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class Element;
+class FE_Element;
+class AnalysisModel;
+class LinearSOE;
+
+//! @ingroup AnalysisIntegrator
+//
+//! @brief Split of the FE_Elements of the analysis model in two
+//! groups: the ones whose tangent doesn't depend on the element state
+//! (see Element::hasConstantTangent) nor on the state of the
+//! multi-freedom constraints of its nodes (see
+//! FE_Element::hasConstantTransformation) and the rest of them.
+//!
+//! The contributions of the first group (K0) are assembled once and
+//! kept in the system of equations (see LinearSOE::storeA), so on each
+//! iteration the tangent is formed by restoring K0 and adding only the
+//! contributions of the second group. The object keeps the version
+//! of the tangent of each element in K0 (see
+//! Element::getTangentStiffVersion) so it can detect when K0 is out
+//! of date. The elements are checked only when the model stamp of the
+//! domain changes (see Domain::modelChange), not on each iteration.
+//! The classification is discarded when FE_Elements are added to or
+//! removed from the analysis model (see
+//! AnalysisModel::getFE_ChangeCounter), because the pointers it
+//! keeps are not valid anymore.
+class TangentSplit
+  {
+  public:
+    typedef std::vector<FE_Element *> fe_container;
+  private:
+    //! @brief Data of an element whose tangent is in K0.
+    struct ConstantTangentRecord
+      {
+        const Element *element; //!< domain element.
+        size_t version; //!< version of the element tangent assembled in K0.
+        bool alive; //!< activation state of the element when assembled.
+        ConstantTangentRecord(const Element *, const size_t &, const bool &);
+      };
+    std::vector<ConstantTangentRecord> records; //!< elements assembled in K0.
+    fe_container constantFEs; //!< FE_Elements assembled in K0.
+    fe_container variableFEs; //!< FE_Elements assembled on each iteration.
+    const LinearSOE *soe; //!< system of equations that stores K0.
+    int statusFlag; //!< flag used to compute the tangents of K0.
+    int modelStamp; //!< model stamp of the domain when the elements were last checked.
+    size_t feChangeCounter; //!< FE_Element change counter of the analysis model when K0 was assembled.
+    bool valid; //!< true if K0 has been stored.
+    size_t numAssemblies; //!< number of times K0 has been assembled.
+
+    bool check_elements(void) const;
+  public:
+    TangentSplit(void);
+    void clear(void);
+    void classify(AnalysisModel &);
+    void setAssembled(const AnalysisModel &, const LinearSOE &, const int &, const int &);
+    bool isValid(const AnalysisModel &, const LinearSOE &, const int &, const int &);
+
+    //! @brief Return the FE_Elements whose contribution goes to K0.
+    inline const fe_container &getConstantFEs(void) const
+      { return constantFEs; }
+    //! @brief Return the FE_Elements assembled on each iteration.
+    inline const fe_container &getVariableFEs(void) const
+      { return variableFEs; }
+    //! @brief Return the number of FE_Elements whose contribution goes to K0.
+    inline size_t getNumConstantFEs(void) const
+      { return constantFEs.size(); }
+    //! @brief Return the number of FE_Elements assembled on each iteration.
+    inline size_t getNumVariableFEs(void) const
+      { return variableFEs.size(); }
+    //! @brief Return the number of times K0 has been assembled.
+    inline size_t getNumAssemblies(void) const
+      { return numAssemblies; }
+  };
+
+} // end of XC namespace
+
+#endif
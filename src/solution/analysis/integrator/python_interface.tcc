@@ -27,8 +27,16 @@ class_<XC::Integrator, bases<XC::MovableObject,CommandEntity>, boost::noncopyabl
 
 class_<XC::EigenIntegrator, bases<XC::Integrator>, boost::noncopyable >("EigenIntegrator", no_init);
 
+class_<XC::TangentSplit, boost::noncopyable >("TangentSplit", no_init)
+  .add_property("numConstantFEs",&XC::TangentSplit::getNumConstantFEs,"Number of FE_Elements whose tangent is assembled only once.")
+  .add_property("numVariableFEs",&XC::TangentSplit::getNumVariableFEs,"Number of FE_Elements whose tangent is assembled on each iteration.")
+  .add_property("numAssemblies",&XC::TangentSplit::getNumAssemblies,"Number of times the constant part of the tangent has been assembled.")
+  ;
+
 class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init)
   .add_property("tangFlag",&XC::IncrementalIntegrator::getTangFlag,&XC::IncrementalIntegrator::setTangFlag,"Get/set the value of the flag to compute the tangent stiffness: CURRENT_TANGENT: 0; INITIAL_TANGENT: 1; CURRENT_SECANT: 2; INITIAL_THEN_CURRENT_TANGENT: 3; NO_TANGENT: 4; SECOND_TANGENT: 5; HALL_TANGENT: 6")
+  .add_property("splitTangent",&XC::IncrementalIntegrator::getSplitTangent,&XC::IncrementalIntegrator::setSplitTangent,"If true, the tangent of the elements whose stiffness doesn't depend on their state is assembled only once (only static integrators).")
+  .add_property("tangentSplit",make_function(&XC::IncrementalIntegrator::getTangentSplit, return_internal_reference<>()),"Return the classification of the FE_Elements used when splitTangent is true.")
   ;
 
 class_<XC::StaticIntegrator, bases<XC::IncrementalIntegrator>, boost::noncopyable >("StaticIntegrator", no_init);
@@ -73,7 +73,7 @@
 //! @param classTag: class identifier.
 //! @param numIncr: number of increments.
 XC::BaseControl::BaseControl(SolutionStrategy *owr,int classTag,int numIncr)
-:StaticIntegrator(owr,classTag), specNumIncrStep(numIncr), numIncrLastStep(numIncr)
+:StaticIntegrator(owr,classTag), specNumIncrStep(numIncr), numIncrLastStep(numIncr), stepScale(1.0)
   { setup_numIncr(numIncr); }
 
 void XC::BaseControl::setup_numIncr(const int &numIncr)
@@ -42,6 +42,7 @@ class BaseControl: public StaticIntegrator
   protected:
     double specNumIncrStep; //!< Jd factor relating load increment at subsequent time steps. (optional, default: 1.0)
     double numIncrLastStep; //!< J(i-1). 
+    double stepScale; //!< factor that multiplies the increment of the step (adaptive step control).
 
     int sendData(Communicator &);
     int recvData(const Communicator &);
@@ -206,7 +206,7 @@ int XC::DisplacementControl::newStep(void)
       }
     
     // determine delta lambda(1) == dlambda    
-    const double dLambda= theIncrement/dUahat;
+    const double dLambda= stepScale*theIncrement/dUahat;
 
     vectors.newStep(dLambda);
 
@@ -225,6 +225,18 @@ int XC::DisplacementControl::newStep(void)
     return 0;
   }
 
+//! @brief Displacement control supports step scaling.
+bool XC::DisplacementControl::supportsStepScaling(void) const
+  { return true; }
+
+//! @brief Set the factor that multiplies the displacement increment
+//! in the next steps.
+int XC::DisplacementControl::setStepScale(const double &s)
+  {
+    stepScale= s;
+    return 0;
+  }
+
 int XC::DisplacementControl::update(const Vector &dU)
   {
     if(theDofID == -1)
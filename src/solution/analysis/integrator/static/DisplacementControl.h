@@ -115,6 +115,8 @@ class DisplacementControl: public DispBase
     ~DisplacementControl(void);
 
     int newStep(void);    
+    bool supportsStepScaling(void) const;
+    int setStepScale(const double &);
     int commit(void);
     int update(const Vector &deltaU);
     int domainChanged(void);
@@ -108,7 +108,7 @@ int XC::LoadControl::newStep(void)
         else if (deltaLambda > dLambdaMax)
           deltaLambda = dLambdaMax;
 
-        const double currentLambda= getCurrentModelTime() + deltaLambda;
+        const double currentLambda= getCurrentModelTime() + stepScale*deltaLambda;
         applyLoadModel(currentLambda);
         numIncrLastStep = 0;
       }
@@ -154,6 +154,17 @@ int XC::LoadControl::update(const Vector &deltaU)
     return 0;
   }
 
+//! @brief Load control supports step scaling.
+bool XC::LoadControl::supportsStepScaling(void) const
+  { return true; }
+
+//! @brief Set the factor that multiplies delta lambda in the next steps.
+int XC::LoadControl::setStepScale(const double &s)
+  {
+    stepScale= s;
+    return 0;
+  }
+
 //! @brief Sets deltaLambda and updates dLamdaMin and dLambdaMax values.
 void XC::LoadControl::setDeltaLambda(const double &newValue)
   {
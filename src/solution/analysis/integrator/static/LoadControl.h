@@ -126,6 +126,8 @@ class LoadControl: public BaseControl
   public:
 
     int newStep(void);    
+    bool supportsStepScaling(void) const;
+    int setStepScale(const double &);
     int update(const Vector &deltaU);
     void setDeltaLambda(const double &);
     inline double getDeltaLambda(void) const
@@ -97,7 +97,7 @@
 //! automatically if the problem needs it.
 XC::AnalysisModel::AnalysisModel(ModelWrapper *owr)
   :MovableObject(AnaMODEL_TAGS_AnalysisModel), CommandEntity(owr),
-   numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+   numFE_Ele(0), numDOF_Grp(0), numEqn(0), feChangeCounter(0),
    theFEs(this,256,"FEs"), theDOFGroups(this,256,"DOFs"), theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
    myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
@@ -109,7 +109,7 @@ XC::AnalysisModel::AnalysisModel(ModelWrapper *owr)
 //! subclass.
 XC::AnalysisModel::AnalysisModel(int theClassTag,CommandEntity *owr)
   :MovableObject(theClassTag), CommandEntity(owr),
-   numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+   numFE_Ele(0), numDOF_Grp(0), numEqn(0), feChangeCounter(0),
    theFEs(this,1024,"FEs"), theDOFGroups(this,1024,"DOFs"),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
    myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
@@ -118,6 +118,7 @@ XC::AnalysisModel::AnalysisModel(int theClassTag,CommandEntity *owr)
 XC::AnalysisModel::AnalysisModel(const AnalysisModel &other)
   : MovableObject(other), CommandEntity(other),
    numFE_Ele(other.numFE_Ele), numDOF_Grp(other.numDOF_Grp), numEqn(other.numEqn),
+   feChangeCounter(other.feChangeCounter),
    theFEs(other.theFEs), theDOFGroups(other.theDOFGroups),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
    myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
@@ -130,6 +131,7 @@ XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
     numFE_Ele= other.numFE_Ele;
     numDOF_Grp= other.numDOF_Grp;
     numEqn= other.numEqn;
+    feChangeCounter= other.feChangeCounter;
     theFEs= other.theFEs;
     theDOFGroups= other.theDOFGroups;
     myDOFGraph= DOF_Graph(*this);
@@ -191,6 +193,7 @@ bool XC::AnalysisModel::addFE_Element(FE_Element *theElement)
 	      {
 		theElement->setAnalysisModel(*this);
 		numFE_Ele++;
+		feChangeCounter++;
 		updateGraphs= true;
 	      }
 	  }
@@ -198,6 +201,26 @@ bool XC::AnalysisModel::addFE_Element(FE_Element *theElement)
     return retval;
   }
 
+//! @brief Removes the FE_Element identified by the argument from the
+//! model (and deletes it).
+//!
+//! @param tag: identifier of the FE_Element to remove.
+bool XC::AnalysisModel::removeFE_Element(int tag)
+  {
+    const bool retval= theFEs.removeComponent(tag);
+    if(retval)
+      {
+        numFE_Ele--;
+        feChangeCounter++;
+	updateGraphs= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; element with tag " << tag
+		<< " not found in model.\n";
+    return retval;
+  }
+
 //! @brief Creates a FE_Element and appends it to the model.
 XC::FE_Element *XC::AnalysisModel::createFE_Element(const int &tag, Element *elePtr)
   {
@@ -518,6 +541,7 @@ void XC::AnalysisModel::clearAll(void)
     numFE_Ele=0;
     numDOF_Grp= 0;
     numEqn= 0;    
+    feChangeCounter++;
     updateGraphs= true;
   }
 
@@ -572,6 +596,13 @@ XC::FE_EleConstIter &XC::AnalysisModel::getConstFEs() const
     return theFEconst_iter;
   }
 
+//! @brief Return the number of times FE_Elements have been added to
+//! or removed from the model. The objects that keep pointers to the
+//! FE_Elements (see TangentSplit) use it to know when those pointers
+//! are not valid anymore.
+size_t XC::AnalysisModel::getFE_ChangeCounter(void) const
+  { return feChangeCounter; }
+
 XC::DOF_GrpIter &XC::AnalysisModel::getDOFGroups()
   {
     theDOFGroupiter.reset();
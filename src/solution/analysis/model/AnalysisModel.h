@@ -137,6 +137,7 @@ class AnalysisModel: public MovableObject, public CommandEntity
     int numFE_Ele; //!< number of FE_Elements objects added
     int numDOF_Grp; //!< number of DOF_Group objects added
     int numEqn; //!< numEqn set by the ConstraintHandler typically
+    size_t feChangeCounter; //!< number of times the set of FE_Elements has changed.
 
     ArrayOfTaggedObjects theFEs;
     ArrayOfTaggedObjects theDOFGroups;
@@ -169,6 +170,8 @@ class AnalysisModel: public MovableObject, public CommandEntity
     friend class AutoConstraintHandler;
     virtual bool addDOF_Group(DOF_Group *theDOF_Grp);
     virtual bool addFE_Element(FE_Element *theFE_Ele);
+    friend class PenaltyConstraintHandler;
+    virtual bool removeFE_Element(int tag);
 
     friend class ModelWrapper;
     friend class FEM_ObjectBroker;
@@ -205,6 +208,7 @@ class AnalysisModel: public MovableObject, public CommandEntity
     virtual FE_EleIter &getFEs();
     virtual DOF_GrpIter &getDOFGroups();
     virtual FE_EleConstIter &getConstFEs() const;
+    size_t getFE_ChangeCounter(void) const;
     virtual DOF_GrpConstIter &getConstDOFs() const;
 
     // method to access the connectivity for SysOfEqn to size itself
@@ -0,0 +1,279 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseTransformation.cc
+
+#include "SparseTransformation.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include <iostream>
+
+//! @brief Constructor.
+XC::SparseTransformation::SparseTransformation(void)
+  {}
+
+//! @brief Remove all the blocks.
+void XC::SparseTransformation::clear(void)
+  {
+    blockRows.clear();
+    blockCols.clear();
+    blockColPtrBegin.clear();
+    colPtr.clear();
+    blockValueBegin.clear();
+    rowIdx.clear();
+    values.clear();
+  }
+
+//! @brief Append the block corresponding to the transformation matrix
+//! argument and return its index.
+//!
+//! @param T: (dense) transformation matrix of the DOF group.
+//! @param keepPattern: if true store also the zero entries so the
+//! block can be updated latter (time-varying constraints).
+int XC::SparseTransformation::addBlock(const Matrix &T, bool keepPattern)
+  {
+    const int retval= blockRows.size();
+    const int nRows= T.noRows();
+    const int nCols= T.noCols();
+    blockRows.push_back(nRows);
+    blockCols.push_back(nCols);
+    blockColPtrBegin.push_back(colPtr.size());
+    const size_t valueBegin= values.size();
+    blockValueBegin.push_back(valueBegin);
+    colPtr.push_back(0);
+    for(int j= 0; j<nCols; j++)
+      {
+        for(int i= 0; i<nRows; i++)
+	  {
+	    const double v= T(i,j);
+	    if(keepPattern || (v!=0.0))
+	      {
+		rowIdx.push_back(i);
+		values.push_back(v);
+	      }
+	  }
+	colPtr.push_back(values.size()-valueBegin);
+      }
+    return retval;
+  }
+
+//! @brief Update the values of the block from the dense matrix argument.
+//!
+//! The sparsity pattern of the block is not modified so the
+//! block must be created with keepPattern= true if the non-zero
+//! entries of the matrix can change.
+int XC::SparseTransformation::updateBlock(int iBlock, const Matrix &T)
+  {
+    if((iBlock<0) || (iBlock>=static_cast<int>(getNumBlocks())))
+      {
+	std::cerr << "SparseTransformation::" << __FUNCTION__
+		  << "; block index: " << iBlock
+		  << " out of range." << std::endl;
+	return -1;
+      }
+    const int nRows= blockRows[iBlock];
+    const int nCols= blockCols[iBlock];
+    if((T.noRows()!=nRows) || (T.noCols()!=nCols))
+      {
+	std::cerr << "SparseTransformation::" << __FUNCTION__
+		  << "; matrix dimensions (" << T.noRows() << 'x'
+		  << T.noCols() << ") don't match block dimensions ("
+		  << nRows << 'x' << nCols << ")." << std::endl;
+	return -2;
+      }
+    const int *cp= colPtr.data()+blockColPtrBegin[iBlock];
+    const size_t offset= blockValueBegin[iBlock];
+    for(int j= 0; j<nCols; j++)
+      for(int k= cp[j]; k<cp[j+1]; k++)
+	values[offset+k]= T(rowIdx[offset+k],j);
+    return 0;
+  }
+
+//! @brief Return the location of the block whose index is being passed
+//! as parameter.
+XC::SparseTransformation::Block XC::SparseTransformation::getBlock(int iBlock) const
+  {
+    Block retval;
+    if((iBlock>=0) && (iBlock<static_cast<int>(getNumBlocks())))
+      {
+	retval.nRows= blockRows[iBlock];
+	retval.nCols= blockCols[iBlock];
+	retval.index= iBlock;
+	retval.colPtrBegin= blockColPtrBegin[iBlock];
+	retval.valueBegin= blockValueBegin[iBlock];
+      }
+    else
+      std::cerr << "SparseTransformation::" << __FUNCTION__
+		<< "; block index: " << iBlock
+		<< " out of range." << std::endl;
+    return retval;
+  }
+
+//! @brief Compute T^t K T where T is the block diagonal matrix
+//! defined by the blocks argument (see Block::isIdentity).
+//!
+//! @param blocks: diagonal blocks of T (one for each node).
+//! @param K: matrix to transform (original DOFs).
+//! @param result: transformed matrix (already sized).
+//! @param work: scratch storage for the K T product.
+void XC::SparseTransformation::transformTangent(const std::vector<Block> &blocks, const Matrix &K, Matrix &result, std::vector<double> &work) const
+  {
+    const int nOrig= K.noRows();
+    const int nTrans= result.noRows();
+    work.assign(static_cast<size_t>(nOrig)*nTrans, 0.0);
+    const double *k= K.getDataPtr();
+    double *kt= work.data();
+
+    // KT= K * T (only the non-zero entries of T are visited).
+    int origOffset= 0;
+    int transOffset= 0;
+    for(std::vector<Block>::const_iterator i= blocks.begin(); i!=blocks.end(); i++)
+      {
+	const Block &b= *i;
+	const int *cp= colPtr.data()+b.colPtrBegin;
+	const int *ri= rowIdx.data()+b.valueBegin;
+	const double *vals= values.data()+b.valueBegin;
+	for(int c= 0; c<b.nCols; c++)
+	  {
+	    double *ktCol= kt+static_cast<size_t>(transOffset+c)*nOrig;
+	    if(!b.isIdentity()) // general block.
+	      {
+		for(int p= cp[c]; p<cp[c+1]; p++)
+		  {
+		    const double v= vals[p];
+		    const double *kCol= k+static_cast<size_t>(origOffset+ri[p])*nOrig;
+		    for(int r= 0; r<nOrig; r++)
+		      ktCol[r]+= v*kCol[r];
+		  }
+	      }
+	    else // identity.
+	      {
+		const double *kCol= k+static_cast<size_t>(origOffset+c)*nOrig;
+		for(int r= 0; r<nOrig; r++)
+		  ktCol[r]= kCol[r];
+	      }
+	  }
+	origOffset+= b.nRows;
+	transOffset+= b.nCols;
+      }
+
+    // result= T^t * KT
+    double *res= result.getDataPtr();
+    for(int col= 0; col<nTrans; col++)
+      {
+	const double *ktCol= kt+static_cast<size_t>(col)*nOrig;
+	double *resCol= res+static_cast<size_t>(col)*nTrans;
+	origOffset= 0;
+	transOffset= 0;
+	for(std::vector<Block>::const_iterator i= blocks.begin(); i!=blocks.end(); i++)
+	  {
+	    const Block &b= *i;
+	    const int *cp= colPtr.data()+b.colPtrBegin;
+	    const int *ri= rowIdx.data()+b.valueBegin;
+	    const double *vals= values.data()+b.valueBegin;
+	    for(int c= 0; c<b.nCols; c++)
+	      {
+		if(!b.isIdentity()) // general block.
+		  {
+		    double sum= 0.0;
+		    for(int p= cp[c]; p<cp[c+1]; p++)
+		      sum+= vals[p]*ktCol[origOffset+ri[p]];
+		    resCol[transOffset+c]= sum;
+		  }
+		else // identity.
+		  resCol[transOffset+c]= ktCol[origOffset+c];
+	      }
+	    origOffset+= b.nRows;
+	    transOffset+= b.nCols;
+	  }
+      }
+  }
+
+//! @brief Compute T^t R where T is the block diagonal matrix
+//! defined by the blocks argument.
+//!
+//! @param blocks: diagonal blocks of T (one for each node).
+//! @param R: vector to transform (original DOFs).
+//! @param result: transformed vector (already sized).
+void XC::SparseTransformation::transformResidual(const std::vector<Block> &blocks, const Vector &R, Vector &result) const
+  {
+    int origOffset= 0;
+    int transOffset= 0;
+    for(std::vector<Block>::const_iterator i= blocks.begin(); i!=blocks.end(); i++)
+      {
+	const Block &b= *i;
+	const int *cp= colPtr.data()+b.colPtrBegin;
+	const int *ri= rowIdx.data()+b.valueBegin;
+	const double *vals= values.data()+b.valueBegin;
+	for(int c= 0; c<b.nCols; c++)
+	  {
+	    if(!b.isIdentity()) // general block.
+	      {
+		double sum= 0.0;
+		for(int p= cp[c]; p<cp[c+1]; p++)
+		  sum+= vals[p]*R(origOffset+ri[p]);
+		result(transOffset+c)= sum;
+	      }
+	    else // identity.
+	      result(transOffset+c)= R(origOffset+c);
+	  }
+	origOffset+= b.nRows;
+	transOffset+= b.nCols;
+      }
+  }
+
+//! @brief Compute T U where T is the block diagonal matrix
+//! defined by the blocks argument (transformed to original DOFs).
+//!
+//! @param blocks: diagonal blocks of T (one for each node).
+//! @param modResp: vector to transform (transformed DOFs).
+//! @param unmodResp: vector in original DOFs (already sized).
+void XC::SparseTransformation::transformResponse(const std::vector<Block> &blocks, const Vector &modResp, Vector &unmodResp) const
+  {
+    unmodResp.Zero();
+    int origOffset= 0;
+    int transOffset= 0;
+    for(std::vector<Block>::const_iterator i= blocks.begin(); i!=blocks.end(); i++)
+      {
+	const Block &b= *i;
+	const int *cp= colPtr.data()+b.colPtrBegin;
+	const int *ri= rowIdx.data()+b.valueBegin;
+	const double *vals= values.data()+b.valueBegin;
+	for(int c= 0; c<b.nCols; c++)
+	  {
+	    const double u= modResp(transOffset+c);
+	    if(!b.isIdentity()) // general block.
+	      {
+		for(int p= cp[c]; p<cp[c+1]; p++)
+		  unmodResp(origOffset+ri[p])+= vals[p]*u;
+	      }
+	    else // identity.
+	      unmodResp(origOffset+c)= u;
+	  }
+	origOffset+= b.nRows;
+	transOffset+= b.nCols;
+      }
+  }
@@ -0,0 +1,103 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseTransformation.h
+
+#ifndef SparseTransformation_h
+#define SparseTransformation_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class Matrix;
+class Vector;
+
+//! @ingroup Analysis
+//
+//! @brief Global block diagonal transformation matrix T stored in
+//! compressed sparse column format.
+//!
+//! Each block corresponds to a DOF_Group affected by a constraint
+//! (see TransformationDOF_Group) and relates the original nodal
+//! degrees of freedom (rows) with the transformed ones (columns).
+//! The storage is assembled once by the TransformationConstraintHandler
+//! (after numbering the DOFs) and then shared by all the TransformationFE
+//! objects, which keep the location (not the address) of their blocks.
+//! The kernels don't use any static buffer so they can be called
+//! concurrently from different elements.
+class SparseTransformation
+  {
+  public:
+    //! @brief Location of one of the blocks in the storage.
+    //!
+    //! Stores offsets (not pointers) into the vectors of the
+    //! SparseTransformation so it remains valid if those vectors
+    //! are reallocated.
+    struct Block
+      {
+	int nRows; //!< number of original DOFs (rows).
+	int nCols; //!< number of transformed DOFs (columns).
+	int index; //!< index of the block (-1 for an identity block).
+	size_t colPtrBegin; //!< position of the first column pointer (size nCols+1).
+	size_t valueBegin; //!< position of the first non-zero entry.
+	Block(void)
+	  : nRows(0), nCols(0), index(-1), colPtrBegin(0), valueBegin(0) {}
+	//! @brief Return true if the block is an identity matrix.
+	inline bool isIdentity(void) const
+	  { return (index<0); }
+      };
+  private:
+    std::vector<int> blockRows; //!< number of rows of each block.
+    std::vector<int> blockCols; //!< number of columns of each block.
+    std::vector<size_t> blockColPtrBegin; //!< position of the first column pointer of each block.
+    std::vector<int> colPtr; //!< column pointers (relative to the block values).
+    std::vector<size_t> blockValueBegin; //!< position of the first value of each block.
+    std::vector<int> rowIdx; //!< row indexes.
+    std::vector<double> values; //!< non-zero values.
+  public:
+    SparseTransformation(void);
+
+    void clear(void);
+    int addBlock(const Matrix &, bool keepPattern= false);
+    int updateBlock(int, const Matrix &);
+
+    //! @brief Return the number of blocks.
+    inline size_t getNumBlocks(void) const
+      { return blockRows.size(); }
+    //! @brief Return the number of non-zero entries.
+    inline size_t getNumNonZeros(void) const
+      { return values.size(); }
+    Block getBlock(int) const;
+
+    void transformTangent(const std::vector<Block> &, const Matrix &, Matrix &, std::vector<double> &) const;
+    void transformResidual(const std::vector<Block> &, const Vector &, Vector &) const;
+    void transformResponse(const std::vector<Block> &, const Vector &, Vector &) const;
+  };
+} // end of XC namespace
+
+#endif
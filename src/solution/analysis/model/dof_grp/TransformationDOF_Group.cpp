@@ -74,9 +74,7 @@
 const int MAX_NUM_DOF= 16;
 
 // static variables initialization
-XC::UnbalAndTangentStorage XC::TransformationDOF_Group::unbalAndTangentArrayMod(MAX_NUM_DOF+1);
 XC::TransformationConstraintHandler *XC::TransformationDOF_Group::theHandler= nullptr;     // number of objects
-XC::Vector XC::TransformationDOF_Group::modTrialDispOld;
 
 //! @brief Create SFreedom_Constraint pointer array
 std::vector<XC::SFreedom_Constraint *> XC::TransformationDOF_Group::getSFreedomConstraintArray(int numNodalDOF) const
@@ -154,16 +152,18 @@ void XC::TransformationDOF_Group::initialize(TransformationConstraintHandler *th
   }
 
 XC::TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, MFreedom_ConstraintBase *m, TransformationConstraintHandler *theTHandler)  
-  :DOF_Group(tag,node), mfc_ptr(m), unbalAndTangentMod(0,unbalAndTangentArrayMod),
-  needRetainedData(-1), theSPs()
+  :DOF_Group(tag,node), mfc_ptr(m), unbalAndTangentArrayMod(0),
+   unbalAndTangentMod(0,unbalAndTangentArrayMod),
+   needRetainedData(-1), theSPs(), sparseT(nullptr), sparseTBlock(-1)
   {
-    initialize(theHandler);
+    initialize(theTHandler);
   }        
 
 XC::TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, TransformationConstraintHandler *theTHandler)
   :DOF_Group(tag,node), mfc_ptr(nullptr), modNumDOF(node->getNumberDOF()),
+   unbalAndTangentArrayMod(0),
    unbalAndTangentMod(node->getNumberDOF(),unbalAndTangentArrayMod),
-  needRetainedData(-1), theSPs()
+   needRetainedData(-1), theSPs(), sparseT(nullptr), sparseTBlock(-1)
   {
     // create space for the SFreedom_Constraint array
     theSPs= std::vector<SFreedom_Constraint *>(modNumDOF,static_cast<SFreedom_Constraint *>(nullptr));
@@ -764,6 +764,65 @@ const XC::Matrix *XC::TransformationDOF_Group::getT(void) const
     return retval;
   }
 
+//! @brief Store the transformation matrix of this group in the global
+//! sparse transformation argument (called by the constraint handler
+//! once the DOFs are numbered).
+int XC::TransformationDOF_Group::setSparseT(SparseTransformation &st)
+  {
+    sparseT= &st;
+    sparseTBlock= -1;
+    const Matrix *T= this->getT();
+    if(T)
+      {
+        const MFreedom_ConstraintBase *mfc= this->getMFreedomConstraint();
+	// Keep the whole pattern if the values can change.
+	const bool keepPattern= mfc->isTimeVarying();
+        sparseTBlock= st.addBlock(*T, keepPattern);
+      }
+    return sparseTBlock;
+  }
+
+//! @brief Return true if the transformation matrix of this group
+//! changes during the analysis (time-varying constraint).
+bool XC::TransformationDOF_Group::hasTimeVaryingT(void) const
+  {
+    const MFreedom_ConstraintBase *mfc= this->getMFreedomConstraint();
+    return (mfc && mfc->isTimeVarying());
+  }
+
+//! @brief Update the values of the block of this group in the global
+//! sparse transformation (only needed for time-varying constraints).
+int XC::TransformationDOF_Group::updateSparseT(SparseTransformation &st) const
+  {
+    int retval= 0;
+    if(sparseTBlock>=0)
+      {
+        const MFreedom_ConstraintBase *mfc= this->getMFreedomConstraint();
+	if(mfc->isTimeVarying())
+	  {
+	    const Matrix *T= this->getT(); // recomputes T.
+	    retval= st.updateBlock(sparseTBlock, *T);
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Return the block of the global sparse transformation
+//! corresponding to this group. If the group has no transformation
+//! matrix the returned block is an identity one.
+XC::SparseTransformation::Block XC::TransformationDOF_Group::getSparseT(void) const
+  {
+    SparseTransformation::Block retval;
+    if(sparseT && (sparseTBlock>=0))
+      retval= sparseT->getBlock(sparseTBlock);
+    else
+      {
+        const int numDOF= this->getNumDOF();
+	retval.nRows= numDOF;
+	retval.nCols= numDOF;
+      }
+    return retval;
+  }
 
 int XC::TransformationDOF_Group::doneID(void)
   {
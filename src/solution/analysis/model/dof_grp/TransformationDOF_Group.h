@@ -68,6 +68,7 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include "utility/matrix/Matrix.h"
 #include "solution/analysis/model/UnbalAndTangent.h"
+#include "solution/analysis/model/SparseTransformation.h"
 #include "domain/mesh/node/Node.h"
 #include "domain/constraints/MFreedom_ConstraintBase.h"
 
@@ -99,12 +100,14 @@ class TransformationDOF_Group: public DOF_Group
     mutable Matrix Trans;
     ID modID;
     int modNumDOF;
+    UnbalAndTangentStorage unbalAndTangentArrayMod; //!< vectors and matrices of this object (reentrant).
     mutable UnbalAndTangent unbalAndTangentMod;
     int needRetainedData;
     std::vector<SFreedom_Constraint *> theSPs; //!< Pointers to single-freedom constraints.
+    const SparseTransformation *sparseT; //!< global sparse transformation (owned by the handler).
+    int sparseTBlock; //!< index of the block of this group in sparseT.
     
     // static variables - single copy for all objects of the class	    
-    static UnbalAndTangentStorage unbalAndTangentArrayMod; //!< array of class wide vectors and matrices
     static TransformationConstraintHandler *theHandler; //!< Transformation constraint handler.
 
 #ifdef TRANSF_INCREMENTAL_MP
@@ -112,7 +115,7 @@ class TransformationDOF_Group: public DOF_Group
     // on getting it from the retained node when processing the constrained
     // node: the retained node may have been processed before
     mutable Vector modTotalDisp;
-    static Vector modTrialDispOld;
+    Vector modTrialDispOld; //!< modTotalDisp at previous iteration.
 #endif // TRANSF_INCREMENTAL_MP
     
     void arrays_setup(int numNodalDOF, int numRetainedNodeDOF, int numRetainedNodes);
@@ -149,6 +152,14 @@ class TransformationDOF_Group: public DOF_Group
     const ID &getID(void) const; 
     virtual void setID(int dof, int value);    
     const Matrix *getT(void) const;
+    int setSparseT(SparseTransformation &);
+    int updateSparseT(SparseTransformation &) const;
+    bool hasTimeVaryingT(void) const;
+    SparseTransformation::Block getSparseT(void) const;
+    //! @brief Return the global sparse transformation that stores
+    //! the block of this group (nullptr if not assigned yet).
+    inline const SparseTransformation *getSparseTransformation(void) const
+      { return sparseT; }
     virtual int getNumDOF(void) const;    
     virtual int getNumFreeDOF(void) const;
     virtual int getNumConstrainedDOF(void) const;
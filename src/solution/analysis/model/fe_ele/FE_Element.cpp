@@ -1255,3 +1255,9 @@ int XC::FE_Element::updateElement(void)
     else
       return 0;
   }
+
+//! @brief Return true if the matrix that transforms the element
+//! tangent into the tangent of this object doesn't change during
+//! the analysis (no transformation at all in this class).
+bool XC::FE_Element::hasConstantTransformation(void) const
+  { return true; }
@@ -176,6 +176,7 @@ class FE_Element: public TaggedObject
     virtual void  addD_Force(const Vector &vel, double fact = 1.0);    
 
     virtual int updateElement(void);
+    virtual bool hasConstantTransformation(void) const;
 
     virtual Integrator *getLastIntegrator(void);
     virtual const Vector &getLastResponse(void);
@@ -64,29 +64,21 @@
 #include <solution/analysis/integrator/Integrator.h>
 #include "domain/domain/subdomain/Subdomain.h"
 #include <solution/analysis/model/AnalysisModel.h>
-#include <utility/matrix/IntPtrWrapper.h>
+#include <solution/analysis/model/dof_grp/TransformationDOF_Group.h>
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
 
-const int MAX_NUM_DOF= 64;
-
-// static variables initialization
-XC::UnbalAndTangentStorage XC::TransformationFE::unbalAndTangentArrayMod(MAX_NUM_DOF+1);
-std::vector<const XC::Matrix *> XC::TransformationFE::theTransformations; 
-int XC::TransformationFE::numTransFE(0);           
-int XC::TransformationFE::transCounter(0);           
-int XC::TransformationFE::sizeTransformations(0);          
-XC::Vector XC::TransformationFE::dataBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
-XC::Vector XC::TransformationFE::localKbuffer(MAX_NUM_DOF*MAX_NUM_DOF);          
-XC::ID XC::TransformationFE::dofData(MAX_NUM_DOF);          
-int XC::TransformationFE::sizeBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
+//! @brief Transformation without blocks (all the nodes unconstrained).
+const XC::SparseTransformation XC::TransformationFE::identityT;
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //        construictor that take the corresponding model element.
 XC::TransformationFE::TransformationFE(int tag, Element *ele)
   :FE_Element(tag, ele), theDOFs(), /* numSPs(0), theSPs(),*/  
-  numGroups(0), numTransformedDOF(0),unbalAndTangentMod(numTransformedDOF,unbalAndTangentArrayMod)
+   numGroups(0), numTransformedDOF(0), unbalAndTangentArrayMod(0),
+   unbalAndTangentMod(numTransformedDOF,unbalAndTangentArrayMod),
+   theSparseT(&identityT), theTransformations()
   {
   // set number of original dof at ele
     numOriginalDOF = ele->getNumDOF();
@@ -121,33 +113,11 @@ XC::TransformationFE::TransformationFE(int tag, Element *ele)
           }        
         theDOFs[i] = theDofGroup;
       }
-
-    // see if theTransformation array is big enough
-    // if not delete the old and create a new_ one
-    if(numNodes > sizeTransformations)
-      {
-        theTransformations.resize(numNodes,static_cast<const Matrix *>(nullptr));
-        sizeTransformations = numNodes;
-      }        
-
-    // increment the number of transformations
-    numTransFE++;
   }
 
 //! @brief Destructor.
 XC::TransformationFE::~TransformationFE(void)
-  {
-    numTransFE--;
-
-    // if this is the last XC::FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if(numTransFE == 0)
-      {
-        sizeTransformations = 0;
-        sizeBuffer = 0;
-        transCounter = 0;
-      }
-  }    
+  {}    
 
 
 const XC::ID &XC::TransformationFE::getDOFtags(void) const 
@@ -193,109 +163,73 @@ int XC::TransformationFE::setID(void)
               }                
       }
     unbalAndTangentMod= UnbalAndTangent(numTransformedDOF,unbalAndTangentArrayMod);
+
+    // get the blocks of the global transformation matrix
+    // corresponding to each node (identity if not constrained).
+    theSparseT= &identityT;
+    theTransformations.resize(numGroups);
+    for(int i=0; i<numGroups; i++)
+      {
+        const TransformationDOF_Group *tDofPtr= dynamic_cast<const TransformationDOF_Group *>(theDOFs[i]);
+	if(tDofPtr)
+	  {
+	    theTransformations[i]= tDofPtr->getSparseT();
+	    if(tDofPtr->getSparseTransformation())
+	      theSparseT= tDofPtr->getSparseTransformation();
+	  }
+	else
+	  {
+	    const int numDOF= theDOFs[i]->getNumDOF();
+	    theTransformations[i]= SparseTransformation::Block();
+	    theTransformations[i].nRows= numDOF;
+	    theTransformations[i].nCols= numDOF;
+	  }
+      }
     return 0;
   }
 
-const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
+//! @brief Compute T^t K T and return it.
+//!
+//! As T is block diagonal (one block for each node) and very sparse,
+//! only its non-zero entries are visited.
+const XC::Matrix &XC::TransformationFE::transformTangent(const Matrix &theTangent)
   {
-    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
+    // scratch storage for the K*T product (one for each thread).
+    static thread_local std::vector<double> work;
+    Matrix &modTangent= unbalAndTangentMod.getTangent();
+    theSparseT->transformTangent(theTransformations, theTangent, modTangent, work);
+    return modTangent;
+  }
 
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-    
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for(int a= 0;a<numNode;a++)
+//! @brief Compute T^t K T u where K is the element matrix
+//! already added to the tangent and u the components of the
+//! vector argument that correspond to this element.
+const XC::Vector &XC::TransformationFE::transformedMatrixVector(const Vector &v)
+  {
+    const Matrix &modTangent= this->transformTangent(this->FE_Element::getTangent(0));
+
+    // get the components we need out of the vector
+    // and place in a temporary vector
+    Vector tmp(numTransformedDOF);
+    for(int j=0; j<numTransformedDOF; j++)
       {
-        const Matrix *theT= theDOFs[a]->getT();
-        theTransformations[a] = theT;
-        if(theT != 0)
-          numDOFs[a] = theT->noRows(); // T^ 
-        else
-          numDOFs[a] = theDOFs[a]->getNumDOF();
+	const int dof= modID(j);
+	if(dof >= 0)
+	  tmp(j)= v(dof);
+	else
+	  tmp(j)= 0.0;
       }
 
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static Matrix localK;
-
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++)
-      {
-        int startCol = 0;
-        int numDOFi = numDOFs[i];        
-        int noColsOriginal = 0;
+    Vector &retval= unbalAndTangentMod.getUnbalance();
+    retval.addMatrixVector(0.0, modTangent, tmp, 1.0);
+    return retval;
+  }
 
-        for(int j=0; j<numNode; j++)
-	  {
-            const Matrix *Ti= theTransformations[i];
-            const Matrix *Tj= theTransformations[j];
-            int numDOFj = numDOFs[j];        
-            localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-
-            // copy K(i,j) into localK matrix
-            // CHECK SIZE OF BUFFER            
-            for(int a=0; a<numDOFi; a++)
-	      for(int b=0; b<numDOFj; b++)
-		localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-            // now perform the matrix computation T(i)^T localK T(j)
-            // note: if T == 0 then the Identity is assumed
-            int noColsTransformed = 0;
-            static Matrix localTtKT;
-            
-            if(Ti != 0 && Tj != 0)
-	      {
-                noRowsTransformed = Ti->noCols();
-                noColsTransformed = Tj->noCols();
-                // CHECK SIZE OF BUFFER
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                localTtKT = (*Ti) ^ localK * (*Tj);
-	      }
-	    else if(Ti == 0 && Tj != 0)
-	      {
-                noRowsTransformed = numDOFi;
-                noColsTransformed = Tj->noCols();
-                // CHECK SIZE OF BUFFER
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                // localTtKT = localK * (*Tj);               
-                localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	      }
-	    else if(Ti != 0 && Tj == 0)
-	      {
-                noRowsTransformed = Ti->noCols();
-                noColsTransformed = numDOFj;
-                // CHECK SIZE OF BUFFER
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                localTtKT = (*Ti) ^ localK;
-	      }
-	    else
-	      {
-                noRowsTransformed = numDOFi;
-                noColsTransformed = numDOFj;
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                localTtKT = localK;
-	      }
-            // now copy into modTangent the T(i)^t K(i,j) T(j) product
-            for(int c=0; c<noRowsTransformed; c++) 
-                for(int d=0; d<noColsTransformed; d++) 
-                    (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-            
-            startCol += noColsTransformed;
-            noColsOriginal += numDOFj;
-	  }
-        noRowsOriginal += numDOFi;
-        startRow += noRowsTransformed;
-      }
-    return unbalAndTangentMod.getTangent();
+const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
+  {
+    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
+    // DO THE SP STUFF TO THE TANGENT 
+    return this->transformTangent(theTangent);
   }
 
 
@@ -306,50 +240,10 @@ const XC::Vector &XC::TransformationFE::getResidual(Integrator *theNewIntegrator
     
     // perform Tt R  -- as T is block diagonal do T(i)^T R(i)
     // where blocks are of size equal to num ele dof at a node
-
-    int startRowTransformed = 0;
-    int startRowOriginal = 0;
-    int numNode = numGroups;
-
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++) {
-        int noRows = 0;
-        int noCols = 0;
-        const Matrix *Ti= theDOFs[i]->getT();
-        if(Ti != 0) {
-          noRows = Ti->noCols(); // T^
-          noCols = Ti->noRows();
-
-          /*
-          Vector orig(noCols);
-          Vector mod(noRows);
-          for(int k=startRowOriginal; k<startRowOriginal+noCols; k++)
-            orig(k-startRowOriginal)= theResidual(k);
-          mod = (*Ti)^orig;
-          for(int k=startRowTransformed; k<startRowTransformed+noRows; k++)
-            (unbalAndTangentMod.getUnbalance())(k) = mod (k-startRowTransformed);
-
-          */
-
-          for(int j=0; j<noRows; j++) {
-            double sum = 0.0;
-            for(int k=0; k<noCols; k++)
-              sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
-            (unbalAndTangentMod.getUnbalance())(startRowTransformed +j) = sum;
-          }
-
-        } else {
-          noCols = theDOFs[i]->getNumDOF();
-          noRows = noCols;
-          for(int j=0; j<noRows; j++)
-            (unbalAndTangentMod.getUnbalance())(startRowTransformed +j) = theResidual(startRowOriginal + j);
-        }
-        startRowTransformed += noRows;
-        startRowOriginal += noCols;
-    }
-
-    return unbalAndTangentMod.getUnbalance();
-}
+    Vector &modResidual= unbalAndTangentMod.getUnbalance();
+    theSparseT->transformResidual(theTransformations, theResidual, modResidual);
+    return modResidual;
+  }
 
 
 
@@ -366,469 +260,37 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
   {
     this->FE_Element::zeroTangent();    
     this->FE_Element::addKtToTang();    
-    const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
-
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for(int a = 0; a<numNode; a++)
-      {
-	const Matrix *theT= theDOFs[a]->getT();
-	theTransformations[a] = theT;
-	if(theT != 0)
-	  numDOFs[a] = theT->noRows(); // T^ 
-	else
-	  numDOFs[a] = theDOFs[a]->getNumDOF();
-      }
-
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static XC::Matrix localK;
-
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++) {
-
-      int startCol = 0;
-      int numDOFi = numDOFs[i];        
-      int noColsOriginal = 0;
-
-      for(int j=0; j<numNode; j++)
-	{
-	  const Matrix *Ti= theTransformations[i];
-	  const Matrix *Tj= theTransformations[j];
-	int numDOFj = numDOFs[j];        
-	localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-
-	// copy K(i,j) into localK matrix
-	// CHECK SIZE OF BUFFER            
-	for(int a=0; a<numDOFi; a++)
-	  for(int b=0; b<numDOFj; b++)
-	    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	// now perform the matrix computation T(i)^T localK T(j)
-	// note: if T == 0 then the Identity is assumed
-	int noColsTransformed = 0;
-	static XC::Matrix localTtKT;
-
-	if(Ti != 0 && Tj != 0) {
-	  noRowsTransformed = Ti->noCols();
-	  noColsTransformed = Tj->noCols();
-	  // CHECK SIZE OF BUFFER
-	  localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-	  localTtKT = (*Ti) ^ localK * (*Tj);
-	} else if(Ti == 0 && Tj != 0) {
-	  noRowsTransformed = numDOFi;
-	  noColsTransformed = Tj->noCols();
-	  // CHECK SIZE OF BUFFER
-	  localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-	  // localTtKT = localK * (*Tj);               
-	  localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	} else if(Ti != 0 && Tj == 0) {
-	  noRowsTransformed = Ti->noCols();
-	  noColsTransformed = numDOFj;
-	  // CHECK SIZE OF BUFFER
-	  localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-	  localTtKT = (*Ti) ^ localK;
-	} else {
-	  noRowsTransformed = numDOFi;
-	  noColsTransformed = numDOFj;
-	  localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-	  localTtKT = localK;
-	}
-	// now copy into modTangent the T(i)^t K(i,j) T(j) product
-	for(int c=0; c<noRowsTransformed; c++) 
-	  for(int d=0; d<noColsTransformed; d++) 
-	    (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-
-	startCol += noColsTransformed;
-	noColsOriginal += numDOFj;
-      }
-
-      noRowsOriginal += numDOFi;
-      startRow += noRowsTransformed;
-    }
-
-    // get the components we need out of the vector
-    // and place in a temporary vector
-    Vector tmp(numTransformedDOF);
-    for(int j=0; j<numTransformedDOF; j++)
-      {
-	int dof = modID(j);
-	if(dof >= 0)
-	  tmp(j) = accel(dof);
-	else
-	  tmp(j) = 0.0;
-      }
-
-    unbalAndTangentMod.getUnbalance().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-    return unbalAndTangentMod.getUnbalance();
+    return this->transformedMatrixVector(accel);
   }
 
 const XC::Vector &XC::TransformationFE::getKi_Force(const XC::Vector &accel, double fact)
   {
     this->FE_Element::zeroTangent();    
     this->FE_Element::addKiToTang();    
-    const Matrix &theTangent= this->FE_Element::getTangent(0);
-
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-
-    // DO THE SP STUFF TO THE TANGENT 
-
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    const int numNode = numGroups;
-    for (int a = 0; a<numNode; a++)
-      {
-	const Matrix *theT= theDOFs[a]->getT();
-	theTransformations[a] = theT;
-	if (theT != nullptr)
-	  numDOFs[a] = theT->noRows(); // T^ 
-	else
-	  numDOFs[a] = theDOFs[a]->getNumDOF();
-      }
-
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static Matrix localK;
-
-    // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++)
-      {
-	int startCol = 0;
-	int numDOFi = numDOFs[i];	
-	int noColsOriginal = 0;
-
-	for (int j=0; j<numNode; j++)
-	  {
-	    const Matrix *Ti= theTransformations[i];
-	    const Matrix *Tj= theTransformations[j];
-	    const int numDOFj = numDOFs[j];	
-	    localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-
-	    // copy K(i,j) into localK matrix
-	    // CHECK SIZE OF BUFFER	    
-	    for (int a=0; a<numDOFi; a++)
-	      for (int b=0; b<numDOFj; b++)
-		localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	// now perform the matrix computation T(i)^T localK T(j)
-	// note: if T == 0 then the Identity is assumed
-	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
-
-	    if (Ti != nullptr && Tj != nullptr)
-	      {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK * (*Tj);
-		localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-	      }
-	    else if (Ti == nullptr && Tj != nullptr)
-	      {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-		// localTtKT = localK * (*Tj);	       
-		localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	      }
-	    else if (Ti != nullptr && Tj == nullptr)
-	      {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = numDOFj;
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK;
-		localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-	      }
-	    else
-	      {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-		localTtKT = localK;
-	      }
-	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
-	    for (int c=0; c<noRowsTransformed; c++) 
-	      for (int d=0; d<noColsTransformed; d++) 
-		(unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-
-	    startCol += noColsTransformed;
-	    noColsOriginal += numDOFj;
-	  }
-
-	noRowsOriginal += numDOFi;
-	startRow += noRowsTransformed;
-      }
-
-    // get the components we need out of the vector
-    // and place in a temporary vector
-    Vector tmp(numTransformedDOF);
-    for(int j=0; j<numTransformedDOF; j++)
-      {
-	const int dof = modID(j);
-	if (dof >= 0)
-	  tmp(j)= accel(dof);
-	else
-	  tmp(j)= 0.0;
-      }
-
-    unbalAndTangentMod.getUnbalance().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-    return unbalAndTangentMod.getUnbalance();
+    return this->transformedMatrixVector(accel);
   }
+
 const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double fact)
   {
     this->FE_Element::zeroTangent();    
     this->FE_Element::addMtoTang();    
-    const Matrix &theTangent = this->FE_Element::getTangent(0);
-
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-  
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for(int a = 0; a<numNode; a++)
-      {
-        const Matrix *theT= theDOFs[a]->getT();
-        theTransformations[a] = theT;
-        if(theT != 0)
-          numDOFs[a] = theT->noRows(); // T^ 
-        else
-          numDOFs[a] = theDOFs[a]->getNumDOF();
-      }
-  
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-  
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-  
-    static Matrix localK;
-  
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++)
-      {
-    
-        int startCol = 0;
-        int numDOFi = numDOFs[i];        
-        int noColsOriginal = 0;
-    
-        for(int j=0; j<numNode; j++)
-          {
-            const Matrix *Ti= theTransformations[i];
-            const Matrix *Tj= theTransformations[j];
-            int numDOFj = numDOFs[j];        
-            localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-      
-            // copy K(i,j) into localK matrix
-            // CHECK SIZE OF BUFFER            
-            for(int a=0; a<numDOFi; a++)
-              for(int b=0; b<numDOFj; b++)
-                localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-            // now perform the matrix computation T(i)^T localK T(j)
-            // note: if T == 0 then the Identity is assumed
-            int noColsTransformed = 0;
-            static Matrix localTtKT;
-      
-      if(Ti != 0 && Tj != 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK * (*Tj);
-      } else if(Ti == 0 && Tj != 0) {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        // localTtKT = localK * (*Tj);               
-        localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if(Ti != 0 && Tj == 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = numDOFj;
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK;
-      } else {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = numDOFj;
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for(int c=0; c<noRowsTransformed; c++) 
-        for(int d=0; d<noColsTransformed; d++) 
-          (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
+    return this->transformedMatrixVector(accel);
   }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for(int j=0; j<numTransformedDOF; j++) {
-    int dof = modID(j);
-    if(dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
-  }
-
-  unbalAndTangentMod.getUnbalance().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-  return unbalAndTangentMod.getUnbalance();
-}
 
 const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, double fact)
-{
-  this->FE_Element::zeroTangent();    
-  this->FE_Element::addCtoTang();    
-  const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
-
-  static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-  numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for(int a = 0; a<numNode; a++)
-    {
-      const Matrix *theT= theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if(theT != 0)
-        numDOFs[a] = theT->noRows(); // T^ 
-      else
-        numDOFs[a] = theDOFs[a]->getNumDOF();
-    }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static XC::Matrix localK;
-  
-  // foreach block row, for each block col do
-  for(int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];        
-    int noColsOriginal = 0;
-    
-    for(int j=0; j<numNode; j++)
-      {
-        const Matrix *Ti= theTransformations[i];
-        const Matrix *Tj= theTransformations[j];
-      int numDOFj = numDOFs[j];        
-      localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER            
-      for(int a=0; a<numDOFi; a++)
-        for(int b=0; b<numDOFj; b++)
-          localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static XC::Matrix localTtKT;
-      
-      if(Ti != 0 && Tj != 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK * (*Tj);
-      } else if(Ti == 0 && Tj != 0) {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        // localTtKT = localK * (*Tj);               
-        localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if(Ti != 0 && Tj == 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = numDOFj;
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK;
-      } else {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = numDOFj;
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for(int c=0; c<noRowsTransformed; c++) 
-        for(int d=0; d<noColsTransformed; d++) 
-          (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for(int j=0; j<numTransformedDOF; j++) {
-    int dof = modID(j);
-    if(dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
+  {
+    this->FE_Element::zeroTangent();    
+    this->FE_Element::addCtoTang();    
+    return this->transformedMatrixVector(accel);
   }
 
-  unbalAndTangentMod.getUnbalance().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-  return unbalAndTangentMod.getUnbalance();
-}
-
 
 void XC::TransformationFE::addD_Force(const XC::Vector &disp,  double fact)
   {
     if(fact == 0.0)
       return;
 
-    static Vector response;
-    response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
+    Vector response(numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
         int loc = modID(i);
@@ -846,8 +308,7 @@ void XC::TransformationFE::addM_Force(const XC::Vector &disp,  double fact)
     if(fact == 0.0)
         return;
 
-    static Vector response;
-    response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
+    Vector response(numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
         int loc = modID(i);
@@ -885,45 +346,31 @@ const XC::Vector &XC::TransformationFE::getLastResponse(void)
     return unbalAndTangentMod.getUnbalance();
   }
 
+//! @brief Return false if any of the nodes of the element is constrained
+//! by a time-varying multi-freedom constraint (e.g. a joint with large
+//! displacements), whose transformation matrix is updated on each step.
+bool XC::TransformationFE::hasConstantTransformation(void) const
+  {
+    bool retval= true;
+    for(int i=0; i<numGroups; i++)
+      {
+        const TransformationDOF_Group *tDofPtr= dynamic_cast<const TransformationDOF_Group *>(theDOFs[i]);
+	if(tDofPtr && tDofPtr->hasTimeVaryingT())
+	  {
+	    retval= false;
+	    break;
+	  }
+      }
+    return retval;
+  }
+
 
 int XC::TransformationFE::transformResponse(const XC::Vector &modResp, 
                                     Vector &unmodResp)
   {
     // perform T R  -- as T is block diagonal do T(i) R(i)
     // where blocks are of size equal to num ele dof at a node
-
-    int startRowOriginal = 0;
-    int startRowTransformed = 0;
-    int numNode = numGroups;
-    int noRows = 0;
-    int noCols = 0;
-
-    for(int i=0; i<numNode; i++)
-      {
-        const Matrix *Ti = theDOFs[i]->getT();
-        if(Ti != 0)
-	  {
-            noRows = Ti->noRows();
-            noCols = Ti->noCols();
-            for(int j=0; j<noRows; j++)
-	      {
-                double sum = 0.0;
-                for(int k=0; k<noCols; k++)
-                    sum += (*Ti)(j,k) * modResp(startRowTransformed +k) ;
-                unmodResp(startRowOriginal + j) = sum;
-	      }
-	  }
-	else
-	  {
-            noCols = theDOFs[i]->getNumDOF();
-            noRows = noCols;
-            for(int j=0; j<noCols; j++)
-	      unmodResp(startRowOriginal + j) = modResp(startRowTransformed +j);
-	  }
-        startRowOriginal += noRows;
-        startRowTransformed += noCols;
-      }
-    
+    theSparseT->transformResponse(theTransformations, modResp, unmodResp);
     return 0;
   }
 
@@ -934,8 +381,7 @@ void XC::TransformationFE::addD_ForceSensitivity(int gradNumber, const XC::Vecto
     if(fact == 0.0)
         return;
 
-    static Vector response;
-    response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
+    Vector response(numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
         int loc = modID(i);
@@ -953,8 +399,7 @@ void XC::TransformationFE::addM_ForceSensitivity(int gradNumber, const XC::Vecto
     if(fact == 0.0)
         return;
 
-    static Vector response;
-    response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
+    Vector response(numOriginalDOF);
                     
     for(int i=0; i<numTransformedDOF; i++) {
         int loc = modID(i);
@@ -65,6 +65,7 @@
 
 #include <solution/analysis/model/fe_ele/FE_Element.h>
 #include "solution/analysis/model/UnbalAndTangent.h"
+#include "solution/analysis/model/SparseTransformation.h"
 
 namespace XC {
 class SFreedom_Constraint;
@@ -86,7 +87,10 @@ class TransformationConstraintHandler;
 //! 
 //! To enforce the constraint a matrix \f$T^T K T\f$ is added to the
 //! tangent and \f$T^T R\f$ is added to the residual where \f$T\f$ is a block
-//! diagonal matrix equal to WHAT?
+//! diagonal matrix whose blocks are the transformation matrices of the
+//! element nodes. Those blocks are taken from the global sparse
+//! transformation assembled by the TransformationConstraintHandler
+//! (see SparseTransformation), so only the non-zero entries are used.
 class TransformationFE: public FE_Element
   {
   private:
@@ -95,20 +99,16 @@ class TransformationFE: public FE_Element
     int numGroups;
     int numTransformedDOF;
     int numOriginalDOF;
+    UnbalAndTangentStorage unbalAndTangentArrayMod; //!< vectors and matrices of this object (reentrant).
     UnbalAndTangent unbalAndTangentMod;
+    static const SparseTransformation identityT;
+    const SparseTransformation *theSparseT; //!< global T matrix (owned by the constraint handler).
+    std::vector<SparseTransformation::Block> theTransformations; //!< blocks of the global T matrix (one for each node).
     
-    // static variables - single copy for all objects of the class	
-    static UnbalAndTangentStorage unbalAndTangentArrayMod; //!< array of class wide vectors and matrices
-    static std::vector<const Matrix *> theTransformations; //!< for holding pointers to the T matrices
-    static int numTransFE;     //!< number of objects    
-    static int transCounter;   //!< a counter used to indicate when to do something
-    static int sizeTransformations; //!< size of theTransformations array
-    static Vector dataBuffer;
-    static Vector localKbuffer;
-    static ID dofData;
-    static int sizeBuffer;
   protected:
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
+    const Matrix &transformTangent(const Matrix &);
+    const Vector &transformedMatrixVector(const Vector &);
  
     friend class AnalysisModel;
     TransformationFE(int tag, Element *theElement);
@@ -135,6 +135,7 @@ class TransformationFE: public FE_Element
     virtual void addM_Force(const Vector &accel, double fact = 1.0);    
     
     const Vector &getLastResponse(void);
+    virtual bool hasConstantTransformation(void) const;
     int addSP(SFreedom_Constraint &theSP);
 
     // AddingSensitivity:BEGIN ////////////////////////////////////
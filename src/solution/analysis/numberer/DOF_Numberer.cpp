@@ -81,6 +81,9 @@
 #include <domain/constraints/MRMFreedom_ConstraintIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
 #include "utility/utils/misc_utils/colormod.h"
+#include "solution/analysis/handler/ConstraintHandler.h"
+#include <set>
+#include <sstream>
 
 //! @brief Create the graph numberer (
 void XC::DOF_Numberer::alloc(const std::string &str)
@@ -152,6 +155,88 @@ XC::DOF_Numberer::~DOF_Numberer(void)
 XC::DOF_Numberer *XC::DOF_Numberer::getCopy(void) const
   { return new DOF_Numberer(*this);  }
 
+//! @brief Return the key used to store the DOF group ordering in the
+//! cache of the domain. The key identifies the constraint handler (that
+//! creates the DOF groups), the graph numbering algorithm and the DOF
+//! groups to number last.
+//!
+//! @param last: DOF groups to number last.
+std::string XC::DOF_Numberer::get_cache_key(const std::string &last) const
+  {
+    std::string retval= getClassName();
+    const ModelWrapper *mw= getModelWrapper();
+    const ConstraintHandler *handler= (mw ? mw->getConstraintHandlerPtr() : nullptr);
+    retval+= "/"+(handler ? handler->getClassName() : std::string("none"));
+    retval+= "/"+theGraphNumberer->getClassName();
+    retval+= "/"+last;
+    return retval;
+  }
+
+//! @brief Return true if the given ordering contains each DOF group of
+//! the model exactly once.
+//!
+//! @param am: analysis model.
+//! @param orderedRefs: ordered DOF group tags.
+bool XC::DOF_Numberer::check_ordering(const AnalysisModel &am, const ID &orderedRefs) const
+  {
+    const int sz= orderedRefs.Size();
+    if(sz!=am.getNumDOF_Groups())
+      return false;
+    std::set<int> tags;
+    for(int i= 0;i<sz;i++)
+      {
+        const int tag= orderedRefs(i);
+        if(!am.getDOF_GroupPtr(tag) || !tags.insert(tag).second)
+          return false;
+      }
+    return true;
+  }
+
+//! @brief Return the ordering of the DOF groups. If the domain cache
+//! contains an ordering computed with the same constraint handler and
+//! numbering algorithm for the current topology it's reused, otherwise
+//! it's computed by the graph numberer (and stored in the cache).
+//!
+//! @param am: analysis model.
+//! @param dom: domain.
+//! @param lastDOF_Group: tag of the DOF group to number last.
+const XC::ID &XC::DOF_Numberer::get_ordered_refs(AnalysisModel &am, Domain &dom, int lastDOF_Group)
+  {
+    DOF_NumberingCache &cache= dom.getNumberingCache();
+    std::ostringstream last;
+    last << lastDOF_Group;
+    const std::string key= get_cache_key(last.str());
+    const ID *cached= cache.find(dom, key);
+    if(cached && check_ordering(am, *cached))
+      return *cached;
+    const ID &retval= theGraphNumberer->number(am.getDOFGroupGraph(), lastDOF_Group);
+    cache.store(dom, key, retval);
+    return retval;
+  }
+
+//! @brief Return the ordering of the DOF groups. If the domain cache
+//! contains an ordering computed with the same constraint handler and
+//! numbering algorithm for the current topology it's reused, otherwise
+//! it's computed by the graph numberer (and stored in the cache).
+//!
+//! @param am: analysis model.
+//! @param dom: domain.
+//! @param lastDOFs: tags of the DOF groups to number last.
+const XC::ID &XC::DOF_Numberer::get_ordered_refs(AnalysisModel &am, Domain &dom, ID &lastDOFs)
+  {
+    DOF_NumberingCache &cache= dom.getNumberingCache();
+    std::ostringstream last;
+    for(int i= 0;i<lastDOFs.Size();i++)
+      last << lastDOFs(i) << ' ';
+    const std::string key= get_cache_key(last.str());
+    const ID *cached= cache.find(dom, key);
+    if(cached && check_ordering(am, *cached))
+      return *cached;
+    const ID &retval= theGraphNumberer->number(am.getDOFGroupGraph(), lastDOFs);
+    cache.store(dom, key, retval);
+    return retval;
+  }
+
 //! @brief Invoked to assign the equation numbers to the dofs.
 //! 
 //! Invoked to assign the equation numbers to the dofs in the DOF\_Groups
@@ -211,8 +296,9 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
     if(am->getNumDOF_Groups() == 0)
       return 0;
 
-    // we first number the dofs using the dof group graph
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOF_Group);
+    // we first number the dofs using the dof group graph (or
+    // the ordering stored in the domain for the same topology).
+    const ID &orderedRefs= get_ordered_refs(*am, *theDomain, lastDOF_Group);
 
     // we now iterate through the DOFs first time setting -2 values  
     if(orderedRefs.Size() != am->getNumDOF_Groups())
@@ -382,9 +468,9 @@ int XC::DOF_Numberer::numberDOF(ID &lastDOFs)
     if(am->getNumDOF_Groups() == 0)
       return 0;
 
-    // we first number the dofs using the dof group graph
-        
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOFs);     
+    // we first number the dofs using the dof group graph (or
+    // the ordering stored in the domain for the same topology).
+    const ID &orderedRefs= get_ordered_refs(*am, *theDomain, lastDOFs);
 
     // we now iterate through the DOFs first time setting -2 values
 
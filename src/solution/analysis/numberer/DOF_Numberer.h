@@ -74,6 +74,7 @@ class GraphNumberer;
 class FEM_ObjectBroker;
 class ID;
 class ModelWrapper;
+class Domain;
 
 //! @ingroup Analysis
 //!
@@ -98,6 +99,11 @@ class DOF_Numberer: public MovableObject, public CommandEntity
     const ModelWrapper *getModelWrapper(void) const;
 
     GraphNumberer *theGraphNumberer; //!< Graph (DOF) numberer.
+
+    std::string get_cache_key(const std::string &) const;
+    bool check_ordering(const AnalysisModel &, const ID &) const;
+    const ID &get_ordered_refs(AnalysisModel &, Domain &, int);
+    const ID &get_ordered_refs(AnalysisModel &, Domain &, ID &);
   protected:
     AnalysisModel *getAnalysisModelPtr(void);
     GraphNumberer *getGraphNumbererPtr(void);
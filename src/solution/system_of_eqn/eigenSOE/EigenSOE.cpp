@@ -403,6 +403,29 @@ double XC::EigenSOE::getTotalMass(void) const
     return retval;
   }
 
+//! @brief Return the product of the mass matrix by the vector
+//! being passed as parameter.
+XC::Vector XC::EigenSOE::getMassProduct(const Vector &v) const
+  {
+    const size_t sz= v.Size();
+    Vector retval(sz);
+    if((massMatrix.size1()!=sz) || (massMatrix.size2()!=sz))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; ERROR the vector has dimension " << sz
+                << " and the mass matrix " << massMatrix.size1()
+                << "x" << massMatrix.size2() << ".\n";
+    else
+      {
+        boost::numeric::ublas::vector<double> tmp(sz);
+        for(size_t i= 0;i<sz;i++)
+          tmp(i)= v(i);
+        tmp= prod(massMatrix,tmp);
+        for(size_t i= 0;i<sz;i++)
+          retval(i)= tmp(i);
+      }
+    return retval;
+  }
+
 //! @brief Return the equivalent static force for the mode
 //! passed as parameter.
 XC::Vector XC::EigenSOE::getEquivalentStaticLoad(int mode,const double &accel_mode) const
@@ -130,6 +130,7 @@ class EigenSOE: public SystemOfEqn
     double getEffectiveModalMass(int mode) const;
     Vector getEffectiveModalMasses(void) const;
     double getTotalMass(void) const;
+    Vector getMassProduct(const Vector &) const;
 
     //Equivalent static load.
     Vector getEquivalentStaticLoad(int mode,const double &) const;
@@ -97,10 +97,14 @@
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
 
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/utils/misc_utils/colormod.h"
 
 #include "solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h"
+#include "solution/system_of_eqn/linearSOE/umfGEN/UmfpackStaticCondensationSolver.h"
 #include "solution/system_of_eqn/linearSOE/mumps/MumpsSolver.h"
 #include "solution/system_of_eqn/linearSOE/mumps/MumpsParallelSolver.h"
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovSolver.h"
 
 //! @brief Constructor.
 //!
@@ -198,10 +202,14 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new SymSparseLinSolver());
     else if(type=="umfpack_gen_lin_solver")
       setSolver(new UmfpackGenLinSolver());
+    else if(type=="umfpack_static_condensation_solver")
+      setSolver(new UmfpackStaticCondensationSolver());
     else if(type=="mumps_solver")
       setSolver(new MumpsSolver());
     else if(type=="mumps_parallel_solver")
       setSolver(new MumpsParallelSolver());
+    else if(type=="krylov_solver")
+      setSolver(new KrylovSolver());
     else
       std::cerr << getClassName() << "::" << __FUNCTION__
 	        << "; solver of type: '"
@@ -224,6 +232,56 @@ XC::LinearSOE::~LinearSOE(void)
 int XC::LinearSOE::solve(void)
   { return (getSolver()->solve()); }
 
+//! @brief Solves the system for several right-hand sides at once.
+//!
+//! Each column of \p BX is a right-hand side; on return it contains
+//! the corresponding solution. The direct solvers that support it
+//! (see LinearSOESolver::supportsMultipleRHS) factor \f$A\f$ once and
+//! perform the forward and backward substitutions for all the columns
+//! in a single call. Otherwise the columns are solved one by one,
+//! which still factors \f$A\f$ only once for the solvers that keep
+//! the "factored" flag (setB doesn't reset it); in that case the
+//! vectors \f$b\f$ and \f$x\f$ are overwritten.
+//! @param BX: right-hand sides on entry, solutions on exit (one per column).
+int XC::LinearSOE::solveMultipleRHS(Matrix &BX)
+  {
+    int retval= 0;
+    const int numEqn= getNumEqn();
+    const int numRHS= BX.noCols();
+    if(BX.noRows()!=numEqn)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; the right-hand sides have " << BX.noRows()
+		  << " rows but the system has " << numEqn << " equations."
+		  << Color::def << std::endl;
+	retval= -1;
+      }
+    else if(getSolver()->supportsMultipleRHS())
+      retval= getSolver()->solveMultipleRHS(BX);
+    else
+      {
+	Vector b(numEqn);
+	for(int j= 0;j<numRHS;j++)
+	  {
+	    for(int i= 0;i<numEqn;i++)
+	      b(i)= BX(i,j);
+	    setB(b);
+	    retval= solve();
+	    if(retval<0)
+	      {
+		std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+			  << "; solution failed for the right-hand side: "
+			  << j << Color::def << std::endl;
+		break;
+	      }
+	    const Vector &x= getX();
+	    for(int i= 0;i<numEqn;i++)
+	      BX(i,j)= x(i);
+	  }
+      }
+    return retval;
+  }
+
 //! @brief Returns the determinant of the system matrix.
 double XC::LinearSOE::getDeterminant(void)
   { return getSolver()->getDeterminant(); }
@@ -239,6 +297,27 @@ double XC::LinearSOE::getRCond(const char &norm)
   { return getSolver()->getRCond(norm); }
 
 
+//! @brief Store a copy of the current values of the matrix \f$A\f$
+//! so they can be recovered later by restoreA (i.e. to keep the
+//! part of the tangent that doesn't change between iterations).
+//! Return false if the system doesn't support this operation.
+bool XC::LinearSOE::storeA(void)
+  { return false; }
+
+//! @brief Set the matrix \f$A\f$ to the values stored by the last
+//! call to storeA. Return false if there are no stored values.
+bool XC::LinearSOE::restoreA(void)
+  { return false; }
+
+//! @brief Return true if there is a stored copy of \f$A\f$ (the
+//! copy is discarded each time the size of the system changes).
+bool XC::LinearSOE::hasStoredA(void) const
+  { return false; }
+
+//! @brief Discard the stored copy of \f$A\f$.
+void XC::LinearSOE::clearStoredA(void)
+  {}
+
 //! @brief Returns a pointer to the solver.
 XC::LinearSOESolver *XC::LinearSOE::getSolver(void)
   { return theSolver; }
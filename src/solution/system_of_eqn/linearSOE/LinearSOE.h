@@ -105,6 +105,7 @@ class LinearSOE: public SystemOfEqn
     virtual ~LinearSOE(void);
 
     virtual int solve(void);    
+    virtual int solveMultipleRHS(Matrix &);
 
     //! @brief Determines and sets the size of the system.
     //!
@@ -153,6 +154,11 @@ class LinearSOE: public SystemOfEqn
     virtual const Vector &getB(void) const= 0;    
     virtual double getDeterminant(void);
     virtual double getRCond(const char &norm= '1');
+
+    virtual bool storeA(void);
+    virtual bool restoreA(void);
+    virtual bool hasStoredA(void) const;
+    virtual void clearStoredA(void);
     //! @brief Return the 2-norm of the vector \f$x\f$.
     virtual double normRHS(void) const= 0;
 
@@ -37,7 +37,7 @@
 //! @param classTag: identifier of the class.
 //! @param N: size of the system.
 XC::LinearSOEData::LinearSOEData(SolutionStrategy *owr,int classTag,int N)
-  :LinearSOE(owr,classTag), size(N) {}
+  :LinearSOE(owr,classTag), size(N), validStoredA(false) {}
 
 
 //! @brief Initializes storage.
@@ -56,6 +56,56 @@ void XC::LinearSOEData::inic(const size_t &sz)
 		<< Color::def << std::endl;
   }
 
+//! @brief Store a copy of the coefficients of the matrix A.
+bool XC::LinearSOEData::store_A(const Vector &a)
+  {
+    storedA= a;
+    validStoredA= true;
+    return validStoredA;
+  }
+
+//! @brief Store a copy of the coefficients of the matrix A.
+bool XC::LinearSOEData::store_A(const std::vector<double> &a)
+  {
+    const size_t sz= a.size();
+    storedA.resize(sz);
+    for(size_t i= 0; i<sz; i++)
+      storedA(i)= a[i];
+    validStoredA= true;
+    return validStoredA;
+  }
+
+//! @brief Copy the stored coefficients into the matrix A.
+bool XC::LinearSOEData::restore_A(Vector &a) const
+  {
+    const bool retval= validStoredA && (a.Size()==storedA.Size());
+    if(retval)
+      a= storedA;
+    return retval;
+  }
+
+//! @brief Copy the stored coefficients into the matrix A.
+bool XC::LinearSOEData::restore_A(std::vector<double> &a) const
+  {
+    const size_t sz= a.size();
+    const bool retval= validStoredA && (sz==size_t(storedA.Size()));
+    if(retval)
+      for(size_t i= 0; i<sz; i++)
+        a[i]= storedA(i);
+    return retval;
+  }
+
+//! @brief Return true if there is a stored copy of the matrix A.
+bool XC::LinearSOEData::hasStoredA(void) const
+  { return validStoredA; }
+
+//! @brief Discard the stored copy of the matrix A.
+void XC::LinearSOEData::clearStoredA(void)
+  {
+    storedA.resize(0);
+    validStoredA= false;
+  }
+
 //! @brief Return the current size of the system.
 int XC::LinearSOEData::getNumEqn(void) const
   { return size; }
@@ -33,6 +33,7 @@
 
 #include <solution/system_of_eqn/linearSOE/LinearSOE.h>
 #include "utility/matrix/Vector.h"
+#include <vector>
 
 namespace XC {
 
@@ -44,8 +45,14 @@ class LinearSOEData: public LinearSOE
   protected:
     int size; //! order of A
     Vector B, X;   //! 1d arrays containing coefficients of B and X  
+    Vector storedA; //!< copy of the coefficients of A (see storeA).
+    bool validStoredA; //!< true if storedA corresponds to the current size.
 
     void inic(const size_t &);
+    bool store_A(const Vector &);
+    bool store_A(const std::vector<double> &);
+    bool restore_A(Vector &) const;
+    bool restore_A(std::vector<double> &) const;
     inline const double &getB(const size_t &i) const
       { return B[i]; }
     inline double &getB(const size_t &i)
@@ -82,6 +89,9 @@ class LinearSOEData: public LinearSOE
     virtual boost::python::list getBPy(void) const;
     virtual double normRHS(void) const;
 
+    virtual bool hasStoredA(void) const;
+    virtual void clearStoredA(void);
+
     void receiveB(const Communicator &);
     void receiveX(const Communicator &);
     void receiveBX(const Communicator &);
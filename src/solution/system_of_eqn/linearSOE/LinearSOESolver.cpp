@@ -64,6 +64,8 @@
 // What: "@(#) LinearSOESolver.C, revA"
 
 #include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+#include "utility/matrix/Matrix.h"
+#include "utility/utils/misc_utils/colormod.h"
 
 //! @brief Constructor.
 //!
@@ -71,8 +73,20 @@
 XC::LinearSOESolver::LinearSOESolver(int classTag)
  : Solver(classTag) {}
 
+//! @brief Return true if the solver can solve several right-hand sides
+//! in a single call (see solveMultipleRHS).
+bool XC::LinearSOESolver::supportsMultipleRHS(void) const
+  { return false; }
 
-
-
-
-
+//! @brief Solve the system for all the right-hand sides stored as the
+//! columns of the argument, overwriting them with the solutions.
+//!
+//! Not implemented by default; the LinearSOE solves the columns one
+//! by one when supportsMultipleRHS returns false.
+int XC::LinearSOESolver::solveMultipleRHS(Matrix &)
+  {
+    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+	      << "; not implemented for this solver."
+	      << Color::def << std::endl;
+    return -1;
+  }
@@ -72,6 +72,7 @@
 
 namespace XC {
 class LinearSOE;
+class Matrix;
 
 //!  @ingroup Solver
 //! 
@@ -104,6 +105,8 @@ class LinearSOESolver: public Solver
     //! data that needs to be updated if the size of the system of equation
     //! changes.
     virtual int setSize(void) = 0;
+    virtual bool supportsMultipleRHS(void) const;
+    virtual int solveMultipleRHS(Matrix &);
   };
 } // end of XC namespace
 
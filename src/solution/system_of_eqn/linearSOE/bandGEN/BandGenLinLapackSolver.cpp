@@ -63,6 +63,7 @@
 
 #include <solution/system_of_eqn/linearSOE/bandGEN/BandGenLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandGEN/BandGenLinSOE.h>
+#include "utility/matrix/Matrix.h"
 
 
 //! A unique class tag defined in classTags.h is passed to the
@@ -96,17 +97,16 @@ extern "C" int dgbtrf_(const int *M, const int *N, const int *KL, const int *KU,
 //! using the LU factorization computed by DGBTRF.
 extern "C" int dgbcon_(char *norm, const int *N, const int *KL, const int *KU, const double *ab, const int *ldab, const int *iPiv, const double *anorm, double *rcond, double *work, int *iwork, int *INFO);
 
-//! @brief Performs the solution of the system of equations.
+//! @brief Solves the system for the \p nrhs right-hand sides stored
+//! (column by column) in \p Xptr, overwriting them with the solutions.
 //!
-//! The solver first copies the B vector into X and then solves the
-//! BandGenLinSOE system by calling the LAPACK routines 
-//! dgbsv(), if the system is marked as not having been factored, and
-//! dgbtrs() if system is marked as having been factored. If the
-//! solution is successfully obtained, i.e. the LAPACK routines return 0
-//! in the INFO argument, it marks the system has having been
-//! factored and returns $0$, otherwise it prints a warning message and
-//! returns INFO. The solve process changes A and X.
-int XC::BandGenLinLapackSolver::solve(void)
+//! Calls the LAPACK routines dgbsv(), if the system is marked as not
+//! having been factored, and dgbtrs() if system is marked as having
+//! been factored. If the solution is successfully obtained, i.e. the
+//! LAPACK routines return 0 in the INFO argument, it marks the system
+//! has having been factored and returns $0$, otherwise it prints a
+//! warning message and returns INFO. The solve process changes A.
+int XC::BandGenLinLapackSolver::solve_columns(double *Xptr, int nrhs)
   {
     if(!theSOE)
       {
@@ -128,19 +128,11 @@ int XC::BandGenLinLapackSolver::solve(void)
 	int kl = theSOE->numSubD;
 	int ku = theSOE->numSuperD;
 	int ldA = 2*kl + ku +1;
-	int nrhs = 1;
 	int ldB = n;
 	int info;
 	double *Aptr = theSOE->A.getDataPtr();
-	double *Xptr = theSOE->getPtrX();
-	double *Bptr = theSOE->getPtrB();
 	int    *iPIV = iPiv.getDataPtr();
 
-	// first copy B into X
-	for(int i=0; i<n; i++)
-	  {	*(Xptr++) = *(Bptr++); }
-	Xptr = theSOE->getPtrX();
-
 	// now solve AX = B
 
 	{
@@ -166,6 +158,47 @@ int XC::BandGenLinLapackSolver::solve(void)
 	return 0;
       }
   }
+
+//! @brief Performs the solution of the system of equations.
+//!
+//! The solver first copies the B vector into X and then solves the
+//! BandGenLinSOE system using solve_columns. The solve process
+//! changes A and X.
+int XC::BandGenLinLapackSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set.\n";
+	return -1;
+      }
+    else
+      {
+	const int n = theSOE->size;    
+	double *Xptr = theSOE->getPtrX();
+	double *Bptr = theSOE->getPtrB();
+
+	// first copy B into X
+	for(int i=0; i<n; i++)
+	  {	*(Xptr++) = *(Bptr++); }
+	return solve_columns(theSOE->getPtrX(), 1);
+      }
+  }
+
+//! @brief Return true (LAPACK solves several right-hand sides at once).
+bool XC::BandGenLinLapackSolver::supportsMultipleRHS(void) const
+  { return true; }
+
+//! @brief Solves the system for all the columns of \p BX with a
+//! single call to dgbsv() or dgbtrs(), overwriting them with the
+//! solutions.
+int XC::BandGenLinLapackSolver::solveMultipleRHS(Matrix &BX)
+  {
+    const int nrhs= BX.noCols();
+    if(nrhs==0)
+      return 0;
+    return solve_columns(BX.getDataPtr(), nrhs);
+  }
     
 
 //! @brief Estimates the reciprocal of the condition number of a real
@@ -80,11 +80,14 @@ class BandGenLinLapackSolver: public BandGenLinSolver
   {
   private:
     ID iPiv;
+    int solve_columns(double *, int);
     virtual LinearSOESolver *getCopy(void) const;
   public:
     BandGenLinLapackSolver(void);
 
     int solve(void);
+    bool supportsMultipleRHS(void) const;
+    int solveMultipleRHS(Matrix &);
     int setSize(void);
     double getRCond(const char &);
 
@@ -148,6 +148,7 @@ bool XC::BandGenLinSOE::setSolver(LinearSOESolver *newSolver)
 //! invoking setSize() on the associated Solver object is returned.
 int XC::BandGenLinSOE::setSize(Graph &theGraph)
   {
+    clearStoredA(); // the stored values are not valid anymore.
     int result = 0;
     size= checkSize(theGraph);
 
@@ -312,6 +313,20 @@ void XC::BandGenLinSOE::zeroA(void)
     factored = false;
   }
 
+//! @brief Store a copy of the current values of the matrix A.
+bool XC::BandGenLinSOE::storeA(void)
+  { return store_A(A); }
+
+//! @brief Set the matrix A to the values stored by the last call
+//! to storeA.
+bool XC::BandGenLinSOE::restoreA(void)
+  {
+    const bool retval= restore_A(A);
+    if(retval)
+      factored= false;
+    return retval;
+  }
+
 int XC::BandGenLinSOE::sendSelf(Communicator &comm)
   { return 0; }
 
@@ -129,6 +129,10 @@ class BandGenLinSOE: public FactoredSOEBase
 
     virtual void zeroA(void);
 
+    virtual bool storeA(void);
+
+    virtual bool restoreA(void);
+
     virtual int sendSelf(Communicator &);
     virtual int recvSelf(const Communicator &);
     friend class BandGenLinLapackSolver;
@@ -62,6 +62,7 @@
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
 #include "utility/utils/misc_utils/colormod.h"
+#include "utility/matrix/Matrix.h"
 
 //! @brief Constructor.
 XC::BandSPDLinLapackSolver::BandSPDLinLapackSolver(void)
@@ -120,17 +121,17 @@ extern "C" double dlansb_(const char *norm, const char *uplo,
 extern "C" int dpbcon_(char *UPLO, int *N, int *KD, double *A,
 		       int *LDA, const double *anorm, double *rcond,
 		       double *work, int *iwork, int *INFO);
-//! Compute solution.
-//! 
-//! The solver first copies the B vector into X and then solves the
-//! BandSPDLinSOE system by calling the LAPACK routines {\em 
-//! dpbsv()}, if the system is marked as not having been factored,
-//! and dpbtrs() if system is marked as having been factored. 
-//! If the solution is successfully obtained, i.e. the LAPACK routines
-//! return \f$0\f$ in the INFO argument, it marks the system has having been 
-//! factored and returns \f$0\f$, otherwise it prints a warning message and
-//! returns INFO. The solve process changes \f$A\f$ and \f$X\f$.   
-int XC::BandSPDLinLapackSolver::solve(void)
+//! @brief Solves the system for the \p nrhs right-hand sides stored
+//! (column by column) in \p Xptr, overwriting them with the solutions.
+//!
+//! Calls the LAPACK routines dpbsv(), if the system is marked as not
+//! having been factored, and dpbtrs() if system is marked as having
+//! been factored. If the solution is successfully obtained, i.e. the
+//! LAPACK routines return \f$0\f$ in the INFO argument, it marks the
+//! system has having been factored and returns \f$0\f$, otherwise it
+//! prints a warning message and returns INFO. The solve process
+//! changes \f$A\f$.
+int XC::BandSPDLinLapackSolver::solve_columns(double *Xptr, int nrhs)
   {
     int retval= 0;
     if(!theSOE)
@@ -145,17 +146,9 @@ int XC::BandSPDLinLapackSolver::solve(void)
 	int n = theSOE->size;
 	int kd = theSOE->half_band -1;
 	int ldA = kd +1;
-	int nrhs = 1;
 	int ldB = n;
 	int info;
 	double *Aptr = theSOE->A.getDataPtr();
-	double *Xptr = theSOE->getPtrX();
-	double *Bptr = theSOE->getPtrB();
-
-	// first copy B into X
-	for(int i=0; i<n; i++)
-	  *(Xptr++) = *(Bptr++);
-	Xptr= theSOE->getPtrX();
 
 	char strU[]= "U";
 	// now solve AX = Y
@@ -181,6 +174,50 @@ int XC::BandSPDLinLapackSolver::solve(void)
     return retval;
   }
 
+//! Compute solution.
+//! 
+//! The solver first copies the B vector into X and then solves the
+//! BandSPDLinSOE system using solve_columns. The solve process
+//! changes \f$A\f$ and \f$X\f$.   
+int XC::BandSPDLinLapackSolver::solve(void)
+  {
+    int retval= 0;
+    if(!theSOE)
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set."
+		  << Color::def << std::endl;
+	retval= -1;
+      }
+    else
+      {
+	const int n = theSOE->size;
+	double *Xptr = theSOE->getPtrX();
+	double *Bptr = theSOE->getPtrB();
+
+	// first copy B into X
+	for(int i=0; i<n; i++)
+	  *(Xptr++) = *(Bptr++);
+	retval= solve_columns(theSOE->getPtrX(), 1);
+      }
+    return retval;
+  }
+
+//! @brief Return true (LAPACK solves several right-hand sides at once).
+bool XC::BandSPDLinLapackSolver::supportsMultipleRHS(void) const
+  { return true; }
+
+//! @brief Solves the system for all the columns of \p BX with a
+//! single call to dpbsv() or dpbtrs(), overwriting them with the
+//! solutions.
+int XC::BandSPDLinLapackSolver::solveMultipleRHS(Matrix &BX)
+  {
+    const int nrhs= BX.noCols();
+    if(nrhs==0)
+      return 0;
+    return solve_columns(BX.getDataPtr(), nrhs);
+  }
+
 //! Compute solution.
 //! 
 //! The solver first copies the B vector into X and then solves the
@@ -79,6 +79,8 @@ namespace XC {
 //! BandSPDLinSOE class.
 class BandSPDLinLapackSolver: public BandSPDLinSolver
   {
+    int solve_columns(double *, int);
+
     friend class FEM_ObjectBroker;
     friend class LinearSOE;
     BandSPDLinLapackSolver();    
@@ -86,6 +88,8 @@ class BandSPDLinLapackSolver: public BandSPDLinSolver
   public:
 
     int solve(void);
+    bool supportsMultipleRHS(void) const;
+    int solveMultipleRHS(Matrix &);
     int setSize(void);
     double getRCond(const char &);
     
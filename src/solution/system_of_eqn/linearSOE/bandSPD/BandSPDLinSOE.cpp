@@ -163,6 +163,7 @@ bool XC::BandSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 //! returned. 
 int XC::BandSPDLinSOE::setSize(Graph &theGraph)
   {
+    clearStoredA(); // the stored values are not valid anymore.
     int result = 0;
     size= checkSize(theGraph);
     half_band= theGraph.getVertexDiffMaxima();
@@ -269,6 +270,20 @@ void XC::BandSPDLinSOE::zeroA(void)
     factored = false;
   }
 
+//! @brief Store a copy of the current values of the matrix A.
+bool XC::BandSPDLinSOE::storeA(void)
+  { return store_A(A); }
+
+//! @brief Set the matrix A to the values stored by the last call
+//! to storeA.
+bool XC::BandSPDLinSOE::restoreA(void)
+  {
+    const bool retval= restore_A(A);
+    if(retval)
+      factored= false;
+    return retval;
+  }
+
 int XC::BandSPDLinSOE::sendSelf(Communicator &comm)
   { return 0; }
 
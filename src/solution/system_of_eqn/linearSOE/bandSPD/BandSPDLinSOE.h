@@ -132,6 +132,10 @@ class BandSPDLinSOE: public FactoredSOEBase
     
     virtual void zeroA(void);
     
+    virtual bool storeA(void);
+    
+    virtual bool restoreA(void);
+    
     virtual int sendSelf(Communicator &);
     virtual int recvSelf(const Communicator &);
     
@@ -90,6 +90,7 @@ bool XC::DiagonalSOE::setSolver(LinearSOESolver *newSolver)
     
 int XC::DiagonalSOE::setSize(Graph &theGraph)
   {
+    clearStoredA(); // the stored values are not valid anymore.
     const int oldSize = size;
     int result = 0;
     size= checkSize(theGraph);
@@ -171,6 +172,20 @@ void XC::DiagonalSOE::zeroA(void)
     factored = false;
   }
 
+//! @brief Store a copy of the current values of the matrix A.
+bool XC::DiagonalSOE::storeA(void)
+  { return store_A(A); }
+
+//! @brief Set the matrix A to the values stored by the last call
+//! to storeA.
+bool XC::DiagonalSOE::restoreA(void)
+  {
+    const bool retval= restore_A(A);
+    if(retval)
+      factored= false;
+    return retval;
+  }
+
 
 int XC::DiagonalSOE::sendSelf(Communicator &comm)
   { return 0; }
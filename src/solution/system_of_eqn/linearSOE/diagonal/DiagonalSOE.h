@@ -87,6 +87,10 @@ class DiagonalSOE: public FactoredSOEBase
     int addA(const Matrix &, const ID &, double fact = 1.0);
     
     void zeroA(void);
+    
+    bool storeA(void);
+    
+    bool restoreA(void);
 
     int sendSelf(Communicator &);
     int recvSelf(const Communicator &);
@@ -63,6 +63,7 @@
 
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSOE.h>
+#include "utility/matrix/Matrix.h"
 
 //! @brief Constructor.
 //!
@@ -79,17 +80,16 @@ extern "C" int dgesv_(int *N, int *NRHS, double *A, int *LDA, int *iPiv,
 extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
 		       int *iPiv, double *B, int *LDB, int *INFO);
 
-//! @brief Computes the solution.
+//! @brief Solves the system for the \p nrhs right-hand sides stored
+//! (column by column) in \p Xptr, overwriting them with the solutions.
 //!
-//! First copies B into X and then solves the FullGenLinSOE system 
-//! it is associated with (pointer kept by parent class) by calling the LAPACK 
-//! routines dgesv(), if the system is marked as not having been factored,
-//! or dgetrs(), if system is marked as having been factored. If the
-//! solution is successfully obtained, i.e. the LAPACK routines return 0
-//! in the INFO argument, it marks the system has having been
-//! factored and returns 0, otherwise it prints a warning message and
-//! returns INFO. The solve process changes A and X.
-int XC::FullGenLinLapackSolver::solve(void)
+//! Calls the LAPACK routines dgesv(), if the system is marked as not
+//! having been factored, or dgetrs(), if system is marked as having
+//! been factored. If the solution is successfully obtained, i.e. the
+//! LAPACK routines return 0 in the INFO argument, it marks the system
+//! has having been factored and returns 0, otherwise it prints a
+//! warning message and returns INFO. The solve process changes A.
+int XC::FullGenLinLapackSolver::solve_columns(double *Xptr, int nrhs)
   {
     if(!theSOE)
       {
@@ -113,19 +113,11 @@ int XC::FullGenLinLapackSolver::solve(void)
       }	
 	
     int ldA= n;
-    int nrhs= 1;
     int ldB= n;
     int info;
     double *Aptr = theSOE->A.getDataPtr();
-    double *Xptr = theSOE->getPtrX();
-    double *Bptr = theSOE->getPtrB();
     int *iPIV= iPiv.getDataPtr();
     
-    // first copy B into X
-    for(int i=0; i<n; i++)
-      *(Xptr++) = *(Bptr++);
-    Xptr= theSOE->getPtrX();
-
     // now solve AX = Y
 
     char strN[]= "N";
@@ -149,6 +141,45 @@ int XC::FullGenLinLapackSolver::solve(void)
     return 0;
   }
 
+//! @brief Computes the solution.
+//!
+//! First copies B into X and then solves the FullGenLinSOE system 
+//! it is associated with (pointer kept by parent class) using
+//! solve_columns. The solve process changes A and X.
+int XC::FullGenLinLapackSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING, no LinearSOE object has been set\n";
+	return -1;
+      }
+    
+    const int n= theSOE->size;
+    double *Xptr = theSOE->getPtrX();
+    double *Bptr = theSOE->getPtrB();
+    
+    // first copy B into X
+    for(int i=0; i<n; i++)
+      *(Xptr++) = *(Bptr++);
+    return solve_columns(theSOE->getPtrX(), 1);
+  }
+
+//! @brief Return true (LAPACK solves several right-hand sides at once).
+bool XC::FullGenLinLapackSolver::supportsMultipleRHS(void) const
+  { return true; }
+
+//! @brief Solves the system for all the columns of \p BX with a
+//! single call to dgesv() or dgetrs(), overwriting them with the
+//! solutions.
+int XC::FullGenLinLapackSolver::solveMultipleRHS(Matrix &BX)
+  {
+    const int nrhs= BX.noCols();
+    if(nrhs==0)
+      return 0;
+    return solve_columns(BX.getDataPtr(), nrhs);
+  }
+
 //! @brief Sets the size of #iPiv from the size of the system of equations.
 //!
 //! Is used to construct a 1d integer array, #iPiv that is needed by
@@ -80,6 +80,7 @@ class FullGenLinLapackSolver: public FullGenLinSolver
   {
   private:
     ID iPiv;
+    int solve_columns(double *, int);
 
     friend class FEM_ObjectBroker;
     friend class LinearSOE;
@@ -87,6 +88,8 @@ class FullGenLinLapackSolver: public FullGenLinSolver
     virtual LinearSOESolver *getCopy(void) const;
   public:
     int solve(void);
+    bool supportsMultipleRHS(void) const;
+    int solveMultipleRHS(Matrix &);
     int setSize(void);
     
     int sendSelf(Communicator &);
@@ -121,6 +121,7 @@ bool XC::FullGenLinSOE::setSolver(LinearSOESolver *newSolver)
 //! invoking setSize() on the associated Solver object is returned.
 int XC::FullGenLinSOE::setSize(Graph &theGraph)
   {
+    clearStoredA(); // the stored values are not valid anymore.
     int result = 0;
     size= checkSize(theGraph);
 
@@ -224,6 +225,20 @@ void XC::FullGenLinSOE::zeroA(void)
     factored = false;
   }
 
+//! @brief Store a copy of the current values of the matrix A.
+bool XC::FullGenLinSOE::storeA(void)
+  { return store_A(A); }
+
+//! @brief Set the matrix A to the values stored by the last call
+//! to storeA.
+bool XC::FullGenLinSOE::restoreA(void)
+  {
+    const bool retval= restore_A(A);
+    if(retval)
+      factored= false;
+    return retval;
+  }
+
 //! @brief Return the rows of the stiffness matrix in a Python list.
 boost::python::list XC::FullGenLinSOE::getAPy(void) const
   {
@@ -125,6 +125,8 @@ class FullGenLinSOE: public FactoredSOEBase
     
     int addA(const Matrix &, const ID &, double fact = 1.0);
     void zeroA(void);
+    bool storeA(void);
+    bool restoreA(void);
     virtual boost::python::list getAPy(void) const;
     
     friend class FullGenLinLapackSolver;    
@@ -0,0 +1,161 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ILUkPreconditioner.cc
+
+#include "ILUkPreconditioner.h"
+#include <map>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include "utility/utils/misc_utils/colormod.h"
+
+//! @brief Constructor.
+//!
+//! @param k: level of fill.
+XC::ILUkPreconditioner::ILUkPreconditioner(const int &k)
+  : fillLevel(std::max(k,0)) {}
+
+//! @brief Compute the pattern of the factors (levels of fill).
+//!
+//! @param a: matrix to factorize.
+//! @param rs: row start positions of the factors (output).
+//! @param cl: column indexes of the factors (output).
+void XC::ILUkPreconditioner::symbolic(const SparseMatrixCSR &a, std::vector<int> &rs, std::vector<int> &cl)
+  {
+    const int n= a.getNumRows();
+    rs.assign(n+1,0);
+    cl.clear();
+    std::vector<int> levels; // level of each entry of the factors.
+    diagPos.assign(n,-1);
+    for(int i= 0;i<n;i++)
+      {
+        std::map<int,int> row; // column -> level
+        for(int k= a.rowBegin(i);k<a.rowEnd(i);k++)
+          row[a.col(k)]= 0;
+        row.insert(std::make_pair(i,0)); // diagonal always present.
+        for(std::map<int,int>::iterator it= row.begin();(it!=row.end()) && (it->first<i);it++)
+          {
+            const int k= it->first;
+            const int levIK= it->second;
+            for(int p= diagPos[k]+1;p<rs[k+1];p++)
+              {
+                const int newLev= levIK+levels[p]+1;
+                if(newLev<=fillLevel)
+                  {
+                    const int j= cl[p];
+                    std::map<int,int>::iterator jt= row.find(j);
+                    if(jt==row.end())
+                      row[j]= newLev;
+                    else if(newLev<jt->second)
+                      jt->second= newLev;
+                  }
+              }
+          }
+        for(std::map<int,int>::const_iterator it= row.begin();it!=row.end();it++)
+          {
+            if(it->first==i)
+              diagPos[i]= cl.size();
+            cl.push_back(it->first);
+            levels.push_back(it->second);
+          }
+        rs[i+1]= cl.size();
+      }
+  }
+
+//! @brief Compute the incomplete factorization of the matrix.
+int XC::ILUkPreconditioner::setup(const SparseMatrixCSR &a)
+  {
+    int retval= 0;
+    const int n= a.getNumRows();
+    std::vector<int> rs, cl;
+    symbolic(a,rs,cl);
+    std::vector<double> vl(cl.size(),0.0);
+    std::vector<int> position(n,-1); // position of column j in current row.
+    int numSmallPivots= 0;
+    for(int i= 0;i<n;i++)
+      {
+        for(int p= rs[i];p<rs[i+1];p++)
+          position[cl[p]]= p;
+        for(int k= a.rowBegin(i);k<a.rowEnd(i);k++)
+          vl[position[a.col(k)]]= a.value(k);
+        for(int p= rs[i];p<diagPos[i];p++) // L part of row i
+          {
+            const int k= cl[p];
+            const double lik= vl[p]/vl[diagPos[k]];
+            vl[p]= lik;
+            for(int q= diagPos[k]+1;q<rs[k+1];q++)
+              {
+                const int pos= position[cl[q]];
+                if(pos>=0)
+                  vl[pos]-= lik*vl[q];
+              }
+          }
+        // Guard against tiny or zero pivots.
+        double &pivot= vl[diagPos[i]];
+        double rowNorm= 0.0;
+        for(int k= a.rowBegin(i);k<a.rowEnd(i);k++)
+          rowNorm= std::max(rowNorm,std::abs(a.value(k)));
+        const double minPivot= 1e-12*std::max(rowNorm,1e-300);
+        if(std::abs(pivot)<minPivot)
+          {
+            pivot= (pivot<0.0 ? -minPivot : minPivot);
+            numSmallPivots++;
+          }
+        for(int p= rs[i];p<rs[i+1];p++)
+          position[cl[p]]= -1;
+      }
+    if(numSmallPivots>0)
+      {
+        std::cerr << Color::red << "ILUkPreconditioner::" << __FUNCTION__
+                  << "; WARNING " << numSmallPivots
+                  << " small pivots have been replaced."
+                  << Color::def << std::endl;
+        retval= 1;
+      }
+    lu= SparseMatrixCSR(n,n,rs,cl,vl);
+    return retval;
+  }
+
+//! @brief Compute z= (LU)^{-1} r by forward and backward substitution.
+void XC::ILUkPreconditioner::apply(const std::vector<double> &r, std::vector<double> &z) const
+  {
+    const int n= lu.getNumRows();
+    for(int i= 0;i<n;i++)
+      {
+        double sum= r[i];
+        for(int p= lu.rowBegin(i);p<diagPos[i];p++)
+          sum-= lu.value(p)*z[lu.col(p)];
+        z[i]= sum;
+      }
+    for(int i= n-1;i>=0;i--)
+      {
+        double sum= z[i];
+        for(int p= diagPos[i]+1;p<lu.rowEnd(i);p++)
+          sum-= lu.value(p)*z[lu.col(p)];
+        z[i]= sum/lu.value(diagPos[i]);
+      }
+  }
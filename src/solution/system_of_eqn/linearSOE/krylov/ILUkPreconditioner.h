@@ -0,0 +1,65 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ILUkPreconditioner.h
+
+#ifndef ILUkPreconditioner_h
+#define ILUkPreconditioner_h
+
+#include "KrylovPreconditioner.h"
+#include "SparseMatrixCSR.h"
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Incomplete LU factorization with level of fill k.
+//!
+//! For symmetric matrices the upper factor is D*L^T so the
+//! preconditioner is equivalent to an incomplete Cholesky
+//! factorization with the same level of fill.
+class ILUkPreconditioner: public KrylovPreconditioner
+  {
+  private:
+    int fillLevel; //!< level of fill (0 means same pattern as the matrix).
+    SparseMatrixCSR lu; //!< L (unit diagonal, not stored) and U factors.
+    std::vector<int> diagPos; //!< position of the diagonal in each row of lu.
+
+    void symbolic(const SparseMatrixCSR &, std::vector<int> &, std::vector<int> &);
+  public:
+    ILUkPreconditioner(const int &k= 0);
+    std::string getName(void) const
+      { return "ilu"; }
+    inline int getFillLevel(void) const
+      { return fillLevel; }
+    int setup(const SparseMatrixCSR &);
+    void apply(const std::vector<double> &, std::vector<double> &) const;
+  };
+
+} // end of XC namespace
+
+#endif
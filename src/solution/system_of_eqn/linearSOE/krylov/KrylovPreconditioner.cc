@@ -0,0 +1,88 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovPreconditioner.cc
+
+#include "KrylovPreconditioner.h"
+#include "SparseMatrixCSR.h"
+#include "ILUkPreconditioner.h"
+#include "SmoothedAggregationAMG.h"
+#include <cmath>
+#include <iostream>
+#include "utility/utils/misc_utils/colormod.h"
+
+//! @brief Virtual constructor.
+//!
+//! @param type: preconditioner type (jacobi, ilu or amg).
+//! @param fillLevel: level of fill of the incomplete factorization.
+XC::KrylovPreconditioner *XC::KrylovPreconditioner::create(const std::string &type, const int &fillLevel)
+  {
+    KrylovPreconditioner *retval= nullptr;
+    if(type=="jacobi")
+      retval= new JacobiPreconditioner();
+    else if((type=="ilu") || (type=="ic"))
+      retval= new ILUkPreconditioner(fillLevel);
+    else if(type=="amg")
+      retval= new SmoothedAggregationAMG();
+    else
+      std::cerr << Color::red << "KrylovPreconditioner::" << __FUNCTION__
+                << "; preconditioner: '" << type
+                << "' unknown. Available types are: jacobi, ilu and amg."
+                << Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Compute the inverse of the diagonal of the matrix.
+int XC::JacobiPreconditioner::setup(const SparseMatrixCSR &a)
+  {
+    int retval= 0;
+    invDiag= a.getDiagonal();
+    const int n= invDiag.size();
+    for(int i= 0;i<n;i++)
+      {
+        if(std::abs(invDiag[i])>0.0)
+          invDiag[i]= 1.0/invDiag[i];
+        else
+          {
+            invDiag[i]= 1.0;
+            retval= -1;
+          }
+      }
+    if(retval<0)
+      std::cerr << Color::red << "JacobiPreconditioner::" << __FUNCTION__
+                << "; WARNING zero diagonal entries found."
+                << Color::def << std::endl;
+    return 0;
+  }
+
+//! @brief Compute z= D^{-1} r.
+void XC::JacobiPreconditioner::apply(const std::vector<double> &r, std::vector<double> &z) const
+  {
+    const int n= invDiag.size();
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<n;i++)
+      z[i]= invDiag[i]*r[i];
+  }
@@ -0,0 +1,75 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovPreconditioner.h
+
+#ifndef KrylovPreconditioner_h
+#define KrylovPreconditioner_h
+
+#include <vector>
+#include <string>
+
+namespace XC {
+class SparseMatrixCSR;
+
+//! @ingroup LinearSolver
+//
+//! @brief Base class for the preconditioners of the Krylov solvers.
+//!
+//! The setup is expensive and done once for a given matrix; the
+//! preconditioner can then be applied to the residuals of several
+//! solves (and several Newton iterations) while it remains effective.
+class KrylovPreconditioner
+  {
+  public:
+    virtual ~KrylovPreconditioner(void) {}
+    virtual std::string getName(void) const= 0;
+    //! @brief Build the preconditioner from the matrix argument.
+    virtual int setup(const SparseMatrixCSR &)= 0;
+    //! @brief Compute z= M^{-1} r.
+    virtual void apply(const std::vector<double> &r, std::vector<double> &z) const= 0;
+
+    static KrylovPreconditioner *create(const std::string &, const int &);
+  };
+
+//! @ingroup LinearSolver
+//
+//! @brief Diagonal (Jacobi) preconditioner.
+class JacobiPreconditioner: public KrylovPreconditioner
+  {
+  private:
+    std::vector<double> invDiag; //!< inverse of the matrix diagonal.
+  public:
+    std::string getName(void) const
+      { return "jacobi"; }
+    int setup(const SparseMatrixCSR &);
+    void apply(const std::vector<double> &, std::vector<double> &) const;
+  };
+
+} // end of XC namespace
+
+#endif
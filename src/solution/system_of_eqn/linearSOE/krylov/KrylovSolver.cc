@@ -0,0 +1,456 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovSolver.cc
+
+#include "KrylovSolver.h"
+#include "KrylovPreconditioner.h"
+#include "SparseMatrixCSR.h"
+#include "solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSOE.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include "classTags.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "utility/utils/misc_utils/colormod.h"
+
+//! @brief Constructor.
+//!
+//! @param m: Krylov method (pcg, minres or gmres).
+//! @param p: preconditioner type (jacobi, ilu or amg).
+XC::KrylovSolver::KrylovSolver(const std::string &m, const std::string &p)
+  : SparseGenRowLinSolver(SOLVER_TAGS_KrylovSolver),
+    method(m), preconditionerType(p), tolerance(1e-10), maxNumIter(1000),
+    restart(50), fillLevel(0), reuseFactor(2.0), thePreconditioner(nullptr),
+    baselineIter(-1), numIter(0), relResidual(0.0), numSetups(0) {}
+
+//! @brief Copy constructor (the preconditioner is not copied, it will
+//! be rebuilt on the next solution).
+XC::KrylovSolver::KrylovSolver(const KrylovSolver &other)
+  : SparseGenRowLinSolver(other),
+    method(other.method), preconditionerType(other.preconditionerType),
+    tolerance(other.tolerance), maxNumIter(other.maxNumIter),
+    restart(other.restart), fillLevel(other.fillLevel),
+    reuseFactor(other.reuseFactor), thePreconditioner(nullptr),
+    baselineIter(-1), numIter(0), relResidual(0.0), numSetups(0) {}
+
+//! @brief Assignment operator.
+XC::KrylovSolver &XC::KrylovSolver::operator=(const KrylovSolver &other)
+  {
+    if(this!=&other)
+      {
+        SparseGenRowLinSolver::operator=(other);
+        method= other.method;
+        preconditionerType= other.preconditionerType;
+        tolerance= other.tolerance;
+        maxNumIter= other.maxNumIter;
+        restart= other.restart;
+        fillLevel= other.fillLevel;
+        reuseFactor= other.reuseFactor;
+        free_preconditioner();
+      }
+    return *this;
+  }
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::KrylovSolver::getCopy(void) const
+  { return new KrylovSolver(*this); }
+
+//! @brief Destructor.
+XC::KrylovSolver::~KrylovSolver(void)
+  { free_preconditioner(); }
+
+//! @brief Release the preconditioner.
+void XC::KrylovSolver::free_preconditioner(void)
+  {
+    if(thePreconditioner)
+      {
+        delete thePreconditioner;
+        thePreconditioner= nullptr;
+      }
+    baselineIter= -1;
+  }
+
+//! @brief Return the Krylov method.
+const std::string &XC::KrylovSolver::getMethod(void) const
+  { return method; }
+
+//! @brief Set the Krylov method (pcg, minres or gmres).
+void XC::KrylovSolver::setMethod(const std::string &m)
+  {
+    if((m=="pcg") || (m=="minres") || (m=="gmres"))
+      method= m;
+    else
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; method: '" << m
+                << "' unknown. Available methods are: pcg, minres and gmres."
+                << Color::def << std::endl;
+  }
+
+//! @brief Return the preconditioner type.
+const std::string &XC::KrylovSolver::getPreconditionerType(void) const
+  { return preconditionerType; }
+
+//! @brief Set the preconditioner type (jacobi, ilu or amg).
+void XC::KrylovSolver::setPreconditionerType(const std::string &p)
+  {
+    if(p!=preconditionerType)
+      {
+        preconditionerType= p;
+        free_preconditioner();
+      }
+  }
+
+//! @brief Return the relative residual tolerance.
+double XC::KrylovSolver::getTolerance(void) const
+  { return tolerance; }
+
+//! @brief Set the relative residual tolerance.
+void XC::KrylovSolver::setTolerance(const double &tol)
+  { tolerance= tol; }
+
+//! @brief Return the maximum number of iterations.
+int XC::KrylovSolver::getMaxNumIter(void) const
+  { return maxNumIter; }
+
+//! @brief Set the maximum number of iterations.
+void XC::KrylovSolver::setMaxNumIter(const int &i)
+  { maxNumIter= i; }
+
+//! @brief Return the restart parameter for GMRES.
+int XC::KrylovSolver::getRestart(void) const
+  { return restart; }
+
+//! @brief Set the restart parameter for GMRES.
+void XC::KrylovSolver::setRestart(const int &i)
+  { restart= std::max(i,1); }
+
+//! @brief Return the level of fill of the incomplete factorization.
+int XC::KrylovSolver::getFillLevel(void) const
+  { return fillLevel; }
+
+//! @brief Set the level of fill of the incomplete factorization.
+void XC::KrylovSolver::setFillLevel(const int &k)
+  {
+    if(k!=fillLevel)
+      {
+        fillLevel= k;
+        free_preconditioner();
+      }
+  }
+
+//! @brief Return the preconditioner reuse factor.
+double XC::KrylovSolver::getReuseFactor(void) const
+  { return reuseFactor; }
+
+//! @brief Set the preconditioner reuse factor: the preconditioner is
+//! rebuilt when the number of iterations exceeds this factor times
+//! the number of iterations needed after its setup (a value lesser
+//! or equal than one forces the setup on each new matrix).
+void XC::KrylovSolver::setReuseFactor(const double &f)
+  { reuseFactor= f; }
+
+//! @brief Return the number of iterations of the last solution.
+int XC::KrylovSolver::getNumIter(void) const
+  { return numIter; }
+
+//! @brief Return the relative residual of the last solution.
+double XC::KrylovSolver::getRelativeResidual(void) const
+  { return relResidual; }
+
+//! @brief Return the number of preconditioner setups.
+int XC::KrylovSolver::getNumPreconditionerSetups(void) const
+  { return numSetups; }
+
+//! @brief Build the preconditioner for the matrix argument.
+int XC::KrylovSolver::setup_preconditioner(const SparseMatrixCSR &a)
+  {
+    free_preconditioner();
+    thePreconditioner= KrylovPreconditioner::create(preconditionerType,fillLevel);
+    int retval= -1;
+    if(thePreconditioner)
+      {
+        retval= thePreconditioner->setup(a);
+        numSetups++;
+      }
+    return retval;
+  }
+
+//! @brief Preconditioned conjugate gradient.
+int XC::KrylovSolver::pcg(const SparseMatrixCSR &a, const std::vector<double> &b, std::vector<double> &x)
+  {
+    const size_t n= b.size();
+    const double bNorm= norm2(b);
+    std::vector<double> r(n), z(n), p(n), ap(n);
+    a.residual(b.data(),x.data(),r.data());
+    thePreconditioner->apply(r,z);
+    p= z;
+    double rz= dot(r,z);
+    for(numIter= 0;numIter<maxNumIter;)
+      {
+        if(norm2(r)<=tolerance*bNorm)
+          return 0;
+        a.mult(p.data(),ap.data());
+        const double pAp= dot(p,ap);
+        if(pAp<=0.0)
+          return -2; // matrix not positive definite.
+        const double alpha= rz/pAp;
+        axpy(alpha,p,x);
+        axpy(-alpha,ap,r);
+        numIter++;
+        thePreconditioner->apply(r,z);
+        const double rzNew= dot(r,z);
+        xpby(z,rzNew/rz,p);
+        rz= rzNew;
+      }
+    return (norm2(r)<=tolerance*bNorm ? 0 : -1);
+  }
+
+//! @brief Preconditioned minimum residual method (Paige and Saunders).
+int XC::KrylovSolver::minres(const SparseMatrixCSR &a, const std::vector<double> &b, std::vector<double> &x)
+  {
+    const size_t n= b.size();
+    const double eps= std::numeric_limits<double>::epsilon();
+    std::vector<double> r1(n), r2(n), y(n), v(n), w(n,0.0), w1(n), w2(n,0.0);
+    a.residual(b.data(),x.data(),r1.data());
+    thePreconditioner->apply(r1,y);
+    double beta1= dot(r1,y);
+    if(beta1<0.0)
+      return -2; // preconditioner not positive definite.
+    beta1= sqrt(beta1);
+    numIter= 0;
+    if(beta1==0.0)
+      return 0;
+    r2= r1;
+    double oldb= 0.0, beta= beta1, dbar= 0.0, epsln= 0.0;
+    double phibar= beta1, cs= -1.0, sn= 0.0;
+    while(numIter<maxNumIter)
+      {
+        numIter++;
+        const double s= 1.0/beta;
+        for(size_t i= 0;i<n;i++)
+          v[i]= s*y[i];
+        a.mult(v.data(),y.data());
+        if(numIter>=2)
+          axpy(-beta/oldb,r1,y);
+        const double alfa= dot(v,y);
+        axpy(-alfa/beta,r2,y);
+        r1.swap(r2);
+        r2= y;
+        thePreconditioner->apply(r2,y);
+        oldb= beta;
+        beta= dot(r2,y);
+        if(beta<0.0)
+          return -2;
+        beta= sqrt(beta);
+        // Apply previous rotation and compute the new one.
+        const double oldeps= epsln;
+        const double delta= cs*dbar+sn*alfa;
+        const double gbar= sn*dbar-cs*alfa;
+        epsln= sn*beta;
+        dbar= -cs*beta;
+        const double gamma= std::max(sqrt(gbar*gbar+beta*beta),eps);
+        cs= gbar/gamma;
+        sn= beta/gamma;
+        const double phi= cs*phibar;
+        phibar= sn*phibar;
+        // Update solution.
+        const double denom= 1.0/gamma;
+        w1.swap(w2);
+        w2.swap(w);
+        for(size_t i= 0;i<n;i++)
+          {
+            w[i]= (v[i]-oldeps*w1[i]-delta*w2[i])*denom;
+            x[i]+= phi*w[i];
+          }
+        if(phibar<=tolerance*beta1)
+          return 0;
+      }
+    return -1;
+  }
+
+//! @brief Restarted GMRES with right preconditioning.
+int XC::KrylovSolver::gmres(const SparseMatrixCSR &a, const std::vector<double> &b, std::vector<double> &x)
+  {
+    const size_t n= b.size();
+    const int m= restart;
+    const double bNorm= norm2(b);
+    std::vector<std::vector<double> > V(m+1,std::vector<double>(n));
+    std::vector<std::vector<double> > H(m+1,std::vector<double>(m,0.0));
+    std::vector<double> cs(m), sn(m), g(m+1), y(m);
+    std::vector<double> r(n), z(n), w(n);
+    numIter= 0;
+    a.residual(b.data(),x.data(),r.data());
+    double beta= norm2(r);
+    while(beta>tolerance*bNorm && numIter<maxNumIter)
+      {
+        for(size_t i= 0;i<n;i++)
+          V[0][i]= r[i]/beta;
+        std::fill(g.begin(),g.end(),0.0);
+        g[0]= beta;
+        int j= 0;
+        for(;j<m && numIter<maxNumIter;)
+          {
+            thePreconditioner->apply(V[j],z);
+            a.mult(z.data(),w.data());
+            for(int i= 0;i<=j;i++) // modified Gram-Schmidt.
+              {
+                H[i][j]= dot(w,V[i]);
+                axpy(-H[i][j],V[i],w);
+              }
+            H[j+1][j]= norm2(w);
+            if(H[j+1][j]>0.0)
+              for(size_t i= 0;i<n;i++)
+                V[j+1][i]= w[i]/H[j+1][j];
+            for(int i= 0;i<j;i++) // apply previous rotations.
+              {
+                const double tmp= cs[i]*H[i][j]+sn[i]*H[i+1][j];
+                H[i+1][j]= -sn[i]*H[i][j]+cs[i]*H[i+1][j];
+                H[i][j]= tmp;
+              }
+            const double den= sqrt(H[j][j]*H[j][j]+H[j+1][j]*H[j+1][j]);
+            cs[j]= (den>0.0 ? H[j][j]/den : 1.0);
+            sn[j]= (den>0.0 ? H[j+1][j]/den : 0.0);
+            H[j][j]= den;
+            H[j+1][j]= 0.0;
+            g[j+1]= -sn[j]*g[j];
+            g[j]= cs[j]*g[j];
+            j++;
+            numIter++;
+            if(std::abs(g[j])<=tolerance*bNorm)
+              break;
+          }
+        // Solve the upper triangular system and update the solution.
+        for(int i= j-1;i>=0;i--)
+          {
+            double sum= g[i];
+            for(int k= i+1;k<j;k++)
+              sum-= H[i][k]*y[k];
+            y[i]= (H[i][i]!=0.0 ? sum/H[i][i] : 0.0);
+          }
+        std::fill(w.begin(),w.end(),0.0);
+        for(int i= 0;i<j;i++)
+          axpy(y[i],V[i],w);
+        thePreconditioner->apply(w,z);
+        axpy(1.0,z,x);
+        a.residual(b.data(),x.data(),r.data());
+        beta= norm2(r);
+      }
+    return (beta<=tolerance*bNorm ? 0 : -1);
+  }
+
+//! @brief Run the selected Krylov method.
+int XC::KrylovSolver::iterate(const SparseMatrixCSR &a, const std::vector<double> &b, std::vector<double> &x)
+  {
+    std::fill(x.begin(),x.end(),0.0);
+    int retval= -1;
+    if(method=="minres")
+      retval= minres(a,b,x);
+    else if(method=="gmres")
+      retval= gmres(a,b,x);
+    else
+      retval= pcg(a,b,x);
+    // True relative residual.
+    const double bNorm= norm2(b);
+    std::vector<double> r(b.size());
+    a.residual(b.data(),x.data(),r.data());
+    relResidual= (bNorm>0.0 ? norm2(r)/bNorm : norm2(r));
+    return retval;
+  }
+
+//! @brief Solve the system of equations.
+int XC::KrylovSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; no LinearSOE object has been set."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    const int n= theSOE->getNumEqn();
+    if(n==0)
+      return 0;
+    const SparseMatrixCSR a(n,n,theSOE->getRowStartA().getDataPtr(),theSOE->getColA().getDataPtr(),theSOE->getA().getDataPtr());
+    const Vector &B= theSOE->getB();
+    std::vector<double> b(B.getDataPtr(),B.getDataPtr()+n);
+    std::vector<double> x(n,0.0);
+
+    bool freshSetup= false;
+    if(!thePreconditioner || ((reuseFactor<=1.0) && !theSOE->getFactored()))
+      {
+        if(setup_preconditioner(a)<0)
+          return -1;
+        freshSetup= true;
+      }
+    int retval= iterate(a,b,x);
+    if(!freshSetup)
+      {
+        const bool tooSlow= (baselineIter>0) && (numIter>reuseFactor*baselineIter) && !theSOE->getFactored();
+        if((retval<0) || tooSlow)
+          { // rebuild the preconditioner for the current matrix.
+            if(setup_preconditioner(a)<0)
+              return -1;
+            freshSetup= true;
+            retval= iterate(a,b,x);
+          }
+      }
+    if(freshSetup)
+      baselineIter= std::max(numIter,1);
+    if(retval<0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; WARNING " << method << " did not converge after "
+                << numIter << " iterations (relative residual: "
+                << relResidual << ")."
+                << Color::def << std::endl;
+    Vector &X= theSOE->getX();
+    std::copy(x.begin(),x.end(),X.getDataPtr());
+    theSOE->setFactored(true);
+    return retval;
+  }
+
+//! @brief Called by the system of equations when its size changes,
+//! the preconditioner must be rebuilt.
+int XC::KrylovSolver::setSize(void)
+  {
+    free_preconditioner();
+    return 0;
+  }
+
+//! @brief Send object through the communicator argument.
+int XC::KrylovSolver::sendSelf(Communicator &comm)
+  {
+    // nothing to do
+    return 0;
+  }
+
+//! @brief Receive object through the communicator argument.
+int XC::KrylovSolver::recvSelf(const Communicator &comm)
+  {
+    // nothing to do
+    return 0;
+  }
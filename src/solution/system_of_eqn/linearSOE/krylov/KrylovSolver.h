@@ -0,0 +1,121 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovSolver.h
+
+#ifndef KrylovSolver_h
+#define KrylovSolver_h
+
+#include "solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSolver.h"
+#include <vector>
+#include <string>
+
+namespace XC {
+class KrylovPreconditioner;
+class SparseMatrixCSR;
+
+//! @ingroup LinearSolver
+//
+//! @brief Preconditioned Krylov subspace solver for the sparse row
+//! storage system of equations (SparseGenRowLinSOE).
+//!
+//! Available methods:
+//! <ul>
+//! <li> pcg: preconditioned conjugate gradient (symmetric positive definite matrices).</li>
+//! <li> minres: minimum residual method (symmetric indefinite matrices, symmetric positive definite preconditioner).</li>
+//! <li> gmres: restarted GMRES with right preconditioning (general matrices).</li>
+//! </ul>
+//! Available preconditioners: jacobi, ilu (incomplete LU/Cholesky
+//! with level of fill k) and amg (smoothed aggregation algebraic
+//! multigrid).
+//!
+//! The preconditioner is built only when needed: it is kept between
+//! solutions (i.e. between Newton iterations and time steps) until the
+//! number of iterations exceeds reuseFactor times the number of
+//! iterations needed just after its setup, or until a solution fails
+//! to converge (in that case the preconditioner is rebuilt and the
+//! solution repeated).
+class KrylovSolver: public SparseGenRowLinSolver
+  {
+  private:
+    std::string method; //!< Krylov method (pcg, minres or gmres).
+    std::string preconditionerType; //!< preconditioner type (jacobi, ilu or amg).
+    double tolerance; //!< relative residual tolerance.
+    int maxNumIter; //!< maximum number of iterations.
+    int restart; //!< restart parameter for GMRES.
+    int fillLevel; //!< level of fill for the incomplete factorization.
+    double reuseFactor; //!< rebuild the preconditioner if iterations > reuseFactor*baseline.
+    KrylovPreconditioner *thePreconditioner; //!< current preconditioner.
+    int baselineIter; //!< iterations after the last preconditioner setup.
+    int numIter; //!< iterations of the last solution.
+    double relResidual; //!< relative residual of the last solution.
+    int numSetups; //!< number of preconditioner setups.
+
+    void free_preconditioner(void);
+    int setup_preconditioner(const SparseMatrixCSR &);
+    int pcg(const SparseMatrixCSR &, const std::vector<double> &, std::vector<double> &);
+    int minres(const SparseMatrixCSR &, const std::vector<double> &, std::vector<double> &);
+    int gmres(const SparseMatrixCSR &, const std::vector<double> &, std::vector<double> &);
+    int iterate(const SparseMatrixCSR &, const std::vector<double> &, std::vector<double> &);
+  protected:
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    KrylovSolver(const std::string &m= "pcg", const std::string &p= "ilu");
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    KrylovSolver(const KrylovSolver &);
+    KrylovSolver &operator=(const KrylovSolver &);
+    ~KrylovSolver(void);
+
+    const std::string &getMethod(void) const;
+    void setMethod(const std::string &);
+    const std::string &getPreconditionerType(void) const;
+    void setPreconditionerType(const std::string &);
+    double getTolerance(void) const;
+    void setTolerance(const double &);
+    int getMaxNumIter(void) const;
+    void setMaxNumIter(const int &);
+    int getRestart(void) const;
+    void setRestart(const int &);
+    int getFillLevel(void) const;
+    void setFillLevel(const int &);
+    double getReuseFactor(void) const;
+    void setReuseFactor(const double &);
+    int getNumIter(void) const;
+    double getRelativeResidual(void) const;
+    int getNumPreconditionerSetups(void) const;
+
+    int solve(void);
+    int setSize(void);
+
+    int sendSelf(Communicator &);
+    int recvSelf(const Communicator &);
+  };
+
+} // end of XC namespace
+
+#endif
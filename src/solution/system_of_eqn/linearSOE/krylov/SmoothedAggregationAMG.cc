@@ -0,0 +1,309 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SmoothedAggregationAMG.cc
+
+#include "SmoothedAggregationAMG.h"
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include "utility/utils/misc_utils/colormod.h"
+
+//! @brief Default constructor.
+XC::SmoothedAggregationAMG::SmoothedAggregationAMG(void)
+  : strengthThreshold(0.08), maxLevels(10), maxCoarseSize(500),
+    numSweeps(2), jacobiWeight(2.0/3.0) {}
+
+//! @brief Compute the inverse of the diagonal guarding against zero
+//! entries.
+static std::vector<double> inverse_diagonal(const XC::SparseMatrixCSR &a)
+  {
+    std::vector<double> retval= a.getDiagonal();
+    for(std::vector<double>::iterator i= retval.begin();i!=retval.end();i++)
+      *i= (std::abs(*i)>0.0 ? 1.0/(*i) : 0.0);
+    return retval;
+  }
+
+//! @brief Group the unknowns in aggregates of strongly connected nodes.
+//!
+//! @param a: matrix of the level.
+//! @param agg: aggregate of each unknown (output).
+//! @return number of aggregates.
+int XC::SmoothedAggregationAMG::aggregate(const SparseMatrixCSR &a, std::vector<int> &agg) const
+  {
+    const int n= a.getNumRows();
+    const std::vector<double> diag= a.getDiagonal();
+    // Strong connections.
+    std::vector<int> sRowStart(n+1,0);
+    std::vector<int> sCols;
+    for(int i= 0;i<n;i++)
+      {
+        for(int k= a.rowBegin(i);k<a.rowEnd(i);k++)
+          {
+            const int j= a.col(k);
+            if(j!=i)
+              {
+                const double threshold= strengthThreshold*sqrt(std::abs(diag[i]*diag[j]));
+                if(std::abs(a.value(k))>=threshold && std::abs(a.value(k))>0.0)
+                  sCols.push_back(j);
+              }
+          }
+        sRowStart[i+1]= sCols.size();
+      }
+    agg.assign(n,-1);
+    int numAgg= 0;
+    // Phase 1: root nodes whose strong neighbours are all free.
+    for(int i= 0;i<n;i++)
+      {
+        if(agg[i]>=0) continue;
+        bool free= true;
+        for(int k= sRowStart[i];k<sRowStart[i+1];k++)
+          if(agg[sCols[k]]>=0)
+            { free= false; break; }
+        if(free && (sRowStart[i+1]>sRowStart[i]))
+          {
+            agg[i]= numAgg;
+            for(int k= sRowStart[i];k<sRowStart[i+1];k++)
+              agg[sCols[k]]= numAgg;
+            numAgg++;
+          }
+      }
+    // Phase 2: attach the remaining nodes to a neighbouring aggregate.
+    std::vector<int> tmp(agg);
+    for(int i= 0;i<n;i++)
+      {
+        if(agg[i]>=0) continue;
+        for(int k= sRowStart[i];k<sRowStart[i+1];k++)
+          if(agg[sCols[k]]>=0)
+            { tmp[i]= agg[sCols[k]]; break; }
+      }
+    agg.swap(tmp);
+    // Phase 3: new aggregates with the nodes still free.
+    for(int i= 0;i<n;i++)
+      {
+        if(agg[i]>=0) continue;
+        agg[i]= numAgg;
+        for(int k= sRowStart[i];k<sRowStart[i+1];k++)
+          if(agg[sCols[k]]<0)
+            agg[sCols[k]]= numAgg;
+        numAgg++;
+      }
+    return numAgg;
+  }
+
+//! @brief Compute the smoothed prolongator P= (I-omega*D^{-1}*A)*P0.
+//!
+//! @param a: matrix of the level.
+//! @param invDiag: inverse of the diagonal of a.
+//! @param agg: aggregate of each unknown.
+//! @param numAgg: number of aggregates.
+XC::SparseMatrixCSR XC::SmoothedAggregationAMG::prolongator(const SparseMatrixCSR &a, const std::vector<double> &invDiag, const std::vector<int> &agg, const int &numAgg) const
+  {
+    const int n= a.getNumRows();
+    // Tentative prolongator (normalized piecewise constant columns).
+    std::vector<int> aggSize(numAgg,0);
+    for(int i= 0;i<n;i++)
+      aggSize[agg[i]]++;
+    std::vector<int> rs(n+1), cl(n);
+    std::vector<double> vl(n);
+    for(int i= 0;i<n;i++)
+      {
+        rs[i]= i;
+        cl[i]= agg[i];
+        vl[i]= 1.0/sqrt(static_cast<double>(aggSize[agg[i]]));
+      }
+    rs[n]= n;
+    const SparseMatrixCSR p0(n,numAgg,rs,cl,vl);
+    // Spectral radius of D^{-1}A (Gershgorin bound).
+    double rho= 0.0;
+    for(int i= 0;i<n;i++)
+      {
+        double sum= 0.0;
+        for(int k= a.rowBegin(i);k<a.rowEnd(i);k++)
+          sum+= std::abs(a.value(k));
+        rho= std::max(rho,sum*std::abs(invDiag[i]));
+      }
+    const double omega= (rho>0.0 ? (4.0/3.0)/rho : 0.0);
+    const SparseMatrixCSR ap0= a*p0;
+    // P= P0 - omega*D^{-1}*A*P0 (rows of A*P0 are sorted).
+    std::vector<int> prs(n+1,0), pcl;
+    std::vector<double> pvl;
+    for(int i= 0;i<n;i++)
+      {
+        const int c0= p0.col(p0.rowBegin(i));
+        const double v0= p0.value(p0.rowBegin(i));
+        const double f= omega*invDiag[i];
+        bool done= false;
+        for(int k= ap0.rowBegin(i);k<ap0.rowEnd(i);k++)
+          {
+            const int c= ap0.col(k);
+            if(!done && c0<c)
+              {
+                pcl.push_back(c0); pvl.push_back(v0);
+                done= true;
+              }
+            double v= -f*ap0.value(k);
+            if(c==c0)
+              { v+= v0; done= true; }
+            pcl.push_back(c); pvl.push_back(v);
+          }
+        if(!done)
+          { pcl.push_back(c0); pvl.push_back(v0); }
+        prs[i+1]= pcl.size();
+      }
+    return SparseMatrixCSR(n,numAgg,prs,pcl,pvl);
+  }
+
+//! @brief Compute the dense LU factorization (partial pivoting) of the
+//! coarsest matrix.
+int XC::SmoothedAggregationAMG::factor_coarse(const SparseMatrixCSR &a)
+  {
+    int retval= 0;
+    const int n= a.getNumRows();
+    coarseLU.assign(n*n,0.0);
+    coarsePivots.assign(n,0);
+    for(int i= 0;i<n;i++)
+      for(int k= a.rowBegin(i);k<a.rowEnd(i);k++)
+        coarseLU[i*n+a.col(k)]= a.value(k);
+    for(int k= 0;k<n;k++)
+      {
+        int p= k;
+        double maxVal= std::abs(coarseLU[k*n+k]);
+        for(int i= k+1;i<n;i++)
+          if(std::abs(coarseLU[i*n+k])>maxVal)
+            { maxVal= std::abs(coarseLU[i*n+k]); p= i; }
+        coarsePivots[k]= p;
+        if(p!=k)
+          for(int j= 0;j<n;j++)
+            std::swap(coarseLU[k*n+j],coarseLU[p*n+j]);
+        if(maxVal==0.0)
+          {
+            coarseLU[k*n+k]= 1.0; // singular: keep the unknown uncoupled.
+            retval= -1;
+            continue;
+          }
+        const double pivot= coarseLU[k*n+k];
+        for(int i= k+1;i<n;i++)
+          {
+            const double f= (coarseLU[i*n+k]/= pivot);
+            if(f!=0.0)
+              for(int j= k+1;j<n;j++)
+                coarseLU[i*n+j]-= f*coarseLU[k*n+j];
+          }
+      }
+    if(retval<0)
+      std::cerr << Color::red << "SmoothedAggregationAMG::" << __FUNCTION__
+                << "; WARNING the coarsest matrix is singular."
+                << Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Solve the coarsest level system.
+void XC::SmoothedAggregationAMG::solve_coarse(const std::vector<double> &b, std::vector<double> &x) const
+  {
+    const int n= coarsePivots.size();
+    x= b;
+    for(int k= 0;k<n;k++)
+      if(coarsePivots[k]!=k)
+        std::swap(x[k],x[coarsePivots[k]]);
+    for(int i= 0;i<n;i++)
+      for(int j= 0;j<i;j++)
+        x[i]-= coarseLU[i*n+j]*x[j];
+    for(int i= n-1;i>=0;i--)
+      {
+        for(int j= i+1;j<n;j++)
+          x[i]-= coarseLU[i*n+j]*x[j];
+        x[i]/= coarseLU[i*n+i];
+      }
+  }
+
+//! @brief Build the multigrid hierarchy.
+int XC::SmoothedAggregationAMG::setup(const SparseMatrixCSR &a)
+  {
+    levels.clear();
+    levels.push_back(Level());
+    levels.back().A= a.getOwnedCopy();
+    while((static_cast<int>(levels.size())<maxLevels) && (levels.back().A.getNumRows()>maxCoarseSize))
+      {
+        Level &fine= levels.back();
+        fine.invDiag= inverse_diagonal(fine.A);
+        std::vector<int> agg;
+        const int numAgg= aggregate(fine.A,agg);
+        if((numAgg==0) || (numAgg>=fine.A.getNumRows()))
+          break; // no coarsening possible.
+        fine.P= prolongator(fine.A,fine.invDiag,agg,numAgg);
+        fine.R= fine.P.getTranspose();
+        Level coarse;
+        coarse.A= fine.R*(fine.A*fine.P);
+        levels.push_back(coarse);
+      }
+    Level &coarsest= levels.back();
+    coarsest.invDiag= inverse_diagonal(coarsest.A);
+    return factor_coarse(coarsest.A);
+  }
+
+//! @brief Damped Jacobi sweeps on the level.
+void XC::SmoothedAggregationAMG::smooth(const Level &l, const std::vector<double> &b, std::vector<double> &x) const
+  {
+    const int n= b.size();
+    std::vector<double> r(n);
+    for(int s= 0;s<numSweeps;s++)
+      {
+        l.A.residual(b.data(),x.data(),r.data());
+        #pragma omp parallel for schedule(static)
+        for(int i= 0;i<n;i++)
+          x[i]+= jacobiWeight*l.invDiag[i]*r[i];
+      }
+  }
+
+//! @brief Apply a V-cycle starting at the level argument.
+void XC::SmoothedAggregationAMG::vcycle(const size_t &lev, const std::vector<double> &b, std::vector<double> &x) const
+  {
+    if(lev+1==levels.size())
+      solve_coarse(b,x);
+    else
+      {
+        const Level &l= levels[lev];
+        const int n= b.size();
+        std::fill(x.begin(),x.end(),0.0);
+        smooth(l,b,x);
+        std::vector<double> r(n);
+        l.A.residual(b.data(),x.data(),r.data());
+        const int nc= l.R.getNumRows();
+        std::vector<double> bc(nc), xc(nc,0.0);
+        l.R.mult(r.data(),bc.data());
+        vcycle(lev+1,bc,xc);
+        l.P.multAdd(1.0,xc.data(),x.data());
+        smooth(l,b,x);
+      }
+  }
+
+//! @brief Compute z= M^{-1} r (one V-cycle).
+void XC::SmoothedAggregationAMG::apply(const std::vector<double> &r, std::vector<double> &z) const
+  {
+    if(!levels.empty())
+      vcycle(0,r,z);
+  }
@@ -0,0 +1,86 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SmoothedAggregationAMG.h
+
+#ifndef SmoothedAggregationAMG_h
+#define SmoothedAggregationAMG_h
+
+#include "KrylovPreconditioner.h"
+#include "SparseMatrixCSR.h"
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Smoothed aggregation algebraic multigrid preconditioner.
+//!
+//! Builds a hierarchy of coarse matrices A_{l+1}= R_l A_l P_l where the
+//! prolongator P_l is obtained by smoothing (one damped Jacobi sweep)
+//! the piecewise constant tentative prolongator defined by the
+//! aggregates of strongly connected unknowns. The preconditioner
+//! applies one V-cycle with damped Jacobi smoothing; the coarsest
+//! level is solved with a dense LU factorization.
+class SmoothedAggregationAMG: public KrylovPreconditioner
+  {
+  private:
+    //! @brief Multigrid level.
+    struct Level
+      {
+        SparseMatrixCSR A; //!< matrix of the level.
+        SparseMatrixCSR P; //!< prolongator to this level from the next one.
+        SparseMatrixCSR R; //!< restrictor from this level to the next one.
+        std::vector<double> invDiag; //!< inverse of the diagonal of A.
+      };
+    double strengthThreshold; //!< threshold for the strong connections.
+    int maxLevels; //!< maximum number of levels.
+    int maxCoarseSize; //!< size of the coarsest level.
+    int numSweeps; //!< number of pre and post smoothing sweeps.
+    double jacobiWeight; //!< smoother damping factor.
+    std::vector<Level> levels; //!< level hierarchy.
+    std::vector<double> coarseLU; //!< dense LU factors of the coarsest matrix.
+    std::vector<int> coarsePivots; //!< pivots of the coarsest factorization.
+
+    int aggregate(const SparseMatrixCSR &, std::vector<int> &) const;
+    SparseMatrixCSR prolongator(const SparseMatrixCSR &, const std::vector<double> &, const std::vector<int> &, const int &) const;
+    int factor_coarse(const SparseMatrixCSR &);
+    void solve_coarse(const std::vector<double> &, std::vector<double> &) const;
+    void smooth(const Level &, const std::vector<double> &, std::vector<double> &) const;
+    void vcycle(const size_t &, const std::vector<double> &, std::vector<double> &) const;
+  public:
+    SmoothedAggregationAMG(void);
+    std::string getName(void) const
+      { return "amg"; }
+    inline size_t getNumLevels(void) const
+      { return levels.size(); }
+    int setup(const SparseMatrixCSR &);
+    void apply(const std::vector<double> &, std::vector<double> &) const;
+  };
+
+} // end of XC namespace
+
+#endif
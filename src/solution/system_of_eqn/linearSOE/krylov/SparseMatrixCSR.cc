@@ -0,0 +1,266 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseMatrixCSR.cc
+
+#include "SparseMatrixCSR.h"
+#include <cmath>
+#include <algorithm>
+
+//! @brief Make the pointers refer to the owned storage.
+void XC::SparseMatrixCSR::set_pointers(void)
+  {
+    rowStart= ownRowStart.data();
+    cols= ownCols.data();
+    values= ownValues.data();
+  }
+
+//! @brief Default constructor (empty matrix).
+XC::SparseMatrixCSR::SparseMatrixCSR(void)
+  : nRows(0), nCols(0), ownRowStart(1,0)
+  { set_pointers(); }
+
+//! @brief Constructor of a view of externally owned CSR arrays.
+//!
+//! @param nr: number of rows.
+//! @param nc: number of columns.
+//! @param rs: row start positions (size nr+1).
+//! @param cl: column indexes.
+//! @param vl: values.
+XC::SparseMatrixCSR::SparseMatrixCSR(const int &nr, const int &nc, const int *rs, const int *cl, const double *vl)
+  : nRows(nr), nCols(nc), rowStart(rs), cols(cl), values(vl) {}
+
+//! @brief Constructor of a matrix that takes ownership of the given
+//! arrays (their contents are swapped into the object).
+XC::SparseMatrixCSR::SparseMatrixCSR(const int &nr, const int &nc, std::vector<int> &rs, std::vector<int> &cl, std::vector<double> &vl)
+  : nRows(nr), nCols(nc)
+  {
+    ownRowStart.swap(rs);
+    ownCols.swap(cl);
+    ownValues.swap(vl);
+    set_pointers();
+  }
+
+//! @brief Copy constructor.
+XC::SparseMatrixCSR::SparseMatrixCSR(const SparseMatrixCSR &other)
+  : nRows(other.nRows), nCols(other.nCols),
+    ownRowStart(other.ownRowStart), ownCols(other.ownCols),
+    ownValues(other.ownValues),
+    rowStart(other.rowStart), cols(other.cols), values(other.values)
+  {
+    if(other.isOwner())
+      set_pointers();
+  }
+
+//! @brief Assignment operator.
+XC::SparseMatrixCSR &XC::SparseMatrixCSR::operator=(const SparseMatrixCSR &other)
+  {
+    if(this!=&other)
+      {
+        nRows= other.nRows;
+        nCols= other.nCols;
+        ownRowStart= other.ownRowStart;
+        ownCols= other.ownCols;
+        ownValues= other.ownValues;
+        if(other.isOwner())
+          set_pointers();
+        else
+          {
+            rowStart= other.rowStart;
+            cols= other.cols;
+            values= other.values;
+          }
+      }
+    return *this;
+  }
+
+//! @brief Return true if the object owns its storage.
+bool XC::SparseMatrixCSR::isOwner(void) const
+  { return (rowStart==ownRowStart.data()); }
+
+//! @brief Return a copy of the matrix that owns its storage (even if
+//! this object is a view).
+XC::SparseMatrixCSR XC::SparseMatrixCSR::getOwnedCopy(void) const
+  {
+    if(nRows==0)
+      return SparseMatrixCSR();
+    const int nnz= getNNZ();
+    std::vector<int> rs(rowStart,rowStart+nRows+1);
+    std::vector<int> cl(cols,cols+nnz);
+    std::vector<double> vl(values,values+nnz);
+    return SparseMatrixCSR(nRows,nCols,rs,cl,vl);
+  }
+
+//! @brief Return the diagonal of the matrix (zero where the diagonal
+//! entry is not stored).
+std::vector<double> XC::SparseMatrixCSR::getDiagonal(void) const
+  {
+    std::vector<double> retval(nRows,0.0);
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<nRows;i++)
+      for(int k= rowStart[i];k<rowStart[i+1];k++)
+        if(cols[k]==i)
+          {
+            retval[i]= values[k];
+            break;
+          }
+    return retval;
+  }
+
+//! @brief Compute y= A*x.
+void XC::SparseMatrixCSR::mult(const double *x, double *y) const
+  {
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<nRows;i++)
+      {
+        double sum= 0.0;
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          sum+= values[k]*x[cols[k]];
+        y[i]= sum;
+      }
+  }
+
+//! @brief Compute y+= alpha*A*x.
+void XC::SparseMatrixCSR::multAdd(const double &alpha, const double *x, double *y) const
+  {
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<nRows;i++)
+      {
+        double sum= 0.0;
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          sum+= values[k]*x[cols[k]];
+        y[i]+= alpha*sum;
+      }
+  }
+
+//! @brief Compute the residual r= b-A*x.
+void XC::SparseMatrixCSR::residual(const double *b, const double *x, double *r) const
+  {
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<nRows;i++)
+      {
+        double sum= b[i];
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          sum-= values[k]*x[cols[k]];
+        r[i]= sum;
+      }
+  }
+
+//! @brief Return the transpose of the matrix.
+XC::SparseMatrixCSR XC::SparseMatrixCSR::getTranspose(void) const
+  {
+    const int nnz= getNNZ();
+    std::vector<int> rs(nCols+1,0);
+    std::vector<int> cl(nnz);
+    std::vector<double> vl(nnz);
+    for(int k= 0;k<nnz;k++)
+      rs[cols[k]+1]++;
+    for(int j= 0;j<nCols;j++)
+      rs[j+1]+= rs[j];
+    std::vector<int> next(rs.begin(),rs.end()-1);
+    for(int i= 0;i<nRows;i++)
+      for(int k= rowStart[i];k<rowStart[i+1];k++)
+        {
+          const int pos= next[cols[k]]++;
+          cl[pos]= i;
+          vl[pos]= values[k];
+        }
+    return SparseMatrixCSR(nCols,nRows,rs,cl,vl);
+  }
+
+//! @brief Return the product of this matrix by the argument (Gustavson's
+//! row-by-row algorithm). The columns of each row are sorted.
+XC::SparseMatrixCSR XC::SparseMatrixCSR::operator*(const SparseMatrixCSR &b) const
+  {
+    const int nc= b.getNumCols();
+    std::vector<int> rs(nRows+1,0);
+    std::vector<int> cl;
+    std::vector<double> vl;
+    std::vector<int> marker(nc,-1);
+    std::vector<double> acc(nc,0.0);
+    std::vector<int> rowCols;
+    for(int i= 0;i<nRows;i++)
+      {
+        rowCols.clear();
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          {
+            const int j= cols[k];
+            const double aij= values[k];
+            for(int l= b.rowBegin(j);l<b.rowEnd(j);l++)
+              {
+                const int c= b.col(l);
+                if(marker[c]!=i)
+                  {
+                    marker[c]= i;
+                    acc[c]= 0.0;
+                    rowCols.push_back(c);
+                  }
+                acc[c]+= aij*b.value(l);
+              }
+          }
+        std::sort(rowCols.begin(),rowCols.end());
+        for(std::vector<int>::const_iterator it= rowCols.begin();it!=rowCols.end();it++)
+          {
+            cl.push_back(*it);
+            vl.push_back(acc[*it]);
+          }
+        rs[i+1]= cl.size();
+      }
+    return SparseMatrixCSR(nRows,nc,rs,cl,vl);
+  }
+
+//! @brief Return the dot product of both vectors.
+double XC::dot(const std::vector<double> &a, const std::vector<double> &b)
+  {
+    const int n= a.size();
+    double retval= 0.0;
+    #pragma omp parallel for reduction(+:retval) schedule(static)
+    for(int i= 0;i<n;i++)
+      retval+= a[i]*b[i];
+    return retval;
+  }
+
+//! @brief Return the euclidean norm of the vector.
+double XC::norm2(const std::vector<double> &a)
+  { return sqrt(dot(a,a)); }
+
+//! @brief Compute y+= alpha*x.
+void XC::axpy(const double &alpha, const std::vector<double> &x, std::vector<double> &y)
+  {
+    const int n= x.size();
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<n;i++)
+      y[i]+= alpha*x[i];
+  }
+
+//! @brief Compute y= x+beta*y.
+void XC::xpby(const std::vector<double> &x, const double &beta, std::vector<double> &y)
+  {
+    const int n= x.size();
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<n;i++)
+      y[i]= x[i]+beta*y[i];
+  }
@@ -0,0 +1,106 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseMatrixCSR.h
+
+#ifndef SparseMatrixCSR_h
+#define SparseMatrixCSR_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Compressed sparse row matrix used by the Krylov solvers and
+//! their preconditioners.
+//!
+//! The matrix can own its storage (coarse levels of the multigrid
+//! preconditioner, incomplete factors) or refer to the arrays of a
+//! system of equations (see SparseGenRowLinSOE) without copying them.
+class SparseMatrixCSR
+  {
+  private:
+    int nRows; //!< number of rows.
+    int nCols; //!< number of columns.
+    std::vector<int> ownRowStart; //!< row start storage (if owned).
+    std::vector<int> ownCols; //!< column indexes storage (if owned).
+    std::vector<double> ownValues; //!< values storage (if owned).
+    const int *rowStart; //!< position of the first entry of each row (size nRows+1).
+    const int *cols; //!< column indexes of the entries.
+    const double *values; //!< values of the entries.
+
+    void set_pointers(void);
+  public:
+    SparseMatrixCSR(void);
+    SparseMatrixCSR(const int &, const int &, const int *, const int *, const double *);
+    SparseMatrixCSR(const int &, const int &, std::vector<int> &, std::vector<int> &, std::vector<double> &);
+    SparseMatrixCSR(const SparseMatrixCSR &);
+    SparseMatrixCSR &operator=(const SparseMatrixCSR &);
+
+    //! @brief Return the number of rows.
+    inline int getNumRows(void) const
+      { return nRows; }
+    //! @brief Return the number of columns.
+    inline int getNumCols(void) const
+      { return nCols; }
+    //! @brief Return the number of stored entries.
+    inline int getNNZ(void) const
+      { return (nRows>0 ? rowStart[nRows] : 0); }
+    //! @brief Return the position of the first entry of row i.
+    inline int rowBegin(const int &i) const
+      { return rowStart[i]; }
+    //! @brief Return the position past the last entry of row i.
+    inline int rowEnd(const int &i) const
+      { return rowStart[i+1]; }
+    //! @brief Return the column of the k-th entry.
+    inline int col(const int &k) const
+      { return cols[k]; }
+    //! @brief Return the value of the k-th entry.
+    inline double value(const int &k) const
+      { return values[k]; }
+    bool isOwner(void) const;
+    SparseMatrixCSR getOwnedCopy(void) const;
+
+    std::vector<double> getDiagonal(void) const;
+    void mult(const double *, double *) const;
+    void multAdd(const double &, const double *, double *) const;
+    void residual(const double *, const double *, double *) const;
+    SparseMatrixCSR getTranspose(void) const;
+    SparseMatrixCSR operator*(const SparseMatrixCSR &) const;
+  };
+
+// Vector kernels (multithreaded through OpenMP).
+double dot(const std::vector<double> &, const std::vector<double> &);
+double norm2(const std::vector<double> &);
+void axpy(const double &, const std::vector<double> &, std::vector<double> &);
+void xpby(const std::vector<double> &, const double &, std::vector<double> &);
+
+} // end of XC namespace
+
+#endif
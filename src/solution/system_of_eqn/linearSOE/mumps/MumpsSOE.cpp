@@ -122,6 +122,7 @@ void XC::MumpsSOE::cppIndexing(void)
 
 int XC::MumpsSOE::setSize(Graph &theGraph)
   {
+    clearStoredA(); // the stored values are not valid anymore.
     int result = 0;
     size = theGraph.getNumVertex();
 
@@ -160,6 +160,7 @@ bool XC::ProfileSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 //! returned. 
 int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
   {
+    clearStoredA(); // the stored values are not valid anymore.
     int result = 0;
     size= checkSize(theGraph);
 
@@ -334,6 +335,20 @@ void XC::ProfileSPDLinSOE::zeroA(void)
     factored = false;
   }
 
+//! @brief Store a copy of the current values of the matrix A.
+bool XC::ProfileSPDLinSOE::storeA(void)
+  { return store_A(A); }
+
+//! @brief Set the matrix A to the values stored by the last call
+//! to storeA.
+bool XC::ProfileSPDLinSOE::restoreA(void)
+  {
+    const bool retval= restore_A(A);
+    if(retval)
+      factored= false;
+    return retval;
+  }
+
 
 int XC::ProfileSPDLinSOE::sendSelf(Communicator &comm)
   { return 0; }
@@ -139,6 +139,10 @@ class ProfileSPDLinSOE: public FactoredSOEBase
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     
     virtual void zeroA(void);
+    
+    virtual bool storeA(void);
+    
+    virtual bool restoreA(void);
 
     virtual int sendSelf(Communicator &);
     virtual int recvSelf(const Communicator &);
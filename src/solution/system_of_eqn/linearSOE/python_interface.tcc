@@ -22,11 +22,12 @@
 //python_interface.tcc
 
 class_<XC::LinearSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("LinearSOE", no_init)
-  .def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver', 'umfpack_gen_lin_solver', 'mumps_solver'" )
+  .def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver', 'umfpack_gen_lin_solver', 'mumps_solver', 'krylov_solver'" )
   .add_property("numEqn", &XC::LinearSOE::getNumEqn, "Return the number of equations.")
   .add_property("b", make_function(&XC::LinearSOE::getB, return_internal_reference<>() ), "Return the rigth hand side of the equation.")
   .add_property("x", make_function(&XC::LinearSOE::getX, return_internal_reference<>() ), "Return the vector of unknowns.")
   .add_property("solver", make_function(&XC::LinearSOE::getSolver, return_internal_reference<>() ), "Return a pointer to the solver.")
+  .def("solveMultipleRHS", &XC::LinearSOE::solveMultipleRHS, "solveMultipleRHS(BX): solve the system for the right-hand sides stored in the columns of BX, overwriting them with the solutions.")
   ;
 
 class_<XC::LinearSOEData, bases<XC::LinearSOE>, boost::noncopyable >("LinearSOEData", no_init);
@@ -162,10 +163,31 @@ class_<XC::SymSparseLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >(
 class_<XC::UmfpackGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("UmfpackGenLinSolver", no_init)
   ;
 
+class_<XC::UmfpackStaticCondensationSolver, bases<XC::UmfpackGenLinSolver>, boost::noncopyable >("UmfpackStaticCondensationSolver", no_init)
+  .add_property("numInterfaceEqs", &XC::UmfpackStaticCondensationSolver::getNumInterfaceEquations,"Return the number of interface (condensed) equations.")
+  .add_property("numInternalEqs", &XC::UmfpackStaticCondensationSolver::getNumInternalEquations,"Return the number of internal (eliminated) equations.")
+  .add_property("numCondensations", &XC::UmfpackStaticCondensationSolver::getNumCondensations,"Return the number of condensations of the linear part computed since the last call to setSize.")
+  ;
+
 class_<XC::MumpsSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("MumpsSolver", no_init)
   ;
 
 class_<XC::MumpsParallelSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("MumpsParallelSolver", no_init)
   ;
 
+const std::string &(XC::KrylovSolver::*getKrylovMethod)(void) const= &XC::KrylovSolver::getMethod;
+const std::string &(XC::KrylovSolver::*getKrylovPreconditioner)(void) const= &XC::KrylovSolver::getPreconditionerType;
+class_<XC::KrylovSolver, bases<XC::SparseGenRowLinSolver>, boost::noncopyable >("KrylovSolver", no_init)
+  .add_property("method", make_function(getKrylovMethod, return_value_policy<copy_const_reference>()), &XC::KrylovSolver::setMethod,"Krylov method: 'pcg', 'minres' or 'gmres'.")
+  .add_property("preconditioner", make_function(getKrylovPreconditioner, return_value_policy<copy_const_reference>()), &XC::KrylovSolver::setPreconditionerType,"Preconditioner type: 'jacobi', 'ilu' or 'amg'.")
+  .add_property("tolerance", &XC::KrylovSolver::getTolerance, &XC::KrylovSolver::setTolerance,"Relative residual tolerance.")
+  .add_property("maxNumIter", &XC::KrylovSolver::getMaxNumIter, &XC::KrylovSolver::setMaxNumIter,"Maximum number of iterations.")
+  .add_property("restart", &XC::KrylovSolver::getRestart, &XC::KrylovSolver::setRestart,"Restart parameter for GMRES.")
+  .add_property("fillLevel", &XC::KrylovSolver::getFillLevel, &XC::KrylovSolver::setFillLevel,"Level of fill of the incomplete factorization.")
+  .add_property("reuseFactor", &XC::KrylovSolver::getReuseFactor, &XC::KrylovSolver::setReuseFactor,"The preconditioner is rebuilt when the number of iterations exceeds this factor times the number of iterations needed after its setup.")
+  .add_property("numIter", &XC::KrylovSolver::getNumIter,"Return the number of iterations of the last solution.")
+  .add_property("relativeResidual", &XC::KrylovSolver::getRelativeResidual,"Return the relative residual of the last solution.")
+  .add_property("numPreconditionerSetups", &XC::KrylovSolver::getNumPreconditionerSetups,"Return the number of preconditioner setups.")
+  ;
+
 
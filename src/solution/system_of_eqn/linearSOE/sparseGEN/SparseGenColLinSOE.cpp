@@ -124,6 +124,7 @@ bool XC::SparseGenColLinSOE::setSolver(LinearSOESolver *newSolver)
 //! the associated Solver object is returned.
 int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
   {
+    clearStoredA(); // the stored values are not valid anymore.
     int result = 0;
     size= checkSize(theGraph);
 
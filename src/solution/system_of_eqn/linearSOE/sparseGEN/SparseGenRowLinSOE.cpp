@@ -84,6 +84,7 @@ bool XC::SparseGenRowLinSOE::setSolver(LinearSOESolver *newSolver)
 //! @brief Sets the size of the system from the number of vertices in the graph.
 int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
   {
+    clearStoredA(); // the stored values are not valid anymore.
     int result = 0;
     size= checkSize(theGraph);
 
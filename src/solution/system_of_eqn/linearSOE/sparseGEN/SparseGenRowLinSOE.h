@@ -85,6 +85,13 @@ class SparseGenRowLinSOE: public SparseGenSOEBase
   public:
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+
+    //! @brief Return the column indexes of the stored coefficients.
+    const ID &getColA(void) const
+      { return colA; }
+    //! @brief Return the position of the first coefficient of each row.
+    const ID &getRowStartA(void) const
+      { return rowStartA; }
     
     int sendSelf(Communicator &);
     int recvSelf(const Communicator &);
@@ -51,6 +51,8 @@ class SparseGenSOEBase: public SparseSOEBase
     Vector &getA(void)
       { return A; }
     virtual void zeroA(void);
+    virtual bool storeA(void);
+    virtual bool restoreA(void);
   };
 } // end of XC namespace
 
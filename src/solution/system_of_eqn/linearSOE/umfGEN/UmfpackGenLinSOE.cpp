@@ -107,6 +107,7 @@ bool XC::UmfpackGenLinSOE::setSolver(LinearSOESolver *newSolver)
 //! @brief Sets the size of the system from the number of vertices in the graph.
 int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
   {
+    clearStoredA(); // the stored values are not valid anymore.
     size= checkSize(theGraph);
     if(size < 0)
       {
@@ -126,9 +127,11 @@ int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
       }
 
     // resize A, B, X
+    Ap.clear();
+    Ai.clear();
     Ap.reserve(size+1);
     Ai.reserve(nnz);
-    Ax.resize(nnz,0.0);
+    Ax.assign(nnz,0.0);
     B.resize(size);
     B.Zero();
     X.resize(size);
@@ -259,6 +262,20 @@ void XC::UmfpackGenLinSOE::zeroA(void)
     this->factored= false;
   }
 
+//! @brief Store a copy of the current values of the matrix A.
+bool XC::UmfpackGenLinSOE::storeA(void)
+  { return store_A(Ax); }
+
+//! @brief Set the matrix A to the values stored by the last call
+//! to storeA.
+bool XC::UmfpackGenLinSOE::restoreA(void)
+  {
+    const bool retval= restore_A(Ax);
+    if(retval)
+      this->factored= false;
+    return retval;
+  }
+
 int XC::UmfpackGenLinSOE::sendSelf(Communicator &comm)
   {
     return 0;
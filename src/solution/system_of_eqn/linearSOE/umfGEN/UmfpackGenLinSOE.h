@@ -92,11 +92,16 @@ class UmfpackGenLinSOE: public LinearSOEData
     int addA(const Matrix &, const ID &, double fact = 1.0);
     
     void zeroA(void);
+    
+    bool storeA(void);
+    
+    bool restoreA(void);
 
     int sendSelf(Communicator &);
     int recvSelf(const Communicator &);
 
     friend class UmfpackGenLinSolver;
+    friend class UmfpackStaticCondensationSolver;
 
   };
 } // end of XC namespace
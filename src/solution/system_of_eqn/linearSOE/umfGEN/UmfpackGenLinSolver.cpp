@@ -63,6 +63,8 @@
 
 #include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h>
+#include "utility/matrix/Matrix.h"
+#include <algorithm>
 
 void XC::UmfpackGenLinSolver::free_symbolic(void)
   {
@@ -87,6 +89,12 @@ XC::UmfpackGenLinSolver::UmfpackGenLinSolver()
    Symbolic(nullptr), Numeric(nullptr), theSOE(nullptr)
   {}
 
+//! @brief Constructor (for derived classes).
+XC::UmfpackGenLinSolver::UmfpackGenLinSolver(int classTag)
+ : LinearSOESolver(classTag),
+   Symbolic(nullptr), Numeric(nullptr), theSOE(nullptr)
+  {}
+
 XC::LinearSOESolver *XC::UmfpackGenLinSolver::getCopy(void) const
    { return new UmfpackGenLinSolver(*this); }
 
@@ -97,19 +105,10 @@ XC::UmfpackGenLinSolver::~UmfpackGenLinSolver()
     free_numeric();
   }
 
-int XC::UmfpackGenLinSolver::solve(void)
+//! @brief Computes the numeric factorization of the matrix if the
+//! system is not marked as factored.
+int XC::UmfpackGenLinSolver::factor(void)
   {
-    const int n = theSOE->X.Size();
-    const int nnz = static_cast<int>(theSOE->Ai.size());
-    if(n == 0 || nnz==0)
-      return 0;
-    
-    int *Ap= theSOE->Ap.data();
-    int *Ai= theSOE->Ai.data();
-    double *Ax = theSOE->Ax.data();
-    double *X = theSOE->X.getDataPtr();
-    double *B = theSOE->B.getDataPtr();
-
     // check if symbolic is done
     if(!Symbolic)
       {
@@ -124,6 +123,9 @@ int XC::UmfpackGenLinSolver::solve(void)
 	  {
 	    this->free_numeric();
 	  }
+	int *Ap= theSOE->Ap.data();
+	int *Ai= theSOE->Ai.data();
+	double *Ax = theSOE->Ax.data();
 	// numerical analysis
 	const int status= umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
 
@@ -148,6 +150,24 @@ int XC::UmfpackGenLinSolver::solve(void)
 	  }
 	theSOE->factored = true;
       }
+    return 0;
+  }
+
+int XC::UmfpackGenLinSolver::solve(void)
+  {
+    const int n = theSOE->X.Size();
+    const int nnz = static_cast<int>(theSOE->Ai.size());
+    if(n == 0 || nnz==0)
+      return 0;
+    
+    if(factor()<0)
+      return -1;
+
+    int *Ap= theSOE->Ap.data();
+    int *Ai= theSOE->Ai.data();
+    double *Ax = theSOE->Ax.data();
+    double *X = theSOE->X.getDataPtr();
+    double *B = theSOE->B.getDataPtr();
 
     // solve
     const int status= umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
@@ -166,6 +186,51 @@ int XC::UmfpackGenLinSolver::solve(void)
     return 0;
   }
 
+//! @brief Return true (the numeric factorization is reused for all the
+//! right-hand sides).
+bool XC::UmfpackGenLinSolver::supportsMultipleRHS(void) const
+  { return true; }
+
+//! @brief Solves the system for all the columns of \p BX, overwriting
+//! them with the solutions.
+//!
+//! UMFPACK solves one right-hand side per call, so the columns are
+//! solved one after another with the same numeric factorization,
+//! without copying them through the \f$b\f$ and \f$x\f$ vectors of
+//! the system.
+int XC::UmfpackGenLinSolver::solveMultipleRHS(Matrix &BX)
+  {
+    const int n = theSOE->X.Size();
+    const int nnz = static_cast<int>(theSOE->Ai.size());
+    const int nrhs= BX.noCols();
+    if(n == 0 || nnz==0 || nrhs==0)
+      return 0;
+    
+    if(factor()<0)
+      return -1;
+
+    int *Ap= theSOE->Ap.data();
+    int *Ai= theSOE->Ai.data();
+    double *Ax = theSOE->Ax.data();
+    std::vector<double> x(n);
+    for(int j= 0;j<nrhs;j++)
+      {
+	double *bx= BX.getDataPtr()+j*n;
+	const int status= umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,x.data(),bx,Numeric,Control,Info);
+	if(status!=UMFPACK_OK)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING: solving right-hand side " << j
+		      << " returns " << static_cast<int>(status)
+		      << std::endl;
+	    this->setPyProp("info", boost::python::object(status));
+	    return -1;
+	  }
+	std::copy(x.begin(), x.end(), bx);
+      }
+    return 0;
+  }
+
 
 int XC::UmfpackGenLinSolver::setSize()
   {
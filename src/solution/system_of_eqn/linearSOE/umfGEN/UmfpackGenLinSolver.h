@@ -82,6 +82,7 @@ class UmfpackGenLinSolver: public LinearSOESolver
     double Control[UMFPACK_CONTROL], Info[UMFPACK_INFO];
     void free_symbolic(void);
     void free_numeric(void);
+    int factor(void);
 
   protected:    
     UmfpackGenLinSOE *theSOE;
@@ -89,6 +90,7 @@ class UmfpackGenLinSolver: public LinearSOESolver
     friend class FEM_ObjectBroker;
     friend class LinearSOE;
     UmfpackGenLinSolver(void);     
+    UmfpackGenLinSolver(int classTag);     
     virtual LinearSOESolver *getCopy(void) const;
     virtual bool setLinearSOE(LinearSOE *theSOE);
   public:
@@ -96,6 +98,8 @@ class UmfpackGenLinSolver: public LinearSOESolver
     ~UmfpackGenLinSolver(void);
 
     int solve(void);
+    bool supportsMultipleRHS(void) const;
+    int solveMultipleRHS(Matrix &);
     int setSize(void);
 
     bool setLinearSOE(UmfpackGenLinSOE &theSOE);
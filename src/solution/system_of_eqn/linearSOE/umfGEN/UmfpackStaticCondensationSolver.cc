@@ -0,0 +1,462 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//UmfpackStaticCondensationSolver.cc
+
+#include "solution/system_of_eqn/linearSOE/umfGEN/UmfpackStaticCondensationSolver.h"
+#include "solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSOE.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/FE_EleIter.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
+#include "domain/mesh/element/Element.h"
+#include "utility/matrix/ID.h"
+#include "utility/utils/misc_utils/colormod.h"
+
+extern "C" int dgesv_(int *N, int *NRHS, double *A, int *LDA, int *iPiv,
+		      double *B, int *LDB, int *INFO);
+
+//! @brief Constructor.
+XC::UmfpackStaticCondensationSolver::BlockEntry::BlockEntry(const int &p, const int &r, const int &c)
+  : pos(p), row(r), col(c) {}
+
+//! @brief Default constructor.
+XC::UmfpackStaticCondensationSolver::UmfpackStaticCondensationSolver(void)
+  : UmfpackGenLinSolver(SOLVER_TAGS_UmfpackStaticCondensationSolver),
+    symbolicKii(nullptr), numericKii(nullptr), condensed(false),
+    numCondensations(0)
+  { umfpack_di_defaults(controlKii); }
+
+//! @brief Copy constructor (the UMFPACK factorizations are not copied,
+//! setSize must be called before solving).
+XC::UmfpackStaticCondensationSolver::UmfpackStaticCondensationSolver(const UmfpackStaticCondensationSolver &other)
+  : UmfpackGenLinSolver(other),
+    internalEqs(other.internalEqs), interfaceEqs(other.interfaceEqs),
+    Kii_p(other.Kii_p), Kii_i(other.Kii_i), Kii_x(other.Kii_x),
+    Kii_pos(other.Kii_pos), Kib(other.Kib), Kib_p(other.Kib_p),
+    Kbi(other.Kbi), Kbb(other.Kbb),
+    linearPos(other.linearPos), symbolicKii(nullptr), numericKii(nullptr),
+    condensed(false), numCondensations(0)
+  { umfpack_di_defaults(controlKii); }
+
+//! @brief Assignment operator (the UMFPACK factorizations are not copied,
+//! setSize must be called before solving).
+XC::UmfpackStaticCondensationSolver &XC::UmfpackStaticCondensationSolver::operator=(const UmfpackStaticCondensationSolver &other)
+  {
+    if(this!=&other)
+      {
+        free_numeric_Kii();
+        free_symbolic_Kii();
+        UmfpackGenLinSolver::operator=(other);
+        internalEqs= other.internalEqs;
+        interfaceEqs= other.interfaceEqs;
+        Kii_p= other.Kii_p;
+        Kii_i= other.Kii_i;
+        Kii_x= other.Kii_x;
+        Kii_pos= other.Kii_pos;
+        Kib= other.Kib;
+        Kib_p= other.Kib_p;
+        Kbi= other.Kbi;
+        Kbb= other.Kbb;
+        linearPos= other.linearPos;
+        linearValues.clear();
+        C.clear();
+        condensed= false;
+        numCondensations= 0;
+      }
+    return *this;
+  }
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::UmfpackStaticCondensationSolver::getCopy(void) const
+   { return new UmfpackStaticCondensationSolver(*this); }
+
+//! @brief Destructor.
+XC::UmfpackStaticCondensationSolver::~UmfpackStaticCondensationSolver(void)
+  {
+    free_numeric_Kii();
+    free_symbolic_Kii();
+  }
+
+//! @brief Free the symbolic factorization of K_ii.
+void XC::UmfpackStaticCondensationSolver::free_symbolic_Kii(void)
+  {
+    if(symbolicKii)
+      {
+        umfpack_di_free_symbolic(&symbolicKii);
+        symbolicKii= nullptr;
+      }
+  }
+
+//! @brief Free the numeric factorization of K_ii.
+void XC::UmfpackStaticCondensationSolver::free_numeric_Kii(void)
+  {
+    if(numericKii)
+      {
+        umfpack_di_free_numeric(&numericKii);
+        numericKii= nullptr;
+      }
+    condensed= false;
+  }
+
+//! @brief Return the number of interface (condensed) equations.
+int XC::UmfpackStaticCondensationSolver::getNumInterfaceEquations(void) const
+  { return interfaceEqs.size(); }
+
+//! @brief Return the number of internal (eliminated) equations.
+int XC::UmfpackStaticCondensationSolver::getNumInternalEquations(void) const
+  { return internalEqs.size(); }
+
+//! @brief Return the number of condensations computed since the last
+//! call to setSize.
+int XC::UmfpackStaticCondensationSolver::getNumCondensations(void) const
+  { return numCondensations; }
+
+//! @brief Split the equations in interface and internal ones. The
+//! interface equations are the ones of the elements whose tangent
+//! is not constant and the ones of the FE_Elements that don't
+//! correspond to a domain element (multi-freedom constraints).
+//!
+//! @param n: number of equations.
+void XC::UmfpackStaticCondensationSolver::classify_equations(const int &n)
+  {
+    std::vector<bool> interface(n,false);
+    AnalysisModel *mdl= theSOE->getAnalysisModelPtr();
+    if(mdl)
+      {
+        FE_Element *fePtr= nullptr;
+        FE_EleIter &theEles= mdl->getFEs();
+        while((fePtr= theEles()) != nullptr)
+          {
+            Element *elem= fePtr->getElement();
+            if(!elem || elem->isSubdomain() || !elem->hasConstantTangent())
+              {
+                const ID &id= fePtr->getID();
+                const int sz= id.Size();
+                for(int k= 0;k<sz;k++)
+                  {
+                    const int eq= id(k);
+                    if(eq>=0 && eq<n)
+                      interface[eq]= true;
+                  }
+              }
+          }
+      }
+    else
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; WARNING: analysis model not found;"
+                << " all the equations are considered internal."
+                << Color::def << std::endl;
+    internalEqs.clear();
+    interfaceEqs.clear();
+    for(int i= 0;i<n;i++)
+      {
+        if(interface[i])
+          interfaceEqs.push_back(i);
+        else
+          internalEqs.push_back(i);
+      }
+  }
+
+//! @brief Extract the blocks of the system matrix and compute the
+//! symbolic factorization of K_ii.
+int XC::UmfpackStaticCondensationSolver::setup_blocks(void)
+  {
+    const int n= theSOE->X.Size();
+    const int ni= internalEqs.size();
+    // Local index of each equation in its block.
+    std::vector<int> local(n,-1);
+    std::vector<bool> internal(n,false);
+    for(int k= 0;k<ni;k++)
+      {
+        local[internalEqs[k]]= k;
+        internal[internalEqs[k]]= true;
+      }
+    const int nb= interfaceEqs.size();
+    for(int k= 0;k<nb;k++)
+      local[interfaceEqs[k]]= k;
+
+    const std::vector<int> &Ap= theSOE->Ap;
+    const std::vector<int> &Ai= theSOE->Ai;
+    Kii_p.clear(); Kii_i.clear(); Kii_pos.clear();
+    Kib.clear(); Kbi.clear(); Kbb.clear();
+    linearPos.clear();
+    Kii_p.reserve(ni+1);
+    for(int j= 0;j<n;j++)
+      {
+        const int lj= local[j];
+        if(internal[j])
+          Kii_p.push_back(Kii_i.size());
+        for(int k= Ap[j];k<Ap[j+1];k++)
+          {
+            const int i= Ai[k];
+            const int li= local[i];
+            if(internal[i] && internal[j])
+              {
+                Kii_i.push_back(li);
+                Kii_pos.push_back(k);
+              }
+            else if(internal[i])
+              Kib.push_back(BlockEntry(k,li,lj));
+            else if(internal[j])
+              Kbi.push_back(BlockEntry(k,li,lj));
+            else
+              {
+                Kbb.push_back(BlockEntry(k,li,lj));
+                continue;
+              }
+            linearPos.push_back(k);
+          }
+      }
+    Kii_p.push_back(Kii_i.size());
+    Kii_x.assign(Kii_i.size(),0.0);
+    // Start of each column of K_ib (its coefficients are sorted by column).
+    Kib_p.assign(nb+1,0);
+    for(std::vector<BlockEntry>::const_iterator i= Kib.begin();i!=Kib.end();i++)
+      Kib_p[i->col+1]++;
+    for(int c= 0;c<nb;c++)
+      Kib_p[c+1]+= Kib_p[c];
+
+    int retval= 0;
+    if(ni>0)
+      {
+        umfpack_di_defaults(controlKii);
+        controlKii[UMFPACK_PIVOT_TOLERANCE]= 1.0;
+        controlKii[UMFPACK_STRATEGY]= UMFPACK_STRATEGY_SYMMETRIC;
+        for(size_t k= 0;k<Kii_pos.size();k++)
+          Kii_x[k]= theSOE->Ax[Kii_pos[k]];
+        const int status= umfpack_di_symbolic(ni,ni,Kii_p.data(),Kii_i.data(),Kii_x.data(),&symbolicKii,controlKii,infoKii);
+        if(status!=UMFPACK_OK)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING: symbolic analysis of the internal block"
+                      << " returns " << status
+                      << Color::def << std::endl;
+            symbolicKii= nullptr;
+            retval= -1;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Return true if any of the coefficients outside the K_bb block
+//! has changed since the last condensation.
+bool XC::UmfpackStaticCondensationSolver::linear_part_changed(void) const
+  {
+    const std::vector<double> &Ax= theSOE->Ax;
+    const size_t sz= linearPos.size();
+    if(linearValues.size()!=sz)
+      return true;
+    for(size_t k= 0;k<sz;k++)
+      if(Ax[linearPos[k]]!=linearValues[k])
+        return true;
+    return false;
+  }
+
+//! @brief Solve K_ii x= b using the stored factorization.
+int XC::UmfpackStaticCondensationSolver::solve_internal(double *x, double *b)
+  {
+    const int status= umfpack_di_solve(UMFPACK_A,Kii_p.data(),Kii_i.data(),Kii_x.data(),x,b,numericKii,controlKii,infoKii);
+    if(status!=UMFPACK_OK)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: solving returns " << status
+                  << Color::def << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Factorize K_ii and compute C= K_bi K_ii^{-1} K_ib.
+//!
+//! The product is computed one column at a time: each column of K_ib
+//! is scattered in a work vector, solved with the factorization of K_ii
+//! and multiplied by K_bi, so only vectors of size ni are needed.
+int XC::UmfpackStaticCondensationSolver::condense(void)
+  {
+    const int ni= internalEqs.size();
+    const int nb= interfaceEqs.size();
+    const std::vector<double> &Ax= theSOE->Ax;
+    free_numeric_Kii();
+    C.assign(nb*nb,0.0);
+    if(ni>0)
+      {
+        if(!symbolicKii)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING: setSize has not been called."
+                      << Color::def << std::endl;
+            return -1;
+          }
+        for(size_t k= 0;k<Kii_pos.size();k++)
+          Kii_x[k]= Ax[Kii_pos[k]];
+        const int status= umfpack_di_numeric(Kii_p.data(),Kii_i.data(),Kii_x.data(),symbolicKii,&numericKii,controlKii,infoKii);
+        if(status!=UMFPACK_OK)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING: numeric factorization of the internal"
+                      << " block returns " << status
+                      << Color::def << std::endl;
+            free_numeric_Kii();
+            return -1;
+          }
+        if(nb>0)
+          {
+            std::vector<double> kc(ni,0.0); // column of K_ib.
+            std::vector<double> yc(ni,0.0); // K_ii^{-1} times that column.
+            for(int c= 0;c<nb;c++)
+              {
+                const int first= Kib_p[c];
+                const int last= Kib_p[c+1];
+                if(first==last) // empty column: C(:,c)= 0.
+                  continue;
+                for(int k= first;k<last;k++)
+                  kc[Kib[k].row]= Ax[Kib[k].pos];
+                if(solve_internal(yc.data(),kc.data())!=0)
+                  return -1;
+                for(int k= first;k<last;k++)
+                  kc[Kib[k].row]= 0.0;
+                // C(:,c)= K_bi yc
+                double *Cc= &C[c*nb];
+                for(std::vector<BlockEntry>::const_iterator i= Kbi.begin();i!=Kbi.end();i++)
+                  Cc[i->row]+= Ax[i->pos]*yc[i->col];
+              }
+          }
+      }
+    linearValues.resize(linearPos.size());
+    for(size_t k= 0;k<linearPos.size();k++)
+      linearValues[k]= Ax[linearPos[k]];
+    condensed= true;
+    numCondensations++;
+    return 0;
+  }
+
+//! @brief Return false: the right-hand sides go through the
+//! condensed system one by one (see LinearSOE::solveMultipleRHS).
+bool XC::UmfpackStaticCondensationSolver::supportsMultipleRHS(void) const
+  { return false; }
+
+//! @brief Solve the system of equations condensing the internal
+//! unknowns on the interface ones.
+int XC::UmfpackStaticCondensationSolver::solve(void)
+  {
+    const int n= theSOE->X.Size();
+    const int nnz= static_cast<int>(theSOE->Ai.size());
+    if(n == 0 || nnz==0)
+      return 0;
+    if(static_cast<int>(internalEqs.size()+interfaceEqs.size())!=n)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: setSize has not been called."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    if(!condensed || linear_part_changed())
+      {
+        if(condense()!=0)
+          return -1;
+      }
+    theSOE->factored= true;
+
+    const int ni= internalEqs.size();
+    int nb= interfaceEqs.size();
+    const std::vector<double> &Ax= theSOE->Ax;
+    const Vector &B= theSOE->B;
+    Vector &X= theSOE->X;
+
+    // z= K_ii^{-1} b_i
+    std::vector<double> z(ni,0.0);
+    std::vector<double> bi(ni);
+    if(ni>0)
+      {
+        for(int k= 0;k<ni;k++)
+          bi[k]= B(internalEqs[k]);
+        if(solve_internal(z.data(),bi.data())!=0)
+          return -1;
+      }
+    std::vector<double> xb(nb,0.0);
+    if(nb>0)
+      {
+        // S= K_bb - K_bi K_ii^{-1} K_ib
+        std::vector<double> S(nb*nb);
+        for(int k= 0;k<nb*nb;k++)
+          S[k]= -C[k];
+        for(std::vector<BlockEntry>::const_iterator i= Kbb.begin();i!=Kbb.end();i++)
+          S[i->row+i->col*nb]+= Ax[i->pos];
+        // g= b_b - K_bi z
+        for(int k= 0;k<nb;k++)
+          xb[k]= B(interfaceEqs[k]);
+        for(std::vector<BlockEntry>::const_iterator i= Kbi.begin();i!=Kbi.end();i++)
+          xb[i->row]-= Ax[i->pos]*z[i->col];
+        int nrhs= 1;
+        int ldA= nb;
+        int ldB= nb;
+        int info= 0;
+        std::vector<int> iPiv(nb);
+        dgesv_(&nb,&nrhs,S.data(),&ldA,iPiv.data(),xb.data(),&ldB,&info);
+        if(info!=0)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING: LAPACK dgesv returns " << info
+                      << " when solving the condensed system."
+                      << Color::def << std::endl;
+            return -1;
+          }
+      }
+    // x_i= K_ii^{-1} (b_i - K_ib x_b)
+    if((ni>0) && (nb>0))
+      {
+        for(std::vector<BlockEntry>::const_iterator i= Kib.begin();i!=Kib.end();i++)
+          bi[i->row]-= Ax[i->pos]*xb[i->col];
+        if(solve_internal(z.data(),bi.data())!=0)
+          return -1;
+      }
+    for(int k= 0;k<ni;k++)
+      X(internalEqs[k])= z[k];
+    for(int k= 0;k<nb;k++)
+      X(interfaceEqs[k])= xb[k];
+    return 0;
+  }
+
+//! @brief Classify the equations, extract the blocks and compute the
+//! symbolic factorization of the internal block.
+int XC::UmfpackStaticCondensationSolver::setSize(void)
+  {
+    free_numeric_Kii();
+    free_symbolic_Kii();
+    numCondensations= 0;
+    linearValues.clear();
+    C.clear();
+    const int n= theSOE->X.Size();
+    const int nnz= static_cast<int>(theSOE->Ai.size());
+    if(n == 0 || nnz==0)
+      {
+        internalEqs.clear();
+        interfaceEqs.clear();
+        return 0;
+      }
+    classify_equations(n);
+    return setup_blocks();
+  }
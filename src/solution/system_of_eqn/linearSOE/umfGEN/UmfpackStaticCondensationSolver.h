@@ -0,0 +1,120 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//UmfpackStaticCondensationSolver.h
+
+#ifndef UmfpackStaticCondensationSolver_h
+#define UmfpackStaticCondensationSolver_h
+
+#include "solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Solver for models with a few nonlinear elements (isolators,
+//! gaps, contact springs...) on a large linear structure. It condenses
+//! the linear substructure on the DOFs of the nonlinear elements.
+//!
+//! The equations are split in interface equations (the ones touched
+//! by the elements whose tangent depends on their state, see
+//! Element::hasConstantTangent, or by the multi-freedom constraints)
+//! and internal equations. With the system matrix written as:
+//! \f[ \begin{bmatrix} K_{ii} & K_{ib} \\ K_{bi} & K_{bb} \end{bmatrix} \f]
+//! the \f$K_{ii}\f$ block is factorized once with UMFPACK, and the
+//! product \f$K_{bi} K_{ii}^{-1} K_{ib}\f$ is computed once too, one
+//! column at a time (only this small dense product is stored). Each
+//! solution then condenses the right hand side with the stored
+//! factorization. It factorizes only the small dense interface system
+//! \f[ (K_{bb} - K_{bi} K_{ii}^{-1} K_{ib})\, x_b = b_b - K_{bi} K_{ii}^{-1} b_i \f]
+//! and recovers the internal unknowns with one more solution with
+//! \f$K_{ii}\f$: \f$x_i= K_{ii}^{-1} (b_i - K_{ib}\, x_b)\f$.
+//!
+//! The condensation is repeated only when the coefficients outside
+//! the \f$K_{bb}\f$ block change (i.e. when the time step changes in a
+//! transient analysis or a material of the linear part is modified).
+class UmfpackStaticCondensationSolver: public UmfpackGenLinSolver
+  {
+  private:
+    //! @brief Coefficient of one of the blocks of the system matrix.
+    struct BlockEntry
+      {
+        int pos; //!< position of the coefficient in the system of equations.
+        int row; //!< row in the block.
+        int col; //!< column in the block.
+        BlockEntry(const int &, const int &, const int &);
+      };
+    std::vector<int> internalEqs; //!< equation number of each internal unknown.
+    std::vector<int> interfaceEqs; //!< equation number of each interface unknown.
+    std::vector<int> Kii_p; //!< column starts of K_ii (compressed column format).
+    std::vector<int> Kii_i; //!< row indexes of K_ii.
+    std::vector<double> Kii_x; //!< values of K_ii.
+    std::vector<int> Kii_pos; //!< position in the system of equations of each value of K_ii.
+    std::vector<BlockEntry> Kib; //!< coefficients of K_ib (sorted by column).
+    std::vector<int> Kib_p; //!< start of each column of K_ib in Kib.
+    std::vector<BlockEntry> Kbi; //!< coefficients of K_bi.
+    std::vector<BlockEntry> Kbb; //!< coefficients of K_bb.
+    std::vector<int> linearPos; //!< positions of the coefficients that don't belong to K_bb.
+    std::vector<double> linearValues; //!< values of those coefficients in the last condensation.
+    std::vector<double> C; //!< K_bi K_ii^{-1} K_ib (column major).
+    void *symbolicKii; //!< UMFPACK symbolic factorization of K_ii.
+    void *numericKii; //!< UMFPACK numeric factorization of K_ii.
+    double controlKii[UMFPACK_CONTROL]; //!< UMFPACK control parameters.
+    double infoKii[UMFPACK_INFO]; //!< UMFPACK information.
+    bool condensed; //!< true if C corresponds to the current coefficients.
+    int numCondensations; //!< number of condensations computed.
+
+    void free_symbolic_Kii(void);
+    void free_numeric_Kii(void);
+    void classify_equations(const int &);
+    int setup_blocks(void);
+    bool linear_part_changed(void) const;
+    int solve_internal(double *, double *);
+    int condense(void);
+  protected:
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    UmfpackStaticCondensationSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    UmfpackStaticCondensationSolver(const UmfpackStaticCondensationSolver &);
+    UmfpackStaticCondensationSolver &operator=(const UmfpackStaticCondensationSolver &);
+    ~UmfpackStaticCondensationSolver(void);
+
+    int getNumInterfaceEquations(void) const;
+    int getNumInternalEquations(void) const;
+    int getNumCondensations(void) const;
+
+    int solve(void);
+    bool supportsMultipleRHS(void) const;
+    int setSize(void);
+  };
+
+} // end of XC namespace
+
+#endif
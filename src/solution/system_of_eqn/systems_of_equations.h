@@ -115,6 +115,8 @@
 
 #include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h>
+
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovSolver.h"
 #ifdef _PARALLEL_PROCESSING
 #include "solution/system_of_eqn/linearSOE/bandSPD/DistributedBandSPDLinSOE.h"
 #include "solution/system_of_eqn/linearSOE/profileSPD/DistributedProfileSPDLinSOE.h"
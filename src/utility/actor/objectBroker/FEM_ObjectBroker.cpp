@@ -1110,6 +1110,9 @@ XC::DataOutputHandler *XC::FEM_ObjectBroker::getPtrNewDataOutputHandler(int clas
         case DATAHANDLER_TAGS_DataOutputDatabaseHandler:
              return new DataOutputDatabaseHandler();
 
+        case DATAHANDLER_TAGS_DataOutputBinaryFileHandler:
+             return new DataOutputBinaryFileHandler();
+
         default:
              std::cerr << Color::red << "FEM_ObjectBroker::" << __FUNCTION__
 		       << "; no XC::DataOutputHandler type exists for class tag "
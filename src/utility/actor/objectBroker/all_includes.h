@@ -124,6 +124,7 @@
 #include "material/section/fiber_section/FiberSection3d.h"
 #include "material/section/fiber_section/FiberSectionGJ.h"
 #include "material/section/fiber_section/FiberSectionShear3d.h"
+#include "material/section/fiber_section/FiberSectionBatchSolver.h"
 #include "material/section/plate_section/ElasticPlateSection.h"
 #include "material/section/plate_section/ElasticMembranePlateSection.h"
 #include "material/section/plate_section/MembranePlateFiberSection.h"
@@ -140,6 +141,7 @@
 #include "material/nD/elastic_isotropic/ElasticIsotropicPlaneStress2D.h"
 #include "material/nD/elastic_isotropic/ElasticIsotropicPlateFiber.h"
 #include "material/nD/elastic_isotropic/ElasticIsotropicAxiSymm.h"
+#include "material/nD/ElasticCrossAnisotropic.h"
 #include "material/nD/elastic_isotropic/ElasticIsotropic3D.h"
 
 #include "material/nD/nd_adaptor/PlaneStressMaterial.h"
@@ -360,6 +362,9 @@
 #include "utility/handler/DataOutputStreamHandler.h"
 #include "utility/handler/DataOutputFileHandler.h"
 #include "utility/handler/DataOutputDatabaseHandler.h"
+#include "utility/handler/DataOutputBinaryFileHandler.h"
+#include "domain/mesh/VtuExporter.h"
+#include "domain/mesh/SpatialIndex.h"
 
 #include "utility/recorder/NodeRecorder.h"
 #include "utility/recorder/ElementRecorder.h"
@@ -558,6 +563,8 @@
 #include "utility/xc_python_utils.h"
 #include "utility/database/SQLiteDatastore.h"
 #include "utility/database/PyDictDatastore.h"
+#include "utility/database/MemoryDatastore.h"
+#include "utility/database/InternalForcesStore.h"
 #include "utility/database/OracleDatastore.h"
 #include "utility/database/BerkeleyDbDatastore.h"
 #include "utility/database/NEESData.h"
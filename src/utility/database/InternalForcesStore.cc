@@ -0,0 +1,627 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//InternalForcesStore.cc
+
+#include "InternalForcesStore.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include "utility/utils/misc_utils/colormod.h"
+#include <limits>
+#include <cstring>
+#include <cmath>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+const std::string XC::InternalForcesStore::magic= "XCIFSTOR";
+const uint32_t XC::InternalForcesStore::version= 1;
+
+//! @brief Return the number of bytes needed to pad the given size to a
+//! multiple of 8.
+static size_t padding(const size_t &sz)
+  { return (8-sz%8)%8; }
+
+//! @brief Write a string preceded by its length and padded to a multiple
+//! of 8 bytes.
+static void write_string(std::ofstream &os, const std::string &str)
+  {
+    const uint64_t length= str.size();
+    os.write(reinterpret_cast<const char *>(&length), sizeof(length));
+    os.write(str.data(), length);
+    static const char zeros[8]= {0,0,0,0,0,0,0,0};
+    os.write(zeros, padding(length));
+  }
+
+//! @brief Default constructor.
+XC::InternalForcesStore::InternalForcesStore(void)
+  : CommandEntity(), inCombination(false), fileDescriptor(-1),
+    mappedData(nullptr), mappedSize(0), elementIndexBuilt(false)
+  {}
+
+//! @brief Destructor.
+XC::InternalForcesStore::~InternalForcesStore(void)
+  { close(); }
+
+//! @brief Write the file header.
+void XC::InternalForcesStore::write_header(void)
+  {
+    outputFile.write(magic.data(), magic.size());
+    const uint32_t numValues= valueNames.size();
+    outputFile.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    outputFile.write(reinterpret_cast<const char *>(&numValues), sizeof(numValues));
+    for(name_container::const_iterator i= valueNames.begin(); i!= valueNames.end(); i++)
+      write_string(outputFile, *i);
+  }
+
+//! @brief Create a new store in the given file.
+//!
+//! @param fName: name of the file (overwritten if it already exists).
+//! @param names: names of the value columns (i.e. N, Vy, Vz, T, My, Mz,...).
+bool XC::InternalForcesStore::create(const std::string &fName, const name_container &names)
+  {
+    close();
+    if(names.empty())
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; no value columns specified."
+		  << Color::def << std::endl;
+	return false;
+      }
+    fileName= fName;
+    valueNames= names;
+    outputFile.open(fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!outputFile)
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; can't open file: '" << fileName << "'."
+		  << Color::def << std::endl;
+	return false;
+      }
+    write_header();
+    return outputFile.good();
+  }
+
+//! @brief Create a new store in the given file (Python interface).
+bool XC::InternalForcesStore::createPy(const std::string &fName, const boost::python::list &names)
+  {
+    name_container tmp;
+    const size_t sz= len(names);
+    for(size_t i= 0;i<sz;i++)
+      tmp.push_back(boost::python::extract<std::string>(names[i]));
+    return create(fName, tmp);
+  }
+
+//! @brief Start the block corresponding to the given load combination.
+bool XC::InternalForcesStore::beginCombination(const std::string &combName)
+  {
+    if(!outputFile.is_open())
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; store not open for writing."
+		  << Color::def << std::endl;
+	return false;
+      }
+    if(inCombination)
+      endCombination();
+    currentCombination= combName;
+    inCombination= true;
+    rowTags.clear();
+    rowSections.clear();
+    rowValues.assign(valueNames.size(), std::vector<double>());
+    return true;
+  }
+
+//! @brief Append a row to the current combination block.
+//!
+//! @param elemTag: element identifier.
+//! @param section: index of the section in the element.
+//! @param values: values of the columns; if the vector is shorter than
+//!                the number of columns the remaining values are
+//!                stored as NaN.
+void XC::InternalForcesStore::addRow(const int &elemTag, const int &section, const Vector &values)
+  {
+    if(!inCombination)
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; no combination block started; row ignored."
+		  << Color::def << std::endl;
+	return;
+      }
+    const size_t numValues= valueNames.size();
+    const size_t sz= values.Size();
+    if(sz>numValues)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; row has " << sz << " values, but the store has "
+		<< numValues << " columns. Remaining values ignored."
+		<< Color::def << std::endl;
+    rowTags.push_back(elemTag);
+    rowSections.push_back(section);
+    for(size_t j= 0;j<numValues;j++)
+      rowValues[j].push_back((j<sz) ? values(j) : std::numeric_limits<double>::quiet_NaN());
+  }
+
+//! @brief Write the current combination block to the file.
+bool XC::InternalForcesStore::endCombination(void)
+  {
+    if(!inCombination)
+      return false;
+    const uint64_t numRows= rowTags.size();
+    outputFile.write(reinterpret_cast<const char *>(&numRows), sizeof(numRows));
+    write_string(outputFile, currentCombination);
+    outputFile.write(reinterpret_cast<const char *>(rowTags.data()), numRows*sizeof(int64_t));
+    outputFile.write(reinterpret_cast<const char *>(rowSections.data()), numRows*sizeof(int64_t));
+    for(size_t j= 0;j<rowValues.size();j++)
+      outputFile.write(reinterpret_cast<const char *>(rowValues[j].data()), numRows*sizeof(double));
+    outputFile.flush();
+    inCombination= false;
+    rowTags.clear();
+    rowSections.clear();
+    rowValues.clear();
+    const bool retval= outputFile.good();
+    if(!retval)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; error writing combination: '" << currentCombination
+		<< "' to file: '" << fileName << "'."
+		<< Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Release the memory mapping.
+void XC::InternalForcesStore::unmap(void)
+  {
+    if(mappedData)
+      {
+        munmap(const_cast<char *>(mappedData), mappedSize);
+        mappedData= nullptr;
+      }
+    if(fileDescriptor>=0)
+      {
+        ::close(fileDescriptor);
+        fileDescriptor= -1;
+      }
+    mappedSize= 0;
+    blocks.clear();
+    combinationIndex.clear();
+    elementIndex.clear();
+    elementIndexBuilt= false;
+  }
+
+//! @brief Finish writing (if needed) and close the file.
+void XC::InternalForcesStore::close(void)
+  {
+    if(outputFile.is_open())
+      {
+        if(inCombination)
+	  endCombination();
+        outputFile.close();
+      }
+    unmap();
+  }
+
+//! @brief Read the file header; return the offset of the first block
+//! or zero on error.
+size_t XC::InternalForcesStore::read_header(void)
+  {
+    const size_t fixedSize= magic.size()+2*sizeof(uint32_t);
+    if((mappedSize<fixedSize) || (std::memcmp(mappedData, magic.data(), magic.size())!=0))
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; file: '" << fileName
+		  << "' is not an internal forces store."
+		  << Color::def << std::endl;
+	return 0;
+      }
+    uint32_t fileVersion= 0, numValues= 0;
+    std::memcpy(&fileVersion, mappedData+magic.size(), sizeof(uint32_t));
+    std::memcpy(&numValues, mappedData+magic.size()+sizeof(uint32_t), sizeof(uint32_t));
+    if(fileVersion!=version)
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; unknown format version: " << fileVersion
+		  << Color::def << std::endl;
+	return 0;
+      }
+    valueNames.clear();
+    size_t offset= fixedSize;
+    for(uint32_t i= 0;i<numValues;i++)
+      {
+        uint64_t length= 0;
+	if(offset+sizeof(length)>mappedSize)
+	  return 0;
+        std::memcpy(&length, mappedData+offset, sizeof(length));
+	offset+= sizeof(length);
+	if(offset+length>mappedSize)
+	  return 0;
+	valueNames.push_back(std::string(mappedData+offset, length));
+	offset+= length+padding(length);
+      }
+    return offset;
+  }
+
+//! @brief Build the combination index from the blocks in the file.
+//!
+//! A truncated block at the end of the file (i.e. the analysis was
+//! interrupted while writing it) is ignored.
+bool XC::InternalForcesStore::scan_blocks(size_t offset)
+  {
+    const size_t numValues= valueNames.size();
+    while(offset+2*sizeof(uint64_t)<=mappedSize)
+      {
+        uint64_t numRows= 0, length= 0;
+        std::memcpy(&numRows, mappedData+offset, sizeof(numRows));
+        std::memcpy(&length, mappedData+offset+sizeof(numRows), sizeof(length));
+	const size_t nameOffset= offset+2*sizeof(uint64_t);
+	const size_t dataOffset= nameOffset+length+padding(length);
+	const size_t blockEnd= dataOffset+numRows*(2*sizeof(int64_t)+numValues*sizeof(double));
+	if((dataOffset>mappedSize) || (blockEnd>mappedSize))
+	  {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; truncated block at offset: " << offset
+		      << " ignored."
+		      << Color::def << std::endl;
+	    break;
+	  }
+	BlockInfo info;
+	info.name= std::string(mappedData+nameOffset, length);
+	info.numRows= numRows;
+	info.dataOffset= dataOffset;
+	if(combinationIndex.find(info.name)!=combinationIndex.end())
+	  std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		    << "; combination: '" << info.name
+		    << "' appears more than once; the last block is used."
+		    << Color::def << std::endl;
+	combinationIndex[info.name]= blocks.size();
+	blocks.push_back(info);
+	offset= blockEnd;
+      }
+    return true;
+  }
+
+//! @brief Open an existing store for reading (memory mapped).
+bool XC::InternalForcesStore::open(const std::string &fName)
+  {
+    close();
+    fileName= fName;
+    fileDescriptor= ::open(fileName.c_str(), O_RDONLY);
+    if(fileDescriptor<0)
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; can't open file: '" << fileName << "'."
+		  << Color::def << std::endl;
+	return false;
+      }
+    struct stat st;
+    if((fstat(fileDescriptor, &st)!=0) || (st.st_size==0))
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; file: '" << fileName << "' is empty."
+		  << Color::def << std::endl;
+	unmap();
+	return false;
+      }
+    mappedSize= st.st_size;
+    void *ptr= mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    if(ptr==MAP_FAILED)
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; can't map file: '" << fileName << "' in memory."
+		  << Color::def << std::endl;
+	mappedSize= 0;
+	unmap();
+	return false;
+      }
+    mappedData= static_cast<const char *>(ptr);
+    const size_t firstBlock= read_header();
+    if(firstBlock==0)
+      {
+	unmap();
+	return false;
+      }
+    return scan_blocks(firstBlock);
+  }
+
+//! @brief Return true if the store is open for reading.
+bool XC::InternalForcesStore::isOpen(void) const
+  { return (mappedData!=nullptr); }
+
+//! @brief Return the element tags column of the block.
+const int64_t *XC::InternalForcesStore::get_tags(const BlockInfo &b) const
+  { return reinterpret_cast<const int64_t *>(mappedData+b.dataOffset); }
+
+//! @brief Return the section indexes column of the block.
+const int64_t *XC::InternalForcesStore::get_sections(const BlockInfo &b) const
+  { return get_tags(b)+b.numRows; }
+
+//! @brief Return the j-th value column of the block.
+const double *XC::InternalForcesStore::get_values(const BlockInfo &b, const size_t &j) const
+  {
+    const char *ptr= mappedData+b.dataOffset+2*b.numRows*sizeof(int64_t);
+    return reinterpret_cast<const double *>(ptr)+j*b.numRows;
+  }
+
+//! @brief Build the element index (element tag -> (block, row) pairs).
+void XC::InternalForcesStore::build_element_index(void) const
+  {
+    if(elementIndexBuilt)
+      return;
+    elementIndex.clear();
+    for(size_t iBlock= 0;iBlock<blocks.size();iBlock++)
+      {
+        const BlockInfo &b= blocks[iBlock];
+	if(combinationIndex.find(b.name)->second!=iBlock)
+	  continue; // overwritten by a later block.
+        const int64_t *tags= get_tags(b);
+        for(size_t iRow= 0;iRow<b.numRows;iRow++)
+	  elementIndex[tags[iRow]].push_back(row_location(iBlock, iRow));
+      }
+    elementIndexBuilt= true;
+  }
+
+//! @brief Return the names of the value columns.
+boost::python::list XC::InternalForcesStore::getValueNamesPy(void) const
+  {
+    boost::python::list retval;
+    for(name_container::const_iterator i= valueNames.begin(); i!= valueNames.end(); i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Return the index of the value column with the given name
+//! (-1 if not found).
+int XC::InternalForcesStore::getValueIndex(const std::string &name) const
+  {
+    int retval= -1;
+    for(size_t j= 0;j<valueNames.size();j++)
+      if(valueNames[j]==name)
+        {
+	  retval= j;
+	  break;
+	}
+    return retval;
+  }
+
+//! @brief Return the number of combinations in the store.
+size_t XC::InternalForcesStore::getNumCombinations(void) const
+  { return combinationIndex.size(); }
+
+//! @brief Return the names of the combinations in the order they were
+//! written.
+boost::python::list XC::InternalForcesStore::getCombinationNamesPy(void) const
+  {
+    boost::python::list retval;
+    for(size_t i= 0;i<blocks.size();i++)
+      {
+        std::map<std::string, size_t>::const_iterator j= combinationIndex.find(blocks[i].name);
+	if(j->second==i) // not overwritten by a later block.
+	  retval.append(blocks[i].name);
+      }
+    return retval;
+  }
+
+//! @brief Return true if the store contains results for the given
+//! combination.
+bool XC::InternalForcesStore::hasCombination(const std::string &combName) const
+  { return (combinationIndex.find(combName)!=combinationIndex.end()); }
+
+//! @brief Return the number of rows of the given combination.
+size_t XC::InternalForcesStore::getNumRows(const std::string &combName) const
+  {
+    size_t retval= 0;
+    std::map<std::string, size_t>::const_iterator i= combinationIndex.find(combName);
+    if(i!=combinationIndex.end())
+      retval= blocks[i->second].numRows;
+    return retval;
+  }
+
+//! @brief Return the total number of rows in the store.
+size_t XC::InternalForcesStore::getTotalNumRows(void) const
+  {
+    size_t retval= 0;
+    for(std::map<std::string, size_t>::const_iterator i= combinationIndex.begin(); i!= combinationIndex.end(); i++)
+      retval+= blocks[i->second].numRows;
+    return retval;
+  }
+
+//! @brief Return the offset (in bytes from the beginning of the file)
+//! of the data of the given combination. The element tags column starts
+//! at this offset, followed by the section indexes and the value columns
+//! (useful to create NumPy views of the file).
+size_t XC::InternalForcesStore::getDataOffset(const std::string &combName) const
+  {
+    size_t retval= 0;
+    std::map<std::string, size_t>::const_iterator i= combinationIndex.find(combName);
+    if(i!=combinationIndex.end())
+      retval= blocks[i->second].dataOffset;
+    else
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; combination: '" << combName << "' not found."
+		<< Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Return the tags of the elements in the store (sorted).
+XC::ID XC::InternalForcesStore::getElementTags(void) const
+  {
+    build_element_index();
+    ID retval(elementIndex.size());
+    size_t k= 0;
+    for(std::map<int, std::vector<row_location> >::const_iterator i= elementIndex.begin(); i!= elementIndex.end(); i++, k++)
+      retval[k]= i->first;
+    return retval;
+  }
+
+//! @brief Return the element tags column of the given combination.
+XC::ID XC::InternalForcesStore::getCombinationElementTags(const std::string &combName) const
+  {
+    ID retval;
+    std::map<std::string, size_t>::const_iterator i= combinationIndex.find(combName);
+    if(i!=combinationIndex.end())
+      {
+        const BlockInfo &b= blocks[i->second];
+        const int64_t *tags= get_tags(b);
+	retval.resize(b.numRows);
+	for(size_t k= 0;k<b.numRows;k++)
+	  retval[k]= tags[k];
+      }
+    return retval;
+  }
+
+//! @brief Return the section indexes column of the given combination.
+XC::ID XC::InternalForcesStore::getCombinationSections(const std::string &combName) const
+  {
+    ID retval;
+    std::map<std::string, size_t>::const_iterator i= combinationIndex.find(combName);
+    if(i!=combinationIndex.end())
+      {
+        const BlockInfo &b= blocks[i->second];
+        const int64_t *sections= get_sections(b);
+	retval.resize(b.numRows);
+	for(size_t k= 0;k<b.numRows;k++)
+	  retval[k]= sections[k];
+      }
+    return retval;
+  }
+
+//! @brief Return the values of the given combination (one row for each
+//! element section, one column for each value).
+XC::Matrix XC::InternalForcesStore::getCombinationValues(const std::string &combName) const
+  {
+    Matrix retval;
+    std::map<std::string, size_t>::const_iterator i= combinationIndex.find(combName);
+    if(i!=combinationIndex.end())
+      {
+        const BlockInfo &b= blocks[i->second];
+	const size_t numValues= valueNames.size();
+	retval.resize(b.numRows, numValues);
+	for(size_t j= 0;j<numValues;j++)
+	  {
+	    const double *column= get_values(b, j);
+	    for(size_t k= 0;k<b.numRows;k++)
+	      retval(k,j)= column[k];
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Return the values of the given column for the given combination.
+XC::Vector XC::InternalForcesStore::getCombinationColumn(const std::string &combName, const std::string &columnName) const
+  {
+    Vector retval;
+    std::map<std::string, size_t>::const_iterator i= combinationIndex.find(combName);
+    const int j= getValueIndex(columnName);
+    if((i!=combinationIndex.end()) && (j>=0))
+      {
+        const BlockInfo &b= blocks[i->second];
+	const double *column= get_values(b, j);
+	retval.resize(b.numRows);
+	for(size_t k= 0;k<b.numRows;k++)
+	  retval(k)= column[k];
+      }
+    else
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; combination: '" << combName
+		<< "' or column: '" << columnName << "' not found."
+		<< Color::def << std::endl;
+    return retval;
+  }
+
+//! @brief Return the results for the given element. Each row of the
+//! returned matrix contains the section index followed by the values
+//! for a section and a combination (see getElementCombinations).
+XC::Matrix XC::InternalForcesStore::getElementValues(const int &elemTag) const
+  {
+    Matrix retval;
+    build_element_index();
+    std::map<int, std::vector<row_location> >::const_iterator i= elementIndex.find(elemTag);
+    if(i!=elementIndex.end())
+      {
+        const std::vector<row_location> &rows= i->second;
+	const size_t numValues= valueNames.size();
+	retval.resize(rows.size(), numValues+1);
+	for(size_t k= 0;k<rows.size();k++)
+	  {
+	    const BlockInfo &b= blocks[rows[k].first];
+	    const size_t iRow= rows[k].second;
+	    retval(k,0)= get_sections(b)[iRow];
+	    for(size_t j= 0;j<numValues;j++)
+	      retval(k,j+1)= get_values(b, j)[iRow];
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Return the combination names corresponding to each row of the
+//! matrix returned by getElementValues.
+boost::python::list XC::InternalForcesStore::getElementCombinationsPy(const int &elemTag) const
+  {
+    boost::python::list retval;
+    build_element_index();
+    std::map<int, std::vector<row_location> >::const_iterator i= elementIndex.find(elemTag);
+    if(i!=elementIndex.end())
+      {
+        const std::vector<row_location> &rows= i->second;
+	for(size_t k= 0;k<rows.size();k++)
+	  retval.append(blocks[rows[k].first].name);
+      }
+    return retval;
+  }
+
+//! @brief Return the minimum (first row) and maximum (second row) values
+//! of each column for the given element over all its sections and
+//! combinations (NaN values are ignored).
+XC::Matrix XC::InternalForcesStore::getElementEnvelope(const int &elemTag) const
+  {
+    const size_t numValues= valueNames.size();
+    const double nan= std::numeric_limits<double>::quiet_NaN();
+    Matrix retval(2, numValues);
+    for(size_t j= 0;j<numValues;j++)
+      { retval(0,j)= nan; retval(1,j)= nan; }
+    build_element_index();
+    std::map<int, std::vector<row_location> >::const_iterator i= elementIndex.find(elemTag);
+    if(i!=elementIndex.end())
+      {
+        const std::vector<row_location> &rows= i->second;
+	for(size_t k= 0;k<rows.size();k++)
+	  {
+	    const BlockInfo &b= blocks[rows[k].first];
+	    const size_t iRow= rows[k].second;
+	    for(size_t j= 0;j<numValues;j++)
+	      {
+		const double v= get_values(b, j)[iRow];
+		if(std::isnan(v))
+		  continue;
+		if(std::isnan(retval(0,j)) || (v<retval(0,j)))
+		  retval(0,j)= v;
+		if(std::isnan(retval(1,j)) || (v>retval(1,j)))
+		  retval(1,j)= v;
+	      }
+	  }
+      }
+    return retval;
+  }
@@ -0,0 +1,144 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//InternalForcesStore.h
+
+#ifndef InternalForcesStore_h
+#define InternalForcesStore_h
+
+#include "utility/kernel/CommandEntity.h"
+#include <vector>
+#include <map>
+#include <string>
+#include <fstream>
+#include <cstdint>
+
+namespace XC {
+class Vector;
+class Matrix;
+class ID;
+
+//! @brief Indexed binary store for the internal forces obtained for
+//! each load combination.
+//!
+//! The results of each load combination are appended to the file as
+//! a block, so the file can be written incrementally (one combination
+//! at a time) and read back through a memory mapping, without loading
+//! it in memory.
+//!
+//! File layout (native byte order, all the fields 8-byte aligned):
+//! - header: magic string "XCIFSTOR" (8 bytes), format version (uint32),
+//!   number of value columns (uint32) and, for each value column, the
+//!   length of its name (uint64) followed by the name padded to a
+//!   multiple of 8 bytes.
+//! - blocks: number of rows (uint64), length of the combination name
+//!   (uint64), combination name padded to a multiple of 8 bytes,
+//!   element tags (int64 x rows), section indexes (int64 x rows) and
+//!   the value columns (float64 x rows, one column after the other).
+//!
+//! Missing values (i. e. a chiLT factor for a shell element) are stored
+//! as NaN.
+class InternalForcesStore: public CommandEntity
+  {
+  public:
+    typedef std::vector<std::string> name_container;
+    //! @brief Location of a combination block in the file.
+    struct BlockInfo
+      {
+        std::string name; //!< combination name.
+        size_t numRows; //!< number of rows in the block.
+        size_t dataOffset; //!< offset of the element tag column.
+      };
+    typedef std::pair<size_t, size_t> row_location; //!< (block, row)
+  private:
+    name_container valueNames; //!< names of the value columns.
+    // Writing.
+    std::ofstream outputFile;
+    std::string currentCombination; //!< name of the block being written.
+    bool inCombination;
+    std::vector<int64_t> rowTags; //!< element tags of the current block.
+    std::vector<int64_t> rowSections; //!< section indexes of the current block.
+    std::vector<std::vector<double> > rowValues; //!< values of the current block.
+    // Reading.
+    std::string fileName;
+    int fileDescriptor;
+    const char *mappedData; //!< memory mapped file.
+    size_t mappedSize;
+    std::vector<BlockInfo> blocks;
+    std::map<std::string, size_t> combinationIndex;
+    mutable std::map<int, std::vector<row_location> > elementIndex;
+    mutable bool elementIndexBuilt;
+
+    void write_header(void);
+    size_t read_header(void);
+    bool scan_blocks(size_t);
+    void build_element_index(void) const;
+    void unmap(void);
+    const int64_t *get_tags(const BlockInfo &) const;
+    const int64_t *get_sections(const BlockInfo &) const;
+    const double *get_values(const BlockInfo &, const size_t &) const;
+    InternalForcesStore(const InternalForcesStore &);
+    InternalForcesStore &operator=(const InternalForcesStore &);
+  public:
+    static const std::string magic;
+    static const uint32_t version;
+    InternalForcesStore(void);
+    ~InternalForcesStore(void);
+
+    // Writing.
+    bool create(const std::string &, const name_container &);
+    bool createPy(const std::string &, const boost::python::list &);
+    bool beginCombination(const std::string &);
+    void addRow(const int &, const int &, const Vector &);
+    bool endCombination(void);
+    void close(void);
+    
+    // Reading.
+    bool open(const std::string &);
+    bool isOpen(void) const;
+    const name_container &getValueNames(void) const
+      { return valueNames; }
+    boost::python::list getValueNamesPy(void) const;
+    int getValueIndex(const std::string &) const;
+    size_t getNumCombinations(void) const;
+    boost::python::list getCombinationNamesPy(void) const;
+    bool hasCombination(const std::string &) const;
+    size_t getNumRows(const std::string &) const;
+    size_t getTotalNumRows(void) const;
+    size_t getDataOffset(const std::string &) const;
+    ID getElementTags(void) const;
+    ID getCombinationElementTags(const std::string &) const;
+    ID getCombinationSections(const std::string &) const;
+    Matrix getCombinationValues(const std::string &) const;
+    Vector getCombinationColumn(const std::string &, const std::string &) const;
+    Matrix getElementValues(const int &) const;
+    boost::python::list getElementCombinationsPy(const int &) const;
+    Matrix getElementEnvelope(const int &) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,166 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.cc
+
+#include <utility/database/MemoryDatastore.h>
+#include <utility/matrix/Vector.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/ID.h>
+
+//! @brief Constructor.
+//!
+//! @param name: name of the database.
+//! @param preprocessor: preprocessor used to build the finite element model.
+//! @param theObjectBroker: deals with object serialization.
+XC::MemoryDatastore::MemoryDatastore(const std::string &name, Preprocessor &preprocessor, FEM_ObjectBroker &theObjectBroker)
+  : FE_Datastore(name, preprocessor, theObjectBroker)
+  {}
+
+int XC::MemoryDatastore::sendMsg(int dataTag, int commitTag,const XC::Message &,ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented." << std::endl;
+    return -1;
+  }
+
+int XC::MemoryDatastore::recvMsg(int dataTag, int commitTag, Message &, ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented." << std::endl;
+    return -1;
+  }
+
+//! @brief Store the data in the table argument.
+template <class TABLE, class T>
+void XC::MemoryDatastore::insertData(TABLE &table, const int &dbTag, const int &commitTag, const T *data, const int &sz)
+  {
+    typename TABLE::mapped_type &values= table[Key(dbTag,commitTag)];
+    values.assign(data, data+sz);
+  }
+
+//! @brief Copy the data from the table argument.
+template <class TABLE, class T>
+int XC::MemoryDatastore::retrieveData(const TABLE &table, const std::string &tbName, const int &dbTag, const int &commitTag, T *data, const int &sz) const
+  {
+    int retval= 0;
+    typename TABLE::const_iterator i= table.find(Key(dbTag,commitTag));
+    if(i==table.end())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; ERROR: " << tbName << " with dbTag: " << dbTag
+		  << " and commit tag: " << commitTag
+		  << " not found." << std::endl;
+        retval= -1;
+      }
+    else
+      {
+	const typename TABLE::mapped_type &values= i->second;
+        if(values.size()!=size_t(sz))
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; ERROR: " << tbName << " with dbTag: " << dbTag
+		      << " has " << values.size() << " values, "
+		      << sz << " expected." << std::endl;
+	    retval= -2;
+	  }
+	else
+	  std::copy(values.begin(), values.end(), data);
+      }
+    return retval;
+  }
+
+int XC::MemoryDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    checkDbTag(dbTag);
+    insertData(matrices,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize());
+    return 0;
+  }
+
+int XC::MemoryDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    checkDbTag(dbTag);
+    return retrieveData(matrices,"matrix",dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize());
+  }
+
+int XC::MemoryDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+  {
+    checkDbTag(dbTag);
+    insertData(vectors,dbTag,commitTag,theVector.getDataPtr(),theVector.Size());
+    return 0;
+  }
+
+int XC::MemoryDatastore::recvVector(int dbTag, int commitTag, Vector &theVector,ChannelAddress *theAddress)
+  {
+    checkDbTag(dbTag);
+    return retrieveData(vectors,"vector",dbTag,commitTag,theVector.getDataPtr(),theVector.Size());
+  }
+
+int XC::MemoryDatastore::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+  {
+    checkDbTag(dbTag);
+    insertData(ids,dbTag,commitTag,theID.getDataPtr(),theID.Size());
+    return 0;
+  }
+
+int XC::MemoryDatastore::recvID(int dbTag, int commitTag,ID &theID,ChannelAddress *theAddress)
+  {
+    checkDbTag(dbTag);
+    return retrieveData(ids,"ID",dbTag,commitTag,theID.getDataPtr(),theID.Size());
+  }
+
+//! @brief Remove the data stored with the commit tag argument.
+void XC::MemoryDatastore::removeCommit(const int &commitTag)
+  {
+    for(DoubleTable::iterator i= matrices.begin(); i!=matrices.end();)
+      if(i->first.second==commitTag) i= matrices.erase(i); else i++;
+    for(DoubleTable::iterator i= vectors.begin(); i!=vectors.end();)
+      if(i->first.second==commitTag) i= vectors.erase(i); else i++;
+    for(IntTable::iterator i= ids.begin(); i!=ids.end();)
+      if(i->first.second==commitTag) i= ids.erase(i); else i++;
+  }
+
+//! @brief Return the (approximate) size of the stored data.
+size_t XC::MemoryDatastore::getNumBytes(void) const
+  {
+    size_t retval= 0;
+    for(DoubleTable::const_iterator i= matrices.begin(); i!=matrices.end(); i++)
+      retval+= i->second.size()*sizeof(double);
+    for(DoubleTable::const_iterator i= vectors.begin(); i!=vectors.end(); i++)
+      retval+= i->second.size()*sizeof(double);
+    for(IntTable::const_iterator i= ids.begin(); i!=ids.end(); i++)
+      retval+= i->second.size()*sizeof(int);
+    return retval;
+  }
+
+//! @brief Remove all the stored data.
+void XC::MemoryDatastore::clearAll(void)
+  {
+    matrices.clear();
+    vectors.clear();
+    ids.clear();
+    clearDbTags();
+  }
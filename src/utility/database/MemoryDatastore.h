@@ -0,0 +1,84 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.h
+
+#ifndef MemoryDatastore_h
+#define MemoryDatastore_h
+
+#include <utility/database/FE_Datastore.h>
+#include <map>
+
+namespace XC {
+
+//! @brief Store model data in memory.
+//!
+//! The data sent through the channel is kept in maps indexed by the
+//! (dbTag, commitTag) pair. Each commit tag can be used as an
+//! independent snapshot of the model state and released when
+//! no longer needed.
+//! @ingroup Database
+class MemoryDatastore: public FE_Datastore
+  {
+  private:
+    typedef std::pair<int,int> Key; //!< (dbTag, commitTag) pair.
+    typedef std::map<Key, std::vector<double> > DoubleTable;
+    typedef std::map<Key, std::vector<int> > IntTable;
+    DoubleTable matrices; //!< matrices data.
+    DoubleTable vectors; //!< vectors data.
+    IntTable ids; //!< integer data.
+
+    template <class TABLE, class T>
+    static void insertData(TABLE &, const int &,const int &,const T *,const int &);
+    template <class TABLE, class T>
+    int retrieveData(const TABLE &, const std::string &, const int &,const int &, T *,const int &) const;
+  public:
+    MemoryDatastore(const std::string &,Preprocessor &, FEM_ObjectBroker &);
+    
+    std::string getTypeId(void) const
+      { return "Memory"; }
+
+    // methods for sending and receiving matrices, vectors and id's
+    int sendMsg(int , int , const Message &, ChannelAddress *a= nullptr);    
+    int recvMsg(int , int , Message &, ChannelAddress *a= nullptr);        
+
+    int sendMatrix(int , int , const Matrix &,ChannelAddress *a= nullptr);
+    int recvMatrix(int , int , Matrix &, ChannelAddress *a= nullptr);
+
+    int sendVector(int , int , const Vector &,ChannelAddress *a= nullptr);
+    int recvVector(int , int , Vector &,ChannelAddress *a= nullptr);
+    
+    int sendID(int , int ,const ID &,ChannelAddress *a= nullptr);
+    int recvID(int , int ,ID &,ChannelAddress *a= nullptr);    
+
+    void removeCommit(const int &);
+    size_t getNumBytes(void) const;
+    void clearAll(void);
+  };
+} // end of XC namespace
+
+#endif
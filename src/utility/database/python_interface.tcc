@@ -39,6 +39,10 @@ class_<XC::SQLiteDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("SQLit
 class_<XC::PyDictDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("PyDictDatastore", no_init)
   ;
 
+class_<XC::MemoryDatastore, bases<XC::FE_Datastore>, boost::noncopyable  >("MemoryDatastore", no_init)
+  .add_property("numBytes", &XC::MemoryDatastore::getNumBytes, "Return the size of the stored data.")
+  ;
+
 //class_<XC::OracleDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("OracleDatastore", no_init)
 //  ;
 
@@ -50,3 +54,29 @@ class_<XC::NEESData, bases<XC::FE_Datastore>, boost::noncopyable  >("NEESData",
 
 class_<XC::FileDatastore, bases<XC::FE_Datastore>, boost::noncopyable  >("FileDatastore", no_init)
   ;
+
+class_<XC::InternalForcesStore, bases<CommandEntity>, boost::noncopyable >("InternalForcesStore", "Indexed binary store for the internal forces obtained for each load combination.")
+  .def("create", &XC::InternalForcesStore::createPy, "create(fileName, valueNames): create a new store for the given value columns (i.e. ['N', 'Vy', 'Vz', 'T', 'My', 'Mz']).")
+  .def("beginCombination", &XC::InternalForcesStore::beginCombination, "beginCombination(combName): start the results block of a load combination.")
+  .def("addRow", &XC::InternalForcesStore::addRow, "addRow(elemTag, sectionIndex, values): append a row to the current combination block.")
+  .def("endCombination", &XC::InternalForcesStore::endCombination, "Write the current combination block to the file.")
+  .def("close", &XC::InternalForcesStore::close, "Finish writing and close the file.")
+  .def("open", &XC::InternalForcesStore::open, "open(fileName): open an existing store for reading (memory mapped).")
+  .add_property("isOpen", &XC::InternalForcesStore::isOpen, "True if the store is open for reading.")
+  .add_property("valueNames", &XC::InternalForcesStore::getValueNamesPy, "Names of the value columns.")
+  .def("getValueIndex", &XC::InternalForcesStore::getValueIndex, "Return the index of the value column with the given name (-1 if not found).")
+  .add_property("numCombinations", &XC::InternalForcesStore::getNumCombinations, "Number of combinations in the store.")
+  .add_property("combinationNames", &XC::InternalForcesStore::getCombinationNamesPy, "Names of the combinations in the order they were written.")
+  .def("hasCombination", &XC::InternalForcesStore::hasCombination, "Return true if the store contains results for the given combination.")
+  .def("getNumRows", &XC::InternalForcesStore::getNumRows, "Return the number of rows of the given combination.")
+  .add_property("totalNumRows", &XC::InternalForcesStore::getTotalNumRows, "Total number of rows in the store.")
+  .def("getDataOffset", &XC::InternalForcesStore::getDataOffset, "Return the offset (in bytes) of the data of the given combination in the file.")
+  .def("getElementTags", &XC::InternalForcesStore::getElementTags, "Return the tags of the elements in the store.")
+  .def("getCombinationElementTags", &XC::InternalForcesStore::getCombinationElementTags, "Return the element tags column of the given combination.")
+  .def("getCombinationSections", &XC::InternalForcesStore::getCombinationSections, "Return the section indexes column of the given combination.")
+  .def("getCombinationValues", &XC::InternalForcesStore::getCombinationValues, "Return the values of the given combination (one row for each element section).")
+  .def("getCombinationColumn", &XC::InternalForcesStore::getCombinationColumn, "getCombinationColumn(combName, columnName): return the values of a column for the given combination.")
+  .def("getElementValues", &XC::InternalForcesStore::getElementValues, "Return the results for the given element (section index followed by the values, one row for each section and combination).")
+  .def("getElementCombinations", &XC::InternalForcesStore::getElementCombinationsPy, "Return the combination names of each row returned by getElementValues.")
+  .def("getElementEnvelope", &XC::InternalForcesStore::getElementEnvelope, "Return the minimum (first row) and maximum (second row) of each value for the given element.")
+  ;
@@ -185,16 +185,11 @@ PosArray<POS>::PosArray(const PosArray &l1_points,const PosArray &l2_points,cons
   {
     const size_t row_number= l1_points.getNumberOfRows();
     const size_t num_cols= l2_points.getNumberOfRows();
-    PosArray row_points= l4_points;
+    // The rows are independent, so they can be generated in parallel.
+    #pragma omp parallel for schedule(static)
     for(size_t i=1;i<=row_number;i++)
       {
-        if(i>1)
-          {
-            if(i==row_number)
-              row_points= l2_points;
-            else
-              row_points= PosArray(l1_points(i,1),l3_points(i,1),num_cols-1);
-          }
+        const PosArray row_points= (i==1 ? l4_points : ((i==row_number) ? l2_points : PosArray(l1_points(i,1),l3_points(i,1),num_cols-1)));
         for(size_t j=1;j<=num_cols;j++)
           (*this)(i,j)= row_points(j,1);
       }
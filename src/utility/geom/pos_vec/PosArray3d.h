@@ -52,6 +52,8 @@ PosArray3d<POS>::PosArray3d( const m_pos &l1_points,const m_pos &l2_points,
   : Array3dBase<PosArray<POS> >(l1_points.size())
   {
     const size_t n_layers= this->size();
+    // The layers are independent, so they can be generated in parallel.
+    #pragma omp parallel for schedule(static)
     for(size_t i=1;i<=n_layers;i++) //Iteration on the point "layers".
       {
         const POS &p1= l1_points(i); //1st. point of the quadrangle. 
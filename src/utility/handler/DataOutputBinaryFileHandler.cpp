@@ -0,0 +1,343 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputBinaryFileHandler.cpp
+
+#include "utility/handler/DataOutputBinaryFileHandler.h"
+#include <utility/matrix/Vector.h>
+#include "utility/actor/actor/CommMetaData.h"
+#include "utility/utils/misc_utils/colormod.h"
+#include <cstdint>
+#include <zlib.h>
+
+//! @brief Magic string at the beginning of the file.
+static const char binary_columns_magic[8]= {'X','C','B','I','N','C','O','L'};
+//! @brief Version of the file format.
+static const uint32_t binary_columns_version= 2;
+//! @brief Flag of the file header: the chunks are compressed with zlib.
+static const uint32_t binary_columns_zlib= 1;
+
+//! @brief Constructor.
+//! @param theFileName: name of the output file.
+//! @param chSize: number of rows in each chunk.
+//! @param maxQueued: maximum number of chunks waiting to be written.
+XC::DataOutputBinaryFileHandler::DataOutputBinaryFileHandler(const std::string &theFileName, const size_t &chSize, const size_t &maxQueued)
+  :DataOutputHandler(DATAHANDLER_TAGS_DataOutputBinaryFileHandler),
+   fileName(theFileName), numColumns(0), chunkSize(std::max(chSize,size_t(1))),
+   maxQueuedChunks(std::max(maxQueued,size_t(1))), compressed(false),
+   currentRows(0), stopWriter(false), writeError(false)
+  {}
+
+//! @brief Destructor.
+XC::DataOutputBinaryFileHandler::~DataOutputBinaryFileHandler(void)
+  { close(); }
+
+//! @brief Write the chunks in the queue until stopWriter is set
+//! and the queue is empty.
+void XC::DataOutputBinaryFileHandler::writer_loop(void)
+  {
+    while(true)
+      {
+        chunk_data chunk;
+        {
+          std::unique_lock<std::mutex> lock(queueMutex);
+          queueNotEmpty.wait(lock, [this]{ return stopWriter || !pendingChunks.empty(); });
+          if(pendingChunks.empty()) // stopWriter && nothing left.
+            break;
+          chunk= std::move(pendingChunks.front());
+          pendingChunks.pop_front();
+        }
+        queueNotFull.notify_one();
+        const uint64_t numRows= chunk.size()/numColumns;
+        outputFile.write(reinterpret_cast<const char *>(&numRows), sizeof(numRows));
+        if(compressed)
+          write_compressed(chunk);
+        else
+          outputFile.write(reinterpret_cast<const char *>(chunk.data()), chunk.size()*sizeof(double));
+        if(!outputFile.good())
+          writeError= true;
+      }
+  }
+
+//! @brief Write the values of the chunk compressed with zlib, preceded
+//! by the size of the compressed data (uint64). Called from the writer
+//! thread.
+void XC::DataOutputBinaryFileHandler::write_compressed(const chunk_data &chunk)
+  {
+    const uLong numBytes= chunk.size()*sizeof(double);
+    uLongf destLen= compressBound(numBytes);
+    compressionBuffer.resize(destLen);
+    const int status= compress2(reinterpret_cast<Bytef *>(compressionBuffer.data()), &destLen, reinterpret_cast<const Bytef *>(chunk.data()), numBytes, Z_BEST_SPEED);
+    if(status!=Z_OK)
+      writeError= true;
+    else
+      {
+        const uint64_t compressedBytes= destLen;
+        outputFile.write(reinterpret_cast<const char *>(&compressedBytes), sizeof(compressedBytes));
+        outputFile.write(compressionBuffer.data(), compressedBytes);
+      }
+  }
+
+//! @brief Launch the writer thread.
+void XC::DataOutputBinaryFileHandler::start_writer(void)
+  {
+    stopWriter= false;
+    writerThread= std::thread(&DataOutputBinaryFileHandler::writer_loop, this);
+  }
+
+//! @brief Wait until the writer thread has written all the pending
+//! chunks and finish it.
+void XC::DataOutputBinaryFileHandler::stop_writer(void)
+  {
+    if(writerThread.joinable())
+      {
+        {
+          std::lock_guard<std::mutex> lock(queueMutex);
+          stopWriter= true;
+        }
+        queueNotEmpty.notify_one();
+        writerThread.join();
+      }
+  }
+
+//! @brief Hand the current chunk to the writer thread (waits only if
+//! the queue is full).
+void XC::DataOutputBinaryFileHandler::push_current_chunk(void)
+  {
+    if(currentRows>0)
+      {
+        chunk_data chunk;
+        if(currentRows==chunkSize)
+          {
+            chunk= std::move(currentChunk);
+            currentChunk= chunk_data(numColumns*chunkSize);
+          }
+        else // partial chunk: compact the columns.
+          {
+            chunk.resize(numColumns*currentRows);
+            for(size_t j= 0;j<numColumns;j++)
+              std::copy(currentChunk.begin()+j*chunkSize, currentChunk.begin()+j*chunkSize+currentRows, chunk.begin()+j*currentRows);
+          }
+        currentRows= 0;
+        {
+          std::unique_lock<std::mutex> lock(queueMutex);
+          queueNotFull.wait(lock, [this]{ return pendingChunks.size()<maxQueuedChunks; });
+          pendingChunks.push_back(std::move(chunk));
+        }
+        queueNotEmpty.notify_one();
+      }
+  }
+
+//! @brief Write the file header.
+int XC::DataOutputBinaryFileHandler::write_header(const std::vector<std::string> &dataDescription)
+  {
+    const uint32_t nc= numColumns;
+    const uint32_t cs= chunkSize;
+    const uint32_t flags= (compressed ? binary_columns_zlib : 0);
+    outputFile.write(binary_columns_magic, sizeof(binary_columns_magic));
+    outputFile.write(reinterpret_cast<const char *>(&binary_columns_version), sizeof(binary_columns_version));
+    outputFile.write(reinterpret_cast<const char *>(&nc), sizeof(nc));
+    outputFile.write(reinterpret_cast<const char *>(&cs), sizeof(cs));
+    outputFile.write(reinterpret_cast<const char *>(&flags), sizeof(flags));
+    for(std::vector<std::string>::const_iterator i= dataDescription.begin(); i!= dataDescription.end(); i++)
+      {
+        const uint32_t len= i->size();
+        outputFile.write(reinterpret_cast<const char *>(&len), sizeof(len));
+        outputFile.write(i->data(), len);
+      }
+    return (outputFile.good() ? 0 : -1);
+  }
+
+//! @brief Open the file, write the header and launch the writer thread.
+int XC::DataOutputBinaryFileHandler::open(const std::vector<std::string> &dataDescription)
+  {
+    if(fileName.empty())
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; no filename." << Color::def << std::endl;
+        return -1;
+      }
+    if(dataDescription.empty())
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; no columns to write to file: " << fileName
+                  << Color::def << std::endl;
+        return -1;
+      }
+    close();
+    outputFile.open(fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!outputFile.is_open())
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; could not open file: " << fileName
+		  << Color::def << std::endl;
+        return -1;
+      }
+    numColumns= dataDescription.size();
+    currentChunk= chunk_data(numColumns*chunkSize);
+    currentRows= 0;
+    writeError= false;
+    const int retval= write_header(dataDescription);
+    if(retval<0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; could not write header to file: " << fileName
+                << Color::def << std::endl;
+    start_writer();
+    return retval;
+  }
+
+//! @brief Compress (or not) the chunks of the files opened from now on.
+void XC::DataOutputBinaryFileHandler::setCompressed(const bool &b)
+  {
+    if(outputFile.is_open())
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; file: " << fileName
+                << " already open, close it first."
+                << Color::def << std::endl;
+    else
+      compressed= b;
+  }
+
+//! @brief Append a row to the current chunk.
+int XC::DataOutputBinaryFileHandler::write(Vector &data) 
+  {
+    if(!writerThread.joinable())
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; file not open or data description not set."
+                  << Color::def << std::endl;
+        return -1;
+      }
+    if(size_t(data.Size()) != numColumns)
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                  << "; vector size: " << data.Size()
+                  << " doesn't match the number of columns: " << numColumns
+                  << Color::def << std::endl;
+        return -1;
+      }
+    for(size_t j= 0;j<numColumns;j++)
+      currentChunk[j*chunkSize+currentRows]= data(j);
+    currentRows++;
+    if(currentRows==chunkSize)
+      push_current_chunk();
+    return (writeError ? -1 : 0);
+  }
+
+//! @brief Write to disk all the rows received until now.
+int XC::DataOutputBinaryFileHandler::flush(void)
+  {
+    int retval= 0;
+    if(writerThread.joinable())
+      {
+        push_current_chunk();
+        stop_writer(); // drains the queue.
+        outputFile.flush();
+        retval= (writeError ? -1 : 0);
+        start_writer();
+      }
+    return retval;
+  }
+
+//! @brief Write the pending rows and close the file.
+int XC::DataOutputBinaryFileHandler::close(void)
+  {
+    int retval= 0;
+    if(writerThread.joinable())
+      {
+        push_current_chunk();
+        stop_writer();
+      }
+    if(outputFile.is_open())
+      {
+        outputFile.close();
+        if(writeError)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; error writing file: " << fileName
+                      << Color::def << std::endl;
+            retval= -1;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Sends object members through the communicator being passed as parameter.
+int XC::DataOutputBinaryFileHandler::sendData(Communicator &comm)
+  {
+    int res= comm.sendString(fileName,getDbTagData(),CommMetaData(0));
+    res+= comm.sendInt(numColumns,getDbTagData(),CommMetaData(1));
+    res+= comm.sendInts(chunkSize,maxQueuedChunks,getDbTagData(),CommMetaData(2));
+    res+= comm.sendBool(compressed,getDbTagData(),CommMetaData(3));
+    return res;
+  }
+
+//! @brief Receives object members through the communicator being passed as parameter.
+int XC::DataOutputBinaryFileHandler::recvData(const Communicator &comm)
+  {
+    int res= comm.receiveString(fileName,getDbTagData(),CommMetaData(0));
+    int nc= 0;
+    res+= comm.receiveInt(nc,getDbTagData(),CommMetaData(1));
+    numColumns= nc;
+    int cs= 0, mq= 0;
+    res+= comm.receiveInts(cs,mq,getDbTagData(),CommMetaData(2));
+    chunkSize= std::max(cs,1);
+    maxQueuedChunks= std::max(mq,1);
+    res+= comm.receiveBool(compressed,getDbTagData(),CommMetaData(3));
+    return res;
+  }
+
+//! @brief Send the object through the communicator argument.
+int XC::DataOutputBinaryFileHandler::sendSelf(Communicator &comm)
+  {
+    inicComm(4);
+    setDbTag(comm);
+    const int dataTag= getDbTag();
+    int res= sendData(comm);
+
+    res+= comm.sendIdData(getDbTagData(),dataTag);
+    if(res < 0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; " << dataTag << " failed to send."
+                << Color::def << std::endl;
+    return res;
+  }
+
+//! @brief Receive the object through the communicator argument.
+int XC::DataOutputBinaryFileHandler::recvSelf(const Communicator &comm)
+  {
+    inicComm(4);
+    const int dataTag= getDbTag();
+    int res= comm.receiveIdData(getDbTagData(),dataTag);
+
+    if(res<0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; " << dataTag << " failed to receive ID."
+                << Color::def << std::endl;
+    else
+      res+= recvData(comm);
+    return res;
+  }
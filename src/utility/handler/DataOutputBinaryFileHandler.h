@@ -0,0 +1,123 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputBinaryFileHandler.h
+
+#ifndef DataOutputBinaryFileHandler_h
+#define DataOutputBinaryFileHandler_h
+
+#include "DataOutputHandler.h"
+#include <fstream>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace XC {
+//! @ingroup DOHandlersGrp
+//
+//! @brief Writes the recorded data to a binary file organized
+//! in column chunks.
+//!
+//! The file starts with a self-describing header:
+//! - magic string "XCBINCOL" (8 bytes).
+//! - format version (uint32).
+//! - number of columns (uint32).
+//! - number of rows per chunk (uint32).
+//! - flags (uint32): bit 0 set if the chunks are compressed with zlib.
+//! - for each column: length of its name (uint32) followed by the name.
+//!
+//! After the header the file contains a sequence of chunks, each one made
+//! of the number of rows it contains (uint64) followed by the values of
+//! each column (float64, one column after the other). If the chunks are
+//! compressed, the number of rows is followed by the size of the
+//! compressed values (uint64) and the values compressed with zlib. All
+//! the values are written in the native byte order. The chunks are written to disk by a
+//! background thread fed through a bounded queue, so the recorders don't
+//! wait for the disk unless the queue is full.
+class DataOutputBinaryFileHandler: public DataOutputHandler
+  {
+  public:
+    typedef std::vector<double> chunk_data; //!< Column-major chunk values.
+  private:
+    std::ofstream outputFile;
+    std::string fileName;
+    size_t numColumns;
+    size_t chunkSize; //!< number of rows in each chunk.
+    size_t maxQueuedChunks; //!< capacity of the writer queue.
+    bool compressed; //!< if true, compress the chunks with zlib.
+    chunk_data currentChunk; //!< chunk being filled.
+    size_t currentRows; //!< number of rows in the current chunk.
+
+    std::deque<chunk_data> pendingChunks; //!< chunks waiting to be written.
+    std::thread writerThread;
+    std::mutex queueMutex;
+    std::condition_variable queueNotEmpty;
+    std::condition_variable queueNotFull;
+    bool stopWriter;
+    std::atomic<bool> writeError; //!< set by the writer thread.
+    std::vector<char> compressionBuffer; //!< used by the writer thread.
+
+    void writer_loop(void);
+    void start_writer(void);
+    void stop_writer(void);
+    void write_compressed(const chunk_data &);
+    void push_current_chunk(void);
+    int write_header(const std::vector<std::string> &);
+  protected:
+    int sendData(Communicator &comm);
+    int recvData(const Communicator &comm);
+
+  public:
+    DataOutputBinaryFileHandler(const std::string &fileName= "", const size_t &chunkSize= 256, const size_t &maxQueuedChunks= 8);
+    DataOutputBinaryFileHandler(const DataOutputBinaryFileHandler &)= delete;
+    DataOutputBinaryFileHandler &operator=(const DataOutputBinaryFileHandler &)= delete;
+    ~DataOutputBinaryFileHandler(void);
+
+    int open(const std::vector<std::string> &dataDescription);
+    int write(Vector &data);
+    int flush(void);
+    int close(void);
+
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    inline size_t getNumColumns(void) const
+      { return numColumns; }
+    inline size_t getChunkSize(void) const
+      { return chunkSize; }
+    inline bool getCompressed(void) const
+      { return compressed; }
+    void setCompressed(const bool &);
+
+    int sendSelf(Communicator &);  
+    int recvSelf(const Communicator &);
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,37 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::DataOutputHandler, bases<XC::MovableObject, CommandEntity>, boost::noncopyable  >("DataOutputHandler", no_init)
+  ;
+
+class_<XC::DataOutputFileHandler, bases<XC::DataOutputHandler>, boost::noncopyable  >("DataOutputFileHandler", no_init)
+  ;
+
+class_<XC::DataOutputBinaryFileHandler, bases<XC::DataOutputHandler>, boost::noncopyable  >("DataOutputBinaryFileHandler", no_init)
+  .add_property("fileName", make_function(&XC::DataOutputBinaryFileHandler::getFileName, return_value_policy<copy_const_reference>()), "Return the name of the output file.")
+  .add_property("numColumns", &XC::DataOutputBinaryFileHandler::getNumColumns, "Return the number of columns written in each row.")
+  .add_property("chunkSize", &XC::DataOutputBinaryFileHandler::getChunkSize, "Return the number of rows in each chunk.")
+  .add_property("compressed", &XC::DataOutputBinaryFileHandler::getCompressed, &XC::DataOutputBinaryFileHandler::setCompressed, "If true, compress the chunks with zlib (set it before the file is opened).")
+  .def("flush", &XC::DataOutputBinaryFileHandler::flush, "Write to disk all the rows received until now.")
+  .def("close", &XC::DataOutputBinaryFileHandler::close, "Write the pending rows and close the file.")
+  ;
@@ -69,6 +69,17 @@ boost::python::object exec_compiled(const boost::python::object& code,
 CommandEntity::CommandEntity(CommandEntity *owr)
   : EntityWithProperties(owr) {}
 
+//! @brief Copy constructor (the compiled code is not copied).
+CommandEntity::CommandEntity(const CommandEntity &other)
+  : EntityWithProperties(other) {}
+
+//! @brief Assignment operator (the compiled code is not copied).
+CommandEntity &CommandEntity::operator=(const CommandEntity &other)
+  {
+    EntityWithProperties::operator=(other);
+    return *this;
+  }
+
 //! @brief Return a pointer to the object owner.
 CommandEntity *CommandEntity::Owner(void)
   {
@@ -145,7 +156,9 @@ boost::python::object CommandEntity::compile_code_block(const std::string &block
     boost::python::object retval;
     std::size_t key = std::hash<std::string>{}(block);
     std::lock_guard<std::mutex> lock(CommandEntity::mutex_);
-    auto range = compiled_code.equal_range(key); // Key already in container.
+    if(!compiled_code)
+      compiled_code= std::make_unique<compiled_code_map>();
+    auto range = compiled_code->equal_range(key); // Key already in container.
     for (auto it = range.first; it != range.second; ++it)
       {
 	if (it->second.source == block)
@@ -157,7 +170,7 @@ boost::python::object CommandEntity::compile_code_block(const std::string &block
     if(!found)      
       {
         retval= compile_script(block, name);
-	compiled_code.emplace(key, CacheEntry{block, retval});
+	compiled_code->emplace(key, CacheEntry{block, retval});
       }
     return retval;
   }
@@ -52,7 +52,9 @@ class CommandEntity: public EntityWithProperties
     typedef std::unordered_map<std::size_t, CacheEntry> compiled_code_map;
     typedef typename compiled_code_map::iterator compiled_code_iterator;
     typedef typename compiled_code_map::const_iterator compiled_code_const_iterator;
-    compiled_code_map compiled_code;
+    //! Compiled code blocks (allocated on first use, most of the
+    //! objects never run a script).
+    std::unique_ptr<compiled_code_map> compiled_code;
     inline static std::mutex mutex_;
     boost::python::object compile_code_block(const std::string &, const std::string &);
   protected:
@@ -62,6 +64,8 @@ class CommandEntity: public EntityWithProperties
     void string_to(T &,const std::string &) const;
   public:
     CommandEntity(CommandEntity *owr= nullptr);
+    CommandEntity(const CommandEntity &);
+    CommandEntity &operator=(const CommandEntity &);
 
     CommandEntity *Owner(void);
     const CommandEntity *Owner(void) const;
@@ -29,13 +29,35 @@ EntityWithProperties::EntityWithProperties(EntityWithProperties *owr)
   : EntityWithOwner(owr)
   {}
 
+//! @brief Copy constructor.
+EntityWithProperties::EntityWithProperties(const EntityWithProperties &other)
+  : EntityWithOwner(other)
+  {
+    if(other.python_dict)
+      python_dict= std::make_unique<PythonDict>(*other.python_dict);
+  }
+
+//! @brief Assignment operator.
+EntityWithProperties &EntityWithProperties::operator=(const EntityWithProperties &other)
+  {
+    if(this!=&other)
+      {
+        EntityWithOwner::operator=(other);
+        if(other.python_dict)
+          python_dict= std::make_unique<PythonDict>(*other.python_dict);
+        else
+          python_dict.reset();
+      }
+    return *this;
+  }
+
 //! @brief Clear python properties map.
 void EntityWithProperties::clearPyProps(void)
-  { python_dict.clear(); }
+  { python_dict.reset(); }
 
 //! @brief Returns true if property exists.
 bool EntityWithProperties::hasPyProp(const std::string &str)
-  { return (python_dict.find(str) != python_dict.end()); }
+  { return (python_dict && (python_dict->find(str) != python_dict->end())); }
 
 //! @brief Return the Python object with the name being passed as parameter.
 boost::python::object EntityWithProperties::getPyProp(const std::string &str)
@@ -43,8 +65,9 @@ boost::python::object EntityWithProperties::getPyProp(const std::string &str)
      boost::python::object retval; //Defaults to None.
      // Python checks the class attributes before it calls __getattr__
      // so we don't have to do anything special here.
-     PythonDict::const_iterator i= python_dict.find(str);
-     if(i == python_dict.end())
+     const PythonDict &dict= getPropertiesDict();
+     PythonDict::const_iterator i= dict.find(str);
+     if(i == dict.end())
        {
          std::clog << getClassName() << "::" << __FUNCTION__
 	           << "; Warning, property: '" << str
@@ -66,14 +89,17 @@ boost::python::object EntityWithProperties::getPyProp(const std::string &str)
 //add_property(), def_readwrite(), etc.
 void EntityWithProperties::setPyProp(std::string str, boost::python::object val)
   {
-    python_dict[str] = val;
+    if(!python_dict)
+      python_dict= std::make_unique<PythonDict>();
+    (*python_dict)[str] = val;
   }
 
 //! @brief Return the names of the object properties weightings.
 boost::python::list EntityWithProperties::getPropNames(void) const
   {
     boost::python::list retval;
-    for(PythonDict::const_iterator i= python_dict.begin();i!= python_dict.end();i++)
+    const PythonDict &dict= getPropertiesDict();
+    for(PythonDict::const_iterator i= dict.begin();i!= dict.end();i++)
       retval.append((*i).first);
     return retval;
   }
@@ -81,14 +107,20 @@ boost::python::list EntityWithProperties::getPropNames(void) const
 //! @brief Copy the properties from the argument.
 void EntityWithProperties::copyPropsFrom(const EntityWithProperties &other)
   {
-    const PythonDict &otherDict= other.python_dict;
+    const PythonDict &otherDict= other.getPropertiesDict();
     for(PythonDict::const_iterator i= otherDict.begin();i!= otherDict.end();i++)
       setPyProp((*i).first, (*i).second);
   }
 
 //! @brief Return a std::map container with the properties of the object.
 const EntityWithProperties::PythonDict &EntityWithProperties::getPropertiesDict(void) const
-  { return python_dict; }
+  {
+    static const PythonDict empty_dict;
+    if(python_dict)
+      return *python_dict;
+    else
+      return empty_dict;
+  }
 
 //! @brief Return true if both objects are equal.
 bool EntityWithProperties::isEqual(const EntityWithProperties &other) const
@@ -101,8 +133,8 @@ bool EntityWithProperties::isEqual(const EntityWithProperties &other) const
 	retval= EntityWithOwner::isEqual(other);
 	if(retval)
 	  {
-            const PythonDict &otherDict= other.python_dict;
-            retval= (python_dict==otherDict);
+            const PythonDict &otherDict= other.getPropertiesDict();
+            retval= (getPropertiesDict()==otherDict);
             // for(PythonDict::const_iterator i= otherDict.begin();i!= otherDict.end();i++)
 	    //   {
 	    // 	const std::string &key= (*i).first;
@@ -126,11 +158,11 @@ bool EntityWithProperties::isEqual(const EntityWithProperties &other) const
 boost::python::dict EntityWithProperties::getPyDict(void) const
   {
     boost::python::dict retval= EntityWithOwner::getPyDict();
-    if(!python_dict.empty()) // if there are properties.
+    if(python_dict && !python_dict->empty()) // if there are properties.
       {
 	// Populate the properties dictionary.
 	boost::python::dict properties_dict;
-	for(PythonDict::const_iterator i= python_dict.begin();i!= python_dict.end();i++)
+	for(PythonDict::const_iterator i= python_dict->begin();i!= python_dict->end();i++)
 	  {
 	    const std::string key= (*i).first;
 	    // check if the object class is derived of EntityWithProperties.
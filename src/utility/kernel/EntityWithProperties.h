@@ -25,6 +25,7 @@
 
 #include "EntityWithOwner.h"
 #include <map>
+#include <memory>
 
 //! @ingroup NUCLEO
 //
@@ -38,9 +39,13 @@ class EntityWithProperties: public EntityWithOwner
   private:
     static inline const std::string py_prop_prefix= "py_prop";
     
-    PythonDict python_dict; //!< Python variables.
+    //! Python variables (allocated on first use, most of the objects
+    //! -fibers, materials of the integration points,...- have none).
+    std::unique_ptr<PythonDict> python_dict;
   public:
     EntityWithProperties(EntityWithProperties *owr= nullptr);
+    EntityWithProperties(const EntityWithProperties &);
+    EntityWithProperties &operator=(const EntityWithProperties &);
     
     void clearPyProps(void);
     bool hasPyProp(const std::string &);
@@ -1419,10 +1419,11 @@ void XC::nDarray::eigsrt(std::vector<double> &d, std::vector<std::vector<double>
       }
   }
 
-// very private part
+//! @brief Return a pointer to the (row-major) values of the array.
 const double *XC::nDarray::data(void) const
   { return this->pc_nDarray_rep.get_data_ptr(); }
 
+// very private part
 const std::vector<double> &XC::nDarray::vector_data(void) const
   { return this->pc_nDarray_rep.get_data(); }
 
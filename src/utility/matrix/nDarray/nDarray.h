@@ -108,7 +108,6 @@ class nDarray
   protected:
     nDarray_rep pc_nDarray_rep;
 
-    const double *data(void) const;
     const std::vector<double> &vector_data(void) const;
     void set_dim(const std::vector<int> &);
     void rank(int);
@@ -155,6 +154,7 @@ class nDarray
 
     const std::vector<int> &dim(void) const;
     boost::python::list dimPy(void) const;
+    const double *data(void) const;
     
     inline const double &operator()(int first) const
       { return pc_nDarray_rep(first); }
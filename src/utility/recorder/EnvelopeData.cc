@@ -67,6 +67,45 @@ int XC::EnvelopeData::restart(void)
     return 0;
   }
 
+//! @brief Allocate storage for the envelope of the given number
+//! of values and restart it.
+void XC::EnvelopeData::setup(const size_t &numColumns)
+  {
+    alloc(numColumns);
+    first= true;
+  }
+
+//! @brief Update the envelope (minimum, maximum and maximum absolute
+//! value stored in the rows of the data matrix) with the values
+//! being passed as parameter.
+void XC::EnvelopeData::update(const Vector &values)
+  {
+    const int sz= std::min(values.Size(),data->noCols());
+    if(first)
+      {
+        for(int i= 0;i<sz;i++)
+          {
+            const double value= values(i);
+            (*data)(0,i)= value;
+            (*data)(1,i)= value;
+            (*data)(2,i)= fabs(value);
+          }
+        first= false;
+      }
+    else
+      for(int i= 0;i<sz;i++)
+        {
+          const double value= values(i);
+          if((*data)(0,i) > value)
+            (*data)(0,i)= value;
+          if((*data)(1,i) < value)
+            (*data)(1,i)= value;
+          const double absValue= fabs(value);
+          if((*data)(2,i) < absValue)
+            (*data)(2,i)= absValue;
+        }
+  }
+
 //! @brief Send the object through the communicator
 //! being passed as parameter.
 int XC::EnvelopeData::sendData(Communicator &comm)
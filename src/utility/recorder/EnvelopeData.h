@@ -70,6 +70,8 @@ class EnvelopeData: public MovableObject
       { return first; }
 
     int restart(void); 
+    void setup(const size_t &);
+    void update(const Vector &);
 
     int sendSelf(Communicator &);  
     int recvSelf(const Communicator &);
@@ -203,6 +203,30 @@ void XC::NodeRecorder::setupDataFlag(const std::string &dataToStore)
       }
   }
 
+//! @brief Set the tags of the nodes to record.
+void XC::NodeRecorder::setNodes(const ID &nodes)
+  {
+    if(theNodalTags)
+      {
+        delete theNodalTags;
+        theNodalTags= nullptr;
+      }
+    setup_nodes(nodes);
+    initializationDone= false;
+  }
+
+//! @brief Set the degrees of freedom to record.
+void XC::NodeRecorder::setDofs(const ID &dofs)
+  {
+    if(theDofs)
+      {
+        delete theDofs;
+        theDofs= nullptr;
+      }
+    setup_dofs(dofs);
+    initializationDone= false;
+  }
+
 XC::NodeRecorder::NodeRecorder(void)
   :NodeRecorderBase(RECORDER_TAGS_NodeRecorder),
    response(0),gradIndex(-1)
@@ -63,6 +63,13 @@ void XC::PropRecorder::callSetupCallback(const int &commitTag,const double &time
       CommandEntity_exec(pyObj,CallbackSetup);
   }
 
+//! @brief The Python code of the callbacks can modify the properties
+//! of the model, notify it to the domain (see Domain::modelChange).
+void XC::PropRecorder::model_may_have_changed(void)
+  {
+    if(theDomain)
+      theDomain->modelChange();
+  }
 
 void XC::PropRecorder::setCallbackRecord(const std::string &str)
   { CallbackRecord= str; }
@@ -50,6 +50,7 @@ class PropRecorder: public DomainRecorderBase
     double nextTimeStampToRecord; //! next time to trigger the record process.
     
     void callSetupCallback(const int &,const double &);
+    void model_may_have_changed(void);
     template <class Container>
     void callRecordCallback(Container &c,const int &,const double &);
     template <class Container>
@@ -95,6 +96,7 @@ void XC::PropRecorder::callRecordCallback(Container &c,const int &commitTag,cons
 	  std::cerr << getClassName() << "::" << __FUNCTION__
 	            << "; pointer is null." << std::endl;
       }
+    model_may_have_changed();
   }
 
 //! @brief Calls restart callback on each container element.
@@ -113,6 +115,7 @@ void PropRecorder::callRestartCallback(Container &c)
 	  std::cerr << getClassName() << "::" << __FUNCTION__
 	            << "; pointer is null." << std::endl;
       }
+    model_may_have_changed();
   }
  
 } // end of XC namespace
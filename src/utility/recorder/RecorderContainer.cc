@@ -66,8 +66,10 @@
 #include <utility/recorder/ElementPropRecorder.h>
 #include "utility/utils/misc_utils/colormod.h"
 
+bool XC::RecorderContainer::all_suspended= false;
+
 XC::RecorderContainer::RecorderContainer(DataOutputHandler::map_output_handlers *oh)
-  : theRecorders(), output_handlers(oh) {}
+  : theRecorders(), output_handlers(oh), suspended(false) {}
 
 
 //! @brief Read a Recorder object from file.
@@ -188,11 +190,13 @@ int XC::RecorderContainer::addRecorder(Recorder &theRecorder)
   }
 
 //! @brief To invoke {\em record(cTag, timeStamp)} on any Recorder objects
-//! which have been added.
+//! which have been added (unless the recorders are suspended, see
+//! setRecordersSuspended and setAllRecordersSuspended).
 int XC::RecorderContainer::record(int cTag, double timeStamp)
   {
-    for(recorders_list::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
-      (*i)->record(cTag, timeStamp);
+    if(!suspended && !all_suspended)
+      for(recorders_list::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
+        (*i)->record(cTag, timeStamp);
     return 0;
   }
 
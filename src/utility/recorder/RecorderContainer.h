@@ -50,6 +50,8 @@ class RecorderContainer
   private:
     recorders_list theRecorders; //!< recorders list.
     DataOutputHandler::map_output_handlers *output_handlers; //!< output handlers.
+    bool suspended; //!< if true, record doesn't invoke the recorders.
+    static bool all_suspended; //!< if true, no container of the process invokes its recorders.
 
   protected:
     int sendData(Communicator &comm);
@@ -74,6 +76,20 @@ class RecorderContainer
     inline const_recorder_iterator recorder_end(void) const
       { return theRecorders.end(); }
     virtual int record(int track, double timeStamp= 0.0);
+    //! @brief Return true if the recorders are not invoked on record.
+    inline bool recordersSuspended(void) const
+      { return suspended; }
+    //! @brief If true, don't invoke the recorders on record.
+    inline void setRecordersSuspended(const bool &b)
+      { suspended= b; }
+    //! @brief Return true if the recorders of all the containers
+    //! of the process are suspended.
+    static inline bool allRecordersSuspended(void)
+      { return all_suspended; }
+    //! @brief If true, no container of the process invokes its
+    //! recorders on record (see setup_forked_worker).
+    static inline void setAllRecordersSuspended(const bool &b)
+      { all_suspended= b; }
     void restart(void);
     virtual int removeRecorders(void);
     void setLinks(Domain *dom);
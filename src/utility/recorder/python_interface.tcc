@@ -74,7 +74,11 @@ class_<XC::ElementRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable
 
 class_<XC::NodeRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable >("NodeRecorderBase", no_init);
 
-class_<XC::NodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("NodeRecorder", no_init);
+class_<XC::NodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("NodeRecorder", no_init)
+  .def("setNodes",&XC::NodeRecorder::setNodes,"Assigns the nodes to record.")
+  .def("setDofs",&XC::NodeRecorder::setDofs,"Assigns the degrees of freedom to record.")
+  .def("setDataToStore",&XC::NodeRecorder::setupDataFlag,"Set the response to record (disp, vel, accel, incrDisp, incrDeltaDisp, unbalance, reaction,...).")
+  ;
 
 class_<XC::EnvelopeNodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("EnvelopeNodeRecorder", no_init);
 
@@ -0,0 +1,319 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjects.cc
+
+#include "VectorOfTaggedObjects.h"
+#include <utility/tagged/TaggedObject.h>
+#include <algorithm>
+#include "utility/utils/misc_utils/colormod.h"
+
+//! @brief Constructor.
+//!
+//! @param owr: object owner (this object is somewhat contained by).
+//! @param containerName: name of the container.
+XC::VectorOfTaggedObjects::VectorOfTaggedObjects(CommandEntity *owr,const std::string &containerName)
+  : TaggedObjectStorage(owr,containerName), keepSorted(true),
+    sorted(true), lastTag(0), numHoles(0), numOpenIters(0), myIter(*this) {}
+
+//! @brief Copy constructor.
+XC::VectorOfTaggedObjects::VectorOfTaggedObjects(const VectorOfTaggedObjects &other)
+  : TaggedObjectStorage(other), keepSorted(other.keepSorted),
+    sorted(true), lastTag(0), numHoles(0), numOpenIters(0), myIter(*this)
+  {
+    copy(other);
+  }
+
+//! @brief Assignment operator.
+XC::VectorOfTaggedObjects &XC::VectorOfTaggedObjects::operator=(const VectorOfTaggedObjects &other)
+  {
+    TaggedObjectStorage::operator=(other);
+    clearAll();
+    keepSorted= other.keepSorted;
+    copy(other);
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::VectorOfTaggedObjects::~VectorOfTaggedObjects(void)
+  { clearComponents(); }
+
+//! @brief Reserve memory for newSize components.
+int XC::VectorOfTaggedObjects::setSize(int newSize)
+  {
+    if(newSize>0)
+      {
+        theComponents.reserve(newSize);
+        tagIndex.reserve(newSize);
+      }
+    return 0;
+  }
+
+//! @brief Adds a component to the container.
+//!
+//! Returns \p true if successful. If there is already a component
+//! with the same tag, a warning is raised and false is returned.
+//! The component is appended at the end of the vector; if its tag
+//! is out of order the vector will be sorted when the next iteration
+//! starts (see tidy), so adding n components costs O(n log(n)).
+bool XC::VectorOfTaggedObjects::addComponent(TaggedObject *newComponent)
+  {
+    bool retval= false;
+    const int tag= newComponent->getTag();
+    if(tagIndex.find(tag)!=tagIndex.end()) // tag occupied
+      {
+        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; not adding as one with similar tag exists, tag: "
+		  << tag << Color::def << std::endl;
+      }
+    else
+      {
+        if(sorted && !tagIndex.empty() && (tag<lastTag))
+          sorted= false; // sort before the next iteration.
+        lastTag= tag;
+        tagIndex[tag]= theComponents.size();
+        theComponents.push_back(newComponent);
+        newComponent->set_owner(this);
+        transmitIDs= true; //Component added.
+        retval= true;
+      }
+    return retval;
+  }
+
+//! @brief Remove the component whose tag is given by \p tag
+//! from the container (and delete it).
+//!
+//! The position of the component in the vector is left empty; the
+//! holes are removed when they are more than the half of the vector
+//! (so the cost of the compaction is amortized over the removals)
+//! and no iterator is open.
+bool XC::VectorOfTaggedObjects::removeComponent(int tag)
+  {
+    bool retval= false;
+    tag_index_map::iterator i= tagIndex.find(tag);
+    if(i!=tagIndex.end())
+      {
+        const size_t pos= i->second;
+        delete theComponents[pos];
+        theComponents[pos]= nullptr;
+        tagIndex.erase(i);
+        numHoles++;
+        if((numOpenIters==0) && (2*numHoles>theComponents.size()))
+          compact();
+        transmitIDs= true; //Component removed.
+        retval= true;
+      }
+    return retval;
+  }
+
+//! @brief Returns the number of components currently stored in the
+//! container.
+int XC::VectorOfTaggedObjects::getNumComponents(void) const
+  { return tagIndex.size(); }
+
+//! @brief To return a pointer to the TaggedObject whose identifier is given by
+//! \p tag (nullptr if there is no such object).
+XC::TaggedObject *XC::VectorOfTaggedObjects::getComponentPtr(int tag)
+  {
+    const VectorOfTaggedObjects *cthis= static_cast<const VectorOfTaggedObjects *>(this);
+    return const_cast<TaggedObject *>(cthis->getComponentPtr(tag));
+  }
+
+//! @brief To return a pointer to the TaggedObject whose identifier is given by
+//! \p tag. Const version of the method.
+const XC::TaggedObject *XC::VectorOfTaggedObjects::getComponentPtr(int tag) const
+  {
+    const TaggedObject *retval= nullptr;
+    tag_index_map::const_iterator i= tagIndex.find(tag);
+    if(i!=tagIndex.end())
+      retval= theComponents[i->second];
+    return retval;
+  }
+
+//! @brief Rebuild the tag to position table from the given position.
+//! @param first: first position to update.
+void XC::VectorOfTaggedObjects::rebuild_index(const size_t &first)
+  {
+    if(first==0)
+      {
+        tagIndex.clear();
+        tagIndex.reserve(theComponents.size());
+      }
+    for(size_t i= first; i<theComponents.size(); i++)
+      if(theComponents[i])
+        tagIndex[theComponents[i]->getTag()]= i;
+  }
+
+//! @brief Remove the holes left by the removed components (the
+//! order of the remaining objects is not changed).
+//!
+//! Moves the objects in the vector, so it must not be called while
+//! iterating through the container.
+void XC::VectorOfTaggedObjects::compact(void)
+  {
+    if(numHoles>0)
+      {
+        theComponents.erase(std::remove(theComponents.begin(), theComponents.end(), nullptr), theComponents.end());
+        rebuild_index();
+        numHoles= 0;
+      }
+  }
+
+//! @brief Sort the objects by tag.
+void XC::VectorOfTaggedObjects::sort_by_tag(void)
+  {
+    compact();
+    std::stable_sort(theComponents.begin(), theComponents.end(), [](const TaggedObject *a, const TaggedObject *c) { return a->getTag()<c->getTag(); });
+    rebuild_index();
+    sorted= true;
+    lastTag= (theComponents.empty() ? 0 : theComponents.back()->getTag());
+  }
+
+//! @brief Sort the objects appended out of order and remove the
+//! holes left by the removed ones, unless an iterator is open
+//! (called when an iteration starts).
+void XC::VectorOfTaggedObjects::tidy(void)
+  {
+    if(numOpenIters==0)
+      {
+        if(keepSorted && !sorted)
+          sort_by_tag();
+        else
+          compact();
+      }
+  }
+
+//! @brief Store the objects in the order given by the argument
+//! (i.e. a locality optimized numbering).
+//!
+//! The objects whose tags are not in the list are placed
+//! after them, in their current order. From now on, the new objects
+//! are appended at the end of the vector (call setSortedByTag(true)
+//! to get back to the default ordering).
+//! @param tags: tags of the objects in the new order.
+int XC::VectorOfTaggedObjects::reorder(const std::vector<int> &tags)
+  {
+    int retval= 0;
+    compact();
+    tagged_vector tmp;
+    tmp.reserve(theComponents.size());
+    std::vector<bool> placed(theComponents.size(),false);
+    for(std::vector<int>::const_iterator i= tags.begin(); i!=tags.end(); i++)
+      {
+        tag_index_map::const_iterator j= tagIndex.find(*i);
+        if(j==tagIndex.end())
+          {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; object with tag: " << *i
+		      << " not found." << Color::def << std::endl;
+            retval= -1;
+          }
+        else if(!placed[j->second])
+          {
+            placed[j->second]= true;
+            tmp.push_back(theComponents[j->second]);
+          }
+      }
+    for(size_t i= 0; i<theComponents.size(); i++)
+      if(!placed[i])
+        tmp.push_back(theComponents[i]);
+    theComponents.swap(tmp);
+    keepSorted= false;
+    rebuild_index();
+    return retval;
+  }
+
+//! @brief If true, sort the objects by tag and keep them sorted
+//! (default behavior), otherwise keep the current order and append
+//! the new objects at the end (insertion order).
+void XC::VectorOfTaggedObjects::setSortedByTag(const bool &b)
+  {
+    if(b && !keepSorted)
+      sort_by_tag();
+    keepSorted= b;
+  }
+
+//! @brief Return an iter for iterating through the objects that have
+//! been added to the container. This iter() is first reset
+//! and a reference to this iter is then returned. 
+XC::TaggedObjectIter &XC::VectorOfTaggedObjects::getComponents(void)
+  {
+    myIter.reset();
+    return myIter;
+  }
+
+//! @brief Return a new iterator over the components.
+XC::VectorOfTaggedObjectsIter XC::VectorOfTaggedObjects::getIter(void)
+  {
+    VectorOfTaggedObjectsIter retval(*this);
+    retval.reset();
+    return retval;
+  }
+
+//! @brief Return an empty copy of the container (the caller is
+//! responsible of deleting it).
+XC::TaggedObjectStorage *XC::VectorOfTaggedObjects::getEmptyCopy(void)
+  {
+    VectorOfTaggedObjects *theCopy= new VectorOfTaggedObjects(Owner(),containerName);  
+    if(!theCopy)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; out of memory." << Color::def << std::endl;
+    else
+      theCopy->keepSorted= keepSorted;
+    return theCopy;
+  }
+
+//! @brief Free memory reserved for components.
+void XC::VectorOfTaggedObjects::clearComponents(void)
+  {
+    for(iterator p= theComponents.begin(); p!=theComponents.end(); p++)
+      {
+	delete *p;
+        *p= nullptr;
+      }
+  }
+
+//! @brief Remove all objects from the container and invoke the
+//! destructor on these objects if \p invokeDestructor is true.
+void XC::VectorOfTaggedObjects::clearAll(bool invokeDestructor)
+  {
+    if(invokeDestructor)
+      clearComponents();
+    theComponents.clear();
+    tagIndex.clear();
+    numHoles= 0;
+    sorted= true;
+    lastTag= 0;
+    transmitIDs= true; //All component removed.
+  }
+
+//! @brief Print stuff.
+void XC::VectorOfTaggedObjects::Print(std::ostream &s, int flag) const
+  {
+    for(const_iterator p= begin(); p!=end(); p++)
+      if(*p)
+	(*p)->Print(s, flag);
+  }
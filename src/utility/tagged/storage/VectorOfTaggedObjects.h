@@ -0,0 +1,127 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjects.h
+
+#ifndef VectorOfTaggedObjects_h
+#define VectorOfTaggedObjects_h
+
+#include <utility/tagged/storage/TaggedObjectStorage.h>
+#include <utility/tagged/storage/VectorOfTaggedObjectsIter.h>
+#include <vector>
+#include <unordered_map>
+
+namespace XC {
+//! @ingroup Tagged
+//
+//! @brief Container that stores the pointers to the objects in a
+//! dense vector and uses a hash table to map the tags to the
+//! positions in that vector.
+//!
+//! Tag lookup is a hash table access and iteration traverses
+//! the vector contiguously. By default the objects are iterated
+//! in increasing tag order (as in MapOfTaggedObjects): the new objects
+//! are always appended and, if they come out of order, the vector is
+//! sorted when the next iteration starts. The objects can also be kept
+//! in insertion order (setSortedByTag(false)) or stored in an arbitrary
+//! (e.g. locality optimized) order by calling reorder. Removals leave
+//! a hole in the vector (skipped by the iterators).
+//!
+//! The objects are never moved while an iterator is open (from its
+//! reset until it returns nullptr): objects added meanwhile are
+//! appended and the holes are kept, so the open iterators remain
+//! valid. The vector is sorted and the holes removed when no iterator
+//! is open. The explicit reorderings (compact, reorder and
+//! setSortedByTag) move the objects, so they must not be called
+//! while iterating.
+class VectorOfTaggedObjects: public TaggedObjectStorage
+  {
+    typedef std::vector<TaggedObject *> tagged_vector;
+    typedef std::unordered_map<int, size_t> tag_index_map;
+  public:
+    typedef tagged_vector::iterator iterator;
+    typedef tagged_vector::const_iterator const_iterator;
+  private:
+    tagged_vector theComponents; //!< pointers to the objects (may contain null holes).
+    tag_index_map tagIndex; //!< position of each tag in the vector.
+    bool keepSorted; //!< if true, objects are sorted by tag.
+    bool sorted; //!< false if objects have been appended out of tag order.
+    int lastTag; //!< tag of the last object appended (if sorted).
+    size_t numHoles; //!< number of null positions in the vector.
+    size_t numOpenIters; //!< number of iterators that haven't reached the end.
+    VectorOfTaggedObjectsIter myIter; //!< the iter for this object
+
+    void rebuild_index(const size_t &first= 0);
+    void sort_by_tag(void);
+    void tidy(void);
+  protected:
+    void clearComponents(void);
+
+  public:
+    VectorOfTaggedObjects(CommandEntity *owr,const std::string &containerName);
+    VectorOfTaggedObjects(const VectorOfTaggedObjects &);
+    VectorOfTaggedObjects &operator=(const VectorOfTaggedObjects &);
+    ~VectorOfTaggedObjects(void);
+
+    void compact(void);
+    //! @brief Return an iterator to the first position of the vector
+    //! in its current order (holes are null pointers; use getComponents
+    //! to traverse the objects sorted by tag).
+    inline const_iterator begin(void) const
+      { return theComponents.begin(); }
+    //! @brief Return an iterator past the last position of the vector.
+    inline const_iterator end(void) const
+      { return theComponents.end(); }
+
+    // public methods to populate a domain
+    int  setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+
+    bool removeComponent(int tag);    
+    int getNumComponents(void) const;
+    
+    TaggedObject *getComponentPtr(int tag);
+    const TaggedObject *getComponentPtr(int tag) const;
+    TaggedObjectIter &getComponents();
+
+    VectorOfTaggedObjectsIter getIter();
+
+    int reorder(const std::vector<int> &);
+    void setSortedByTag(const bool &);
+    //! @brief Return true if the objects are kept sorted by tag.
+    inline bool isSortedByTag(void) const
+      { return keepSorted; }
+    
+    TaggedObjectStorage *getEmptyCopy(void);
+    void clearAll(bool invokeDestructor = true);
+    
+    void Print(std::ostream &s, int flag =0) const;
+    friend class VectorOfTaggedObjectsIter;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,88 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjectsIter.cc
+
+#include <utility/tagged/storage/VectorOfTaggedObjectsIter.h>
+#include <utility/tagged/storage/VectorOfTaggedObjects.h>
+
+//! @brief Constructor.
+XC::VectorOfTaggedObjectsIter::VectorOfTaggedObjectsIter(VectorOfTaggedObjects &components)
+  : theComponents(components), currentIndex(0), open(false)  {}
+
+//! @brief Copy constructor.
+XC::VectorOfTaggedObjectsIter::VectorOfTaggedObjectsIter(const VectorOfTaggedObjectsIter &other)
+  : TaggedObjectIter(other), theComponents(other.theComponents),
+    currentIndex(other.currentIndex), open(other.open)
+  {
+    if(open)
+      theComponents.numOpenIters++;
+  }
+
+//! @brief Destructor.
+XC::VectorOfTaggedObjectsIter::~VectorOfTaggedObjectsIter(void)
+  { close(); }
+
+//! @brief Mark the iteration as finished.
+void XC::VectorOfTaggedObjectsIter::close(void)
+  {
+    if(open)
+      {
+        open= false;
+        theComponents.numOpenIters--;
+      }
+  }
+
+//! @brief Go to the first component.
+//!
+//! If no other iterator is open, the container sorts the objects
+//! added out of order and removes the holes left by the removed ones
+//! (see VectorOfTaggedObjects::tidy); otherwise the objects are not
+//! moved (the holes are skipped), so resetting an iterator doesn't
+//! change the position of the others.
+void XC::VectorOfTaggedObjectsIter::reset(void)
+  {
+    close();
+    theComponents.tidy();
+    open= true;
+    theComponents.numOpenIters++;
+    currentIndex= 0;
+  }
+
+//! @brief Return the next component (nullptr if there are no more).
+XC::TaggedObject *XC::VectorOfTaggedObjectsIter::operator()(void)
+  {
+    const std::vector<TaggedObject *> &v= theComponents.theComponents;
+    while(currentIndex<v.size())
+      {
+	TaggedObject *result= v[currentIndex];
+	currentIndex++;
+        if(result) // skip holes.
+	  return result;
+      }
+    close(); // end of the iteration.
+    return nullptr;
+  }
@@ -0,0 +1,63 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjectsIter.h
+
+#ifndef VectorOfTaggedObjectsIter_h
+#define VectorOfTaggedObjectsIter_h
+
+#include <utility/tagged/storage/TaggedObjectIter.h>
+#include <cstddef>
+
+namespace XC {
+class VectorOfTaggedObjects;
+
+//! @ingroup Tagged
+//
+//! @brief Iterator over the objects of a VectorOfTaggedObjects
+//! container (traverses the underlying vector in order).
+//!
+//! The iterator is open from its reset until it returns nullptr;
+//! while it's open the container doesn't move its objects.
+class VectorOfTaggedObjectsIter: public TaggedObjectIter
+  {
+  private:
+    VectorOfTaggedObjects &theComponents;
+    size_t currentIndex; //!< index of the next component.
+    bool open; //!< true if the iteration has not reached the end.
+    void close(void);
+  public:
+    VectorOfTaggedObjectsIter(VectorOfTaggedObjects &theComponents);
+    VectorOfTaggedObjectsIter(const VectorOfTaggedObjectsIter &);
+    ~VectorOfTaggedObjectsIter(void);
+    
+    virtual void reset(void);
+    virtual TaggedObject *operator()(void);    
+  };
+} // end of XC namespace
+
+#endif
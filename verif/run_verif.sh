@@ -465,12 +465,15 @@ echo "$BLEU" "  Mixed DOFs tests." "$NORMAL"
 python tests/nodes/mixed_dofs/test_quad_and_beam2d_01.py
 python tests/nodes/mixed_dofs/test_brick_and_shell_01.py
 python tests/nodes/mixed_dofs/test_truss_and_beam2d_01.py
+python tests/nodes/storage/test_contiguous_nodal_storage_01.py
+python tests/nodes/storage/test_vector_of_tagged_objects_01.py
 echo "$BLEU" "Elements tests." "$NORMAL"
 echo "$BLEU" "  Truss element tests." "$NORMAL"
 python tests/elements/trusses/truss_test_00.py
 python tests/elements/trusses/truss_test_01.py
 python tests/elements/trusses/truss_test_02.py
 python tests/elements/trusses/truss_test_03.py
+python tests/elements/trusses/truss_test_04.py
 echo "$BLEU" "  Coordinate transformations tests." "$NORMAL"
 python tests/elements/crd_transf/test_linear_crd_transf_2d_01.py
 python tests/elements/crd_transf/test_pdelta_crd_transf_2d_01.py
@@ -548,6 +551,7 @@ python tests/elements/beam_column/elastic_beam_3d/elastic_beam3d_deformation_pla
 python tests/elements/beam_column/elastic_beam_3d/test_beam3d_tributary_lengths_01.py
 python tests/elements/beam_column/elastic_beam_3d/elastic_beam3d_release_node_01.py
 python tests/elements/beam_column/elastic_beam_3d/elastic_beam3d_release_node_02.py
+python tests/elements/beam_column/elastic_beam_3d/elastic_beam3d_tangent_cache_01.py
 echo "$BLEU" "    Timoshenko beam 2D tests." "$NORMAL"
 python tests/elements/beam_column/timoshenko_beam2d_test1.py
 python tests/elements/beam_column/timoshenko_beam2d_sign_criteria_01.py
@@ -634,6 +638,9 @@ python tests/elements/shell/test_shell_mitc4_25.py
 python tests/elements/shell/test_shell_mitc4_26.py
 python tests/elements/shell/test_shell_mitc4_27.py
 python tests/elements/shell/test_shell_mitc4_28.py
+python tests/elements/shell/test_shell_mitc4_tangent_cache_01.py
+python tests/elements/shell/test_shell_q4_distorted_element_01.py
+python tests/elements/shell/test_asd_shell_q4_corotational_01.py
 python tests/elements/shell/test_shell_mitc9_01.py
 python tests/elements/shell/test_shell_mitc9_02.py
 python tests/elements/shell/test_shell_mitc9_03.py
@@ -657,6 +664,8 @@ python tests/elements/volume/test_brick_05.py
 python tests/elements/volume/test_extrapolation_matrix.py
 python tests/elements/volume/test_brick_shape_functions.py
 python tests/elements/volume/test_extrapolate_values_brick.py
+python tests/elements/volume/test_isoparametric_bricks_01.py
+python tests/elements/volume/test_isoparametric_bricks_patch_test.py
 
 echo "$BLEU" "  Bridge bearing modelization tests." "$NORMAL"
 python tests/elements/bridge_bearings/test_elastomeric_bearing_01.py
@@ -751,13 +760,23 @@ echo "$BLEU" "  Systems of equations tests." "$NORMAL"
 python tests/solution/system_of_eqn/superlu_solver_test_01.py
 python tests/solution/system_of_eqn/superlu_solver_test_02.py
 python tests/solution/system_of_eqn/umf_solver_test_01.py
+python tests/solution/system_of_eqn/static_condensation_test_01.py
 python tests/solution/system_of_eqn/mumps_solver_test_01.py
+python tests/solution/system_of_eqn/krylov_solver_test_01.py
+python tests/solution/system_of_eqn/multiple_rhs_solve_test_01.py
 echo "$BLEU" "  Ill conditioning tests." "$NORMAL"
 python tests/solution/ill_conditioning/ill_conditioning_01.py
 python tests/solution/ill_conditioning/get_floating_nodes_01.py
+echo "$BLEU" "  Solution algorithms tests." "$NORMAL"
+python tests/solution/algorithm/adaptive_newton_test_01.py
 echo "$BLEU" "  Integrators tests." "$NORMAL"
 python tests/solution/integrator/test_displacement_control_integrator_01.py
 python tests/solution/integrator/test_displacement_control_integrator_02.py
+python tests/solution/integrator/test_adaptive_step_control_01.py
+python tests/solution/integrator/test_adaptive_step_control_02.py
+python tests/solution/integrator/test_split_tangent_01.py
+python tests/solution/integrator/test_split_tangent_02.py
+python tests/solution/integrator/test_split_tangent_03.py
 python tests/solution/integrator/test_plain_linear_newmark_integrator.py
 python tests/solution/integrator/test_penalty_newton_raphson_newmark_integrator.py
 python tests/solution/integrator/test_transformation_newton_raphson_newmark_integrator.py
@@ -778,7 +797,13 @@ python tests/solution/constraint_handler/plain_handler_test_01.py
 python tests/solution/constraint_handler/transformation_handler_test_01.py
 python tests/solution/constraint_handler/transformation_handler_test_02.py
 python tests/solution/constraint_handler/transformation_handler_test_03.py
+python tests/solution/constraint_handler/transformation_handler_test_04.py
 python tests/solution/constraint_handler/lagrange_handler_test_01.py
+python tests/solution/constraint_handler/penalty_handler_sp_update_01.py
+
+## DOF numberer tests.
+echo "$BLEU" "  DOF numberer tests." "$NORMAL"
+python tests/solution/numberer/dof_numbering_cache_01.py
 
 ## Eigenvalues.
 echo "$BLEU" "  Eigenvalue solution tests." "$NORMAL"
@@ -803,6 +828,7 @@ python tests/solution/eigenvalues/modal_analysis/modal_analysis_test_03.py
 python tests/solution/eigenvalues/modal_analysis/modal_analysis_test_04.py
 python tests/solution/eigenvalues/modal_analysis/modal_analysis_test_05.py
 python tests/solution/eigenvalues/modal_analysis/modal_analysis_test_06.py
+python tests/solution/eigenvalues/modal_analysis/modal_analysis_test_07.py
 echo "$BLEU" "    Linear buckling analysis tests." "$NORMAL"
 python tests/solution/eigenvalues/linear_buckling_analysis/linear_buckling_column01.py
 python tests/solution/eigenvalues/linear_buckling_analysis/linear_buckling_column02.py
@@ -845,6 +871,7 @@ echo "$BLEU" "  Ground motion solution tests." "$NORMAL"
 python tests/solution/ground_motion/elastic_response_spectra.py
 python tests/solution/ground_motion/test_sdof_response_01.py
 python tests/solution/ground_motion/test_sdof_response_02.py
+python tests/solution/ground_motion/test_ground_motion_batch_01.py
 
 ## Convergence tests.
 echo "$BLEU" "  Convergence tests." "$NORMAL"
@@ -902,6 +929,7 @@ python tests/preprocessor/geom_entities/test_2d_scheme.py
 python tests/preprocessor/geom_entities/test_3d_scheme.py
 python tests/preprocessor/geom_entities/test_nearest_node_01.py
 python tests/preprocessor/geom_entities/test_nearest_element_01.py
+python tests/preprocessor/geom_entities/test_spatial_index_01.py
 python tests/preprocessor/geom_entities/split_line_01.py
 python tests/preprocessor/geom_entities/split_line_02.py
 python tests/preprocessor/geom_entities/split_line_03.py
@@ -920,6 +948,7 @@ python tests/preprocessor/geom_entities/test_block_05.py
 python tests/preprocessor/geom_entities/test_block_06.py
 python tests/preprocessor/geom_entities/test_block_07.py
 python tests/preprocessor/geom_entities/test_block_08.py
+python tests/preprocessor/geom_entities/test_structured_mesh_numbering_01.py
 python tests/preprocessor/geom_entities/test_is_closer_than_method_01.py
 python tests/preprocessor/geom_entities/test_is_closer_than_method_02.py
 python tests/preprocessor/geom_entities/test_is_closer_than_method_03.py
@@ -1402,6 +1431,7 @@ echo "$BLEU" "      steel materials." "$NORMAL"
 python tests/materials/xc_materials/uniaxial/steel/test_steel01.py
 python tests/materials/xc_materials/uniaxial/steel/test_steel02.py
 python tests/materials/xc_materials/uniaxial/steel/test_steel02_prestressing.py
+python tests/materials/xc_materials/uniaxial/steel/test_steel_shared_parameters.py
 echo "$BLEU" "      EHE reinforcing steel." "$NORMAL"
 python tests/materials/xc_materials/uniaxial/steel/test_B400S_01.py
 python tests/materials/xc_materials/uniaxial/steel/test_B400S_02.py
@@ -1557,6 +1587,8 @@ python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_06.py
 python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_07.py
 python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_08.py
 python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_09.py
+python tests/materials/xc_materials/sections/fiber_section/test_fiber_section_batch_solver_01.py
+python tests/materials/xc_materials/sections/fiber_section/test_fiber_section_batch_solver_02.py
 echo "$BLEU" "        Reinf layer definition tests." "$NORMAL"
 python tests/materials/xc_materials/sections/fiber_section/reinf_layers/test_straight_reinf_layer_01.py
 python tests/materials/xc_materials/sections/fiber_section/reinf_layers/test_straight_reinf_layer_02.py
@@ -2034,6 +2066,8 @@ python tests/database/sqlite_test_01.py
 python tests/database/sqlite_test_02.py
 python tests/database/sqlite_test_03.py
 python tests/database/readln_test_01.py
+python tests/database/test_domain_snapshots_01.py
+python tests/database/test_domain_snapshots_02.py
 
 echo "$BLEU" "Verifiyng misc. utilities." "$NORMAL"
 python tests/utility/rcond_01.py
@@ -2042,6 +2076,10 @@ python tests/utility/rcond_03.py
 python tests/utility/import_combinations.py
 python tests/utility/test_suitable_xzvector.py
 
+echo "$BLEU" "Verifying reliability analysis tools." "$NORMAL"
+python tests/reliability/latin_hypercube_generator_01.py
+python tests/reliability/sobol_sequence_generator_01.py
+
 echo "$BLEU" "Verifiying routines for rough calculations,..." "$NORMAL"
 python tests/rough_calculations/test_min_dim_abut_support.py
 python tests/rough_calculations/test_earth_pressure_kray.py
@@ -2106,6 +2144,9 @@ python tests/rough_calculations/reinforced_concrete/test_hinge_design_02.py
 echo "$BLEU" "Verifiying routines for post processing." "$NORMAL"
 python tests/postprocess/test_export_shell_internal_forces.py
 python tests/postprocess/test_get_connected_constraints.py
+python tests/postprocess/test_internal_forces_store_01.py
+python tests/postprocess/test_binary_columns_output_01.py
+python tests/postprocess/test_binary_columns_output_02.py
 echo "$BLEU" "  limit state checking." "$NORMAL"
 echo "$BLEU" "    SIA 262 limit state checking." "$NORMAL"
 python tests/postprocess/limit_state_checking/sia262/test_shell_normal_stresses_uls_checking.py
@@ -2209,6 +2250,7 @@ python tests/postprocess/vtk/test_display_zero_length_local_axes_02.py
 python tests/postprocess/vtk/test_display_reactions_01.py
 python tests/postprocess/vtk/test_display_eigenvectors_01.py
 python tests/postprocess/vtk/test_display_strong_weak_axis_01.py
+python tests/postprocess/vtk/test_vtu_export_01.py
 echo "$BLEU" "    Graphic output. Element properties." "$NORMAL"
 python tests/postprocess/vtk/element_properties/test_display_truss_areas.py
 python tests/postprocess/vtk/element_properties/test_display_element_thickness.py
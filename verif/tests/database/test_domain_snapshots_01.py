@@ -0,0 +1,116 @@
+# -*- coding: utf-8 -*-
+''' Check the in-memory snapshots of the domain state: the analysis
+    branches from a common state and returns to it.
+'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2024, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+
+# Load
+F= 1.5e3 # Load magnitude (kN)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+n1= nodes.newNodeXYZ(0,0.0,0.0)
+n2= nodes.newNodeXYZ(L,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+    
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+elementHandler= preprocessor.getElementHandler
+elementHandler.defaultTransformation= lin.name
+elementHandler.defaultMaterial= scc.name
+beam3d= elementHandler.newElement("ElasticBeam3d",xc.ID([n1.tag,n2.tag]))
+
+modelSpace.fixNode000_000(n1.tag)
+
+# Load definition.
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(n2.tag,xc.Vector([F,0,0,0,0,0]))
+lp1= modelSpace.newLoadPattern(name= '1')
+lp1.newNodalLoad(n2.tag,xc.Vector([0,F,0,0,0,0]))
+
+# Common state.
+modelSpace.addLoadCaseToDomain(lp0.name)
+analysis= predefined_solutions.simple_static_linear(feProblem)
+result= analysis.analyze(1)
+domain= preprocessor.getDomain
+domain.saveSnapshot('common')
+ux0= n2.getDisp[0]
+t0= domain.currentTime
+
+# First branch.
+modelSpace.addLoadCaseToDomain(lp1.name)
+result+= analysis.analyze(1)
+branchDisp= n2.getDisp
+uy1= branchDisp[1]
+ux1= branchDisp[0]
+modelSpace.removeLoadCaseFromDomain(lp1.name)
+
+# Back to the common state.
+result+= domain.restoreSnapshot('common')
+ux0r= n2.getDisp[0]
+uy0r= n2.getDisp[1]
+t0r= domain.currentTime
+
+# Second branch (the same as the first one).
+modelSpace.addLoadCaseToDomain(lp1.name)
+result+= analysis.analyze(1)
+uy2= n2.getDisp[1]
+ux2= n2.getDisp[0]
+
+snapshotNames= domain.getSnapshotNames()
+domain.clearSnapshots()
+
+uxTeor= F*L/(E*A)
+ratio1= abs(ux0-uxTeor)/uxTeor
+ratio2= abs(ux0r-ux0)/ux0
+ratio3= abs(uy0r)
+ratio4= abs(t0r-t0)
+ratio5= abs(uy2-uy1)/abs(uy1)
+ratio6= abs(ux2-ux1)/abs(ux1)
+
+''' 
+print("ux0= ", ux0, " ux0r= ", ux0r, " uxTeor= ", uxTeor)
+print("uy1= ", uy1, " uy2= ", uy2)
+print("t0= ", t0, " t0r= ", t0r)
+print(ratio1, ratio2, ratio3, ratio4, ratio5, ratio6)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) and (ratio1<1e-5) and (ratio2<1e-12) and (ratio3<1e-15) and (ratio4<1e-15) and (ratio5<1e-12) and (ratio6<1e-12) and (snapshotNames==['common']) and (len(domain.getSnapshotNames())==0):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,132 @@
+# -*- coding: utf-8 -*-
+''' Check the in-memory snapshots of the domain state with a material
+    that has yielded before the snapshot is taken: after restoring it
+    the committed stress, strain and plastic state of the material must
+    be the same as when the snapshot was taken.
+'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+# Material properties
+E= 2.0e11 # Elastic modulus (Pa)
+fy= 355e6 # Yield stress (Pa)
+b= 0.01 # Strain-hardening ratio.
+
+# Geometry
+A= 1e-4 # Cross section area (m2)
+L= 1.0 # Bar length (m)
+
+# Loads
+P0= 1.2*fy*A # Load beyond the elastic limit.
+dP= 0.2*fy*A # Additional load after the snapshot.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+n1= nodes.newNodeXY(0,0)
+n2= nodes.newNodeXY(L,0)
+
+# Materials definition
+steel= typical_materials.defSteel01(preprocessor, "steel", E= E, fy= fy, b= b)
+
+# Elements definition
+modelSpace.setElementDimension(2)
+modelSpace.setDefaultMaterial(steel)
+truss= modelSpace.newElement("Truss",nodeTags= [n1.tag,n2.tag])
+truss.sectionArea= A
+material= truss.getMaterial()
+
+# Constraints
+modelSpace.fixNode00(n1.tag)
+modelSpace.fixNodeF0(n2.tag)
+
+# Load definition.
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(n2.tag,xc.Vector([P0,0]))
+lp1= modelSpace.newLoadPattern(name= '1')
+lp1.newNodalLoad(n2.tag,xc.Vector([dP,0]))
+lp2= modelSpace.newLoadPattern(name= '2')
+lp2.newNodalLoad(n2.tag,xc.Vector([-P0,0]))
+
+def get_state():
+    ''' Return the displacement of the free node and the strain, stress
+        and tangent of the material.'''
+    return [n2.getDisp[0], material.getStrain(), material.getStress(), material.getTangent()]
+
+# The bar yields.
+modelSpace.addLoadCaseToDomain(lp0.name)
+analysis= predefined_solutions.plain_newton_raphson(feProblem)
+result= analysis.analyze(1)
+domain= preprocessor.getDomain
+domain.saveSnapshot('yielded')
+state0= get_state()
+
+# First branch: push the bar further.
+modelSpace.addLoadCaseToDomain(lp1.name)
+result+= analysis.analyze(1)
+state1= get_state()
+modelSpace.removeLoadCaseFromDomain(lp1.name)
+
+# Back to the yielded state.
+result+= domain.restoreSnapshot('yielded')
+state0r= get_state()
+
+# Second branch (the same as the first one).
+modelSpace.addLoadCaseToDomain(lp1.name)
+result+= analysis.analyze(1)
+state2= get_state()
+modelSpace.removeLoadCaseFromDomain(lp1.name)
+
+# Back to the yielded state again and unload the bar: the residual
+# strain is the plastic strain of the snapshot.
+result+= domain.restoreSnapshot('yielded')
+modelSpace.addLoadCaseToDomain(lp2.name)
+result+= analysis.analyze(1)
+state3= get_state()
+modelSpace.removeLoadCaseFromDomain(lp2.name)
+domain.clearSnapshots()
+
+# The material has yielded at the snapshot.
+epsY= fy/E
+sigma0= P0/A
+yieldOk= (state0[1]>epsY) and (abs(state0[3]-b*E)/(b*E)<1e-12)
+ratio0= abs(state0[2]-sigma0)/sigma0
+# The committed state is restored.
+ratio1= max(abs(r-s)/abs(s) for r, s in zip(state0r, state0))
+# The plastic state is restored: the bar follows the same path.
+ratio2= max(abs(r-s)/abs(s) for r, s in zip(state2, state1))
+# Residual strain after unloading.
+epsPlastic= state0[1]-state0[2]/E
+ratio3= abs(state3[1]-epsPlastic)/epsPlastic
+ratio4= abs(state3[2])/sigma0
+
+'''
+print("state0= ", state0)
+print("state0r= ", state0r)
+print("state1= ", state1)
+print("state2= ", state2)
+print("state3= ", state3, " plastic strain: ", epsPlastic)
+print(ratio0, ratio1, ratio2, ratio3, ratio4)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) and yieldOk and (ratio0<1e-9) and (ratio1<1e-12) and (ratio2<1e-12) and (ratio3<1e-9) and (ratio4<1e-9):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,112 @@
+# -*- coding: utf-8 -*-
+''' Check the tangent stiffness cache of the ElasticBeam3d element: the
+    cached matrix must be computed again after a change of the section
+    properties, of the nodal coordinates or of the orientation of the
+    local axes, and scaled (without being computed again) when the
+    element is deactivated.
+Home made test'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+import geom
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e11 # Young modulus.
+G= E/2.6 # Shear modulus.
+A= 1e-2 # Cross-section area.
+Iz= 2e-5 # Moment of inertia about z axis.
+Iy= 1e-5 # Moment of inertia about y axis.
+J= 1e-6 # Torsional constant.
+L= 2.0 # Element length.
+deadSRF= 1e-3 # Stiffness reduction factor of the dead elements.
+
+# Define FE problem.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+n1= nodes.newNodeXYZ(0,0,0)
+n2= nodes.newNodeXYZ(L,0,0)
+n3= nodes.newNodeXYZ(0,L,0)
+n4= nodes.newNodeXYZ(L,L,0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,0,1]))
+pDelta= modelSpace.newPDeltaCrdTransf("pDelta",xc.Vector([0,0,1]))
+section= typical_materials.defElasticSection3d(preprocessor, "section", A, E, G, Iz, Iy, J)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= section.name
+elements.defaultTransformation= lin.name
+beam= elements.newElement("ElasticBeam3d",xc.ID([n1.tag,n2.tag]))
+elements.defaultTransformation= pDelta.name
+beamPDelta= elements.newElement("ElasticBeam3d",xc.ID([n3.tag,n4.tag]))
+
+kAxial= E*A/L
+kBending= 12*E*Iz/L**3
+
+# The tangent stiffness is computed once.
+constantTangent1= beam.hasConstantTangent()
+constantTangent2= beamPDelta.hasConstantTangent()
+K= beam.getTangentStiff()
+k00= K(0,0); k11= K(1,1)
+version0= beam.tangentStiffVersion
+K= beam.getTangentStiff()
+version1= beam.tangentStiffVersion
+err= (k00-kAxial)**2/kAxial**2+(k11-kBending)**2/kBending**2
+err+= (K(0,0)-k00)**2/kAxial**2
+
+# Changing the section properties computes the matrix again.
+beam.sectionProperties.Iz= 2*Iz
+K= beam.getTangentStiff()
+version2= beam.tangentStiffVersion
+err+= (K(0,0)-kAxial)**2/kAxial**2+(K(1,1)-2*kBending)**2/kBending**2
+
+# Dead element: the cached matrix is scaled, not computed again.
+mesh= preprocessor.getDomain.getMesh
+mesh.setDeadSRF(deadSRF)
+beam.kill()
+K= beam.getTangentStiff()
+err+= (K(0,0)-deadSRF*kAxial)**2/(deadSRF*kAxial)**2
+beam.alive()
+K= beam.getTangentStiff()
+err+= (K(0,0)-kAxial)**2/kAxial**2
+version3= beam.tangentStiffVersion
+
+# Rotating the element (same length, so the basic stiffness doesn't
+# change): the new local axes of the transformation must be detected.
+n2.setPos(geom.Pos3d(0,L,0))
+beam.resetNodalCoordinates()
+K= beam.getTangentStiff()
+version4= beam.tangentStiffVersion
+err+= (K(0,0)-2*kBending)**2/kBending**2+(K(1,1)-kAxial)**2/kAxial**2
+err+= (K(2,2)-kBending/2)**2/kBending**2
+
+# Turning the local axes around the element axis (same nodes and basic
+# stiffness): the strong and weak axes swap.
+beam.getCoordTransf.xzVector= xc.Vector([1,0,0])
+beam.resetNodalCoordinates()
+K= beam.getTangentStiff()
+version5= beam.tangentStiffVersion
+err+= (K(0,0)-kBending/2)**2/kBending**2+(K(2,2)-2*kBending)**2/kBending**2
+err= err**0.5
+
+'''
+print('versions: ', version0, version1, version2, version3, version4, version5)
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if constantTangent1 and (not constantTangent2) and (version0==1) and (version1==1) and (version2==2) and (version3==2) and (version4==3) and (version5==4) and (err<1e-10):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,178 @@
+# -*- coding: utf-8 -*-
+''' Check the co-rotational ASDShellQ4 element:
+
+    - a large rigid body rotation produces no nodal forces.
+    - a large rigid body rotation combined with a small membrane
+      stretch produces the consistent nodal loads of the constant
+      membrane forces, rotated with the element.
+    - after a change of the nodal coordinates (resetNodalCoordinates)
+      the strain-displacement data and the reference orientation of
+      the element are computed again: its stiffness matrix and its
+      resisting force are the same as those of a reference element
+      that computes them for the first time.
+
+    Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc
+import geom
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e6 # Young modulus.
+nu= 0.3 # Poisson's ratio.
+t= 0.1 # Thickness.
+dens= 1.33 # Specific mass.
+Dm= E*t/(1.0-nu**2) # Membrane stiffness.
+
+# Define FE problem.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodeHandler= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodeHandler)
+shellMat= typical_materials.defElasticMembranePlateSection(preprocessor, "shellMat", E, nu, dens, t)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= shellMat.name
+
+# First geometry: distorted element on the XY plane.
+corners1= [(0.1,0.0,0.0), (2.0,0.3,0.0), (2.4,1.8,0.0), (-0.2,1.5,0.0)]
+# Second geometry: another distorted element on an inclined plane.
+corners2= [(x, y, 0.3*x+0.2*y) for (x,y) in [(0.0,0.0), (1.5,-0.2), (1.8,1.1), (0.3,1.4)]]
+offset= 10.0 # Position of the reference element.
+
+# Element under test (co-rotational by default).
+nodesA= [nodeHandler.newNodeXYZ(x, y, z) for (x, y, z) in corners1]
+shell= elements.newElement("ASDShellQ4", xc.ID([n.tag for n in nodesA]))
+# Reference element with the second geometry.
+nodesR= [nodeHandler.newNodeXYZ(x+offset, y, z) for (x, y, z) in corners2]
+shellRef= elements.newElement("ASDShellQ4", xc.ID([n.tag for n in nodesR]))
+
+def rotation_matrix(axis, angle):
+    ''' Return the rotation matrix (list of rows) that corresponds to
+        the axis and the angle arguments (Rodrigues' formula).'''
+    norm= math.sqrt(sum(a**2 for a in axis))
+    n= [a/norm for a in axis]
+    c= math.cos(angle); s= math.sin(angle)
+    W= [[0.0,-n[2],n[1]],[n[2],0.0,-n[0]],[-n[1],n[0],0.0]]
+    return [[c*(i==j)+s*W[i][j]+(1.0-c)*n[i]*n[j] for j in range(0,3)] for i in range(0,3)]
+
+def mat_vec(A, v):
+    return [sum(A[i][j]*v[j] for j in range(0,3)) for i in range(0,3)]
+
+axis= [1.0,2.0,3.0]; angle= 0.8
+rotVector= [angle*a/math.sqrt(sum(b**2 for b in axis)) for a in axis]
+R= rotation_matrix(axis, angle)
+
+def impose_displacements(nodes, element, stretch= None, perturbation= None):
+    ''' Impose on the nodes a rigid body rotation around the center of
+        the element, optionally after a membrane stretch and with a
+        perturbation, and return the vector of nodal displacements.
+
+    :param nodes: nodes of the element.
+    :param element: element to update.
+    :param stretch: symmetric in-plane displacement gradient (list of rows).
+    :param perturbation: function that returns a perturbation of the
+                         six displacements of the i-th node.
+    '''
+    positions= list()
+    for n in nodes:
+        pos= n.getInitialPos3d
+        positions.append([pos.x, pos.y, pos.z])
+    center= [sum(p[k] for p in positions)/4.0 for k in range(0,3)]
+    values= list()
+    for i, (n, X) in enumerate(zip(nodes, positions)):
+        X0= [X[k]-center[k] for k in range(0,3)]
+        Xd= list(X0)
+        if(stretch):
+            for a in range(0,2):
+                Xd[a]+= stretch[a][0]*X0[0]+stretch[a][1]*X0[1]
+        Xd= mat_vec(R, Xd)
+        u= [Xd[k]-X0[k] for k in range(0,3)]+rotVector
+        if(perturbation):
+            u= [a+b for a, b in zip(u, perturbation(i))]
+        n.setTrialDisp(xc.Vector(u))
+        values.extend(u)
+    element.update()
+    return xc.Vector(values)
+
+def reset_displacements(nodes, element):
+    ''' Set the displacements of the nodes to zero.'''
+    for n in nodes:
+        n.setTrialDisp(xc.Vector([0.0]*6))
+    element.update()
+
+def relDiff(A, B):
+    ''' Relative difference between two matrices or vectors.'''
+    return (A-B).Norm()/B.Norm()
+
+errors= list()
+isCorotational= shell.corotational
+K0= shell.getTangentStiff()*1.0
+
+# Large rigid body rotation.
+u= impose_displacements(nodesA, shell)
+errors.append(xc.Vector(shell.getResistingForce()).Norm()/(K0.Norm()*u.Norm()))
+
+# Large rigid body rotation and small membrane stretch.
+H= [[2e-5,-1e-5],[-1e-5,3e-5]]
+u= impose_displacements(nodesA, shell, stretch= H)
+epsM= [H[0][0], H[1][1], H[0][1]+H[1][0]]
+N= [[Dm*(epsM[0]+nu*epsM[1]), Dm*(1.0-nu)/2.0*epsM[2]],
+    [Dm*(1.0-nu)/2.0*epsM[2], Dm*(epsM[1]+nu*epsM[0])]]
+refForces= list()
+for i in range(0,4):
+    f= [0.0, 0.0, 0.0]
+    for a, b in [((i-1)%4, i), (i, (i+1)%4)]:
+        xa, ya, za= corners1[a]; xb, yb, zb= corners1[b]
+        n= (yb-ya, xa-xb) # outward normal times the side length.
+        for k in range(0,2):
+            f[k]+= 0.5*(N[k][0]*n[0]+N[k][1]*n[1])
+    refForces.extend(mat_vec(R, f)+[0.0, 0.0, 0.0])
+refForces= xc.Vector(refForces)
+errors.append(relDiff(xc.Vector(shell.getResistingForce()), refForces))
+reset_displacements(nodesA, shell)
+
+# Change the nodal coordinates: resetNodalCoordinates must invalidate
+# the strain-displacement data and update the reference orientation.
+for n, (x, y, z) in zip(nodesA, corners2):
+    n.setPos(geom.Pos3d(x, y, z))
+shell.resetNodalCoordinates()
+K1= shell.getTangentStiff()*1.0
+KRef= shellRef.getTangentStiff()*1.0
+errors.append(relDiff(K1, KRef))
+changed= (relDiff(K1, K0)>0.1)
+## No forces without displacements.
+errors.append(xc.Vector(shell.getResistingForce()).Norm()/(K1.Norm()*u.Norm()))
+## Large rigid body rotation.
+u= impose_displacements(nodesA, shell)
+errors.append(xc.Vector(shell.getResistingForce()).Norm()/(K1.Norm()*u.Norm()))
+## Large rigid body rotation and deformation (imposed in one step on
+## both elements, the rotations are not additive).
+def perturbation(i):
+    return [1e-4*math.sin(i+k) for k in range(0,6)]
+reset_displacements(nodesA, shell)
+impose_displacements(nodesA, shell, perturbation= perturbation)
+impose_displacements(nodesR, shellRef, perturbation= perturbation)
+errors.append(relDiff(xc.Vector(shell.getResistingForce()), xc.Vector(shellRef.getResistingForce())))
+errors.append(relDiff(shell.getTangentStiff()*1.0, shellRef.getTangentStiff()*1.0))
+
+'''
+print(errors)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if isCorotational and changed and (max(errors[:2])<1e-3) and (max(errors[2:])<1e-9):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
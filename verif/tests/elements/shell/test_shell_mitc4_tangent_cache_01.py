@@ -0,0 +1,108 @@
+# -*- coding: utf-8 -*-
+''' Check the tangent stiffness cache of the ShellMITC4 element: the
+    cached matrix must be computed again after a change of the section
+    materials or of the nodal coordinates, and scaled (without being
+    computed again) when the element is deactivated. The matrices are
+    compared with the ones of reference elements that compute them for
+    the first time.
+Home made test'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+import geom
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e6 # Young modulus.
+nu= 0.3 # Poisson's ratio.
+h= 0.1 # Thickness.
+dens= 1.33 # Specific mass.
+deadSRF= 1e-3 # Stiffness reduction factor of the dead elements.
+
+# Define FE problem.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+def newSquareNodes(x0, a, b):
+    ''' Create the nodes of an a x b rectangle with its first corner
+        at (x0,0,0).'''
+    return [nodes.newNodeXYZ(x0,0,0), nodes.newNodeXYZ(x0+a,0,0), nodes.newNodeXYZ(x0+a,b,0), nodes.newNodeXYZ(x0,b,0)]
+
+shellMat= typical_materials.defElasticMembranePlateSection(preprocessor, "shellMat", E, nu, dens, h)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= shellMat.name
+# Element under test.
+nodesA= newSquareNodes(0.0, 1.0, 1.0)
+shell= elements.newElement("ShellMITC4",xc.ID([n.tag for n in nodesA]))
+# Reference element with the same geometry.
+nodesR1= newSquareNodes(10.0, 1.0, 1.0)
+shellRef1= elements.newElement("ShellMITC4",xc.ID([n.tag for n in nodesR1]))
+# Reference element with the geometry of the last stage.
+nodesR2= newSquareNodes(20.0, 2.0, 1.0)
+shellRef2= elements.newElement("ShellMITC4",xc.ID([n.tag for n in nodesR2]))
+
+def relDiff(KA, KB):
+    ''' Relative difference between two matrices.'''
+    return (KA-KB).Norm()/KB.Norm()
+
+# The tangent stiffness is computed once.
+constantTangent= shell.hasConstantTangent()
+K0= shell.getTangentStiff()*1.0
+version0= shell.tangentStiffVersion
+K1= shell.getTangentStiff()*1.0
+version1= shell.tangentStiffVersion
+err= relDiff(K1, K0)
+
+# Changing the section materials computes the matrix again.
+for elem in [shell, shellRef1, shellRef2]:
+    for mat in elem.physicalProperties.getVectorMaterials:
+        mat.E= 2*E
+K2= shell.getTangentStiff()*1.0
+version2= shell.tangentStiffVersion
+KRef1= shellRef1.getTangentStiff()*1.0
+err+= relDiff(K2, KRef1)
+changed= (relDiff(K2, K0)>0.1)
+
+# Dead element: the cached matrix is scaled, not computed again.
+mesh= preprocessor.getDomain.getMesh
+mesh.setDeadSRF(deadSRF)
+shell.kill()
+K3= shell.getTangentStiff()*1.0
+err+= relDiff(K3, KRef1*deadSRF)
+shell.alive()
+K4= shell.getTangentStiff()*1.0
+err+= relDiff(K4, KRef1)
+version3= shell.tangentStiffVersion
+
+# Changing the nodal coordinates: resetNodalCoordinates must invalidate
+# the cache (the section tangents and the drilling stiffness are the same).
+nodesA[1].setPos(geom.Pos3d(2.0,0,0))
+nodesA[2].setPos(geom.Pos3d(2.0,1.0,0))
+shell.resetNodalCoordinates()
+K5= shell.getTangentStiff()*1.0
+version4= shell.tangentStiffVersion
+KRef2= shellRef2.getTangentStiff()*1.0
+err+= relDiff(K5, KRef2)
+
+'''
+print('versions: ', version0, version1, version2, version3, version4)
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if constantTangent and changed and (version0==1) and (version1==1) and (version2==2) and (version3==2) and (version4==3) and (err<1e-10):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,183 @@
+# -*- coding: utf-8 -*-
+''' Check the stiffness matrix and the resisting force of the 4-node
+    shell elements (ShellMITC4 and ASDShellQ4 with and without the AGQI
+    enhancement of the membrane strains) on a distorted element against
+    closed form values:
+
+    - the stiffness matrix is symmetric and the rigid body motions are
+      in its null space.
+    - for a linear in-plane displacement field (with the drilling
+      rotation equal to the rigid body rotation) and for a constant
+      curvature field (with the rotations equal to the slopes of the
+      deflection) the stiffness matrix gives the exact strain energy
+      and the nodal forces are the consistent nodal loads of the
+      constant membrane forces and bending moments on the element
+      sides.
+
+    Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e6 # Young modulus.
+nu= 0.3 # Poisson's ratio.
+t= 0.1 # Thickness.
+dens= 1.33 # Specific mass.
+Dm= E*t/(1.0-nu**2) # Membrane stiffness.
+Db= E*t**3/12.0/(1.0-nu**2) # Bending stiffness.
+
+# Distorted element (counterclockwise nodes on the XY plane).
+corners= [(0.1,0.0), (2.0,0.3), (2.4,1.8), (-0.2,1.5)]
+area= 0.5*sum(corners[i][0]*corners[(i+1)%4][1]-corners[(i+1)%4][0]*corners[i][1] for i in range(0,4))
+
+def side_normals(i):
+    ''' Return the outward normals (times the side length) of the two
+        sides of the element that meet at the i-th node.'''
+    retval= list()
+    for a, b in [((i-1)%4, i), (i, (i+1)%4)]:
+        xa, ya= corners[a]; xb, yb= corners[b]
+        retval.append((yb-ya, xa-xb))
+    return retval
+
+def consistent_forces(S):
+    ''' Return the nodal forces corresponding to the constant symmetric
+        tensor S (membrane forces or bending moments) on the sides of
+        the element: 0.5*sum(S*n*L) for the two sides of each node.
+
+    :param S: tensor components [[Sxx, Sxy],[Sxy, Syy]].
+    '''
+    retval= list()
+    for i in range(0,4):
+        f= [0.0, 0.0]
+        for n in side_normals(i):
+            for a in range(0,2):
+                f[a]+= 0.5*(S[a][0]*n[0]+S[a][1]*n[1])
+        retval.append(f)
+    return retval
+
+def create_element(elementType, useEAS= None):
+    ''' Create the element to check.
+
+    :param elementType: type of the element.
+    :param useEAS: if not None, use (or not) the AGQI enhancement of
+                   the ASDShellQ4 element (linear kinematics).
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor= feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics3D(nodeHandler)
+    nodes= [nodeHandler.newNodeXYZ(x, y, 0.0) for (x, y) in corners]
+    shellMat= typical_materials.defElasticMembranePlateSection(preprocessor, "shellMat", E, nu, dens, t)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= shellMat.name
+    element= elements.newElement(elementType, xc.ID([n.tag for n in nodes]))
+    if(useEAS is not None):
+        element.corotational= False
+        element.useEAS= useEAS
+    return feProblem, nodes, element
+
+def impose_displacements(nodes, element, field):
+    ''' Impose the displacements obtained from the field argument
+        on the nodes of the element and return the vector of nodal
+        displacements.
+
+    :param nodes: nodes of the element.
+    :param element: element to update.
+    :param field: function that returns the six displacements of
+                  the point (x,y).
+    '''
+    values= list()
+    for n in nodes:
+        pos= n.getInitialPos3d
+        u= field(pos.x, pos.y)
+        n.setTrialDisp(xc.Vector(u))
+        values.extend(u)
+    element.update()
+    return xc.Vector(values)
+
+# Linear in-plane field: u= c+H*x, drilling rotation equal to the
+# rigid body rotation.
+c= [1e-4,-2e-4]
+H= [[1e-3,2e-4],[-5e-4,-7e-4]]
+def membrane_field(x, y):
+    return [c[0]+H[0][0]*x+H[0][1]*y, c[1]+H[1][0]*x+H[1][1]*y, 0.0, 0.0, 0.0, 0.5*(H[1][0]-H[0][1])]
+epsM= [H[0][0], H[1][1], H[0][1]+H[1][0]]
+N= [[Dm*(epsM[0]+nu*epsM[1]), Dm*(1.0-nu)/2.0*epsM[2]],
+    [Dm*(1.0-nu)/2.0*epsM[2], Dm*(epsM[1]+nu*epsM[0])]]
+membraneEnergy= area*(N[0][0]*epsM[0]+N[1][1]*epsM[1]+N[0][1]*epsM[2])
+membraneForces= list()
+for f in consistent_forces(N):
+    membraneForces.extend([f[0], f[1], 0.0, 0.0, 0.0, 0.0])
+membraneForces= xc.Vector(membraneForces)
+
+# Constant curvature field: w= 1/2*(kx*x^2+ky*y^2)+kxy*x*y, the
+# rotations are the slopes of the deflection (zero transverse shear).
+kx= 2e-3; ky= -1e-3; kxy= 5e-4
+def bending_field(x, y):
+    w= 0.5*(kx*x**2+ky*y**2)+kxy*x*y
+    return [0.0, 0.0, w, ky*y+kxy*x, -(kx*x+kxy*y), 0.0]
+M= [[Db*(kx+nu*ky), Db*(1.0-nu)*kxy],
+    [Db*(1.0-nu)*kxy, Db*(ky+nu*kx)]]
+bendingEnergy= area*(M[0][0]*kx+M[1][1]*ky+2.0*M[0][1]*kxy)
+bendingForces= list()
+for g in consistent_forces(M):
+    # theta_x is the slope along y and theta_y minus the slope along x.
+    bendingForces.extend([0.0, 0.0, 0.0, g[1], -g[0], 0.0])
+bendingForces= xc.Vector(bendingForces)
+
+# Rigid body motions: translations and infinitesimal rotations.
+rigidBodyMotions= [lambda x, y: [1.0, 0.0, 0.0, 0.0, 0.0, 0.0],
+                   lambda x, y: [0.0, 1.0, 0.0, 0.0, 0.0, 0.0],
+                   lambda x, y: [0.0, 0.0, 1.0, 0.0, 0.0, 0.0],
+                   lambda x, y: [0.0, 0.0, y, 1.0, 0.0, 0.0],
+                   lambda x, y: [0.0, 0.0, -x, 0.0, 1.0, 0.0],
+                   lambda x, y: [-y, x, 0.0, 0.0, 0.0, 1.0]]
+
+cases= [('ShellMITC4', None), ('ASDShellQ4', False), ('ASDShellQ4', True)]
+errors= list()
+for elementType, useEAS in cases:
+    feProblem, nodes, element= create_element(elementType, useEAS)
+    ## Symmetry.
+    K= xc.Matrix(element.getTangentStiff())
+    Kmax= max(abs(K(i,j)) for i in range(0,24) for j in range(0,24))
+    errors.append(max(abs(K(i,j)-K(j,i)) for i in range(0,24) for j in range(0,24))/Kmax)
+    ## Rigid body motions.
+    for field in rigidBodyMotions:
+        uRigid= impose_displacements(nodes, element, field)
+        errors.append((K*uRigid).Norm()/(Kmax*uRigid.Norm()))
+    ## Linear in-plane field.
+    u= impose_displacements(nodes, element, membrane_field)
+    K= xc.Matrix(element.getTangentStiff())
+    errors.append(abs(u.dot(K*u)-membraneEnergy)/membraneEnergy)
+    errors.append((K*u-membraneForces).Norm()/membraneForces.Norm())
+    R= xc.Vector(element.getResistingForce())
+    errors.append((R-membraneForces).Norm()/membraneForces.Norm())
+    ## Constant curvature field.
+    u= impose_displacements(nodes, element, bending_field)
+    K= xc.Matrix(element.getTangentStiff())
+    errors.append(abs(u.dot(K*u)-bendingEnergy)/bendingEnergy)
+    errors.append((K*u-bendingForces).Norm()/bendingForces.Norm())
+    R= xc.Vector(element.getResistingForce())
+    errors.append((R-bendingForces).Norm()/bendingForces.Norm())
+
+'''
+print(errors)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(max(errors)<1e-9):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
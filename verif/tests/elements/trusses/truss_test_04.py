@@ -0,0 +1,76 @@
+# -*- coding: utf-8 -*-
+''' Check the tangent stiffness cache of the elements whose tangent doesn't
+    depend on their state (truss with elastic material).
+Home made test'''
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+# Define FE problem.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodeHandler= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodeHandler)
+
+## Define mesh.
+### Define nodes.
+l= 10 #Bar length
+n1= nodeHandler.newNodeXY(0,0)
+n2= nodeHandler.newNodeXY(l,0)
+n3= nodeHandler.newNodeXY(2*l,0)
+
+### Define materials.
+E= 30e6 #Young modulus
+A= 1e-2 # Cross-section area.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+elastPP= typical_materials.defElasticPPMaterial(preprocessor, "elastPP", E= E, fyp= 275e6, fyn= -275e6)
+
+### Define elements.
+modelSpace.setElementDimension(2) # Truss defined in a two-dimensional space.
+modelSpace.setDefaultMaterial(elast)
+truss1= modelSpace.newElement("Truss",nodeTags= [n1.tag,n2.tag])
+truss1.sectionArea= A
+modelSpace.setDefaultMaterial(elastPP)
+truss2= modelSpace.newElement("Truss",nodeTags= [n2.tag,n3.tag])
+truss2.sectionArea= A
+
+# Elastic truss: the tangent stiffness is computed once.
+constantTangent1= truss1.hasConstantTangent()
+k0= truss1.getTangentStiff()(0,0)
+version0= truss1.tangentStiffVersion
+k1= truss1.getTangentStiff()(0,0)
+version1= truss1.tangentStiffVersion
+# Changing the material properties invalidates the cached matrix.
+truss1.getMaterial().E= 2*E
+k2= truss1.getTangentStiff()(0,0)
+version2= truss1.tangentStiffVersion
+
+# Elastic-perfectly plastic truss: no cache.
+constantTangent2= truss2.hasConstantTangent()
+
+ratio0= abs(k0-E*A/l)/(E*A/l)
+ratio1= abs(k1-k0)/k0
+ratio2= abs(k2-2*k0)/k0
+
+'''
+print('k0= ', k0, 'version: ', version0)
+print('k1= ', k1, 'version: ', version1)
+print('k2= ', k2, 'version: ', version2)
+print(ratio0, ratio1, ratio2)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if constantTangent1 and (not constantTangent2) and (version0==1) and (version1==1) and (version2==2) and (abs(ratio0)<1e-12) and (abs(ratio1)<1e-12) and (abs(ratio2)<1e-12):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,188 @@
+# -*- coding: utf-8 -*-
+''' Check the stiffness matrix and the resisting force of the
+    isoparametric hexahedra (EightNodeBrick, TwentyNodeBrick and
+    TwentySevenNodeBrick) against closed form values:
+
+    - the nodal forces corresponding to an uniform stress state in a
+      cube are the consistent nodal loads of the tractions on its faces.
+    - the stiffness matrix is symmetric, the rigid body motions are
+      in its null space and, for a linear displacement field on an
+      (affinely) distorted element, it gives the exact strain energy
+      and the same nodal forces as the resisting force.
+
+    Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+# Material properties.
+E= 2.0e5 # Young modulus.
+nu= 0.25 # Poisson's ratio.
+G= E/(2.0*(1.0+nu)) # Shear modulus.
+lmbda= E*nu/((1.0+nu)*(1.0-2.0*nu)) # Lamé's first parameter.
+
+# Natural coordinates of the nodes of each element type.
+corners= [(1,1,1), (-1,1,1), (-1,-1,1), (1,-1,1), (1,1,-1), (-1,1,-1), (-1,-1,-1), (1,-1,-1)]
+naturalCoordinates= {'EightNodeBrick': corners,
+                     'TwentyNodeBrick': corners+[(0,1,1), (-1,0,1), (0,-1,1), (1,0,1),
+                                                 (0,1,-1), (-1,0,-1), (0,-1,-1), (1,0,-1),
+                                                 (1,1,0), (-1,1,0), (-1,-1,0), (1,-1,0)],
+                     'TwentySevenNodeBrick': corners+[(1,1,0), (-1,1,0), (-1,-1,0), (1,-1,0),
+                                                      (0,1,1), (-1,0,1), (0,-1,1), (1,0,1),
+                                                      (0,1,-1), (-1,0,-1), (0,-1,-1), (1,0,-1),
+                                                      (0,1,0), (-1,0,0), (0,-1,0), (1,0,0),
+                                                      (0,0,1), (0,0,-1), (0,0,0)]}
+
+def face_weight(elementType, r, s):
+    ''' Return the fraction of an uniform traction on a face of the
+        cube that corresponds to the node with in-face natural
+        coordinates (r,s).
+
+    :param elementType: type of the element.
+    :param r, s: natural coordinates of the node in the face.
+    '''
+    if(elementType=='EightNodeBrick'):
+        retval= 1/4.0
+    elif(elementType=='TwentyNodeBrick'):
+        if((r!=0) and (s!=0)): # corner node.
+            retval= -1/12.0
+        else: # mid-side node.
+            retval= 1/3.0
+    else: # Simpson's rule weights.
+        w= {-1: 1/6.0, 0: 4/6.0, 1: 1/6.0}
+        retval= w[r]*w[s]
+    return retval
+
+def create_element(elementType, M, a, x0):
+    ''' Create an element whose nodes are at: x0+M*(a/2*xi) where xi are
+        the natural coordinates of the nodes.
+
+    :param elementType: type of the element.
+    :param M: linear transformation (list of rows).
+    :param a: side of the cube (before the transformation).
+    :param x0: position of the center of the element.
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor= feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics3D(nodeHandler)
+    nodes= list()
+    for xi in naturalCoordinates[elementType]:
+        pos= [x0[i]+sum(M[i][j]*a/2.0*xi[j] for j in range(0,3)) for i in range(0,3)]
+        nodes.append(nodeHandler.newNodeXYZ(pos[0], pos[1], pos[2]))
+    # Isotropic material defined as a cross-anisotropic one (the
+    # elements need a material that implements the tensor interface).
+    mat= typical_materials.defElasticCrossAnisotropic3d(preprocessor, 'mat', Eh= E, Ev= E, nuhv= nu, nuhh= nu, Ghv= G)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= mat.name
+    element= elements.newElement(elementType, xc.ID([n.tag for n in nodes]))
+    return feProblem, nodes, element
+
+def impose_linear_field(nodes, element, c, H):
+    ''' Impose the displacement field u= c+H*x on the nodes of the element
+        and return the vector of nodal displacements.
+
+    :param nodes: nodes of the element.
+    :param element: element to update.
+    :param c: rigid body translation.
+    :param H: displacement gradient (list of rows).
+    '''
+    values= list()
+    for n in nodes:
+        pos= n.getInitialPos3d
+        x= [pos.x, pos.y, pos.z]
+        u= [c[i]+sum(H[i][j]*x[j] for j in range(0,3)) for i in range(0,3)]
+        n.setTrialDisp(xc.Vector(u))
+        values.extend(u)
+    element.update()
+    return xc.Vector(values)
+
+def strain_energy_density(H):
+    ''' Return the strain energy density (times two) corresponding to
+        the displacement gradient argument.
+
+    :param H: displacement gradient (list of rows).
+    '''
+    eps= [[0.5*(H[i][j]+H[j][i]) for j in range(0,3)] for i in range(0,3)]
+    trace= eps[0][0]+eps[1][1]+eps[2][2]
+    return lmbda*trace**2+2.0*G*sum(eps[i][j]**2 for i in range(0,3) for j in range(0,3))
+
+def determinant(M):
+    ''' Return the determinant of the 3x3 matrix argument.'''
+    return M[0][0]*(M[1][1]*M[2][2]-M[1][2]*M[2][1])-M[0][1]*(M[1][0]*M[2][2]-M[1][2]*M[2][0])+M[0][2]*(M[1][0]*M[2][1]-M[1][1]*M[2][0])
+
+identity= [[1.0,0.0,0.0],[0.0,1.0,0.0],[0.0,0.0,1.0]]
+distortion= [[1.0,0.2,0.1],[0.05,1.0,0.15],[0.1,-0.1,1.0]]
+a= 0.5 # side of the cube.
+x0= [1.0,2.0,3.0] # center of the element.
+c= [1e-4,-2e-4,3e-4] # rigid body translation.
+
+errors= list()
+for elementType in naturalCoordinates:
+    xis= naturalCoordinates[elementType]
+    ## Uniform stress state on a cube.
+    feProblem, nodes, element= create_element(elementType, identity, a, x0)
+    strains= [1e-3,-2e-4,5e-4]
+    H= [[strains[0],0.0,0.0],[0.0,strains[1],0.0],[0.0,0.0,strains[2]]]
+    u= impose_linear_field(nodes, element, c, H)
+    stresses= [lmbda*sum(strains)+2.0*G*e for e in strains]
+    refForces= list()
+    for xi in xis:
+        for k in range(0,3):
+            f= 0.0
+            if(abs(xi[k])==1):
+                r, s= [xi[j] for j in range(0,3) if j!=k]
+                f= xi[k]*stresses[k]*a**2*face_weight(elementType, r, s)
+            refForces.append(f)
+    refForces= xc.Vector(refForces)
+    R= xc.Vector(element.getResistingForce())
+    errors.append((R-refForces).Norm()/refForces.Norm())
+    K= xc.Matrix(element.getTangentStiff())
+    errors.append((K*u-refForces).Norm()/refForces.Norm())
+    ## Symmetry.
+    numDOF= 3*len(xis)
+    Kmax= max(abs(K(i,j)) for i in range(0,numDOF) for j in range(0,numDOF))
+    errors.append(max(abs(K(i,j)-K(j,i)) for i in range(0,numDOF) for j in range(0,numDOF))/Kmax)
+    ## Rigid body motions (translations and infinitesimal rotations).
+    rigidBodyMotions= [([1.0,0.0,0.0], [[0.0]*3]*3),
+                       ([0.0,1.0,0.0], [[0.0]*3]*3),
+                       ([0.0,0.0,1.0], [[0.0]*3]*3),
+                       ([0.0]*3, [[0.0,-1.0,0.0],[1.0,0.0,0.0],[0.0,0.0,0.0]]),
+                       ([0.0]*3, [[0.0,0.0,1.0],[0.0,0.0,0.0],[-1.0,0.0,0.0]]),
+                       ([0.0]*3, [[0.0,0.0,0.0],[0.0,0.0,-1.0],[0.0,1.0,0.0]])]
+    for t, W in rigidBodyMotions:
+        uRigid= impose_linear_field(nodes, element, t, W)
+        errors.append((K*uRigid).Norm()/(Kmax*uRigid.Norm()))
+        errors.append(xc.Vector(element.getResistingForce()).Norm()/(Kmax*uRigid.Norm()))
+    ## Linear field on a distorted element.
+    feProblem, nodes, element= create_element(elementType, distortion, a, x0)
+    H= [[1e-3,2e-4,-3e-4],[5e-4,-7e-4,1e-4],[2e-4,3e-4,4e-4]]
+    u= impose_linear_field(nodes, element, c, H)
+    K= xc.Matrix(element.getTangentStiff())
+    Ku= K*u
+    refEnergy= strain_energy_density(H)*determinant(distortion)*a**3
+    errors.append(abs(u.dot(Ku)-refEnergy)/refEnergy)
+    R= xc.Vector(element.getResistingForce())
+    errors.append((R-Ku).Norm()/Ku.Norm())
+
+'''
+print(errors)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(max(errors)<1e-9):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
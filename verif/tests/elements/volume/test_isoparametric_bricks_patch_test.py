@@ -0,0 +1,132 @@
+# -*- coding: utf-8 -*-
+''' Patch test for the isoparametric hexahedra (EightNodeBrick,
+    TwentyNodeBrick and TwentySevenNodeBrick). A cube is meshed with
+    2x2x2 elements whose interior nodes are moved from their regular
+    positions. A linear displacement field is imposed on the boundary
+    nodes; the displacements obtained for the interior nodes must
+    reproduce exactly the same linear field.
+
+    Home made test.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import random
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+# Material properties.
+E= 2.0e5 # Young modulus.
+nu= 0.3 # Poisson's ratio.
+G= E/(2.0*(1.0+nu)) # Shear modulus.
+
+# Geometry
+L= 1.0 # Side of the cube.
+h= L/4.0 # Distance between nodes in the grid (two quadratic elements per side).
+
+# Natural coordinates of the nodes of each element type.
+corners= [(1,1,1), (-1,1,1), (-1,-1,1), (1,-1,1), (1,1,-1), (-1,1,-1), (-1,-1,-1), (1,-1,-1)]
+naturalCoordinates= {'EightNodeBrick': corners,
+                     'TwentyNodeBrick': corners+[(0,1,1), (-1,0,1), (0,-1,1), (1,0,1),
+                                                 (0,1,-1), (-1,0,-1), (0,-1,-1), (1,0,-1),
+                                                 (1,1,0), (-1,1,0), (-1,-1,0), (1,-1,0)],
+                     'TwentySevenNodeBrick': corners+[(1,1,0), (-1,1,0), (-1,-1,0), (1,-1,0),
+                                                      (0,1,1), (-1,0,1), (0,-1,1), (1,0,1),
+                                                      (0,1,-1), (-1,0,-1), (0,-1,-1), (1,0,-1),
+                                                      (0,1,0), (-1,0,0), (0,-1,0), (1,0,0),
+                                                      (0,0,1), (0,0,-1), (0,0,0)]}
+
+# Linear displacement field u= c+H*x.
+c= [1e-3,-2e-3,5e-4]
+H= [[1e-3,2e-4,-3e-4],[5e-4,-7e-4,1e-4],[2e-4,3e-4,4e-4]]
+
+def linear_field(x):
+    ''' Return the value of the linear displacement field at the
+        position argument.'''
+    return [c[i]+sum(H[i][j]*x[j] for j in range(0,3)) for i in range(0,3)]
+
+def patch_test(elementType):
+    ''' Solve the patch test with the element type argument and return
+        the maximum error in the displacements of the interior nodes.
+
+    :param elementType: type of the elements.
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor= feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics3D(nodeHandler)
+    # Isotropic material defined as a cross-anisotropic one (the
+    # elements need a material that implements the tensor interface).
+    mat= typical_materials.defElasticCrossAnisotropic3d(preprocessor, 'mat', Eh= E, Ev= E, nuhv= nu, nuhh= nu, Ghv= G)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= mat.name
+
+    # Mesh: the nodes are indexed by their position in the grid.
+    rnd= random.Random(1234)
+    nodes= dict()
+    for i in range(0,2):
+        for j in range(0,2):
+            for k in range(0,2):
+                tags= list()
+                for xi in naturalCoordinates[elementType]:
+                    index= (2*i+1+xi[0], 2*j+1+xi[1], 2*k+1+xi[2])
+                    if(not index in nodes):
+                        pos= [h*idx for idx in index]
+                        if(min(index)>0 and max(index)<4): # interior node.
+                            pos= [x+rnd.uniform(-0.1*h,0.1*h) for x in pos]
+                        nodes[index]= nodeHandler.newNodeXYZ(pos[0], pos[1], pos[2])
+                    tags.append(nodes[index].tag)
+                elements.newElement(elementType, xc.ID(tags))
+
+    # Impose the linear displacement field on the boundary nodes.
+    lp0= modelSpace.newLoadPattern(name= '0')
+    interiorNodes= list()
+    for index in nodes:
+        n= nodes[index]
+        if(min(index)>0 and max(index)<4):
+            interiorNodes.append(n)
+        else:
+            pos= n.getInitialPos3d
+            u= linear_field([pos.x, pos.y, pos.z])
+            for dof in range(0,3):
+                lp0.newSPConstraint(n.tag, dof, u[dof])
+    modelSpace.addLoadCaseToDomain(lp0.name)
+
+    # Solution.
+    analysis= predefined_solutions.simple_static_linear(feProblem)
+    result= analysis.analyze(1)
+    if(result!=0):
+        return 1e6
+
+    # Check the displacements of the interior nodes.
+    uMax= 0.0; err= 0.0
+    for n in interiorNodes:
+        pos= n.getInitialPos3d
+        uRef= linear_field([pos.x, pos.y, pos.z])
+        u= n.getDisp
+        uMax= max(uMax, max(abs(v) for v in uRef))
+        err= max(err, max(abs(u[i]-uRef[i]) for i in range(0,3)))
+    return err/uMax
+
+errors= list()
+for elementType in naturalCoordinates:
+    errors.append(patch_test(elementType))
+
+'''
+print(errors)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(max(errors)<1e-9):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+''' Compute the deformations of an elastic fiber section for a list of
+    internal forces with FiberSectionBatchSolver and compare them with
+    the closed form solution.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import math
+import geom
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Elastic modulus.
+width= 0.6 # Section width.
+depth= 0.4 # Section depth.
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast", E)
+# Section
+sectionGeometry= preprocessor.getMaterialHandler.newSectionGeometry("sectionGeometry")
+regions= sectionGeometry.getRegions
+region= regions.newQuadRegion("elast")
+region.nDivIJ= 12
+region.nDivJK= 8
+region.pMin= geom.Pos2d(-width/2.0,-depth/2.0)
+region.pMax= geom.Pos2d(width/2.0,depth/2.0)
+section= sectionGeometry.getFiberSection3d("section")
+fibers= section.getFibers()
+A= fibers.getArea(1.0)
+Iz= fibers.getIz(1.0, 0.0)
+Iy= fibers.getIy(1.0, 0.0)
+
+# Fiber set: fibers with positive y coordinate.
+topFibers= section.getFiberSets().create('top')
+for f in fibers:
+    if(f.getLocY()>0.0):
+        topFibers.insert(f)
+
+# Internal forces (N, Mz, My).
+N= 100.0
+Mz= 20.0
+My= -15.0
+targets= xc.Matrix([[N, 0, 0], [0, Mz, 0], [0, 0, My], [N, Mz, My], [0, 0, 0]])
+
+solver= xc.FiberSectionBatchSolver()
+solver.section= section
+solver.fiberSetNames= ['top']
+solver.numThreads= 1
+numFailed= solver.solve(targets)
+deformations= xc.Matrix(solver.deformations)
+solver.numThreads= 3
+numFailedParallel= solver.solve(targets)
+
+# Closed form solution.
+ratio1= abs(deformations(0,0)-N/(E*A))/(N/(E*A))
+ratio2= abs(abs(deformations(1,1))-Mz/(E*Iz))/(Mz/(E*Iz))
+ratio3= abs(abs(deformations(2,2))-abs(My)/(E*Iy))/(abs(My)/(E*Iy))
+# Superposition.
+ratio4= 0.0
+for j in range(0,3):
+    ratio4= max(ratio4, abs(deformations(3,j)-deformations(0,j)-deformations(1,j)-deformations(2,j)))
+ratio4/= deformations.Norm()
+ratio5= abs(deformations(4,0))+abs(deformations(4,1))+abs(deformations(4,2))
+# Threads don't change the results.
+ratio6= (solver.deformations-deformations).Norm()/deformations.Norm()
+# Fiber stresses: uniform under axial force and with the same sign
+# in the top fibers under bending around z.
+sigmaN= N/A
+axialStresses= solver.getFiberSetResults(0, '')
+ratio7= (abs(axialStresses[2]-sigmaN)+abs(axialStresses[3]-sigmaN))/sigmaN
+bendingStresses= solver.getFiberSetResults(1, '')
+topBendingStresses= solver.getFiberSetResults(1, 'top')
+bendingOk= (bendingStresses[2]<0.0) and (bendingStresses[3]>0.0) and (topBendingStresses[2]*topBendingStresses[3]>0.0)
+convergenceOk= (numFailed==0) and (numFailedParallel==0) and (sum(solver.convergenceFlags.getList())==5)
+
+'''
+print(deformations)
+print('ratio1= ', ratio1)
+print('ratio2= ', ratio2)
+print('ratio3= ', ratio3)
+print('ratio4= ', ratio4)
+print('ratio5= ', ratio5)
+print('ratio6= ', ratio6)
+print('ratio7= ', ratio7)
+print(bendingStresses, topBendingStresses)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if convergenceOk and bendingOk and (ratio1<1e-10) and (ratio2<1e-10) and (ratio3<1e-10) and (ratio4<1e-10) and (ratio5<1e-15) and (ratio6<1e-15) and (ratio7<1e-10):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,94 @@
+# -*- coding: utf-8 -*-
+''' Compute the deformations of a steel fiber section with shear and
+    torsion responses (FiberSectionShear3d) for a list of internal forces
+    that make the fibers yield with FiberSectionBatchSolver. The results
+    obtained with several threads must be the same as those obtained
+    with only one.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import math
+import geom
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2e11 # Elastic modulus.
+fy= 355e6 # Yield stress.
+G= E/(2*(1+0.3)) # Shear modulus.
+width= 0.3 # Section width.
+depth= 0.5 # Section depth.
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+# Materials definition
+steel= typical_materials.defSteel01(preprocessor, "steel", E= E, fy= fy, b= 0.01)
+area= width*depth
+respVy= typical_materials.defElasticMaterial(preprocessor, "respVy", 5/6.0*G*area)
+respVz= typical_materials.defElasticMaterial(preprocessor, "respVz", 5/6.0*G*area)
+respT= typical_materials.defElasticMaterial(preprocessor, "respT", G*0.2*width**3*depth)
+# Section
+sectionGeometry= preprocessor.getMaterialHandler.newSectionGeometry("sectionGeometry")
+regions= sectionGeometry.getRegions
+region= regions.newQuadRegion("steel")
+region.nDivIJ= 10
+region.nDivJK= 16
+region.pMin= geom.Pos2d(-width/2.0,-depth/2.0)
+region.pMax= geom.Pos2d(width/2.0,depth/2.0)
+section= sectionGeometry.getFiberSectionShear3d("section", respVy.name, respVz.name, respT.name)
+
+# Internal forces (N, Mz, My, Vy, Vz, T): the biaxial bending moment
+# turns around the section with an intensity beyond the elastic limit.
+Mz_el= fy*width*depth**2/6.0
+My_el= fy*depth*width**2/6.0
+N= 0.1*fy*area
+rows= list()
+numRows= 96
+for i in range(0, numRows):
+    theta= 2*math.pi*i/numRows
+    factor= 0.8+0.4*(i%4)/3.0 # from 0.8 to 1.2 times the elastic limit.
+    rows.append([N, factor*Mz_el*math.cos(theta), factor*My_el*math.sin(theta), 0.5e6*math.cos(3*theta), 0.2e6, 1e4*math.sin(theta)])
+targets= xc.Matrix(rows)
+
+solver= xc.FiberSectionBatchSolver()
+solver.section= section
+solver.numThreads= 1
+numFailed= solver.solve(targets)
+deformations= xc.Matrix(solver.deformations)
+fiberResults= xc.Matrix(solver.fiberResults)
+solver.numThreads= 4
+numFailedParallel= solver.solve(targets)
+
+# The fibers yield.
+epsY= fy/E
+maxStrain= 0.0
+for i in range(0, numRows):
+    results= solver.getFiberSetResults(i, '')
+    maxStrain= max(maxStrain, abs(results[0]), abs(results[1]))
+yieldOk= (maxStrain>1.5*epsY)
+# Threads don't change the results.
+ratio1= (solver.deformations-deformations).Norm()/deformations.Norm()
+ratio2= (solver.fiberResults-fiberResults).Norm()/fiberResults.Norm()
+convergenceOk= (numFailed==0) and (numFailedParallel==0) and (sum(solver.convergenceFlags.getList())==numRows)
+
+'''
+print('max. strain: ', maxStrain, ' yield strain: ', epsY)
+print('ratio1= ', ratio1)
+print('ratio2= ', ratio2)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if convergenceOk and yieldOk and (ratio1<1e-15) and (ratio2<1e-15):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,120 @@
+# -*- coding: utf-8 -*-
+''' The copies of a steel material (one for each element or fiber) share
+    its properties until one of them is modified. Check that modifying the
+    properties of one of the copies (or the material defined in the
+    material handler) doesn't change the others, also when the copies
+    are made through the copies of a fiber section.
+
+    Home made test.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+fy= 2600 # Yield stress of the steel.
+E= 2.1e6 # Young modulus of the steel.
+b= 0.001 # Strain-hardening ratio.
+
+# Model definition
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Materials definition
+steel01= typical_materials.defSteel01(preprocessor, "steel01", E, fy, b)
+steel02= typical_materials.defSteel02(preprocessor, "steel02", E, fy, b)
+steel03= preprocessor.getMaterialHandler.newMaterial("steel03", "steel03")
+steel03.E= E
+steel03.fy= fy
+steel03.b= b
+
+# Elements definition (two springs for each material).
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 # Dimension of element space
+springs= dict()
+for mat in [steel01, steel02, steel03]:
+    elements.defaultMaterial= mat.name
+    springs[mat.name]= list()
+    for i in range(0,2):
+        n1= nodes.newNodeXY(0,0)
+        n2= nodes.newNodeXY(1,0)
+        springs[mat.name].append(elements.newElement("Spring",xc.ID([n1.tag, n2.tag])))
+
+eps= 2.0*fy/E # Trial strain (beyond the yield strain).
+err= 0.0
+for mat in [steel01, steel02, steel03]:
+    matA= springs[mat.name][0].getMaterial()
+    matB= springs[mat.name][1].getMaterial()
+    # The copies have the properties of the material.
+    err+= (matA.fy-fy)**2+(matB.fy-fy)**2+(matA.E-E)**2+(matB.b-b)**2
+    # Modify the material in the material handler.
+    mat.fy= 2.0*fy
+    err+= (matA.fy-fy)**2+(matB.fy-fy)**2
+    # Modify the first copy.
+    matA.fy= 0.5*fy
+    matA.E= 2.0*E
+    err+= (matA.fy-0.5*fy)**2+(matB.fy-fy)**2+(mat.fy-2.0*fy)**2
+    err+= (matA.E-2.0*E)**2+(matB.E-E)**2+(mat.E-E)**2
+    # The response of each copy corresponds to its own properties.
+    if(mat.name=='steel03'):
+        continue # Smooth transition: the stress is not the yield stress.
+    matA.setTrialStrain(eps,0.0)
+    matB.setTrialStrain(eps,0.0)
+    sgA= matA.getStress()
+    sgB= matB.getStress()
+    err+= ((sgA-0.5*fy)/fy)**2+((sgB-fy)/fy)**2
+
+# Copies made through the copies of a fiber section.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+steel= typical_materials.defSteel02(preprocessor, "steel", E, fy, b)
+fiberArea= 1e-4
+section= preprocessor.getMaterialHandler.newMaterial("fiber_section_3d","section")
+for y, z in [(-1.0,-1.0), (1.0,-1.0), (1.0,1.0), (-1.0,1.0)]:
+    section.addFiber(steel.name, fiberArea, xc.Vector([y,z]))
+## Two elements, each one with its own copy of the section.
+elements= preprocessor.getElementHandler
+elements.dimElem= 3
+elements.defaultMaterial= section.name
+zeroLengthElements= list()
+for i in range(0,2):
+    n1= nodes.newNodeXYZ(0,0,0)
+    n2= nodes.newNodeXYZ(0,0,0)
+    zeroLengthElements.append(elements.newElement("ZeroLengthSection",xc.ID([n1.tag, n2.tag])))
+fibersA= zeroLengthElements[0].getSection().getFibers()
+fibersB= zeroLengthElements[1].getSection().getFibers()
+fibers= section.getFibers()
+## Modify the properties of the fibers of the first copy.
+for f in fibersA:
+    f.getMaterial().fy= 0.5*fy
+for fA, fB, f in zip(fibersA, fibersB, fibers):
+    err+= (fA.getMaterial().fy-0.5*fy)**2+(fB.getMaterial().fy-fy)**2+(f.getMaterial().fy-fy)**2
+## Modify the properties of a fiber of the section in the material handler.
+fibers[0].getMaterial().E= 2.0*E
+err+= (fibers[0].getMaterial().E-2.0*E)**2+(fibers[1].getMaterial().E-E)**2
+for fA, fB in zip(fibersA, fibersB):
+    err+= (fA.getMaterial().E-E)**2+(fB.getMaterial().E-E)**2
+err+= (steel.fy-fy)**2+(steel.E-E)**2
+
+'''
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(err<1e-4):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
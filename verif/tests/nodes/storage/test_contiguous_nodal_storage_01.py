@@ -0,0 +1,75 @@
+# -*- coding: utf-8 -*-
+''' Check that storing the nodal response vectors in mesh-wide contiguous
+    arrays gives the same results as the storage node by node.
+'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2024, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+def solve_cantilever(contiguous: bool):
+    ''' Compute the tip displacement of a cantilever beam.
+
+    :param contiguous: if true store the nodal response vectors in
+                       mesh-wide contiguous arrays.
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+    mesh= feProblem.getDomain.getMesh
+    mesh.contiguousNodalStorage= contiguous
+
+    # Define mesh.
+    L= 5.0 # Beam length.
+    numDiv= 10
+    nodeList= list()
+    for i in range(0, numDiv+1):
+        nodeList.append(nodes.newNodeXY(i*L/numDiv, 0.0))
+    ## Cross section properties.
+    scc= typical_materials.defElasticSection2d(preprocessor, "scc", A= 1e-2, E= 2.1e11, I= 1e-5)
+    lin= modelSpace.newLinearCrdTransf("lin")
+    modelSpace.setDefaultCoordTransf(lin)
+    modelSpace.setDefaultMaterial(scc)
+    for nA, nB in zip(nodeList, nodeList[1:]):
+        modelSpace.newElement("ElasticBeam2d", [nA.tag, nB.tag])
+    modelSpace.fixNode000(nodeList[0].tag)
+
+    # Define loads.
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(nodeList[-1].tag, xc.Vector([0.0, -10e3, 0.0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+
+    # Solve in several steps to commit more than once.
+    analysis= predefined_solutions.plain_newton_raphson(feProblem)
+    result= analysis.analyze(4)
+    tipDisp= nodeList[-1].getDisp[1]
+    # Revert to the initial state.
+    feProblem.getDomain.revertToStart()
+    revertedDisp= nodeList[-1].getDisp[1]
+    return result, tipDisp, revertedDisp
+
+result0, disp0, reverted0= solve_cantilever(contiguous= False)
+result1, disp1, reverted1= solve_cantilever(contiguous= True)
+
+'''
+print(disp0, disp1)
+print(reverted0, reverted1)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((result0==0) and (result1==0) and (abs(disp0)>0.0) and (abs(disp1-disp0)<1e-12) and (abs(reverted0)<1e-15) and (abs(reverted1)<1e-15)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
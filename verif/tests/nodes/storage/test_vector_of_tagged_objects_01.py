@@ -0,0 +1,205 @@
+# -*- coding: utf-8 -*-
+''' Check the order of the nodes and elements of the mesh (stored
+    in dense vectors with tag lookup through a hash table) and the
+    tag lookup after removals (holes in the vectors), after
+    reordering them and after sorting them again. Check that the
+    nodes added or removed while iterating don't move the other ones.
+    Check also that the results of the analysis don't depend on the
+    order.
+
+    Home made test.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+L= 5.0 # Beam length.
+numDiv= 10 # Number of elements.
+
+def get_node_tags(mesh):
+    ''' Return the tags of the nodes in iteration order.'''
+    retval= list()
+    nIter= mesh.getNodeIter
+    nod= nIter.next()
+    while not(nod is None):
+        retval.append(nod.tag)
+        nod= nIter.next()
+    return retval
+
+def get_element_tags(mesh):
+    ''' Return the tags of the elements in iteration order.'''
+    retval= list()
+    eIter= mesh.getElementIter
+    elem= eIter.next()
+    while not(elem is None):
+        retval.append(elem.tag)
+        elem= eIter.next()
+    return retval
+
+def check_lookup(mesh, tags):
+    ''' Return true if the nodes with the given tags are found.'''
+    retval= (mesh.getNumNodes()==len(tags))
+    for tag in tags:
+        retval= retval and (mesh.getNode(tag).tag==tag)
+    return retval
+
+def solve_cantilever(reorder: bool):
+    ''' Compute the tip displacement of a cantilever beam whose nodes
+        and elements are created in reverse order.
+
+    :param reorder: if true, store the nodes and the elements in the
+                    order of the beam axis.
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+    mesh= feProblem.getDomain.getMesh
+    # Define mesh (node i has the tag numDiv-i+1).
+    nodeList= [None]*(numDiv+1)
+    for i in reversed(range(0, numDiv+1)):
+        nodeList[i]= nodes.newNodeIDXY(numDiv-i+1, i*L/numDiv, 0.0)
+    scc= typical_materials.defElasticSection2d(preprocessor, "scc", A= 1e-2, E= 2.1e11, I= 1e-5)
+    lin= modelSpace.newLinearCrdTransf("lin")
+    modelSpace.setDefaultCoordTransf(lin)
+    modelSpace.setDefaultMaterial(scc)
+    elementList= list()
+    for nA, nB in zip(nodeList, nodeList[1:]):
+        elementList.append(modelSpace.newElement("ElasticBeam2d", [nA.tag, nB.tag]))
+    if(reorder):
+        mesh.reorderNodes(xc.ID([n.tag for n in nodeList]))
+        mesh.reorderElements(xc.ID([e.tag for e in reversed(elementList)]))
+    modelSpace.fixNode000(nodeList[0].tag)
+    # Define loads.
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(nodeList[-1].tag, xc.Vector([0.0, -10e3, 0.0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    analysis= predefined_solutions.simple_static_linear(feProblem)
+    result= analysis.analyze(1)
+    nodeTags= get_node_tags(mesh)
+    elementTags= get_element_tags(mesh)
+    return result, nodeList[-1].getDisp[1], nodeTags, elementTags
+
+ok= True
+
+# Model definition
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+mesh= feProblem.getDomain.getMesh
+
+## Nodes created out of order are iterated in increasing tag order.
+tags= [5, 1, 9, 3, 7, 2, 8, 4, 6, 10]
+for i, tag in enumerate(tags):
+    nodes.newNodeIDXY(tag, float(i), 0.0)
+ok= ok and mesh.nodesSortedByTag
+ok= ok and (get_node_tags(mesh)==sorted(tags))
+ok= ok and check_lookup(mesh, tags)
+
+## Remove some nodes (holes in the vector).
+for tag in [3, 7]:
+    mesh.removeNode(tag)
+    tags.remove(tag)
+ok= ok and (get_node_tags(mesh)==sorted(tags))
+ok= ok and check_lookup(mesh, tags)
+ok= ok and (mesh.getNode(3) is None) and (mesh.getNode(7) is None)
+## Add a node in the middle (appended and sorted when the next
+## iteration starts).
+nodes.newNodeIDXY(3, 20.0, 0.0)
+tags.append(3)
+ok= ok and (get_node_tags(mesh)==sorted(tags))
+ok= ok and check_lookup(mesh, tags)
+## Remove more than half the nodes (the holes are removed).
+for tag in [1, 2, 4, 5, 6]:
+    mesh.removeNode(tag)
+    tags.remove(tag)
+ok= ok and (get_node_tags(mesh)==sorted(tags))
+ok= ok and check_lookup(mesh, tags)
+
+## Reorder the nodes (the missing ones go at the end, in their order).
+for tag in [1, 2, 4, 5, 6, 7]:
+    nodes.newNodeIDXY(tag, 30.0+tag, 0.0)
+    tags.append(tag)
+newOrder= [6, 10, 1, 9]
+mesh.reorderNodes(xc.ID(newOrder))
+expectedOrder= newOrder+[t for t in sorted(tags) if t not in newOrder]
+ok= ok and not mesh.nodesSortedByTag
+ok= ok and (get_node_tags(mesh)==expectedOrder)
+ok= ok and check_lookup(mesh, tags)
+## New nodes are appended (insertion order).
+nodes.newNodeIDXY(0, 40.0, 0.0)
+tags.append(0)
+expectedOrder.append(0)
+ok= ok and (get_node_tags(mesh)==expectedOrder)
+## Remove nodes from the reordered vector.
+for tag in [10, 2]:
+    mesh.removeNode(tag)
+    tags.remove(tag)
+    expectedOrder.remove(tag)
+ok= ok and (get_node_tags(mesh)==expectedOrder)
+ok= ok and check_lookup(mesh, tags)
+
+## Sort the nodes by tag again.
+mesh.nodesSortedByTag= True
+ok= ok and (get_node_tags(mesh)==sorted(tags))
+ok= ok and check_lookup(mesh, tags)
+
+## Remove and add nodes while iterating: the open iteration goes on
+## (the removed node is skipped and the new one comes at the end) and
+## the next one is sorted again.
+nIter= mesh.getNodeIter
+visited= [nIter.next().tag]
+sortedTags= sorted(tags)
+removedTag= sortedTags[-1]
+newTag= 2 # out of order.
+mesh.removeNode(removedTag)
+tags.remove(removedTag)
+nodes.newNodeIDXY(newTag, 50.0, 0.0)
+tags.append(newTag)
+ok= ok and check_lookup(mesh, tags)
+nod= nIter.next()
+while not(nod is None):
+    visited.append(nod.tag)
+    nod= nIter.next()
+ok= ok and (visited==sortedTags[:-1]+[newTag])
+ok= ok and (get_node_tags(mesh)==sorted(tags))
+ok= ok and check_lookup(mesh, tags)
+
+## Insertion order.
+mesh.nodesSortedByTag= False
+for tag in [20, 15, 11]:
+    nodes.newNodeIDXY(tag, float(tag), 0.0)
+    tags.append(tag)
+ok= ok and (get_node_tags(mesh)==sorted(tags[:-3])+[20, 15, 11])
+ok= ok and check_lookup(mesh, tags)
+
+# The results don't depend on the order of the nodes and elements.
+result0, disp0, nodeTags0, elementTags0= solve_cantilever(reorder= False)
+result1, disp1, nodeTags1, elementTags1= solve_cantilever(reorder= True)
+ok= ok and (result0==0) and (result1==0)
+ok= ok and (nodeTags0==list(range(1, numDiv+2)))
+ok= ok and (nodeTags1==list(reversed(range(1, numDiv+2))))
+ok= ok and (elementTags1==list(reversed(elementTags0)))
+ratio= abs(disp1-disp0)/abs(disp0)
+
+'''
+print(ok, disp0, disp1, ratio)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ok and (ratio<1e-12):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,98 @@
+# -*- coding: utf-8 -*-
+''' Check the binary columns output handler: the displacements of a truss
+    loaded in several steps are written by a node recorder to a binary
+    file organized in column chunks and read back with the
+    postprocess.binary_columns module.
+Home made test'''
+
+from __future__ import print_function
+from __future__ import division
+
+import os
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+from postprocess import binary_columns
+from misc_utils import log_messages as lmsg
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus.
+A= 1e-2 # Cross-section area.
+l= 10.0 # Bar length.
+P= 1e3 # Load.
+numSteps= 300 # More than the default chunk size (256 rows).
+
+# Define FE problem.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodeHandler= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodeHandler)
+n1= nodeHandler.newNodeXY(0,0)
+n2= nodeHandler.newNodeXY(l,0)
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+modelSpace.setElementDimension(2)
+modelSpace.setDefaultMaterial(elast)
+truss= modelSpace.newElement("Truss",nodeTags= [n1.tag,n2.tag])
+truss.sectionArea= A
+modelSpace.fixNode00(n1.tag)
+modelSpace.fixNodeF0(n2.tag)
+
+# Load definition.
+lts= modelSpace.newTimeSeries(name= 'lts', tsType= 'linear_ts')
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(n2.tag, xc.Vector([P,0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Output handler and recorder.
+fname= os.path.basename(__file__)
+outputFileName= '/tmp/'+fname.replace('.py', '.bin')
+handler= feProblem.newOutputHandler('binary_file', 'binary_output', outputFileName)
+recorder= modelSpace.preprocessor.getDomain.newRecorder('node_recorder', handler)
+recorder.setNodes(xc.ID([n2.tag]))
+recorder.setDofs(xc.ID([0]))
+recorder.setDataToStore('disp')
+
+# Solution.
+solProc= predefined_solutions.SimpleStaticLinear(feProblem, numSteps= numSteps)
+result= solProc.solve()
+handler.close()
+
+# Read the file back.
+columnNames, data= binary_columns.read_binary_columns(outputFileName)
+columnsDict= binary_columns.read_binary_columns_dict(outputFileName)
+os.remove(outputFileName)
+
+refColumnNames= ['time', 'Node'+str(n2.tag)+'_disp_1']
+numRows= data.shape[0]
+lastTime= data[-1,0]
+uLast= data[-1,1]
+uRef= P*l/(E*A)
+# Each row must match the load factor of its step.
+err= 0.0
+for row in data:
+    err+= (row[1]-row[0]*uRef)**2
+err= err**0.5/uRef
+ratio1= abs(uLast-n2.getDisp[0])/uRef
+ratio2= abs(uLast-uRef)/uRef
+dictOk= (len(columnsDict[refColumnNames[1]])==numSteps) and (columnsDict['time'][-1]==lastTime)
+
+'''
+print('column names: ', columnNames)
+print('number of rows: ', numRows)
+print('last time: ', lastTime)
+print('uLast= ', uLast, 'uRef= ', uRef)
+print('err= ', err)
+print('ratio1= ', ratio1)
+print('ratio2= ', ratio2)
+'''
+
+if((result==0) and (columnNames==refColumnNames) and (numRows==numSteps) and (handler.chunkSize<numSteps) and (abs(lastTime-1.0)<1e-12) and (err<1e-10) and (ratio1<1e-12) and (ratio2<1e-10) and dictOk):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
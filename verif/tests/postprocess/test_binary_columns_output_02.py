@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+''' Check the compression of the chunks of the binary columns output
+    handler: the displacements of a truss loaded in several steps are
+    written to two binary files, one of them with its chunks compressed
+    with zlib, and read back with the postprocess.binary_columns module.
+Home made test'''
+
+from __future__ import print_function
+from __future__ import division
+
+import os
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+from postprocess import binary_columns
+from misc_utils import log_messages as lmsg
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus.
+A= 1e-2 # Cross-section area.
+l= 10.0 # Bar length.
+P= 1e3 # Load.
+numSteps= 300 # More than the default chunk size (256 rows).
+fname= os.path.basename(__file__)
+
+def solve(compressed: bool):
+    ''' Solve the truss and return the result of the analysis, the name
+        of the output file and the output handler.
+
+    :param compressed: if true, compress the chunks of the file.
+    '''
+    # Define FE problem.
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics2D(nodeHandler)
+    n1= nodeHandler.newNodeXY(0,0)
+    n2= nodeHandler.newNodeXY(l,0)
+    elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+    modelSpace.setElementDimension(2)
+    modelSpace.setDefaultMaterial(elast)
+    truss= modelSpace.newElement("Truss",nodeTags= [n1.tag,n2.tag])
+    truss.sectionArea= A
+    modelSpace.fixNode00(n1.tag)
+    modelSpace.fixNodeF0(n2.tag)
+    # Load definition.
+    lts= modelSpace.newTimeSeries(name= 'lts', tsType= 'linear_ts')
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(n2.tag, xc.Vector([P,0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    # Output handler and recorder.
+    suffix= '_zlib.bin' if compressed else '.bin'
+    outputFileName= '/tmp/'+fname.replace('.py', suffix)
+    handler= feProblem.newOutputHandler('binary_file', 'binary_output', outputFileName)
+    handler.compressed= compressed
+    recorder= modelSpace.preprocessor.getDomain.newRecorder('node_recorder', handler)
+    recorder.setNodes(xc.ID([n2.tag]))
+    recorder.setDofs(xc.ID([0]))
+    recorder.setDataToStore('disp')
+    # Solution.
+    solProc= predefined_solutions.SimpleStaticLinear(feProblem, numSteps= numSteps)
+    result= solProc.solve()
+    handler.close()
+    return result, outputFileName, handler
+
+result0, fileName0, handler0= solve(compressed= False)
+result1, fileName1, handler1= solve(compressed= True)
+
+# Read the files back.
+with open(fileName1, 'rb') as f:
+    headerNames, chunkSize, compressedFlag= binary_columns.read_header(f)
+columnNames0, data0= binary_columns.read_binary_columns(fileName0)
+columnNames1, data1= binary_columns.read_binary_columns(fileName1)
+os.remove(fileName0)
+os.remove(fileName1)
+
+uRef= P*l/(E*A)
+# Each row must match the load factor of its step.
+err= 0.0
+for row in data1:
+    err+= (row[1]-row[0]*uRef)**2
+err= err**0.5/uRef
+# Both files contain the same values.
+sameData= (data0.shape==data1.shape) and (data0==data1).all()
+
+'''
+print('column names: ', columnNames1)
+print('shapes: ', data0.shape, data1.shape)
+print('err= ', err)
+'''
+
+if((result0==0) and (result1==0) and handler1.compressed and not handler0.compressed and compressedFlag and (columnNames0==columnNames1) and (data1.shape[0]==numSteps) and (chunkSize<numSteps) and sameData and (err<1e-10)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
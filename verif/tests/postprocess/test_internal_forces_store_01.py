@@ -0,0 +1,127 @@
+# -*- coding: utf-8 -*-
+''' Check the internal forces store: the internal forces of a cantilever
+    are written, one load case at a time, to an indexed binary file and
+    read back (through the XC InternalForcesStore object and through the
+    NumPy memory-mapped reader). The results must be the same that those
+    obtained from the JSON file.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import os
+import json
+import math
+import xc
+
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+from postprocess.reports import export_internal_forces as eif
+from postprocess import internal_forces_store as ifs
+from postprocess import limit_state_data as lsd
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e11 # Elastic modulus.
+A= 1e-2 # Area.
+I= 1e-4 # Moment of inertia.
+L= 2.0 # Length of each element.
+F= 1e3 # Load.
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+n0= nodes.newNodeXY(0,0)
+n1= nodes.newNodeXY(L,0)
+n2= nodes.newNodeXY(2*L,0)
+modelSpace.fixNode000(n0.tag)
+
+# Elements definition
+scc= typical_materials.defElasticSection2d(preprocessor, "scc", A, E, I)
+lin= modelSpace.newLinearCrdTransf("lin")
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= lin.name
+elements.defaultMaterial= scc.name
+beam0= elements.newElement("ElasticBeam2d",xc.ID([n0.tag, n1.tag]))
+beam1= elements.newElement("ElasticBeam2d",xc.ID([n1.tag, n2.tag]))
+beam0.setProp('chiLT', 0.8) # lateral buckling reduction factor.
+
+# Load cases.
+lts= modelSpace.newTimeSeries(name= 'lts', tsType= 'linear_ts')
+lp0= modelSpace.newLoadPattern(name= 'lp0')
+lp0.newNodalLoad(n2.tag, xc.Vector([0,-F,0]))
+lp1= modelSpace.newLoadPattern(name= 'lp1')
+lp1.newNodalLoad(n2.tag, xc.Vector([2*F,0,F*L]))
+
+# Solution, one load case at a time.
+fname= os.path.basename(__file__)
+baseName= '/tmp/'+fname.replace('.py', '')
+storeFileName= baseName+'.xcif'
+jsonFileName= baseName+'.json'
+xcTotalSet= modelSpace.getTotalSet()
+writer= ifs.InternalForcesStoreWriter(storeFileName)
+internalForcesDict= dict()
+analysis= predefined_solutions.simple_static_linear(feProblem)
+for lp in [lp0, lp1]:
+    modelSpace.removeAllLoadPatternsFromDomain()
+    modelSpace.revertToStart()
+    modelSpace.addLoadCaseToDomain(lp.name)
+    result= analysis.analyze(1)
+    combDict= eif.get_internal_forces_dict(lp.name, xcTotalSet.elements)
+    writer.appendCombinationDict(combDict)
+    internalForcesDict.update(combDict)
+writer.close()
+with open(jsonFileName, 'w') as outfile:
+    json.dump(internalForcesDict, outfile)
+
+# Read the store through the XC object.
+store= xc.InternalForcesStore()
+store.open(storeFileName)
+storeOk= (store.combinationNames==['lp0', 'lp1']) and (store.totalNumRows==8)
+storeOk= storeOk and (store.getElementTags().getList()==[beam0.tag, beam1.tag])
+storeOk= storeOk and (store.getNumRows('lp1')==4)
+iMz= store.getValueIndex('Mz')
+envelope= store.getElementEnvelope(beam0.tag)
+# Maximum bending moment at the fixed end under lp0: F*2*L.
+envelopeErr= abs(max(abs(envelope(0,iMz)), abs(envelope(1,iMz)))-2*F*L)/(F*L)
+elementValues= store.getElementValues(beam1.tag)
+storeOk= storeOk and (elementValues.noRows==4) and (store.getElementCombinations(beam1.tag)==['lp0', 'lp0', 'lp1', 'lp1'])
+iChiLT= store.getValueIndex('chiLT')
+storeOk= storeOk and (envelope(0,iChiLT)==0.8) and math.isnan(store.getElementEnvelope(beam1.tag)(0,iChiLT))
+store.close()
+
+# Compare with the results read from the JSON file.
+jsonTags, jsonCombs, jsonValues= lsd.read_int_forces_dict(jsonFileName)
+storeTags, storeCombs, storeValues= lsd.read_internal_forces_file(storeFileName)
+err= 0.0
+readOk= (jsonTags==storeTags) and (jsonCombs==storeCombs)
+for tag in jsonTags:
+    jsonForces= sorted(jsonValues[tag], key= lambda x: (x.idComb, x.idSection))
+    storeForces= sorted(storeValues[tag], key= lambda x: (x.idComb, x.idSection))
+    readOk= readOk and (len(jsonForces)==len(storeForces))
+    for a, b in zip(jsonForces, storeForces):
+        readOk= readOk and (a.idSection==b.idSection) and (getattr(a, 'chiLT', None)==getattr(b, 'chiLT', None))
+        err+= (a.N-b.N)**2+(a.Vy-b.Vy)**2+(a.Mz-b.Mz)**2
+err= math.sqrt(err)/F
+
+'''
+print('storeOk= ', storeOk)
+print('envelopeErr= ', envelopeErr)
+print('readOk= ', readOk)
+print('err= ', err)
+'''
+
+from misc_utils import log_messages as lmsg
+if storeOk and (envelopeErr<1e-6) and readOk and (err<1e-12):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
+# Clean up.
+os.remove(storeFileName)
+os.remove(jsonFileName)
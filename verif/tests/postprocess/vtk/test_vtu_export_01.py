@@ -0,0 +1,165 @@
+# -*- coding: utf-8 -*-
+''' Check the VtuExporter class: writes a cantilever model and its results
+    to .vtu files (binary appended data, compressed with zlib or raw),
+    to a .pvd collection and to a VTKHDF file and reads them back.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import os
+import re
+import struct
+import zlib
+import math
+import xc
+
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e11 # Elastic modulus.
+A= 1e-2 # Area.
+I= 1e-4 # Moment of inertia.
+L= 2.0 # Length of each element.
+F= 1e3 # Load.
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+n0= nodes.newNodeXY(0,0)
+n1= nodes.newNodeXY(L,0)
+n2= nodes.newNodeXY(2*L,0)
+modelSpace.fixNode000(n0.tag)
+
+# Elements definition
+scc= typical_materials.defElasticSection2d(preprocessor, "scc", A, E, I)
+lin= modelSpace.newLinearCrdTransf("lin")
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= lin.name
+elements.defaultMaterial= scc.name
+beam0= elements.newElement("ElasticBeam2d",xc.ID([n0.tag, n1.tag]))
+beam1= elements.newElement("ElasticBeam2d",xc.ID([n1.tag, n2.tag]))
+beam0.setProp('check', 0.5)
+beam1.setProp('check', 0.75)
+
+# Load
+lts= modelSpace.newTimeSeries(name= 'lts', tsType= 'linear_ts')
+lp0= modelSpace.newLoadPattern(name= 'lp0', setCurrent= True)
+lp0.newNodalLoad(n2.tag, xc.Vector([0,-F,0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Solution
+analysis= predefined_solutions.simple_static_linear(feProblem)
+result= analysis.analyze(1)
+modelSpace.calculateNodalReactions()
+
+# Export
+xcTotalSet= modelSpace.getTotalSet()
+exporter= xc.VtuExporter()
+exporter.setSet(xcTotalSet)
+exporter.addNodalField('disp')
+exporter.addNodalField('reaction')
+exporter.addElementResponse('force', ['force'])
+exporter.addElementProperty('check')
+fname= os.path.basename(__file__)
+baseName= '/tmp/'+fname.replace('.py', '')
+exporter.writeStep(baseName, 1.0)
+exporter.writeStep(baseName, 2.0)
+exporter.writePvd(baseName+'.pvd')
+## Same file without compression.
+exporter.compressed= False
+rawResult= exporter.write(baseName+'_raw.vtu')
+exporter.compressed= True
+## VTKHDF file.
+hdfResult= exporter.writeVtkHdf(baseName+'.vtkhdf')
+
+def readVtu(fileName):
+    ''' Return a dictionary with the arrays of the file.'''
+    with open(fileName, 'rb') as f:
+        content= f.read()
+    pos= content.index(b'<AppendedData')
+    header= content[:pos].decode('utf-8')
+    compressed= ('compressor="vtkZLibDataCompressor"' in header)
+    dataStart= content.index(b'_', pos)+1
+    formats= {'Float64':'d', 'Int64':'q', 'Int32':'i', 'UInt8':'B'}
+    retval= dict()
+    for m in re.finditer(r'<DataArray type="(\w+)"(?: Name="([^"]*)")? NumberOfComponents="(\d+)" format="appended" offset="(\d+)"/>', header):
+        tp, name, nc, offset= m.group(1), m.group(2) or 'points', int(m.group(3)), int(m.group(4))
+        start= dataStart+offset
+        if(compressed):
+            # Header: number of blocks, block size, last block size and
+            # compressed size of each block.
+            numBlocks= struct.unpack('<Q', content[start:start+8])[0]
+            blockSizes= struct.unpack('<'+str(numBlocks)+'Q', content[start+24:start+24+8*numBlocks])
+            data= b''
+            blockStart= start+24+8*numBlocks
+            for sz in blockSizes:
+                data+= zlib.decompress(content[blockStart:blockStart+sz])
+                blockStart+= sz
+        else:
+            numBytes= struct.unpack('<Q', content[start:start+8])[0]
+            data= content[start+8:start+8+numBytes]
+        itemSize= struct.calcsize(formats[tp])
+        values= struct.unpack('<'+str(len(data)//itemSize)+formats[tp], data)
+        retval[name]= (nc, values)
+    return retval, compressed
+
+arrays, compressed= readVtu(baseName+'_000001.vtu')
+# The raw file contains the same values.
+rawArrays, rawCompressed= readVtu(baseName+'_raw.vtu')
+rawOk= (rawResult==0) and compressed and not rawCompressed and (rawArrays==arrays)
+# VTKHDF file (HDF5 signature), only if the library is built with HDF5.
+hdfOk= True
+if(hdfResult==0):
+    with open(baseName+'.vtkhdf', 'rb') as f:
+        hdfOk= (f.read(8)==b'\x89HDF\r\n\x1a\n')
+nodeTags= list(arrays['node_tag'][1])
+# Displacements.
+err= 0.0
+for n in [n0, n1, n2]:
+    i= nodeTags.index(n.tag)
+    err+= (arrays['disp'][1][3*i]-n.getDisp[0])**2
+    err+= (arrays['disp'][1][3*i+1]-n.getDisp[1])**2
+    err+= (arrays['reaction'][1][3*i+1]-n.getReaction[1])**2
+err= math.sqrt(err)
+# Connectivity and cell types (VTK_LINE= 3).
+connectivity= [nodeTags[i] for i in arrays['connectivity'][1]]
+connectivityOk= (connectivity==[n0.tag, n1.tag, n1.tag, n2.tag]) and (list(arrays['offsets'][1])==[2, 4]) and (list(arrays['types'][1])==[3, 3])
+# Element results.
+forceErr= 0.0
+forces= arrays['force'][1]
+for j, e in enumerate([beam0, beam1]):
+    R= e.getResistingForce()
+    for k in range(0,6):
+        forceErr+= (forces[6*j+k]-R[k])**2
+forceErr= math.sqrt(forceErr)/F
+propOk= (list(arrays['check'][1])==[0.5, 0.75])
+# Collection.
+with open(baseName+'.pvd', 'r') as f:
+    pvd= f.read()
+pvdOk= (pvd.count('<DataSet')==2) and (fname.replace('.py', '_000000.vtu') in pvd)
+
+'''
+print(arrays)
+print('err= ', err)
+print('forceErr= ', forceErr)
+print(connectivityOk, propOk, pvdOk, rawOk, hdfOk)
+'''
+
+from misc_utils import log_messages as lmsg
+if (err<1e-12) and (forceErr<1e-12) and connectivityOk and propOk and pvdOk and rawOk and hdfOk and (exporter.numPoints==3) and (exporter.numCells==2):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
+# Clean up.
+for suffix in ['_000000.vtu', '_000001.vtu', '_raw.vtu', '.pvd', '.vtkhdf']:
+    if os.path.exists(baseName+suffix):
+        os.remove(baseName+suffix)
@@ -0,0 +1,139 @@
+# -*- coding: utf-8 -*-
+''' SpatialIndex test: batched k-nearest nodes, nodes in radius, element
+    containing a point (trusses, quads and shells) and coincident nodes
+    queries.'''
+
+from __future__ import print_function
+
+import math
+import xc
+from materials import typical_materials
+from model import predefined_spaces
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numNodes= 1000
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+nodeList= list()
+for i in range(0,numNodes):
+    n= nodes.newNodeXYZ(i,0,0)
+    nodeList.append(n)
+# Nodes coincident with others.
+dup3= nodes.newNodeXYZ(3+1e-9,0,0)
+dup7= nodes.newNodeXYZ(7,1e-9,0)
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",2.1e6)
+
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= elast.name
+elements.dimElem= 2 # Dimension of element space
+elementList= list()
+for i in range(1,numNodes):
+    nA= nodeList[i-1]
+    nB= nodeList[i]
+    truss= elements.newElement("Truss",xc.ID([nA.tag,nB.tag]))
+    truss.sectionArea= 1
+    elementList.append(truss)
+
+index= xc.SpatialIndex()
+index.setMesh(feProblem.getDomain.getMesh)
+sizeOk= (index.numNodes==numNodes+2) and (index.numElements==numNodes-1)
+
+# k nearest nodes.
+positions= xc.Matrix([[50.2,0,0],[500.9,0.0,0]])
+tags, distances= index.getKNearestNodes(positions, 2)
+kNearestOk= (int(tags(0,0))==nodeList[50].tag) and (int(tags(0,1))==nodeList[51].tag)
+kNearestOk= kNearestOk and (int(tags(1,0))==nodeList[501].tag) and (int(tags(1,1))==nodeList[500].tag)
+kNearestErr= math.sqrt((distances(0,0)-0.2)**2+(distances(0,1)-0.8)**2+(distances(1,0)-0.1)**2+(distances(1,1)-0.9)**2)
+## No nodes to search (empty result).
+tags0, distances0= index.getKNearestNodes(positions, 0)
+kNearestOk= kNearestOk and (tags0.noRows==2) and (tags0.noCols==0) and (distances0.noCols==0)
+
+# Nodes in radius.
+inRadius= index.getNodesInRadius(xc.Matrix([[10,0,0],[-10,0,0]]), 1.5)
+inRadiusOk= (inRadius[0].getList()==sorted([nodeList[9].tag, nodeList[10].tag, nodeList[11].tag])) and (inRadius[1].getList()==[])
+
+# Element containing the point.
+elemTags, naturalCoords= index.getElementsContaining(xc.Matrix([[50.25,0,0],[2000,0,0]]), 1e-3)
+containingOk= (elemTags[0]==elementList[50].tag) and (elemTags[1]==-1)
+naturalErr= abs(naturalCoords(0,0)+0.5)
+
+# Coincident nodes.
+groups= index.getCoincidentNodes(1e-6)
+groupLists= [g.getList() for g in groups]
+coincidentOk= (len(groupLists)==2) and (sorted([nodeList[3].tag, dup3.tag]) in groupLists) and (sorted([nodeList[7].tag, dup7.tag]) in groupLists)
+
+# Element containing the point: two parallelograms whose bounding
+# boxes overlap.
+def defineParallelograms(modelSpace, z= lambda y: 0.0):
+    ''' Define two parallelogram elements with nodes at z(y) and return
+        them.'''
+    nodes= modelSpace.preprocessor.getNodeHandler
+    xy= [(0,0), (1,0), (1.5,1), (0.5,1), (2,0), (2.5,1)]
+    pNodes= list()
+    for (x,y) in xy:
+        if(modelSpace.getSpaceDimension()==2):
+            pNodes.append(nodes.newNodeXY(x,y))
+        else:
+            pNodes.append(nodes.newNodeXYZ(x,y,z(y)))
+    elemA= modelSpace.newElement(elemType, [pNodes[0].tag, pNodes[1].tag, pNodes[2].tag, pNodes[3].tag])
+    elemB= modelSpace.newElement(elemType, [pNodes[1].tag, pNodes[4].tag, pNodes[5].tag, pNodes[2].tag])
+    return elemA, elemB
+
+## Four node quads.
+quadProblem= xc.FEProblem()
+quadPreprocessor= quadProblem.getPreprocessor
+quadSpace= predefined_spaces.SolidMechanics2D(quadPreprocessor.getNodeHandler)
+quadMat= typical_materials.defElasticIsotropicPlaneStress(quadPreprocessor, "quadMat", 2.1e6, 0.3, 0.0)
+quadSpace.setDefaultMaterial(quadMat)
+elemType= 'FourNodeQuad'
+quadA, quadB= defineParallelograms(quadSpace)
+quadIndex= xc.SpatialIndex()
+quadIndex.setMesh(quadProblem.getDomain.getMesh)
+# Point inside B but in the bounding box of A, point in the center of A
+# and point in the bounding box of A but outside both elements.
+quadTags, quadNaturalCoords= quadIndex.getElementsContaining(xc.Matrix([[1.48,0.9,0],[0.75,0.5,0],[0.1,0.9,0]]), 1e-3)
+quadOk= (quadTags[0]==quadB.tag) and (quadTags[1]==quadA.tag) and (quadTags[2]==-1)
+quadNaturalErr= math.sqrt(quadNaturalCoords(1,0)**2+quadNaturalCoords(1,1)**2)
+
+## Shells (on an inclined plane).
+shellProblem= xc.FEProblem()
+shellPreprocessor= shellProblem.getPreprocessor
+shellSpace= predefined_spaces.StructuralMechanics3D(shellPreprocessor.getNodeHandler)
+shellMat= typical_materials.defElasticMembranePlateSection(shellPreprocessor, "shellMat", 2.1e6, 0.3, 0.0, 0.1)
+shellSpace.setDefaultMaterial(shellMat)
+elemType= 'ShellMITC4'
+shellA, shellB= defineParallelograms(shellSpace, z= lambda y: 0.5*y)
+shellIndex= xc.SpatialIndex()
+shellIndex.setMesh(shellProblem.getDomain.getMesh)
+# Same points as before, plus a point in the bounding box of A that
+# is not in the plane of the elements.
+shellTags, shellNaturalCoords= shellIndex.getElementsContaining(xc.Matrix([[1.48,0.9,0.45],[0.75,0.5,0.25],[0.1,0.9,0.45],[0.75,0.5,0.45]]), 1e-3)
+shellOk= (shellTags[0]==shellB.tag) and (shellTags[1]==shellA.tag) and (shellTags[2]==-1) and (shellTags[3]==-1)
+shellNaturalErr= math.sqrt(shellNaturalCoords(1,0)**2+shellNaturalCoords(1,1)**2)
+
+''' 
+print('sizeOk= ', sizeOk)
+print(tags, distances)
+print('kNearestErr= ', kNearestErr)
+print('inRadiusOk= ', inRadiusOk)
+print(elemTags, naturalCoords)
+print(groupLists)
+print(quadTags, quadNaturalCoords, quadNaturalErr)
+print(shellTags, shellNaturalCoords, shellNaturalErr)
+   '''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(sizeOk and kNearestOk and (kNearestErr<1e-10) and inRadiusOk and containingOk and (naturalErr<1e-10) and coincidentOk and quadOk and (quadNaturalErr<1e-8) and shellOk and (shellNaturalErr<1e-8)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,183 @@
+# -*- coding: utf-8 -*-
+''' Check the meshing of quadrilateral surfaces and blocks (nodes created
+    and elements registered in batches): number of nodes and elements,
+    merging of the nodes shared by adjacent entities and numbering (the
+    interior nodes of each entity get consecutive tags in the (i,j,k)
+    order after the nodes of its boundary, and the elements of each
+    entity get consecutive tags).
+
+    Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+numDiv= 3 # Number of divisions of each edge.
+
+def get_entity_nodes(entity):
+    ''' Return the nodes of the entity in (i,j,k) order and a list with
+        true for the interior ones.'''
+    layers= entity.getNodeLayers
+    nLayers= len(layers)
+    nRows= layers.getLayer(0).nRow
+    nCols= layers.getLayer(0).nCol
+    nodes= list()
+    interior= list()
+    for i in range(1, nLayers+1):
+        for j in range(1, nRows+1):
+            for k in range(1, nCols+1):
+                nodes.append(entity.getNode(i,j,k))
+                interiorLayer= (nLayers==1) or (1<i<nLayers)
+                interior.append(interiorLayer and (1<j<nRows) and (1<k<nCols))
+    return nodes, interior
+
+def check_entity(entity, numNodes, numElements):
+    ''' Return true if the nodes and elements of the entity are the
+        expected ones.
+
+    :param entity: quadrilateral surface or block.
+    :param numNodes: expected number of nodes.
+    :param numElements: expected number of elements.
+    '''
+    nodes, interior= get_entity_nodes(entity)
+    retval= (len(nodes)==numNodes) and (None not in nodes)
+    if(retval):
+        tags= [n.tag for n in nodes]
+        retval= (len(set(tags))==numNodes)
+        # Interior nodes: consecutive tags in (i,j,k) order, after the
+        # boundary ones.
+        interiorTags= [t for t, inside in zip(tags, interior) if inside]
+        boundaryTags= [t for t, inside in zip(tags, interior) if not inside]
+        if(interiorTags):
+            retval= retval and (interiorTags==list(range(interiorTags[0], interiorTags[0]+len(interiorTags))))
+            retval= retval and (min(interiorTags)>max(boundaryTags))
+        # Elements: consecutive tags, connected to the entity nodes.
+        elements= entity.getElementLayers.elements
+        elementTags= sorted([e.tag for e in elements])
+        retval= retval and (len(elements)==numElements)
+        retval= retval and (elementTags==list(range(elementTags[0], elementTags[0]+numElements)))
+        nodeTags= set(tags)
+        for e in elements:
+            retval= retval and set(e.getNodes.getExternalNodes).issubset(nodeTags)
+    return retval
+
+def check_mesh(mesh, numNodes, numElements):
+    ''' Return true if the mesh has the expected number of nodes and
+        elements and there are no coincident nodes.'''
+    positions= set()
+    tags= set()
+    nIter= mesh.getNodeIter
+    nod= nIter.next()
+    while not(nod is None):
+        pos= nod.getInitialPos3d
+        positions.add((round(pos.x,9), round(pos.y,9), round(pos.z,9)))
+        tags.add(nod.tag)
+        nod= nIter.next()
+    return (mesh.getNumNodes()==numNodes) and (len(positions)==numNodes) and (len(tags)==numNodes) and (mesh.getNumElements()==numElements)
+
+ok= True
+
+# Two quadrilateral surfaces that share an edge.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d", 30e6, 0.3, 0.0)
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= elast2d.name
+quad= seedElemHandler.newElement("FourNodeQuad")
+#
+#  4 +-------+ 3 ------+ 6
+#    |  s1   |   s2    |
+#  1 +-------+ 2 ------+ 5
+#
+pt1= modelSpace.newKPoint(0,0)
+pt2= modelSpace.newKPoint(3,0)
+pt3= modelSpace.newKPoint(3,2)
+pt4= modelSpace.newKPoint(0,2)
+pt5= modelSpace.newKPoint(5,0)
+pt6= modelSpace.newKPoint(5,2)
+surfaces= preprocessor.getMultiBlockTopology.getSurfaces
+s1= surfaces.newQuadSurfacePts(pt1.tag, pt2.tag, pt3.tag, pt4.tag)
+s2= surfaces.newQuadSurfacePts(pt2.tag, pt5.tag, pt6.tag, pt3.tag)
+for s in [s1, s2]:
+    s.nDivI= numDiv
+    s.nDivJ= numDiv
+xcTotalSet= modelSpace.getTotalSet()
+xcTotalSet.genMesh(xc.meshDir.I)
+nodesPerSurface= (numDiv+1)**2
+elementsPerSurface= numDiv**2
+for s in [s1, s2]:
+    ok= ok and check_entity(s, nodesPerSurface, elementsPerSurface)
+## The nodes of the shared edge are merged.
+mesh= feProblem.getDomain.getMesh
+ok= ok and check_mesh(mesh, 2*nodesPerSurface-(numDiv+1), 2*elementsPerSurface)
+surfacesOk= ok
+
+# Two blocks that share a face.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", 1e6, 0.25, 0.0)
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= elast3d.name
+brick= seedElemHandler.newElement("Brick")
+pt1= modelSpace.newKPoint(0,0,0)
+pt2= modelSpace.newKPoint(1,0,0)
+pt3= modelSpace.newKPoint(1,1,0)
+pt4= modelSpace.newKPoint(0,1,0)
+pt5= modelSpace.newKPoint(0,0,1)
+pt6= modelSpace.newKPoint(1,0,1)
+pt7= modelSpace.newKPoint(1,1,1)
+pt8= modelSpace.newKPoint(0,1,1)
+pt9= modelSpace.newKPoint(1,2,0)
+pt10= modelSpace.newKPoint(0,2,0)
+pt11= modelSpace.newKPoint(1,2,1)
+pt12= modelSpace.newKPoint(0,2,1)
+bodies= preprocessor.getMultiBlockTopology.getBodies
+b1= bodies.newBlockPts(pt1.tag, pt2.tag, pt3.tag, pt4.tag, pt5.tag, pt6.tag, pt7.tag, pt8.tag)
+b2= bodies.newBlockPts(pt4.tag, pt3.tag, pt9.tag, pt10.tag, pt8.tag, pt7.tag, pt11.tag, pt12.tag)
+for b in [b1, b2]:
+    vl= b.getVerbosityLevel()
+    b.setVerbosityLevel(0) # Don't bother with the warnings of the shared face.
+    b.nDivI= numDiv
+    b.nDivJ= numDiv
+    b.nDivK= numDiv
+    b.setVerbosityLevel(vl)
+modelSpace.conciliaNDivs()
+xcTotalSet= modelSpace.getTotalSet()
+xcTotalSet.fillDownwards()
+xcTotalSet.genMesh(xc.meshDir.I)
+nodesPerBlock= (numDiv+1)**3
+elementsPerBlock= numDiv**3
+for b in [b1, b2]:
+    ok= ok and check_entity(b, nodesPerBlock, elementsPerBlock)
+## The nodes of the shared face are merged.
+mesh= feProblem.getDomain.getMesh
+ok= ok and check_mesh(mesh, 2*nodesPerBlock-(numDiv+1)**2, 2*elementsPerBlock)
+## The interior nodes of the second block come after the first block.
+nodes1, interior1= get_entity_nodes(b1)
+nodes2, interior2= get_entity_nodes(b2)
+ok= ok and (min([n.tag for n, inside in zip(nodes2, interior2) if inside])>max([n.tag for n in nodes1]))
+
+'''
+print(surfacesOk, ok)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
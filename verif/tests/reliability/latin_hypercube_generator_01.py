@@ -0,0 +1,91 @@
+# -*- coding: utf-8 -*-
+''' Checks the stratification of the samples produced by the Latin
+    hypercube generator: in each dimension every one of the
+    numberOfSamples strata of the unit interval must be sampled exactly
+    once per design. Checks also that the design can be reproduced from
+    its seed (this is what makes the results of the sampling analysis
+    independent of the number of worker processes, since the samples
+    are always generated in the parent process).
+
+    Home made test.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+
+numberOfSamples= 20
+numberOfDimensions= 3
+seed= 5
+
+def get_design(generator, seed, lower= 0.0, upper= 1.0):
+    ''' Return the numberOfSamples samples of a design.
+
+    :param generator: random number generator.
+    :param seed: seed of the design (0: continue the current sequence).
+    :param lower: lower bound of the interval.
+    :param upper: upper bound of the interval.
+    '''
+    retval= list()
+    for i in range(0, numberOfSamples):
+        generator.generateUniformNumbers(numberOfDimensions, lower, upper, seed if(i==0) else 0)
+        retval.append(generator.generatedNumbers.getList())
+    return retval
+
+lhs= xc.LatinHypercubeGenerator(numberOfSamples)
+design= get_design(lhs, seed)
+
+# Each stratum sampled exactly once in each dimension.
+stratified= True
+for j in range(0, numberOfDimensions):
+    strata= sorted([int(sample[j]*numberOfSamples) for sample in design])
+    stratified= stratified and (strata==list(range(0, numberOfSamples)))
+
+# The next design uses new strata permutations, but keeps the stratification.
+nextDesign= get_design(lhs, 0)
+for j in range(0, numberOfDimensions):
+    strata= sorted([int(sample[j]*numberOfSamples) for sample in nextDesign])
+    stratified= stratified and (strata==list(range(0, numberOfSamples)))
+differentDesigns= (nextDesign!=design)
+
+# Same seed, same design (even with a new generator).
+lhs2= xc.LatinHypercubeGenerator(numberOfSamples)
+sameDesign= (get_design(lhs2, seed)==design)
+sameDesign= sameDesign and (get_design(lhs, seed)==design)
+sameSeed= (lhs.seed==seed)
+
+# Scaling to the [lower, upper) interval keeps the strata.
+lower= -2.0; upper= 6.0
+scaledDesign= get_design(lhs, seed, lower, upper)
+scaledError= 0.0
+for sample, scaledSample in zip(design, scaledDesign):
+    for u, v in zip(sample, scaledSample):
+        scaledError= max(scaledError, abs(lower+(upper-lower)*u-v))
+
+# Standard normal numbers: one per stratum of the normal distribution,
+# so the sample mean must be very close to zero.
+lhs.generateStdNormalNumbers(1, seed)
+normalSamples= [lhs.generatedNumbers[0]]
+for i in range(1, numberOfSamples):
+    lhs.generateStdNormalNumbers(1, 0)
+    normalSamples.append(lhs.generatedNumbers[0])
+normalMean= sum(normalSamples)/numberOfSamples
+
+'''
+print(stratified, differentDesigns, sameDesign, sameSeed)
+print(scaledError)
+print(normalMean)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(stratified and differentDesigns and sameDesign and sameSeed and (scaledError<1e-12) and (abs(normalMean)<0.1)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
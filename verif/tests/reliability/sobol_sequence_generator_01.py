@@ -0,0 +1,81 @@
+# -*- coding: utf-8 -*-
+''' Checks the points generated by the Sobol sequence generator against
+    the first points of the sequence (Joe-Kuo direction numbers, Gray
+    code order, without the origin). Checks also that the sequence can
+    be resumed from the seed (index of the next point) and that the
+    points have low discrepancy: any 2^k consecutive points starting at
+    the beginning of the sequence put one point in each of the 2^k
+    intervals of each dimension.
+
+    Home made test.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+
+# First points of the three-dimensional Sobol sequence.
+refPoints= [[0.5, 0.5, 0.5],
+            [0.75, 0.25, 0.25],
+            [0.25, 0.75, 0.75],
+            [0.375, 0.375, 0.625],
+            [0.875, 0.875, 0.125],
+            [0.625, 0.125, 0.875],
+            [0.125, 0.625, 0.375],
+            [0.1875, 0.3125, 0.9375]]
+
+numberOfDimensions= 3
+
+sobol= xc.SobolSequenceGenerator()
+points= list()
+for i in range(0, len(refPoints)):
+    sobol.generateUniformNumbers(numberOfDimensions, 0.0, 1.0, 0)
+    points.append(sobol.generatedNumbers.getList())
+err= 0.0
+for p, pRef in zip(points, refPoints):
+    for v, vRef in zip(p, pRef):
+        err= max(err, abs(v-vRef))
+
+# Resume the sequence from its seed.
+nextIndex= sobol.seed
+sobol.generateUniformNumbers(numberOfDimensions, 0.0, 1.0, 0)
+nextPoint= sobol.generatedNumbers.getList()
+sobol2= xc.SobolSequenceGenerator()
+sobol2.generateUniformNumbers(numberOfDimensions, 0.0, 1.0, nextIndex)
+resumedPoint= sobol2.generatedNumbers.getList()
+sobol2.generateUniformNumbers(numberOfDimensions, 0.0, 1.0, 4)
+restartedPoint= sobol2.generatedNumbers.getList()
+resumeOk= (nextIndex==len(refPoints)+1) and (resumedPoint==nextPoint) and (restartedPoint==points[3])
+
+# Low discrepancy: the origin plus the first 2^k-1 points fill
+# the 2^k intervals of each dimension.
+numIntervals= 32
+sobol3= xc.SobolSequenceGenerator()
+intervals= [[0] for j in range(0, numberOfDimensions)] # the origin.
+for i in range(1, numIntervals):
+    sobol3.generateUniformNumbers(numberOfDimensions, 0.0, 1.0, 0)
+    u= sobol3.generatedNumbers
+    for j in range(0, numberOfDimensions):
+        intervals[j].append(int(u[j]*numIntervals))
+lowDiscrepancy= True
+for j in range(0, numberOfDimensions):
+    lowDiscrepancy= lowDiscrepancy and (sorted(intervals[j])==list(range(0, numIntervals)))
+
+'''
+print(points)
+print(err)
+print(resumeOk, lowDiscrepancy)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((err<1e-12) and resumeOk and lowDiscrepancy):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
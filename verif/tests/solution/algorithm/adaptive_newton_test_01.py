@@ -0,0 +1,102 @@
+# -*- coding: utf-8 -*-
+''' Check the adaptive Newton algorithm (tangent refreshed only when the
+    convergence rate degrades) with a geometrically nonlinear problem:
+    prestressed cable under a transverse load.
+
+    Test from Ansys manual
+    Reference:  Strength of Material, Part I, Elementary Theory and Problems, pg. 26, problem 10.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 30e6 # Young modulus (psi)
+l= 10 # Cable length in inches
+sigmaPret= 1500 # Prestressing force (pounds)
+area= 2
+fPret= sigmaPret*area # Prestressing force (pounds)
+F= 100 # Transverse force (pounds)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+# Model definition
+n1= nodes.newNodeXYZ(0,0,0)
+n2= nodes.newNodeXYZ(l/2,0.0,0)
+n3= nodes.newNodeXYZ(l,0.0,0)
+
+# Materials definition
+cable= typical_materials.defCableMaterial(preprocessor, "cable",E,sigmaPret,0.0)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= cable.name
+elements.dimElem= 3 # Dimension of element space
+truss1= elements.newElement("CorotTruss",xc.ID([n1.tag, n2.tag]))
+truss1.sectionArea= area
+truss2= elements.newElement("CorotTruss",xc.ID([n2.tag, n3.tag]))
+truss2.sectionArea= area
+     
+# Constraints
+modelSpace.fixNode000_000(n1.tag)
+modelSpace.fixNodeFFF_000(n2.tag)
+modelSpace.fixNode000_000(n3.tag)
+
+# Load case definition.
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(n2.tag,xc.Vector([0,-F,0,0,0,0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Solution procedure
+solProc= predefined_solutions.SolutionProcedure(name= 'adaptive', constraintHandlerType= 'plain', maxNumIter= 50, convergenceTestTol= 1e-9, convTestType= 'norm_unbalance_conv_test', soeType= 'sparse_gen_col_lin_soe', solverType= 'super_lu_solver', solutionAlgorithmType= 'adaptive_newton_soln_algo', numSteps= 10)
+solProc.setFEProblem(feProblem)
+solProc.setup()
+algorithm= solProc.solutionStrategy.getSolutionAlgorithm
+result= solProc.solve()
+
+nodes.calculateNodalReactions(True,1e-7)
+R1X= n3.getReaction[0]
+R2X= n1.getReaction[0]
+deltaY= n2.getDisp[1]  
+tension= truss1.getN()
+alpha= -math.atan2(deltaY,l/2)
+tensTeor= F/(2*math.sin(alpha))
+ratio1= (abs(R1X+R2X)/fPret)
+ratio2= (abs(tension-tensTeor)/tensTeor)
+
+numIterations= algorithm.numIterations
+numTangents= algorithm.numTangents
+numFactorizationsSaved= algorithm.numFactorizationsSaved
+
+''' 
+print("deltaY= ",deltaY)
+print("tensTeor= ",(tensTeor))
+print("tension= ",(tension))
+print("ratio1= ",(ratio1))
+print("ratio2= ",(ratio2))
+print("iterations: ", numIterations)
+print("tangents: ", numTangents)
+print("factorizations saved: ", numFactorizationsSaved)
+'''
+    
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & (abs(ratio1)<1e-9) & (abs(ratio2)<1e-6) & (numTangents<numIterations) & (numFactorizationsSaved>0):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
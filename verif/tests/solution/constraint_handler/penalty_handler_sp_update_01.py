@@ -0,0 +1,111 @@
+# -*- coding: utf-8 -*-
+''' Staged construction with the penalty constraint handler: single freedom
+    constraints are added and removed between analysis steps. The results
+    obtained updating only the penalty SP elements (without renumbering the
+    model) must be the same that those obtained setting up the analysis
+    from scratch (domainChanged) after each change.
+Home made test'''
+
+from __future__ import print_function
+from __future__ import division
+
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus.
+A= 1e-2 # Cross-section area.
+l= 10.0 # Bar length.
+P= 1e3 # Load.
+
+def run_stages(fullUpdate):
+    ''' Run the staged analysis and return the displacements of the nodes
+        at the end of each stage and the number of incremental SP updates.
+
+    :param fullUpdate: if true set up the analysis from scratch after
+                       each change of the constraints.
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics2D(nodeHandler)
+    ## Truss chain along the x axis.
+    nodes= list()
+    for i in range(0,4):
+        nodes.append(nodeHandler.newNodeXY(i*l,0))
+    elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+    modelSpace.setElementDimension(2)
+    modelSpace.setDefaultMaterial(elast)
+    for n0, n1 in zip(nodes, nodes[1:]):
+        truss= modelSpace.newElement("Truss",nodeTags= [n0.tag,n1.tag])
+        truss.sectionArea= A
+    modelSpace.fixNode00(nodes[0].tag)
+    for n in nodes[1:]:
+        modelSpace.fixNodeF0(n.tag)
+    ## Load.
+    cts= modelSpace.newTimeSeries(name= 'cts', tsType= 'constant_ts')
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(nodes[-1].tag, xc.Vector([P,0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    ## Solution procedure.
+    solProc= predefined_solutions.SimpleStaticLinear(feProblem)
+    analysis= solProc.setup_if_required()
+    constraints= preprocessor.getBoundaryCondHandler
+
+    def solve_stage():
+        if(fullUpdate):
+            analysis.domainChanged()
+        ok= analysis.analyze(1)
+        return ok, [n.getDisp[0] for n in nodes]
+
+    results= list()
+    # Stage 0: whole chain.
+    results.append(solve_stage())
+    # Stage 1: prop at node 2.
+    sp2= constraints.newSPConstraint(nodes[2].tag,0,0.0)
+    results.append(solve_stage())
+    # Stage 2: move the prop to node 1.
+    modelSpace.removeSPConstraint(sp2.tag)
+    sp1= constraints.newSPConstraint(nodes[1].tag,0,0.0)
+    results.append(solve_stage())
+    # Stage 3: remove the prop.
+    modelSpace.removeSPConstraint(sp1.tag)
+    results.append(solve_stage())
+    return results, analysis.numSPUpdates
+
+incrementalResults, incrementalUpdates= run_stages(fullUpdate= False)
+fullResults, fullUpdates= run_stages(fullUpdate= True)
+
+# Displacement of the loaded node at the end of each stage.
+u0= P*l/(E*A)
+refTipDisps= [3*u0, u0, 2*u0, 3*u0]
+
+err= 0.0
+okResults= True
+for (okIncr, dispIncr), (okFull, dispFull), uRef in zip(incrementalResults, fullResults, refTipDisps):
+    okResults= okResults and (okIncr==0) and (okFull==0)
+    for ui, uf in zip(dispIncr, dispFull):
+        err+= (ui-uf)**2
+    err+= ((dispIncr[-1]-uRef)/uRef)**2
+err= err**0.5
+
+'''
+print('incremental: ', incrementalResults, incrementalUpdates)
+print('full: ', fullResults, fullUpdates)
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(okResults and (err<1e-8) and (incrementalUpdates==3) and (fullUpdates==0)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
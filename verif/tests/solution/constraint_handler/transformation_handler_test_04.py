@@ -0,0 +1,151 @@
+# -*- coding: utf-8 -*-
+''' Check the transformation constraint handler on a model that combines
+    multi-freedom constraints (equal DOF), multi-retained node
+    constraints (node glued to a shell element) and single freedom
+    constraints (some of them not null) on both retained and constrained
+    nodes. The displacements and the reactions must be the same as those
+    obtained with the Lagrange constraint handler (and, within the
+    accuracy of the penalty factors, with the penalty constraint
+    handler).
+
+    Home made test.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+E= 2.1e11 # Young modulus.
+nu= 0.3 # Poisson's ratio.
+h= 0.2 # Thickness of the plate.
+dens= 2500.0 # Density.
+A= 31e-4 # Beam cross-section area.
+Iy= 2810e-8 # Inertia of the beam section.
+Iz= Iy
+J= 25.2935e-8 # Cross section torsion constant (m4)
+F= 10e3 # Load.
+
+def solve(constraintHandlerType):
+    ''' Build and solve the model using the constraint handler argument
+        and return the displacements and the reactions of the nodes.
+
+    :param constraintHandlerType: 'transformation', 'lagrange' or 'penalty'.
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+    # Plate: 2x2 shell elements.
+    plateNodes= dict()
+    for i in range(0,3):
+        for j in range(0,3):
+            plateNodes[(i,j)]= nodes.newNodeXYZ(i, j, 0.0)
+    shellMat= typical_materials.defElasticMembranePlateSection(preprocessor, "shellMat", E, nu, dens, h)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= shellMat.name
+    shells= list()
+    for i in range(0,2):
+        for j in range(0,2):
+            nTags= [plateNodes[(i,j)].tag, plateNodes[(i+1,j)].tag, plateNodes[(i+1,j+1)].tag, plateNodes[(i,j+1)].tag]
+            shells.append(elements.newElement("ShellMITC4",xc.ID(nTags)))
+
+    # Beams.
+    sectionProperties= xc.CrossSectionProperties3d()
+    sectionProperties.A= A; sectionProperties.E= E; sectionProperties.G= E/(2.0*(1+nu))
+    sectionProperties.Iz= Iz; sectionProperties.Iy= Iy; sectionProperties.J= J
+    scc= typical_materials.defElasticSectionFromMechProp3d(preprocessor, "scc",sectionProperties)
+    lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+    elements.defaultMaterial= scc.name
+    elements.defaultTransformation= lin.name
+    ## Column hanging from a point of the first shell element.
+    nA= nodes.newNodeXYZ(0.4, 0.3, 0.0) # node to be glued.
+    nB= nodes.newNodeXYZ(0.4, 0.3, -1.0)
+    elements.newElement("ElasticBeam3d",xc.ID([nA.tag,nB.tag]))
+    ## Cantilever whose tip follows the deflection of the plate center.
+    nC= nodes.newNodeXYZ(1.0, 1.0, -0.5)
+    nD= nodes.newNodeXYZ(1.0, 2.0, -0.5)
+    elements.newElement("ElasticBeam3d",xc.ID([nC.tag,nD.tag]))
+
+    # Constraints.
+    ## Supports of the plate (retained nodes of the glue).
+    for key in [(0,0), (2,0), (0,2)]:
+        modelSpace.fixNode000_FFF(plateNodes[key].tag)
+    ## Imposed settlement of a support.
+    nE= plateNodes[(2,2)]
+    modelSpace.fixNode('00F_FFF', nE.tag)
+    modelSpace.constraints.newSPConstraint(nE.tag,2,-1e-4)
+    ## Node glued to the shell (translations). The rotations of the
+    ## glued node are fixed (SP on the constrained node).
+    glue= modelSpace.constraints.newGlueNodeToElement(nA,shells[0],xc.ID([0,1,2]))
+    for i in range(3,6):
+        modelSpace.constraints.newSPConstraint(nA.tag,i,0.0)
+    ## Tip of the cantilever: the vertical displacement is equal to
+    ## that of the plate center (MFC), its rotations are fixed (SP on
+    ## the constrained node) and the plate center can't move along
+    ## x (SP on the retained node).
+    nCenter= plateNodes[(1,1)]
+    modelSpace.newEqualDOF(nCenter.tag, nC.tag, xc.ID([2]))
+    modelSpace.fixNode('FFF_000', nC.tag)
+    modelSpace.constraints.newSPConstraint(nCenter.tag,0,0.0)
+    modelSpace.fixNode000_000(nD.tag)
+
+    # Loads.
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(nB.tag, xc.Vector([F, 2*F, -5*F, 0, 0, 0]))
+    lp0.newNodalLoad(nC.tag, xc.Vector([0.5*F, -F, -2*F, 0, 0, 0]))
+    lp0.newNodalLoad(plateNodes[(1,0)].tag, xc.Vector([0, 0, -3*F, 0, 0, 0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+
+    # Solution.
+    if(constraintHandlerType=='transformation'):
+        solProc= predefined_solutions.SimpleTransformationStaticLinear(feProblem)
+    elif(constraintHandlerType=='lagrange'):
+        solProc= predefined_solutions.SimpleLagrangeStaticLinear(feProblem)
+    else:
+        solProc= predefined_solutions.SimpleStaticLinearUMF(feProblem)
+    result= solProc.solve(calculateNodalReactions= True, reactionCheckTolerance= 1e-7)
+
+    disp= list(); reactions= list()
+    for n in list(plateNodes.values())+[nA, nB, nC, nD]:
+        disp.append(n.getDisp)
+        reactions.append(n.getReaction)
+    return result, disp, reactions
+
+resultT, dispT, reactionsT= solve('transformation')
+resultL, dispL, reactionsL= solve('lagrange')
+resultP, dispP, reactionsP= solve('penalty')
+
+def relative_error(valuesA, valuesB):
+    ''' Return the maximum difference between the vectors of
+        both lists divided by the maximum norm of the second one.'''
+    refNorm= max(v.Norm() for v in valuesB)
+    return max((a-b).Norm() for a, b in zip(valuesA, valuesB))/refNorm
+
+dispErr= relative_error(dispT, dispL)
+reactionErr= relative_error(reactionsT, reactionsL)
+dispErrP= relative_error(dispT, dispP)
+reactionErrP= relative_error(reactionsT, reactionsP)
+
+'''
+print('dispErr= ', dispErr)
+print('reactionErr= ', reactionErr)
+print('dispErrP= ', dispErrP)
+print('reactionErrP= ', reactionErrP)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (resultT==0) and (resultL==0) and (resultP==0) and (dispErr<1e-8) and (reactionErr<1e-8) and (dispErrP<1e-3) and (reactionErrP<1e-3):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+''' Response history by modal superposition. Single degree of freedom
+    system under a constant ground acceleration (step function); the
+    results are compared with the closed form solution (see
+    section 4.3 of the book «Dynamics of Structures» by Anil K. Chopra).'''
+
+from __future__ import print_function
+from __future__ import division
+
+import math
+import xc
+
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+m= 1e6 # Storey mass.
+E= 30e9 # Elastic modulus.
+b= 0.4 # Column size.
+I= b**4/12.0 # Cross section moment of inertia.
+H= 3.0 # Storey height.
+k= 12*E*I/H**3 # Lateral stiffness (rotation fixed at the top).
+zeta= 0.05 # Damping ratio.
+ag= 2.0 # Ground acceleration.
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+n0= nodes.newNodeXY(0,0)
+n1= nodes.newNodeXY(0,H)
+n1.mass= xc.Matrix([[m,0,0],[0,m,0],[0,0,0]])
+modelSpace.fixNode000(n0.tag)
+modelSpace.fixNodeF00(n1.tag)
+
+# Materials definition
+scc= typical_materials.defElasticSection2d(preprocessor, "scc", b*b, E, I)
+
+# Elements definition
+lin= modelSpace.newLinearCrdTransf("lin")
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= lin.name
+elements.defaultMaterial= scc.name
+beam= elements.newElement("ElasticBeam2d",xc.ID([n0.tag, n1.tag]))
+
+# Solution procedure
+analysis= predefined_solutions.frequency_analysis(feProblem, systemPrefix= 'full_gen')
+analOk= analysis.analyze(1)
+
+omega= math.sqrt(k/m)
+ratio0= abs(analysis.getAngularFrequency(1)-omega)/omega
+gamma= analysis.getParticipationFactors(0)[0]
+
+# Ground motion record.
+dt= 0.005
+numSteps= 401
+accel= xc.Vector([ag]*numSteps)
+
+def closedFormDisp(t):
+    ''' Relative displacement of the oscillator under a step
+        ground acceleration.'''
+    wd= omega*math.sqrt(1-zeta**2)
+    return -ag/omega**2*(1-math.exp(-zeta*omega*t)*(math.cos(wd*t)+zeta/math.sqrt(1-zeta**2)*math.sin(wd*t)))
+
+def maxError(method):
+    ''' Compute the response with the given method and return the
+        maximum error with respect to the closed form solution.'''
+    analysis.computeGroundMotionResponse(accel, dt, 0, xc.Vector([zeta]), method)
+    u= analysis.getNodeDispHistory(n1.tag, 0)
+    uMax= abs(ag/omega**2)
+    retval= 0.0
+    for j in range(0, numSteps):
+        retval= max(retval, abs(u[j]-closedFormDisp(j*dt))/uMax)
+    return retval, u
+
+ratio1, uNewmark= maxError('newmark')
+ratio2, u= maxError('piecewise_linear')
+
+# Recover the response in the domain.
+step= 300
+analysis.updateDomain(step)
+ratio3= abs(n1.getDisp[0]-u[step])/abs(u[step])
+
+'''
+print('omega= ', omega, analysis.getAngularFrequency(1), ratio0)
+print('gamma= ', gamma)
+print('ratio1= ', ratio1)
+print('ratio2= ', ratio2)
+print('ratio3= ', ratio3)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((ratio0<1e-8) and (abs(abs(gamma)-1.0)<1e-10) and (ratio1<1e-2) and (ratio2<1e-8) and (ratio3<1e-8)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,142 @@
+# -*- coding: utf-8 -*-
+''' Batch of ground motion analyses of a linear single degree of freedom
+    system. Checks that:
+
+    - the peak response is proportional to the scale factor (the
+      system is linear).
+    - the runs distributed among worker processes give the same
+      results than the serial ones.
+    - the worker processes don't invoke the recorders of the parent.
+    - the model is left in its initial state after the batch.
+'''
+
+from __future__ import print_function
+from __future__ import division
+
+import math
+import os
+import tempfile
+import xc
+
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+m= 1e4 # Mass.
+E= 30e9 # Elastic modulus.
+b= 0.3 # Column size.
+I= b**4/12.0 # Cross section moment of inertia.
+H= 3.0 # Column height.
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+n0= nodes.newNodeXY(0,0)
+n1= nodes.newNodeXY(0,H)
+n1.mass= xc.Matrix([[m,0,0],[0,m,0],[0,0,0]])
+modelSpace.fixNode000(n0.tag)
+modelSpace.fixNodeF00(n1.tag)
+
+# Materials definition
+scc= typical_materials.defElasticSection2d(preprocessor, "scc", b*b, E, I)
+
+# Elements definition
+lin= modelSpace.newLinearCrdTransf("lin")
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= lin.name
+elements.defaultMaterial= scc.name
+beam= elements.newElement("ElasticBeam2d",xc.ID([n0.tag, n1.tag]))
+
+# Ground motion records.
+dt= 0.01
+numSteps= 101
+pulse= [math.sin(math.pi*i/20.0) if i<=20 else 0.0 for i in range(0, numSteps)]
+triangle= [0.1*i if i<=10 else max(2.0-0.1*i, 0.0) for i in range(0, numSteps)]
+
+# Uniform excitation.
+gm= modelSpace.newUniformExcitation(name= 'gm', dof= 0, path= pulse, dt= dt, cod_ts= 'gmAccel')
+modelSpace.addLoadCaseToDomain(gm.name)
+
+# Damping.
+domain= modelSpace.getDomain()
+domain.setRayleighDampingFactors(xc.RayleighDampingFactors(0.2, 0.0, 0.0, 0.0))
+
+# Solution procedure.
+solProc= predefined_solutions.PlainNewmarkNewtonRaphson(feProblem, numSteps= numSteps, timeStep= dt, gamma= 0.5, beta= 0.25, maxNumIter= 10, convergenceTestTol= 1e-12, printFlag= 0)
+solProc.setup()
+analysis= solProc.getAnalysis()
+
+batch= analysis.groundMotionBatch
+batch.pattern= gm
+batch.addRecord(xc.Vector(pulse), dt)
+batch.addRecord(xc.Vector(triangle), dt)
+batch.scaleFactors= xc.Vector([1.0, 2.0])
+batch.nodeTags= xc.ID([n1.tag])
+batch.responseType= 'disp'
+
+def getPeaks():
+    ''' Run the batch and return the peak displacements.'''
+    ok= analysis.analyzeGroundMotionBatch()
+    retval= list()
+    for i in range(0, batch.numRecords):
+        for j in range(0, 2):
+            retval.append(batch.getPeak(i, j))
+            ok= min(ok, batch.getStatus(i, j))
+    return ok, retval
+
+# Recorder that writes to a file (the workers must not invoke it).
+recordFile= tempfile.NamedTemporaryFile(mode= 'w', delete= False)
+recorder= domain.newRecorder("node_prop_recorder",None)
+recorder.setNodes(xc.ID([n1.tag]))
+recorder.callbackRecord= "recordFile.write(str(self.getDisp[0])+'\\n'); recordFile.flush()"
+
+def getNumRecordedLines():
+    ''' Return the number of lines written by the recorder.'''
+    with open(recordFile.name) as f:
+        retval= len(f.readlines())
+    return retval
+
+t0= domain.getTimeTracker.getCurrentTime
+okSerial, serialPeaks= getPeaks()
+serialLines= getNumRecordedLines()
+batch.numberOfWorkers= 3
+okParallel, parallelPeaks= getPeaks()
+parallelLines= getNumRecordedLines()-serialLines
+t1= domain.getTimeTracker.getCurrentTime
+recordFile.close()
+os.remove(recordFile.name)
+
+# Linearity.
+ratio1= abs(serialPeaks[1]-2*serialPeaks[0])/serialPeaks[0]
+ratio2= abs(serialPeaks[3]-2*serialPeaks[2])/serialPeaks[2]
+# Serial vs parallel.
+ratio3= 0.0
+for s, p in zip(serialPeaks, parallelPeaks):
+    ratio3= max(ratio3, abs(s-p)/s)
+# Initial state recovered.
+ratio4= abs(t1-t0)+abs(n1.getDisp[0])
+
+'''
+print('serial peaks: ', serialPeaks)
+print('parallel peaks: ', parallelPeaks)
+print('ratio1= ', ratio1)
+print('ratio2= ', ratio2)
+print('ratio3= ', ratio3)
+print('ratio4= ', ratio4)
+print('recorded lines: ', serialLines, parallelLines)
+'''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (okSerial==0) and (okParallel==0) and (serialPeaks[0]>0.0) and (ratio1<1e-8) and (ratio2<1e-8) and (ratio3<1e-12) and (ratio4<1e-12) and (serialLines>0) and (parallelLines==0):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+'''Adaptive step control with cutbacks: an elastic-perfectly plastic spring
+   is loaded beyond its capacity. The steps that reach the yield load fail
+   and are cut back until the minimum step size is reached; the analysis
+   must stop with the domain at the last committed (elastic) state, just
+   below the yield load.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 1e3 # Spring stiffness.
+P= 10.0 # Total load.
+fy= 0.73*P # Yield force.
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+
+# Define materials
+epp= typical_materials.defElasticPPMaterial(preprocessor, "epp", E= E, fyp= fy, fyn= -fy)
+
+# Define mesh.
+n1= nodes.newNodeXY(0,0)
+n2= nodes.newNodeXY(0,0)
+
+# Define element.
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= epp.name
+elements.dimElem= 2 # Dimension of element space
+spring= elements.newElement("ZeroLength",xc.ID([n1.tag,n2.tag]))
+
+# Define load.
+## Load definition.
+ts= modelSpace.newTimeSeries(name= "ts", tsType= "linear_ts")
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(n2.tag,xc.Vector([P,0,0]))
+## We add the load case to domain.
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Constraints
+modelSpace.fixNode000(n1.tag)
+modelSpace.fixNodeF00(n2.tag)
+
+# Solution
+numSteps= 10
+solProc= predefined_solutions.PlainNewtonRaphsonBandGen(prb= feProblem, maxNumIter= 10, numSteps= numSteps)
+analysis= solProc.setup_if_required()
+## Activate the adaptive step control.
+stepControl= analysis.adaptiveStepControl
+stepControl.active= True
+stepControl.minRatio= 1.0/64.0
+
+result= analysis.analyze(numSteps)
+
+# Committed state.
+domain= preprocessor.getDomain
+lambdaC= domain.getTimeTracker.getCurrentTime # load factor.
+lambdaY= fy/P # yield load factor.
+dLambda= 1.0/numSteps # nominal load increment.
+history= stepControl.getStepHistory()
+numAdaptiveSteps= stepControl.numSteps
+totalCutbacks= stepControl.totalCutbacks
+deltax= n2.getDisp[0]
+ratio1= abs(deltax-lambdaC*P/E)/(lambdaC*P/E)
+ratio2= abs(history[-1]['time']-lambdaC)
+# The last step of minimum size failed: the committed state is
+# at less than one minimum step of the yield load.
+belowYield= (lambdaC<lambdaY) and (lambdaY-lambdaC<stepControl.minRatio*dLambda)
+# Nominal steps until the yield load, and at least one more reduced step.
+numNominal= len([s for s in history if s['ratio']==1.0])
+
+'''
+print('result= ', result)
+print('lambdaC= ', lambdaC, ' lambdaY= ', lambdaY)
+print('dx= ', deltax)
+print('ratio1= ', ratio1)
+print('ratio2= ', ratio2)
+print("number of steps: ", numAdaptiveSteps, "nominal: ", numNominal)
+print("number of cutbacks: ", totalCutbacks)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((result<0) and belowYield and (ratio1<1e-9) and (ratio2<1e-12) and (numNominal==7) and (numAdaptiveSteps>numNominal) and (totalCutbacks>0)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
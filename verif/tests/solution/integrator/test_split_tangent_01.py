@@ -0,0 +1,119 @@
+# -*- coding: utf-8 -*-
+''' Split of the tangent matrix in a constant part, assembled only once, and
+    a variable part assembled on each iteration. Chain of elastic trusses
+    connected to the ground through an elastic-perfectly plastic spring.
+    The constant part must be assembled only once for each analysis
+    and again when the material of a truss changes; the results must be
+    the same as without the split.
+Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Define materials
+E= 1e3 # Young modulus of the trusses.
+A= 1.0 # Cross-section area of the trusses.
+L= 1.0 # Length of the trusses.
+ks= 1e3 # Initial stiffness of the spring.
+Fy= 10.0 # Yield force of the spring.
+P= 50.0 # Load.
+
+def solve(splitTangent: bool):
+    ''' Solve the model in two stages: the load is applied in ten steps,
+        then the stiffness of the first truss is doubled and the load is
+        increased in ten more steps.
+
+    :param splitTangent: if true, assemble the constant part of the
+                         tangent only once.
+    '''
+    # Problem type
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+    elast= typical_materials.defElasticMaterial(preprocessor, "elast", E)
+    epp= typical_materials.defElasticPPMaterial(preprocessor, "epp", E= ks, fyp= Fy, fyn= -Fy)
+    # Define mesh.
+    n0= nodes.newNodeXY(0,0)
+    n1= nodes.newNodeXY(L,0)
+    n2= nodes.newNodeXY(2*L,0)
+    n3= nodes.newNodeXY(3*L,0)
+    n4= nodes.newNodeXY(3*L,0)
+    # Define elements.
+    modelSpace.setElementDimension(2)
+    modelSpace.setDefaultMaterial(elast)
+    trusses= list()
+    for nA, nB in [(n0,n1), (n1,n2), (n2,n3)]:
+        truss= modelSpace.newElement("Truss",nodeTags= [nA.tag,nB.tag])
+        truss.sectionArea= A
+        trusses.append(truss)
+    modelSpace.setDefaultMaterial(epp)
+    spring= modelSpace.newElement("ZeroLength",nodeTags= [n4.tag,n3.tag])
+    # Constraints
+    modelSpace.fixNode00(n0.tag)
+    modelSpace.fixNode00(n4.tag)
+    for n in [n1, n2, n3]:
+        modelSpace.fixNodeF0(n.tag)
+    # Define load.
+    ts= modelSpace.newTimeSeries(name= "ts", tsType= "linear_ts")
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(n3.tag,xc.Vector([P,0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    # Solution
+    solProc= predefined_solutions.PlainNewtonRaphsonBandGen(feProblem, numSteps= 10)
+    solProc.setup_if_required()
+    integrator= solProc.getIntegrator()
+    integrator.splitTangent= splitTangent
+    result= solProc.solve()
+    tangentSplit= integrator.tangentSplit
+    # First stage results.
+    stage1= (result, n3.getDisp[0], trusses[0].getN(), tangentSplit.numAssemblies, tangentSplit.numConstantFEs, tangentSplit.numVariableFEs)
+    # Second stage: stiffer first truss.
+    trusses[0].getMaterial().E= 2*E
+    result= solProc.solve()
+    stage2= (result, n3.getDisp[0], trusses[0].getN(), tangentSplit.numAssemblies)
+    return stage1, stage2, integrator.splitTangent
+
+split1, split2, splitOn= solve(splitTangent= True)
+plain1, plain2, splitOff= solve(splitTangent= False)
+
+result, u, N, numAssemblies, numConstantFEs, numVariableFEs= split1
+# The spring yields, so the trusses carry P-Fy.
+kb= E*A/(3*L) # stiffness of the truss chain.
+uRef= (P-Fy)/kb
+ratio1= abs(u-uRef)/uRef
+ratio2= abs(N-(P-Fy))/(P-Fy)
+# Same results with and without the split.
+ratio3= abs(u-plain1[1])/uRef
+ratio4= abs(split2[1]-plain2[1])/abs(plain2[1])
+ratio5= abs(split2[2]-plain2[2])/abs(plain2[2])
+# K0 assembled once in each stage (the material change is detected).
+assembliesOk= (numAssemblies==1) and (split2[3]==2) and (plain1[3]==0) and (plain2[3]==0)
+resultsOk= (result==0) and (split2[0]==0) and (plain1[0]==0) and (plain2[0]==0)
+
+'''
+print('u= ', u, ' uRef= ', uRef, ' ratio1= ', ratio1)
+print('N= ', N, ' ratio2= ', ratio2)
+print('ratio3= ', ratio3, ' ratio4= ', ratio4, ' ratio5= ', ratio5)
+print('constant FEs: ', numConstantFEs, ' variable FEs: ', numVariableFEs)
+print('assemblies: ', numAssemblies, split2[3], plain1[3], plain2[3])
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if resultsOk and (abs(ratio1)<1e-9) and (abs(ratio2)<1e-9) and (ratio3<1e-12) and (ratio4<1e-12) and (ratio5<1e-12) and (numConstantFEs==3) and (numVariableFEs==1) and assembliesOk and splitOn and not splitOff:
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
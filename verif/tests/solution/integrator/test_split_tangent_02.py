@@ -0,0 +1,143 @@
+# -*- coding: utf-8 -*-
+''' Split of the tangent matrix in a constant part, assembled only once, and
+    a variable part assembled on each iteration, in a staged construction
+    analysis with the penalty constraint handler. The penalty elements
+    that impose the single freedom constraints are replaced without
+    renumbering the model each time a node locker is released or a
+    support is added, so the tangent split must forget the FE elements
+    it has classified and assemble the constant part again. The results
+    must be the same as without the split.
+Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Define materials
+E= 1e3 # Young modulus of the trusses.
+A= 1.0 # Cross-section area of the trusses.
+L= 1.0 # Length of the trusses.
+ks= 1e3 # Initial stiffness of the spring.
+Fy= 10.0 # Yield force of the spring.
+P= 50.0 # Load.
+
+def solve(splitTangent: bool):
+    ''' Solve the model in three stages: in the first one the last truss
+        is not built yet and its free node is held by a node locker, in
+        the second one the truss is built and the locker released and in
+        the third one a support is added at the end of the chain. The
+        load increases in ten steps on each stage.
+
+    :param splitTangent: if true, assemble the constant part of the
+                         tangent only once.
+    '''
+    # Problem type
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+    elast= typical_materials.defElasticMaterial(preprocessor, "elast", E)
+    epp= typical_materials.defElasticPPMaterial(preprocessor, "epp", E= ks, fyp= Fy, fyn= -Fy)
+    # Define mesh.
+    n0= nodes.newNodeXY(0,0)
+    n1= nodes.newNodeXY(L,0)
+    n2= nodes.newNodeXY(2*L,0)
+    n3= nodes.newNodeXY(3*L,0)
+    n4= nodes.newNodeXY(2*L,0)
+    # Define elements.
+    modelSpace.setElementDimension(2)
+    modelSpace.setDefaultMaterial(elast)
+    trusses= list()
+    for nA, nB in [(n0,n1), (n1,n2), (n2,n3)]:
+        truss= modelSpace.newElement("Truss",nodeTags= [nA.tag,nB.tag])
+        truss.sectionArea= A
+        trusses.append(truss)
+    modelSpace.setDefaultMaterial(epp)
+    spring= modelSpace.newElement("ZeroLength",nodeTags= [n4.tag,n2.tag])
+    # Constraints
+    modelSpace.fixNode00(n0.tag)
+    modelSpace.fixNode00(n4.tag)
+    for n in [n1, n2, n3]:
+        modelSpace.fixNodeF0(n.tag)
+    # Last truss not built yet.
+    lastTrussSet= preprocessor.getSets.defSet('lastTruss')
+    lastTrussSet.elements.append(trusses[-1])
+    modelSpace.deactivateElements(lastTrussSet)
+    # Define load.
+    ts= modelSpace.newTimeSeries(name= "ts", tsType= "linear_ts")
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(n2.tag,xc.Vector([P,0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    # Solution
+    solProc= predefined_solutions.PenaltyNewtonRaphson(feProblem, numSteps= 10)
+    analysis= solProc.setup_if_required()
+    integrator= solProc.getIntegrator()
+    integrator.splitTangent= splitTangent
+    tangentSplit= integrator.tangentSplit
+    results= list()
+    # First stage: the node locker holds the end of the chain.
+    result= solProc.solve()
+    numFEs= tangentSplit.numConstantFEs+tangentSplit.numVariableFEs
+    results.append((result, n2.getDisp[0], n3.getDisp[0], tangentSplit.numAssemblies, numFEs))
+    # Second stage: build the last truss and release the locker.
+    modelSpace.activateElements(lastTrussSet)
+    result= solProc.solve()
+    numFEs= tangentSplit.numConstantFEs+tangentSplit.numVariableFEs
+    results.append((result, n2.getDisp[0], n3.getDisp[0], tangentSplit.numAssemblies, numFEs))
+    # Third stage: support at the end of the chain (no element changes).
+    preprocessor.getBoundaryCondHandler.newSPConstraint(n3.tag,0,n3.getDisp[0])
+    result= solProc.solve()
+    numFEs= tangentSplit.numConstantFEs+tangentSplit.numVariableFEs
+    results.append((result, n2.getDisp[0], n3.getDisp[0], tangentSplit.numAssemblies, numFEs))
+    return results, analysis.numSPUpdates, integrator.splitTangent
+
+splitResults, splitSPUpdates, splitOn= solve(splitTangent= True)
+plainResults, plainSPUpdates, splitOff= solve(splitTangent= False)
+
+# First stage: the spring yields, the first two trusses carry P-Fy.
+kb= E*A/(2*L) # stiffness of the first two trusses.
+u1Ref= (P-Fy)/kb
+ratio1= abs(splitResults[0][1]-u1Ref)/u1Ref
+# Second stage: the free end of the chain follows node 2.
+u2Ref= (2*P-Fy)/kb
+ratio2= abs(splitResults[1][1]-u2Ref)/u2Ref
+# Same results with and without the split.
+err= 0.0
+resultsOk= True
+for split, plain in zip(splitResults, plainResults):
+    resultsOk= resultsOk and (split[0]==0) and (plain[0]==0)
+    err+= (split[1]-plain[1])**2+(split[2]-plain[2])**2
+err= err**0.5/u2Ref
+# K0 assembled again on each stage.
+assemblies= [r[3] for r in splitResults]
+assembliesOk= (assemblies==[1,2,3]) and all(r[3]==0 for r in plainResults)
+# The locker constraints are gone in the second stage and the new
+# support is there in the third one.
+numFEs= [r[4] for r in splitResults]
+feCountOk= (numFEs[1]<numFEs[0]) and (numFEs[2]==numFEs[1]+1)
+# The constraints have been updated without renumbering.
+spUpdatesOk= (splitSPUpdates>=1) and (splitSPUpdates==plainSPUpdates)
+
+'''
+print('split: ', splitResults, splitSPUpdates)
+print('plain: ', plainResults, plainSPUpdates)
+print('ratio1= ', ratio1, ' ratio2= ', ratio2, ' err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if resultsOk and (ratio1<1e-5) and (ratio2<1e-5) and (err<1e-10) and assembliesOk and feCountOk and spUpdatesOk and splitOn and not splitOff:
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
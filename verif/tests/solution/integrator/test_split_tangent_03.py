@@ -0,0 +1,115 @@
+# -*- coding: utf-8 -*-
+''' Split of the tangent matrix in a constant part, assembled only once, and
+    a variable part assembled on each iteration, with the transformation
+    constraint handler and a rigid link with large displacements
+    (MFreedom_Joint2D). The transformation matrix of the link is updated
+    on each step, so the elastic truss attached to the link must be
+    assembled on each iteration even if its own tangent is constant. The
+    results must be the same as without the split.
+Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Define materials
+E= 1e3 # Young modulus of the trusses.
+A= 1.0 # Cross-section area of the trusses.
+L= 1.0 # Length of the rigid link.
+H= 1.0 # Length of the trusses.
+P= 600.0 # Load at the end of the link.
+Q= 100.0 # Load at the end of the free truss.
+
+def solve(splitTangent: bool):
+    ''' Solve a rigid link that turns around a pinned node and is held
+        by a vertical truss at its free end, along with an independent
+        truss. The load is applied in ten steps.
+
+    :param splitTangent: if true, assemble the constant part of the
+                         tangent only once.
+    '''
+    # Problem type
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+    elast= typical_materials.defElasticMaterial(preprocessor, "elast", E)
+    # Define mesh.
+    nodes.numDOFs= 4 # center of the joint: ux, uy and two rotations.
+    nR= nodes.newNodeXY(0,0)
+    nodes.numDOFs= 3
+    nC= nodes.newNodeXY(L,0)
+    nD= nodes.newNodeXY(L,-H)
+    nA= nodes.newNodeXY(2*L,0)
+    nB= nodes.newNodeXY(2*L+H,0)
+    # Define elements.
+    modelSpace.setElementDimension(2)
+    modelSpace.setDefaultMaterial(elast)
+    linkTruss= modelSpace.newElement("Truss",nodeTags= [nD.tag,nC.tag])
+    linkTruss.sectionArea= A
+    freeTruss= modelSpace.newElement("Truss",nodeTags= [nA.tag,nB.tag])
+    freeTruss.sectionArea= A
+    # Constraints
+    modelSpace.fixNode('00F0', nR.tag) # the link turns around nR.
+    modelSpace.fixNode000(nD.tag)
+    modelSpace.fixNode000(nA.tag)
+    modelSpace.fixNode('F00', nB.tag)
+    # Rigid link between nR and nC with large displacements.
+    joint= preprocessor.getBoundaryCondHandler.newJoint2D(nR.tag, nC.tag, 2, 1, 1)
+    # Define load.
+    ts= modelSpace.newTimeSeries(name= "ts", tsType= "linear_ts")
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(nC.tag,xc.Vector([0,P,0]))
+    lp0.newNodalLoad(nB.tag,xc.Vector([Q,0,0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    # Solution
+    solProc= predefined_solutions.TransformationNewtonRaphsonBandGen(feProblem, numSteps= 10)
+    solProc.setup_if_required()
+    integrator= solProc.getIntegrator()
+    integrator.splitTangent= splitTangent
+    result= solProc.solve()
+    tangentSplit= integrator.tangentSplit
+    return result, nR.getDisp[2], nC.getDisp[1], nB.getDisp[0], tangentSplit.numAssemblies, tangentSplit.numConstantFEs, tangentSplit.numVariableFEs, integrator.splitTangent
+
+split= solve(splitTangent= True)
+plain= solve(splitTangent= False)
+
+result, theta, uyC, uxB, numAssemblies, numConstantFEs, numVariableFEs, splitOn= split
+# The vertical truss takes the whole load at the end of the link.
+uyCRef= P*H/(E*A)
+ratio1= abs(uyC-uyCRef)/uyCRef
+uxBRef= Q*H/(E*A)
+ratio2= abs(uxB-uxBRef)/uxBRef
+# The link turns a finite angle.
+rotationOk= (theta>0.5)
+# Same results with and without the split.
+ratio3= (abs(theta-plain[1])+abs(uyC-plain[2])+abs(uxB-plain[3]))/uyCRef
+# Only the free truss is assembled in K0.
+splitOk= (numAssemblies==1) and (numConstantFEs==1) and (numVariableFEs==1) and splitOn and not plain[7]
+resultsOk= (result==0) and (plain[0]==0)
+
+'''
+print('theta= ', theta, ' uyC= ', uyC, ' uyCRef= ', uyCRef, ' ratio1= ', ratio1)
+print('uxB= ', uxB, ' ratio2= ', ratio2)
+print('ratio3= ', ratio3)
+print('constant FEs: ', numConstantFEs, ' variable FEs: ', numVariableFEs)
+print('assemblies: ', numAssemblies)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if resultsOk and (ratio1<1e-6) and (ratio2<1e-9) and (ratio3<1e-9) and rotationOk and splitOk:
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
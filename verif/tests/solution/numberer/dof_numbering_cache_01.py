@@ -0,0 +1,104 @@
+# -*- coding: utf-8 -*-
+''' Reuse of the DOF numbering by successive analyses on the same mesh.
+    The ordering computed by the first analysis is stored in the domain
+    and reused by the next ones until the topology of the model changes.
+Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+from misc_utils import log_messages as lmsg
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Define materials
+E= 1e3 # Young modulus of the trusses.
+A= 1.0 # Cross-section area of the trusses.
+L= 1.0 # Length of the trusses.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast", E)
+
+# Define mesh (chain of trusses).
+numTrusses= 10
+chainNodes= [nodes.newNodeXY(i*L,0) for i in range(0,numTrusses+1)]
+modelSpace.setElementDimension(2)
+modelSpace.setDefaultMaterial(elast)
+for nA, nB in zip(chainNodes[:-1], chainNodes[1:]):
+    truss= modelSpace.newElement("Truss",nodeTags= [nA.tag,nB.tag])
+    truss.sectionArea= A
+
+# Constraints
+modelSpace.fixNode00(chainNodes[0].tag)
+for n in chainNodes[1:]:
+    modelSpace.fixNodeF0(n.tag)
+
+# Define load.
+P= 50.0
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(chainNodes[-1].tag,xc.Vector([P,0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+numberingCache= preprocessor.getDomain.numberingCache
+
+def solve(name):
+    ''' Solve the problem with a new analysis and return the
+        displacement of the tip.'''
+    modelSpace.revertToStart()
+    solProc= predefined_solutions.SimpleStaticLinear(feProblem, name= name)
+    result= solProc.solve()
+    if(result!=0):
+        lmsg.error(name+' failed.')
+    return chainNodes[-1].getDisp[0]
+
+# First analysis: the ordering is computed and stored.
+u1= solve('first')
+hits1= numberingCache.numHits
+# Second analysis on the same mesh: the ordering is reused.
+u2= solve('second')
+hits2= numberingCache.numHits
+
+# Change the topology: a new truss at the tip of the chain.
+newNode= nodes.newNodeXY((numTrusses+1)*L,0)
+modelSpace.setDefaultMaterial(elast)
+truss= modelSpace.newElement("Truss",nodeTags= [chainNodes[-1].tag,newNode.tag])
+truss.sectionArea= A
+modelSpace.fixNodeF0(newNode.tag)
+# Third analysis: the stored ordering is not valid anymore.
+u3= solve('third')
+hits3= numberingCache.numHits
+# Fourth analysis: the new ordering is reused.
+u4= solve('fourth')
+hits4= numberingCache.numHits
+numEntries= numberingCache.numEntries
+
+uRef= P*numTrusses*L/E/A
+ratio1= abs(u1-uRef)/uRef
+ratio2= abs(u2-u1)/uRef
+ratio3= abs(u3-uRef)/uRef
+ratio4= abs(u4-u3)/uRef
+
+'''
+print('u1= ', u1, ' u2= ', u2, ' u3= ', u3, ' u4= ', u4, ' uRef= ', uRef)
+print('hits: ', hits1, hits2, hits3, hits4)
+print('entries: ', numEntries)
+'''
+
+import os
+fname= os.path.basename(__file__)
+if (ratio1<1e-9) and (ratio2<1e-12) and (ratio3<1e-9) and (ratio4<1e-12) and (hits1==0) and (hits2==1) and (hits3==1) and (hits4==2) and (numEntries==1):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
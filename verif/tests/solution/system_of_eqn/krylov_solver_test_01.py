@@ -0,0 +1,103 @@
+# -*- coding: utf-8 -*-
+''' Test the preconditioned Krylov solvers (PCG, MINRES and GMRES) with
+    the different preconditioners available (Jacobi, ILU(k) and smoothed
+    aggregation AMG). The displacements obtained for a cantilever
+    meshed with quadrilateral elements are compared with those obtained
+    with a direct solver.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2026, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+# Material properties.
+E= 30e6 # Young modulus (psi)
+nu= 0.3 # Poisson's ratio
+
+# Geometry
+L= 10.0 # Cantilever length.
+h= 1.0 # Cantilever depth.
+nx= 40 # Number of divisions along the length.
+ny= 4 # Number of divisions along the depth.
+F= -1000.0 # Tip load.
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Define mesh.
+grid= list()
+for i in range(0,nx+1):
+    column= list()
+    for j in range(0,ny+1):
+        column.append(nodes.newNodeXY(i*L/nx, j*h/ny))
+    grid.append(column)
+elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= elast2d.name
+for i in range(0,nx):
+    for j in range(0,ny):
+        elements.newElement("FourNodeQuad",xc.ID([grid[i][j].tag, grid[i+1][j].tag, grid[i+1][j+1].tag, grid[i][j+1].tag]))
+
+# Constraints
+for n in grid[0]:
+    modelSpace.fixNode00(n.tag)
+
+# Load definition.
+lp0= modelSpace.newLoadPattern(name= '0')
+tipNode= grid[nx][ny]
+lp0.newNodalLoad(tipNode.tag,xc.Vector([0,F]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+def getDisplacements():
+    ''' Return the vertical displacements of the nodes.'''
+    return [n.getDisp[1] for column in grid for n in column]
+
+# Reference solution (direct solver).
+refSolProc= predefined_solutions.SimpleTransformationStaticLinear(feProblem, name= 'reference')
+result= refSolProc.solve()
+refDisp= getDisplacements()
+maxRefDisp= max([abs(u) for u in refDisp])
+
+# Krylov solvers.
+errors= list()
+iterations= list()
+for (method, preconditioner, fillLevel) in [('pcg', 'amg', 0), ('pcg', 'ilu', 1), ('minres', 'jacobi', 0), ('gmres', 'ilu', 0)]:
+    modelSpace.revertToStart()
+    solProc= predefined_solutions.SolutionProcedure(name= method+'_'+preconditioner, constraintHandlerType= 'transformation', soeType= 'sparse_gen_row_lin_soe', solverType= 'krylov_solver')
+    solProc.setFEProblem(feProblem)
+    solProc.setup()
+    solver= solProc.getAnalysis().linearSOE.solver
+    solver.method= method
+    solver.preconditioner= preconditioner
+    solver.fillLevel= fillLevel
+    solver.tolerance= 1e-12
+    solver.maxNumIter= 5000
+    result= solProc.solve()
+    disp= getDisplacements()
+    errors.append(max([abs(u-uRef) for u, uRef in zip(disp, refDisp)])/maxRefDisp)
+    iterations.append(solver.numIter)
+
+'''
+print('reference tip displacement: ', refDisp[-1])
+print('errors: ', errors)
+print('iterations: ', iterations)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (max(errors)<1e-6) and (result==0):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,141 @@
+# -*- coding: utf-8 -*-
+''' Checks the solution of several right-hand sides at once
+    (LinearSOE.solveMultipleRHS), as used by the sensitivity algorithm
+    to solve the right-hand sides of all the gradients with a single
+    factorization of the tangent. The block solution is compared with
+    the solutions obtained one load pattern at a time.
+
+    Home made test.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+numElements= 4
+
+# Loads
+F= 1.5e3 # Load magnitude (N)
+M= 2e2 # Moment magnitude (N.m)
+
+def check_multiple_rhs(soeType, solverType):
+    ''' Solve the cantilever for two load patterns, one after another,
+        and then solve at once the right-hand sides of both patterns
+        (and a combination of them) with the last factorization of the
+        tangent. Return the relative difference between the block
+        solution and the solutions obtained one by one.
+
+    :param soeType: type of the system of equations.
+    :param solverType: type of the solver.
+    '''
+    # Define FE Problem.
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+
+    # Problem type
+    modelSpace= predefined_spaces.StructuralMechanics2D(nodeHandler)
+
+    # Problem geometry
+    nodes= list()
+    for i in range(0, numElements+1):
+        nodes.append(modelSpace.newNode(i*L/numElements, 0.0))
+
+    ## Coordinate transformation.
+    lin= modelSpace.newLinearCrdTransf("lin")
+
+    ## Define material.
+    sectionProperties= xc.CrossSectionProperties2d()
+    sectionProperties.A= A; sectionProperties.E= E; sectionProperties.G= G
+    sectionProperties.I= Iz
+    section= typical_materials.defElasticSectionFromMechProp2d(preprocessor, "section",sectionProperties)
+
+    # Define elements.
+    elements= preprocessor.getElementHandler
+    elements.defaultTransformation= lin.name
+    elements.defaultMaterial= section.name
+    for nA, nB in zip(nodes, nodes[1:]):
+        elements.newElement("ElasticBeam2d",xc.ID([nA.tag,nB.tag]))
+
+    # Define constraints.
+    modelSpace.fixNode000(nodes[0].tag)
+
+    # Load definition.
+    lp1= modelSpace.newLoadPattern(name= '1')
+    lp1.newNodalLoad(nodes[-1].tag,xc.Vector([F,-F,0]))
+    lp2= modelSpace.newLoadPattern(name= '2')
+    lp2.newNodalLoad(nodes[2].tag,xc.Vector([0,F/2.0,M]))
+
+    # Solution procedure.
+    solu= feProblem.getSoluProc
+    solCtrl= solu.getSoluControl
+    solModels= solCtrl.getModelWrapperContainer
+    sm= solModels.newModelWrapper("sm")
+    cHandler= sm.newConstraintHandler("plain_handler")
+    numberer= sm.newNumberer("default_numberer")
+    numberer.useAlgorithm("rcm")
+    solutionStrategies= solCtrl.getSolutionStrategyContainer
+    solutionStrategy= solutionStrategies.newSolutionStrategy("solutionStrategy","sm")
+    solAlgo= solutionStrategy.newSolutionAlgorithm("linear_soln_algo")
+    integ= solutionStrategy.newIntegrator("load_control_integrator",xc.Vector([]))
+    soe= solutionStrategy.newSystemOfEqn(soeType)
+    solver= soe.newSolver(solverType)
+    analysis= solu.newAnalysis("static_analysis","solutionStrategy","")
+
+    # Solve one load pattern at a time.
+    modelSpace.addLoadCaseToDomain(lp1.name)
+    analysis.analyze(1)
+    b1= soe.b.getList(); x1= soe.x.getList()
+    modelSpace.removeLoadCaseFromDomain(lp1.name)
+    modelSpace.addLoadCaseToDomain(lp2.name)
+    analysis.analyze(1)
+    b2= soe.b.getList(); x2= soe.x.getList()
+
+    # Solve all the right-hand sides at once.
+    numEqn= soe.numEqn
+    BX= xc.Matrix([[b1[i], b2[i], b1[i]+3.0*b2[i]] for i in range(0, numEqn)])
+    result= soe.solveMultipleRHS(BX)
+    X= xc.Matrix([[x1[i], x2[i], x1[i]+3.0*x2[i]] for i in range(0, numEqn)])
+    if(result!=0):
+        return 1e6
+    return (BX-X).Norm()/X.Norm()
+
+solvers= [('full_gen_lin_soe', 'full_gen_lin_lapack_solver'),
+          ('band_gen_lin_soe', 'band_gen_lin_lapack_solver'),
+          ('band_spd_lin_soe', 'band_spd_lin_lapack_solver'),
+          ('umfpack_gen_lin_soe', 'umfpack_gen_lin_solver'),
+          ('sparse_gen_col_lin_soe', 'super_lu_solver')] # solves the columns one by one.
+
+errors= list()
+for soeType, solverType in solvers:
+    errors.append(check_multiple_rhs(soeType, solverType))
+
+'''
+print(errors)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(max(errors)<1e-9):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+''' Static condensation of the linear part of the model on the DOFs of the
+    nonlinear elements. Chain of elastic trusses connected to the ground
+    through an elastic-perfectly plastic spring.
+Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Define materials
+E= 1e3 # Young modulus of the trusses.
+A= 1.0 # Cross-section area of the trusses.
+L= 1.0 # Length of the trusses.
+ks= 1e3 # Initial stiffness of the spring.
+Fy= 10.0 # Yield force of the spring.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast", E)
+epp= typical_materials.defElasticPPMaterial(preprocessor, "epp", E= ks, fyp= Fy, fyn= -Fy)
+
+# Define mesh.
+n0= nodes.newNodeXY(0,0)
+n1= nodes.newNodeXY(L,0)
+n2= nodes.newNodeXY(2*L,0)
+n3= nodes.newNodeXY(3*L,0)
+n4= nodes.newNodeXY(3*L,0)
+
+# Define elements.
+modelSpace.setElementDimension(2)
+modelSpace.setDefaultMaterial(elast)
+trusses= list()
+for nA, nB in [(n0,n1), (n1,n2), (n2,n3)]:
+    truss= modelSpace.newElement("Truss",nodeTags= [nA.tag,nB.tag])
+    truss.sectionArea= A
+    trusses.append(truss)
+modelSpace.setDefaultMaterial(epp)
+spring= modelSpace.newElement("ZeroLength",nodeTags= [n4.tag,n3.tag])
+
+# Constraints
+modelSpace.fixNode00(n0.tag)
+modelSpace.fixNode00(n4.tag)
+for n in [n1, n2, n3]:
+    modelSpace.fixNodeF0(n.tag)
+
+# Define load.
+P= 50.0
+ts= modelSpace.newTimeSeries(name= "ts", tsType= "linear_ts")
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(n3.tag,xc.Vector([P,0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Solution
+solProc= predefined_solutions.SolutionProcedure(name= 'static_condensation', constraintHandlerType= 'plain', numSteps= 10, convTestType= 'norm_unbalance_conv_test', soeType= 'umfpack_gen_lin_soe', solverType= 'umfpack_static_condensation_solver', solutionAlgorithmType= 'newton_raphson_soln_algo')
+solProc.setFEProblem(feProblem)
+solProc.setup()
+solver= solProc.getAnalysis().linearSOE.solver
+result= solProc.solve()
+
+# The spring yields, so the trusses carry P-Fy.
+kb= E*A/(3*L) # stiffness of the truss chain.
+uRef= (P-Fy)/kb
+u= n3.getDisp[0]
+ratio1= abs(u-uRef)/uRef
+N= trusses[0].getN()
+ratio2= abs(N-(P-Fy))/(P-Fy)
+# Only the DOF of the spring is condensed and, the trusses being
+# linear, the condensation is computed only once.
+numInterfaceEqs= solver.numInterfaceEqs
+numInternalEqs= solver.numInternalEqs
+numCondensations= solver.numCondensations
+
+'''
+print('u= ', u, ' uRef= ', uRef, ' ratio1= ', ratio1)
+print('N= ', N, ' ratio2= ', ratio2)
+print('interface equations: ', numInterfaceEqs)
+print('internal equations: ', numInternalEqs)
+print('condensations: ', numCondensations)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) and (abs(ratio1)<1e-9) and (abs(ratio2)<1e-9) and (numInterfaceEqs==1) and (numInternalEqs==2) and (numCondensations==1):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')